@@ -56,7 +56,9 @@ bool loadOBJFile(Aurora::IRenderer* pRenderer, Aurora::IScene* pScene, const str
     SceneContents& sceneContents);
 
 // Loads a glTF file (.gltf ASCII or .glb binary) into the specified renderer and scene, from the
-// specified file path.
+// specified file path. This includes the meshes, materials, textures, and cameras of the node
+// hierarchy, and mesh instancing with EXT_mesh_gpu_instancing. Returns true if the file has any
+// instances or cameras, e.g. a file of cameras saved by Plasma.
 bool loadglTFFile(Aurora::IRenderer* pRenderer, Aurora::IScene* pScene, const string& filePath,
     SceneContents& SceneContents);
 
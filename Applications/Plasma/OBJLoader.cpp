@@ -15,6 +15,7 @@
 
 #include "Aurora/Foundation/Geometry.h"
 #include "Loaders.h"
+#include "OBJParser.h"
 #include "SceneContents.h"
 
 bool gEnableMaterialXMaterials = false;
@@ -23,47 +24,6 @@ uint32_t ImageCache::whitePixels[1] = { 0xFFFFFFFF };
 
 #define PLASMA_HAS_TANGENTS 0
 
-// A simple structure describing an OBJ index, which has sub-indices for vertex channels: position,
-// normal, and texture coordinates.
-struct OBJIndex
-{
-    // Constructor, from a tinyobj::index_t.
-    OBJIndex(const tinyobj::index_t& index) :
-        Position(index.vertex_index), Normal(index.normal_index), TexCoord(index.texcoord_index)
-    {
-    }
-
-    // Equality operator, for use in a hash map.
-    bool operator==(const OBJIndex& other) const
-    {
-        return Position == other.Position && Normal == other.Normal && TexCoord == other.TexCoord;
-    }
-
-    // Indices, same as tinyobj::index_t.
-    int Position;
-    int Normal;
-    int TexCoord;
-};
-
-// A hash function object for OBJIndex.
-struct hashOBJIndex
-{
-    size_t operator()(const OBJIndex& index) const
-    {
-        // Get hash values for the individual indices...
-        hash<int> hasher;
-        size_t h1 = hasher(index.Position);
-        size_t h2 = hasher(index.Normal);
-        size_t h3 = hasher(index.TexCoord);
-
-        // ... and combine them in one recommended way.
-        return ((h1 ^ (h2 << 1)) >> 1) ^ (h3 << 1);
-    }
-};
-
-// An unordered (hash) map from an OBJIndex (with vertex channel indices) to a single index.
-using OBJIndexMap = unordered_map<OBJIndex, uint32_t, hashOBJIndex>;
-
 void loadMaterialXForOBJMaterials(bool enabled)
 {
     gEnableMaterialXMaterials = enabled;
@@ -79,26 +39,19 @@ bool loadOBJFile(Aurora::IRenderer* /*pRenderer*/, Aurora::IScene* pScene, const
     Foundation::CPUTimer timer;
     ::infoMessage("Reading OBJ file \"" + filePath + "\"...");
 
-    // Load the OBJ file with tinyobjloader. If the load is not successful or has no shapes, do
-    // nothing else.
-    // NOTE: tinyobjloader currently does not support wide strings on Windows, so files with wide
-    // non-ASCII characters in their names will fail to load.
-    tinyobj::attrib_t attrib;
-    vector<tinyobj::shape_t> shapes;
-    vector<tinyobj::material_t> objMaterials;
+    // Read the OBJ file with the parallel OBJ parser. If the read is not successful or has no
+    // shapes, do nothing else.
+    OBJData objData;
     string sWarnings;
     string sErrors;
     uint32_t objectCount = 0;
-    bool result =
-        tinyobj::LoadObj(&attrib, &shapes, &objMaterials, &sWarnings, &sErrors, filePath.c_str());
-    if (!result || shapes.empty())
+    bool result          = ::readOBJFile(filePath, objData, sWarnings, sErrors);
+    if (!result || objData.shapes.empty())
     {
-        return false;
-    }
-
-    if (!sErrors.empty())
-    {
-        AU_WARN("LoadOBJFile Errors: %s", sErrors.c_str());
+        if (!sErrors.empty())
+        {
+            AU_WARN("LoadOBJFile Errors: %s", sErrors.c_str());
+        }
         return false;
     }
 
@@ -116,10 +69,10 @@ bool loadOBJFile(Aurora::IRenderer* /*pRenderer*/, Aurora::IScene* pScene, const
 
     // Parse the OBJ materials into a corresponding array of Aurora materials.
     vector<Aurora::Path> lstMaterials;
-    lstMaterials.reserve(objMaterials.size());
+    lstMaterials.reserve(objData.materials.size());
     ImageCache imageCache;
     int mtlCount = 0;
-    for (auto& objMaterial : objMaterials)
+    for (auto& objMaterial : objData.materials)
     {
         // Flag is set try and load a materialX file with the OBJ material name.
         if (gEnableMaterialXMaterials && !objMaterial.name.empty())
@@ -233,129 +186,48 @@ bool loadOBJFile(Aurora::IRenderer* /*pRenderer*/, Aurora::IScene* pScene, const
         lstMaterials.push_back(materialPath);
     };
 
-    // Get the data arrays from the tinyobj::attrib_t object.
-    const auto& srcPositions = attrib.vertices;
-    const auto& srcNormals   = attrib.normals;
-    const auto& srcTexCoords = attrib.texcoords;
-
-    // Iterate the shapes, creating an Aurora geometry for each one and adding an instance of it
-    // to the scene.
-    bool hasMesh = false;
-
-    for (const auto& shape : shapes)
+    // Create the scene geometry data for each shape that has a mesh, skipping shapes that don't
+    // have a mesh (e.g. lines or points). The data is added sequentially, as the scene contents are
+    // not thread-safe, and then filled below.
+    vector<const OBJShape*> meshShapes;
+    vector<Aurora::Path> geomPaths;
+    vector<SceneGeometryData*> geometryDataList;
+    for (const auto& shape : objData.shapes)
     {
-
-        // Skip shapes that don't have a mesh (e.g. lines or points).
-        auto indexCount = static_cast<uint32_t>(shape.mesh.indices.size());
-        if (indexCount == 0)
+        if (shape.corners.empty())
         {
             continue;
         }
-        hasMesh = true;
 
-        Aurora::Path sceneInstancePath =
-            filePath + "-" + shape.name + ":OBJFileInstance-" + to_string(objectCount);
         Aurora::Path geomPath =
             filePath + "-" + shape.name + ":OBJFileGeom-" + to_string(objectCount);
         objectCount++;
-
-        SceneGeometryData& geometryData = sceneContents.addGeometry(geomPath);
+        meshShapes.push_back(&shape);
+        geomPaths.push_back(geomPath);
+        geometryDataList.push_back(&sceneContents.addGeometry(geomPath));
+    }
+    bool hasMesh = !meshShapes.empty();
+
+    // Build the vertex data and descriptor for each shape in parallel, with the shape bounds merged
+    // into the scene bounds afterward.
+    vector<Foundation::BoundingBox> shapeBounds(meshShapes.size());
+    Foundation::parallelFor(meshShapes.size(), 0, [&](size_t shapeIndex) {
+        const OBJShape& shape           = *meshShapes[shapeIndex];
+        SceneGeometryData& geometryData = *geometryDataList[shapeIndex];
+        Aurora::Path geomPath           = geomPaths[shapeIndex];
         auto& positions                 = geometryData.positions;
         auto& normals                   = geometryData.normals;
-        auto& tex_coords                = geometryData.texCoords;
         auto& indices                   = geometryData.indices;
-        indices.reserve(indexCount);
-
-        bool bHasNormals   = shape.mesh.indices[0].normal_index >= 0;
-        bool bHasTexCoords = shape.mesh.indices[0].texcoord_index >= 0;
-
-        // Iterate the "OBJ indices" in the shape, which consist of three sub-indices for individual
-        // position, normal, and texture coordinate values. These are used to define unique vertices
-        // (i.e. identical combinations of the three sub-indices) and populate the data arrays.
-        uint32_t nextIndex = 0;
-        OBJIndexMap objIndexMap;
-        for (const auto& objIndex : shape.mesh.indices)
-        {
-            // If this OBJ index is already in the map, add the corresponding unique index to the
-            // index array. The OBJIndex struct supports hashing to allow this.
-            if (objIndexMap.find(objIndex) != objIndexMap.end())
-            {
-                indices.push_back(objIndexMap[objIndex]);
-            }
+        auto indexCount                 = static_cast<uint32_t>(shape.corners.size());
+        bool bHasNormals                = shape.hasNormals;
+#if PLASMA_HAS_TANGENTS
+        auto& tex_coords   = geometryData.texCoords;
+        bool bHasTexCoords = shape.hasTexCoords;
+#endif
 
-            // Else: Add the corresponding position, normal, and texture coordinate values to the
-            // their respective arrays. Also add the next index value to the index array and the OBJ
-            // index map.
-            else
-            {
-                // Validate all indices before proceeding to avoid memory corruption
-                const size_t posIndex = objIndex.vertex_index * 3;
-                if (posIndex + 3 > srcPositions.size())
-                {
-                    AU_WARN("Invalid vertex index %d in OBJ file %s", objIndex.vertex_index,
-                        filePath.c_str());
-                    continue;
-                }
-
-                // Check normal index bounds if normals are expected
-                if (bHasNormals)
-                {
-                    if (objIndex.normal_index < 0 ||
-                        static_cast<size_t>(objIndex.normal_index * 3) >= srcNormals.size())
-                    {
-                        AU_WARN("Invalid normal index %d in OBJ file %s", objIndex.normal_index,
-                            filePath.c_str());
-                        continue;
-                    }
-                }
-
-                // Check texture coordinate index bounds if texture coordinates are expected
-                if (bHasTexCoords)
-                {
-                    if (objIndex.texcoord_index < 0 ||
-                        static_cast<size_t>(objIndex.texcoord_index * 2) >= srcTexCoords.size())
-                    {
-                        AU_WARN("Invalid texture coordinate index %d in OBJ file %s",
-                            objIndex.texcoord_index, filePath.c_str());
-                        continue;
-                    }
-                }
-
-                // Add the position (XYZ) value, including updating the bounding box if needed.
-                const float* position = &srcPositions[posIndex];
-                sceneContents.bounds.add(position);
-                positions.push_back(*position++);
-                positions.push_back(*position++);
-                positions.push_back(*position);
-
-                // Add the normal (XYZ) value, if needed.
-                if (bHasNormals)
-                {
-                    // Normalize the normal, in case the source data has bad normals.
-                    glm::vec3 normal =
-                        glm::normalize(make_vec3(&srcNormals[objIndex.normal_index * 3]));
-
-                    // Add the normal.
-                    normals.push_back(normal.x);
-                    normals.push_back(normal.y);
-                    normals.push_back(normal.z);
-                }
-
-                // Add the texture coordinate (UV) value, if needed.
-                if (bHasTexCoords)
-                {
-                    const float* tex_coord = &srcTexCoords[objIndex.texcoord_index * 2];
-                    tex_coords.push_back(*tex_coord++);
-                    tex_coords.push_back(1.0f - *tex_coord); // flip V
-                }
-
-                // Add the next index to the index array and the OBJ index map, for the current OBJ
-                // index.
-                indices.push_back(nextIndex);
-                objIndexMap[objIndex] = nextIndex;
-                nextIndex++;
-            }
-        }
+        // Create unique vertices (i.e. identical combinations of the position, normal, and texture
+        // coordinate indices) from the triangle corners, and populate the data arrays.
+        ::buildOBJGeometry(objData, shape, geometryData, shapeBounds[shapeIndex]);
 
         // Calculate the vertex count.
         uint32_t vertexCount = static_cast<uint32_t>(positions.size()) / 3;
@@ -435,15 +307,26 @@ bool loadOBJFile(Aurora::IRenderer* /*pRenderer*/, Aurora::IScene* pScene, const
 
             return true;
         };
+    });
 
+    // Add the geometry and an instance of it to the scene, for each shape.
+    for (size_t shapeIndex = 0; shapeIndex < meshShapes.size(); shapeIndex++)
+    {
+        const OBJShape& shape                      = *meshShapes[shapeIndex];
+        const Aurora::Path& geomPath               = geomPaths[shapeIndex];
+        const Aurora::GeometryDescriptor& geomDesc = geometryDataList[shapeIndex]->descriptor;
+        sceneContents.bounds.add(shapeBounds[shapeIndex]);
         pScene->setGeometryDescriptor(geomPath, geomDesc);
 
+        Aurora::Path sceneInstancePath =
+            filePath + "-" + shape.name + ":OBJFileInstance-" + to_string(shapeIndex);
+
         // Create an Aurora geometry object and get the associated material. Add an instance with
         // that geometry and material to the scene.
         // NOTE: An OBJ file can have different materials for each face (triangle) in a mesh. Here
         // we only use the material assigned to the *first* face for the entire mesh. If no material
         // is specified, use a null pointer which indicates Aurora should use a default material.
-        int material_id = shape.mesh.material_ids[0];
+        int material_id = shape.materialID;
 
         // Add instance to the scene.
         Aurora::InstanceDefinition instDef = { sceneInstancePath,
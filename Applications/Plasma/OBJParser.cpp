@@ -0,0 +1,753 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "OBJParser.h"
+#include "SceneContents.h"
+
+#include <cstring>
+#include <map>
+
+#if defined(WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// The target size of the ranges of lines that are parsed in parallel. This is small enough to
+// balance the work across threads, and large enough that the per-range overhead is negligible.
+static constexpr size_t kChunkSize = 4 * 1024 * 1024;
+
+// A read-only memory mapping of an entire file.
+class MappedFile
+{
+public:
+    ~MappedFile() { close(); }
+
+    // Maps the file with the specified path, returning false if it can't be opened or is empty.
+    bool open(const string& filePath)
+    {
+#if defined(WIN32)
+        _hFile = ::CreateFileW(Foundation::s2w(filePath).c_str(), GENERIC_READ, FILE_SHARE_READ,
+            nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        LARGE_INTEGER size;
+        if (_hFile == INVALID_HANDLE_VALUE || !::GetFileSizeEx(_hFile, &size) ||
+            size.QuadPart == 0)
+        {
+            return false;
+        }
+        _hMapping = ::CreateFileMappingW(_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!_hMapping)
+        {
+            return false;
+        }
+        _pData = static_cast<const char*>(::MapViewOfFile(_hMapping, FILE_MAP_READ, 0, 0, 0));
+        _size  = static_cast<size_t>(size.QuadPart);
+#else
+        _file = ::open(filePath.c_str(), O_RDONLY);
+        struct stat status;
+        if (_file < 0 || ::fstat(_file, &status) != 0 || status.st_size == 0)
+        {
+            return false;
+        }
+        void* pData = ::mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, _file, 0);
+        if (pData == MAP_FAILED)
+        {
+            return false;
+        }
+        ::madvise(pData, status.st_size, MADV_WILLNEED);
+        _pData = static_cast<const char*>(pData);
+        _size  = static_cast<size_t>(status.st_size);
+#endif
+
+        return _pData != nullptr;
+    }
+
+    // Unmaps and closes the file.
+    void close()
+    {
+#if defined(WIN32)
+        if (_pData)
+        {
+            ::UnmapViewOfFile(_pData);
+        }
+        if (_hMapping)
+        {
+            ::CloseHandle(_hMapping);
+        }
+        if (_hFile != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(_hFile);
+        }
+        _hMapping = nullptr;
+        _hFile    = INVALID_HANDLE_VALUE;
+#else
+        if (_pData)
+        {
+            ::munmap(const_cast<char*>(_pData), _size);
+        }
+        if (_file >= 0)
+        {
+            ::close(_file);
+        }
+        _file = -1;
+#endif
+        _pData = nullptr;
+        _size  = 0;
+    }
+
+    const char* data() const { return _pData; }
+    size_t size() const { return _size; }
+
+private:
+#if defined(WIN32)
+    HANDLE _hFile    = INVALID_HANDLE_VALUE;
+    HANDLE _hMapping = nullptr;
+#else
+    int _file = -1;
+#endif
+    const char* _pData = nullptr;
+    size_t _size       = 0;
+};
+
+// A run of faces in a range of lines that belong to the same shape.
+struct OBJSegment
+{
+    size_t shape      = 0;
+    int materialID    = -1;
+    bool hasNormals   = true;
+    bool hasTexCoords = true;
+    vector<OBJCorner> corners;
+};
+
+// A range of lines of an OBJ file, which is first scanned to count the statements that affect the
+// following ranges, and then parsed.
+struct OBJChunk
+{
+    const char* pBegin = nullptr;
+    const char* pEnd   = nullptr;
+
+    // The results of the first (counting) pass: the number of vertex values of each type, the names
+    // of the shapes that are started, the last material that is used, and the material libraries.
+    size_t positionCount = 0;
+    size_t normalCount   = 0;
+    size_t texCoordCount = 0;
+    vector<string> shapeNames;
+    string lastMaterial;
+    bool hasMaterial = false;
+    vector<string> materialLibraries;
+
+    // The state at the start of the range, from the preceding ranges.
+    size_t firstPosition = 0;
+    size_t firstNormal   = 0;
+    size_t firstTexCoord = 0;
+    size_t firstShape    = 0;
+    size_t shapeAtStart  = 0;
+    int materialAtStart  = -1;
+
+    // The results of the second (parsing) pass.
+    vector<OBJSegment> segments;
+    size_t invalidFaceCount = 0;
+};
+
+static inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline const char* skipSpace(const char* p, const char* pEnd)
+{
+    while (p < pEnd && isSpace(*p))
+    {
+        p++;
+    }
+
+    return p;
+}
+
+// Gets whether a line starts with the specified keyword, followed by whitespace or the end of the
+// line, returning the position after the keyword.
+static inline bool startsWith(
+    const char* p, const char* pEnd, const char* keyword, const char*& pAfterOut)
+{
+    size_t length = strlen(keyword);
+    if (static_cast<size_t>(pEnd - p) < length || memcmp(p, keyword, length) != 0)
+    {
+        return false;
+    }
+    p += length;
+    if (p < pEnd && !isSpace(*p))
+    {
+        return false;
+    }
+    pAfterOut = p;
+
+    return true;
+}
+
+// Gets the rest of a line with leading and trailing whitespace removed, e.g. for names.
+static string trimmed(const char* p, const char* pEnd)
+{
+    p = skipSpace(p, pEnd);
+    while (pEnd > p && isSpace(pEnd[-1]))
+    {
+        pEnd--;
+    }
+
+    return string(p, pEnd);
+}
+
+// Parses a (possibly signed) integer, returning false if there are no digits.
+static inline bool parseInt(const char*& p, const char* pEnd, int64_t& valueOut)
+{
+    bool negative = false;
+    if (p < pEnd && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        p++;
+    }
+    const char* pDigits = p;
+    int64_t value       = 0;
+    while (p < pEnd && *p >= '0' && *p <= '9')
+    {
+        value = value * 10 + (*p - '0');
+        p++;
+    }
+    valueOut = negative ? -value : value;
+
+    return p != pDigits;
+}
+
+// Parses a floating-point number in decimal or scientific notation, returning false if there is no
+// number. This doesn't need the text to be null-terminated (unlike strtof), is independent of the
+// locale, and is much faster, while being accurate enough for geometry.
+static inline bool parseFloat(const char*& p, const char* pEnd, float& valueOut)
+{
+    static const double kPowersOf10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    bool negative = false;
+    if (p < pEnd && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        p++;
+    }
+
+    // Accumulate up to 19 significant digits in an integer, and track the decimal exponent.
+    uint64_t mantissa     = 0;
+    int significantDigits = 0;
+    int exponent          = 0;
+    bool hasDigits        = false;
+    bool isFraction       = false;
+    for (; p < pEnd; p++)
+    {
+        if (*p == '.' && !isFraction)
+        {
+            isFraction = true;
+            continue;
+        }
+        if (*p < '0' || *p > '9')
+        {
+            break;
+        }
+        hasDigits = true;
+        if (significantDigits < 19)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+            significantDigits += mantissa > 0 ? 1 : 0;
+            exponent -= isFraction ? 1 : 0;
+        }
+        else if (!isFraction)
+        {
+            exponent++;
+        }
+    }
+    if (!hasDigits)
+    {
+        return false;
+    }
+    if (p < pEnd && (*p == 'e' || *p == 'E'))
+    {
+        const char* pExponent = p + 1;
+        int64_t value         = 0;
+        if (parseInt(pExponent, pEnd, value))
+        {
+            exponent += static_cast<int>(value < -400 ? -400 : (value > 400 ? 400 : value));
+            p = pExponent;
+        }
+    }
+
+    double value = static_cast<double>(mantissa);
+    if (exponent < 0)
+    {
+        value = -exponent <= 22 ? value / kPowersOf10[-exponent] : value * pow(10.0, exponent);
+    }
+    else if (exponent > 0)
+    {
+        value = exponent <= 22 ? value * kPowersOf10[exponent] : value * pow(10.0, exponent);
+    }
+    valueOut = static_cast<float>(negative ? -value : value);
+
+    return true;
+}
+
+// Parses up to the specified number of floats, leaving any that are missing as zero.
+static inline void parseFloats(const char* p, const char* pEnd, float* pValues, int count)
+{
+    bool isValid = true;
+    for (int i = 0; i < count; i++)
+    {
+        p       = skipSpace(p, pEnd);
+        isValid = isValid && parseFloat(p, pEnd, pValues[i]);
+        if (!isValid)
+        {
+            pValues[i] = 0.0f;
+        }
+    }
+}
+
+// Resolves a one-based (or negative, relative) OBJ index to a zero-based index, returning false if
+// it is out of range. Relative indices are relative to the number of values before the face.
+static inline bool resolveIndex(int64_t index, size_t countBefore, size_t total, int32_t& indexOut)
+{
+    int64_t resolved = index > 0 ? index - 1 : static_cast<int64_t>(countBefore) + index;
+    if (index == 0 || resolved < 0 || resolved >= static_cast<int64_t>(total))
+    {
+        return false;
+    }
+    indexOut = static_cast<int32_t>(resolved);
+
+    return true;
+}
+
+// Calls a function for each line of a range, excluding the line ending.
+template <typename Func>
+static void forEachLine(const char* pBegin, const char* pEnd, Func func)
+{
+    const char* p = pBegin;
+    while (p < pEnd)
+    {
+        const char* pLineEnd = static_cast<const char*>(memchr(p, '\n', pEnd - p));
+        pLineEnd             = pLineEnd ? pLineEnd : pEnd;
+        func(skipSpace(p, pLineEnd), pLineEnd);
+        p = pLineEnd + 1;
+    }
+}
+
+// Counts the statements in a range of lines that the following ranges depend on: the number of
+// vertex values (for relative indices), the shapes, and the last material.
+static void countChunk(OBJChunk& chunk)
+{
+    forEachLine(chunk.pBegin, chunk.pEnd, [&chunk](const char* p, const char* pEnd) {
+        const char* pAfter = nullptr;
+        if (p == pEnd || *p == '#')
+        {
+            return;
+        }
+        else if (startsWith(p, pEnd, "v", pAfter))
+        {
+            chunk.positionCount++;
+        }
+        else if (startsWith(p, pEnd, "vn", pAfter))
+        {
+            chunk.normalCount++;
+        }
+        else if (startsWith(p, pEnd, "vt", pAfter))
+        {
+            chunk.texCoordCount++;
+        }
+        else if (startsWith(p, pEnd, "o", pAfter) || startsWith(p, pEnd, "g", pAfter))
+        {
+            chunk.shapeNames.push_back(trimmed(pAfter, pEnd));
+        }
+        else if (startsWith(p, pEnd, "usemtl", pAfter))
+        {
+            chunk.lastMaterial = trimmed(pAfter, pEnd);
+            chunk.hasMaterial  = true;
+        }
+        else if (startsWith(p, pEnd, "mtllib", pAfter))
+        {
+            chunk.materialLibraries.push_back(trimmed(pAfter, pEnd));
+        }
+    });
+}
+
+// Parses a range of lines, writing the vertex values to the (already allocated) arrays, and adding
+// the triangulated faces to segments for each shape.
+static void parseChunk(OBJChunk& chunk, OBJData& data, const map<string, int>& materialMap)
+{
+    size_t positionIndex = chunk.firstPosition;
+    size_t normalIndex   = chunk.firstNormal;
+    size_t texCoordIndex = chunk.firstTexCoord;
+    size_t nextShape     = chunk.firstShape;
+    size_t shape         = chunk.shapeAtStart;
+    int materialID       = chunk.materialAtStart;
+    size_t positionTotal = data.positions.size() / 3;
+    size_t normalTotal   = data.normals.size() / 3;
+    size_t texCoordTotal = data.texCoords.size() / 2;
+    OBJSegment* pSegment = nullptr;
+    vector<OBJCorner> face;
+
+    forEachLine(chunk.pBegin, chunk.pEnd, [&](const char* p, const char* pEnd) {
+        const char* pAfter = nullptr;
+        if (p == pEnd || *p == '#')
+        {
+            return;
+        }
+        else if (startsWith(p, pEnd, "v", pAfter))
+        {
+            parseFloats(pAfter, pEnd, &data.positions[positionIndex++ * 3], 3);
+        }
+        else if (startsWith(p, pEnd, "vn", pAfter))
+        {
+            parseFloats(pAfter, pEnd, &data.normals[normalIndex++ * 3], 3);
+        }
+        else if (startsWith(p, pEnd, "vt", pAfter))
+        {
+            parseFloats(pAfter, pEnd, &data.texCoords[texCoordIndex++ * 2], 2);
+        }
+        else if (startsWith(p, pEnd, "f", pAfter))
+        {
+            // Parse the corners of the face, which have the form "p", "p/t", "p//n", or "p/t/n".
+            face.clear();
+            bool isValid = true;
+            p            = skipSpace(pAfter, pEnd);
+            while (p < pEnd && isValid)
+            {
+                OBJCorner corner = { -1, -1, -1 };
+                int64_t index    = 0;
+                isValid          = parseInt(p, pEnd, index) &&
+                    resolveIndex(index, positionIndex, positionTotal, corner.position);
+                if (isValid && p < pEnd && *p == '/')
+                {
+                    p++;
+                    if (p < pEnd && *p != '/')
+                    {
+                        isValid = parseInt(p, pEnd, index) &&
+                            resolveIndex(index, texCoordIndex, texCoordTotal, corner.texCoord);
+                    }
+                    if (isValid && p < pEnd && *p == '/')
+                    {
+                        p++;
+                        isValid = parseInt(p, pEnd, index) &&
+                            resolveIndex(index, normalIndex, normalTotal, corner.normal);
+                    }
+                }
+                isValid = isValid && (p == pEnd || isSpace(*p));
+                face.push_back(corner);
+                p = skipSpace(p, pEnd);
+            }
+            if (!isValid || face.size() < 3)
+            {
+                chunk.invalidFaceCount++;
+                return;
+            }
+
+            // Start a segment for the current shape if needed, and add the face to it, as a fan of
+            // triangles.
+            if (!pSegment)
+            {
+                chunk.segments.emplace_back();
+                pSegment             = &chunk.segments.back();
+                pSegment->shape      = shape;
+                pSegment->materialID = materialID;
+            }
+            for (size_t i = 1; i + 1 < face.size(); i++)
+            {
+                pSegment->corners.push_back(face[0]);
+                pSegment->corners.push_back(face[i]);
+                pSegment->corners.push_back(face[i + 1]);
+            }
+            for (const OBJCorner& corner : face)
+            {
+                pSegment->hasNormals   = pSegment->hasNormals && corner.normal >= 0;
+                pSegment->hasTexCoords = pSegment->hasTexCoords && corner.texCoord >= 0;
+            }
+        }
+        else if (startsWith(p, pEnd, "o", pAfter) || startsWith(p, pEnd, "g", pAfter))
+        {
+            shape    = nextShape++;
+            pSegment = nullptr;
+        }
+        else if (startsWith(p, pEnd, "usemtl", pAfter))
+        {
+            auto it    = materialMap.find(trimmed(pAfter, pEnd));
+            materialID = it == materialMap.end() ? -1 : it->second;
+        }
+    });
+}
+
+// Reads the materials from the first of the specified material libraries that can be opened,
+// which is what tinyobjloader does.
+static void readMaterials(const string& filePath, const vector<string>& libraries,
+    vector<tinyobj::material_t>& materials, map<string, int>& materialMap, string& warnings)
+{
+    filesystem::path directory = filesystem::path(filePath).parent_path();
+    for (const string& libraryLine : libraries)
+    {
+        istringstream names(libraryLine);
+        string name;
+        while (names >> name)
+        {
+            ifstream stream(directory / name);
+            if (!stream)
+            {
+                continue;
+            }
+            string errors;
+            tinyobj::LoadMtl(&materialMap, &materials, &stream, &warnings, &errors);
+            if (!errors.empty())
+            {
+                warnings += errors;
+            }
+
+            return;
+        }
+    }
+    if (!libraries.empty())
+    {
+        warnings += "Material libraries could not be read.\n";
+    }
+}
+
+bool readOBJFile(const string& filePath, OBJData& dataOut, string& warnings, string& errors,
+    uint32_t threadCount)
+{
+    dataOut = OBJData();
+
+    MappedFile file;
+    if (!file.open(filePath))
+    {
+        errors = "Unable to read file \"" + filePath + "\".";
+
+        return false;
+    }
+
+    // Split the file into ranges of lines. Each range starts after the line ending found after an
+    // evenly spaced position, so a range can be empty if it has no line ending.
+    size_t chunkCount = (file.size() + kChunkSize - 1) / kChunkSize;
+    vector<OBJChunk> chunks(chunkCount);
+    const char* pFileEnd = file.data() + file.size();
+    for (size_t i = 0; i < chunkCount; i++)
+    {
+        const char* p = file.data() + i * kChunkSize;
+        if (i > 0)
+        {
+            p = static_cast<const char*>(memchr(p, '\n', pFileEnd - p));
+            p = p ? p + 1 : pFileEnd;
+        }
+        chunks[i].pBegin = p;
+        if (i > 0)
+        {
+            chunks[i - 1].pEnd = p;
+        }
+    }
+    chunks.back().pEnd = pFileEnd;
+
+    // Count the statements in each range in parallel, so that the state at the start of every range
+    // is known. Then read the materials, which the material statements refer to.
+    Foundation::parallelFor(
+        chunkCount, threadCount, [&chunks](size_t index) { countChunk(chunks[index]); });
+    vector<string> materialLibraries;
+    for (const OBJChunk& chunk : chunks)
+    {
+        materialLibraries.insert(materialLibraries.end(), chunk.materialLibraries.begin(),
+            chunk.materialLibraries.end());
+    }
+    map<string, int> materialMap;
+    readMaterials(filePath, materialLibraries, dataOut.materials, materialMap, warnings);
+
+    // Compute the state at the start of each range, from the preceding ranges. The first shape
+    // (index zero) contains any faces before the first shape statement.
+    size_t positionCount = 0;
+    size_t normalCount   = 0;
+    size_t texCoordCount = 0;
+    size_t shapeCount    = 1;
+    int materialID       = -1;
+    dataOut.shapes.resize(1);
+    for (OBJChunk& chunk : chunks)
+    {
+        chunk.firstPosition   = positionCount;
+        chunk.firstNormal     = normalCount;
+        chunk.firstTexCoord   = texCoordCount;
+        chunk.firstShape      = shapeCount;
+        chunk.shapeAtStart    = shapeCount - 1;
+        chunk.materialAtStart = materialID;
+        positionCount += chunk.positionCount;
+        normalCount += chunk.normalCount;
+        texCoordCount += chunk.texCoordCount;
+        shapeCount += chunk.shapeNames.size();
+        for (string& name : chunk.shapeNames)
+        {
+            dataOut.shapes.emplace_back();
+            dataOut.shapes.back().name = std::move(name);
+        }
+        if (chunk.hasMaterial)
+        {
+            auto it    = materialMap.find(chunk.lastMaterial);
+            materialID = it == materialMap.end() ? -1 : it->second;
+        }
+    }
+
+    // Check the vertex counts fit in the 32-bit indices of the corners.
+    if (positionCount > INT32_MAX || normalCount > INT32_MAX || texCoordCount > INT32_MAX)
+    {
+        errors = "Too many vertices in file \"" + filePath + "\".";
+
+        return false;
+    }
+
+    // Parse the ranges in parallel, writing the vertex values directly to their final locations.
+    dataOut.positions.resize(positionCount * 3);
+    dataOut.normals.resize(normalCount * 3);
+    dataOut.texCoords.resize(texCoordCount * 2);
+    Foundation::parallelFor(chunkCount, threadCount, [&](size_t index) {
+        parseChunk(chunks[index], dataOut, materialMap);
+    });
+
+    // Find the segments of each shape, in file order, and report any invalid faces.
+    vector<vector<OBJSegment*>> shapeSegments(dataOut.shapes.size());
+    size_t invalidFaceCount = 0;
+    for (OBJChunk& chunk : chunks)
+    {
+        for (OBJSegment& segment : chunk.segments)
+        {
+            shapeSegments[segment.shape].push_back(&segment);
+        }
+        invalidFaceCount += chunk.invalidFaceCount;
+    }
+    if (invalidFaceCount > 0)
+    {
+        warnings += "Skipped " + to_string(invalidFaceCount) + " invalid faces.\n";
+    }
+
+    // Combine the segments of each shape in parallel, releasing the memory of each segment as soon
+    // as it has been copied. The material of a shape is the material of its first face.
+    Foundation::parallelFor(dataOut.shapes.size(), threadCount, [&](size_t index) {
+        OBJShape& shape                     = dataOut.shapes[index];
+        const vector<OBJSegment*>& segments = shapeSegments[index];
+        if (segments.empty())
+        {
+            return;
+        }
+        size_t cornerCount = 0;
+        for (const OBJSegment* pSegment : segments)
+        {
+            cornerCount += pSegment->corners.size();
+        }
+        shape.materialID = segments[0]->materialID;
+        shape.corners.reserve(cornerCount);
+        for (OBJSegment* pSegment : segments)
+        {
+            shape.corners.insert(
+                shape.corners.end(), pSegment->corners.begin(), pSegment->corners.end());
+            shape.hasNormals   = shape.hasNormals && pSegment->hasNormals;
+            shape.hasTexCoords = shape.hasTexCoords && pSegment->hasTexCoords;
+            pSegment->corners  = vector<OBJCorner>();
+        }
+    });
+
+    return true;
+}
+
+void buildOBJGeometry(const OBJData& data, const OBJShape& shape, SceneGeometryData& geometryOut,
+    Foundation::BoundingBox& boundsOut)
+{
+    static constexpr uint32_t kEmptySlot = 0xFFFFFFFF;
+
+    // Create an open-addressing hash table (with linear probing) that maps the unique corners to
+    // vertex indices, with a capacity of at least twice the number of corners so that it is at most
+    // half full. Each slot only stores a vertex index, and the corner of that vertex is compared to
+    // find a match. The normal and texture coordinate indices are ignored unless they are used.
+    size_t cornerCount = shape.corners.size();
+    size_t capacity    = 16;
+    while (capacity < cornerCount * 2)
+    {
+        capacity *= 2;
+    }
+    vector<uint32_t> slots(capacity, kEmptySlot);
+    vector<OBJCorner> vertices;
+    vertices.reserve(cornerCount / 2);
+    vector<uint32_t>& indices = geometryOut.indices;
+    indices.resize(cornerCount);
+    for (size_t i = 0; i < cornerCount; i++)
+    {
+        OBJCorner corner = shape.corners[i];
+        corner.normal    = shape.hasNormals ? corner.normal : -1;
+        corner.texCoord  = shape.hasTexCoords ? corner.texCoord : -1;
+
+        // Hash the corner, mixing the bits so that nearby indices are spread across the table.
+        uint64_t hash = static_cast<uint32_t>(corner.position) * 0x9E3779B97F4A7C15ull;
+        hash ^= static_cast<uint32_t>(corner.normal) * 0xC2B2AE3D27D4EB4Full;
+        hash ^= static_cast<uint32_t>(corner.texCoord) * 0x165667B19E3779F9ull;
+        hash ^= hash >> 29;
+
+        size_t slot = static_cast<size_t>(hash) & (capacity - 1);
+        while (true)
+        {
+            uint32_t vertexIndex = slots[slot];
+            if (vertexIndex == kEmptySlot)
+            {
+                vertexIndex = static_cast<uint32_t>(vertices.size());
+                slots[slot] = vertexIndex;
+                vertices.push_back(corner);
+                indices[i] = vertexIndex;
+                break;
+            }
+            const OBJCorner& vertex = vertices[vertexIndex];
+            if (vertex.position == corner.position && vertex.normal == corner.normal &&
+                vertex.texCoord == corner.texCoord)
+            {
+                indices[i] = vertexIndex;
+                break;
+            }
+            slot = (slot + 1) & (capacity - 1);
+        }
+    }
+
+    // Fill the vertex arrays from the unique corners.
+    size_t vertexCount = vertices.size();
+    geometryOut.positions.resize(vertexCount * 3);
+    geometryOut.normals.resize(shape.hasNormals ? vertexCount * 3 : 0);
+    geometryOut.texCoords.resize(shape.hasTexCoords ? vertexCount * 2 : 0);
+    for (size_t i = 0; i < vertexCount; i++)
+    {
+        const OBJCorner& vertex = vertices[i];
+        const float* pPosition  = &data.positions[static_cast<size_t>(vertex.position) * 3];
+        boundsOut.add(pPosition);
+        memcpy(&geometryOut.positions[i * 3], pPosition, sizeof(float) * 3);
+
+        // Normalize the normal, in case the source data has bad normals.
+        if (shape.hasNormals)
+        {
+            size_t normalIndex = static_cast<size_t>(vertex.normal) * 3;
+            vec3 normal        = normalize(make_vec3(&data.normals[normalIndex]));
+            memcpy(&geometryOut.normals[i * 3], &normal, sizeof(float) * 3);
+        }
+
+        // Flip the V texture coordinate.
+        if (shape.hasTexCoords)
+        {
+            size_t texCoordIndex             = static_cast<size_t>(vertex.texCoord) * 2;
+            geometryOut.texCoords[i * 2]     = data.texCoords[texCoordIndex];
+            geometryOut.texCoords[i * 2 + 1] = 1.0f - data.texCoords[texCoordIndex + 1];
+        }
+    }
+}
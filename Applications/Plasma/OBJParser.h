@@ -0,0 +1,73 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+struct SceneGeometryData;
+
+// A corner of an OBJ face, with zero-based indices of the position, normal, and texture coordinate
+// values in the file. The normal and texture coordinate indices are -1 if they are not specified.
+struct OBJCorner
+{
+    int32_t position;
+    int32_t normal;
+    int32_t texCoord;
+};
+
+// A shape in an OBJ file, i.e. the faces following an "o" or "g" statement, triangulated.
+struct OBJShape
+{
+    // The name of the shape, from the "o" or "g" statement.
+    string name;
+
+    // The material of the first face of the shape, as an index into the OBJ materials, or -1 if the
+    // face has no material.
+    int materialID = -1;
+
+    // The corners of the triangles of the shape, three per triangle.
+    vector<OBJCorner> corners;
+
+    // Whether every corner has a normal, and a texture coordinate.
+    bool hasNormals   = true;
+    bool hasTexCoords = true;
+};
+
+// The contents of an OBJ file, with the vertex data shared by all shapes.
+struct OBJData
+{
+    vector<float> positions;
+    vector<float> normals;
+    vector<float> texCoords;
+    vector<OBJShape> shapes;
+    vector<tinyobj::material_t> materials;
+};
+
+// Reads a Wavefront OBJ file, along with the materials in its material libraries.
+//
+// The file is memory-mapped and split into ranges of lines that are parsed in parallel, with the
+// specified maximum number of threads, or all hardware threads if that is zero. This is much faster
+// than tinyobjloader for large files, which parses the file on one thread through iostreams. Faces
+// are triangulated as fans, and lines and points are ignored. The material libraries are read with
+// tinyobjloader, as they are small.
+//
+// Returns false with the errors if the file could not be read. Any warnings are also returned,
+// e.g. for faces with invalid indices, which are skipped.
+bool readOBJFile(const string& filePath, OBJData& dataOut, string& warnings, string& errors,
+    uint32_t threadCount = 0);
+
+// Builds the vertex data and indices of an OBJ shape, with a vertex for each unique combination of
+// position, normal, and texture coordinate indices, and adds the vertex positions to the bounds.
+// Normals are normalized, the texture coordinates are flipped vertically, and the normals or
+// texture coordinates are left empty unless every corner of the shape has them.
+void buildOBJGeometry(const OBJData& data, const OBJShape& shape, SceneGeometryData& geometryOut,
+    Foundation::BoundingBox& boundsOut);
@@ -735,8 +735,7 @@ bool Plasma::addDecal(const string& decalMtlXPath)
         for (size_t j = 0; j < geom.descriptor.vertexDesc.count; j++)
         {
             // Transform position into view space.
-            vec4 pos(geom.positions[j * 3 + 0], geom.positions[j * 3 + 1],
-                geom.positions[j * 3 + 2], 1.0f);
+            vec4 pos(geom.position(j), 1.0f);
             mat4 xform =
                 inst.def.properties[Aurora::Names::InstanceProperties::kTransform].asMatrix4();
             pos          = pos * xform;
@@ -1199,35 +1198,49 @@ bool Plasma::loadSceneFile(const string& filePath)
     auto directory = filesystem::path(filePath).parent_path();
     filesystem::current_path(directory);
 
-    // TODO: when we support full scene loading (and not just cameras) remove this block and use the block below to load gltf and glb
-    std::filesystem::path stdFilePath = filePath;
-    std::filesystem::path foundExtension = stdFilePath.extension();
-    if(foundExtension.compare(".gltf") == 0 || foundExtension.compare(".glb") == 0) {
-        if (!loadSceneFunc(_pRenderer.get(), _pScene.get(), filePath, _sceneContents))
+    // Load glTF files into a new scene. A glTF file with only cameras (e.g. saved by Plasma) sets
+    // the cameras of the current scene instead of replacing it.
+    string extension = filesystem::path(filePath).extension().string();
+    Foundation::sLower(extension);
+    if (extension.compare(".gltf") == 0 || extension.compare(".glb") == 0)
+    {
+        Aurora::IScenePtr pScene = _pRenderer->createScene();
+        SceneContents sceneContents;
+        addAssetPathContainingFile(filePath);
+        if (!loadSceneFunc(_pRenderer.get(), pScene.get(), filePath, sceneContents))
         {
             ::errorMessage("Unable to load the specified scene file: \"" + filePath + "\"");
+
             return false;
         }
+        if (sceneContents.instances.empty())
+        {
+            _sceneContents.cameras = sceneContents.cameras;
+        }
+        else
+        {
+            _pScene = pScene;
+            _pRenderer->setScene(_pScene);
+            _sceneContents  = std::move(sceneContents);
+            _instanceLayers = vector<Layers>(_sceneContents.instances.size());
+            updateNewScene();
+        }
+
         // Report the load time.
         ::infoMessage("Loaded scene file \"" + filePath + "\" in " +
             to_string(static_cast<int>(loadTimer.elapsed())) + " ms.");
 
 #if defined(INTERACTIVE_PLASMA)
-        if(_sceneContents.cameras.size() > 0) {
-            if (_pArguments->count("camera_id"))
-            {
-                switchToCamera((*_pArguments)["camera_id"].as<int>());
-                
-            }
-            else
-            {
-                switchToCamera(0);
-            }
-        }
-        else {
-            switchToCamera(0);
+        // Switch to the requested camera from the file, if any, and request an update.
+        if (!_sceneContents.cameras.empty())
+        {
+            int cameraID =
+                _pArguments->count("camera_id") ? (*_pArguments)["camera_id"].as<int>() : 0;
+            switchToCamera(cameraID);
         }
+        requestUpdate();
 #endif
+
         return true;
     }
     
@@ -15,6 +15,21 @@
 
 #include "SceneContents.h"
 
+glm::vec3 SceneGeometryData::position(size_t index) const
+{
+    if (!positions.empty())
+    {
+        return make_vec3(&positions[index * 3]);
+    }
+
+    // Read the position from the attribute data, which has a stride of one position if not set.
+    const Aurora::AttributeData& data = attributes.at(Aurora::Names::VertexAttributes::kPosition);
+    const uint8_t* pData              = static_cast<const uint8_t*>(data.address);
+    size_t stride                     = data.stride == 0 ? sizeof(glm::vec3) : data.stride;
+
+    return make_vec3(reinterpret_cast<const float*>(pData + data.offset + index * stride));
+}
+
 // Clear the contents all the loaded values instance data.
 void SceneContents::reset()
 {
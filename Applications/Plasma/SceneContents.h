@@ -23,6 +23,16 @@ struct SceneGeometryData
 
     std::vector<std::uint32_t> indices;
     Aurora::GeometryDescriptor descriptor;
+
+    // The attribute data, for geometry whose attributes point directly into the data of the loaded
+    // file (e.g. glTF buffers), instead of the arrays above. The file data is kept alive while the
+    // geometry exists.
+    Aurora::AttributeDataMap attributes;
+    std::shared_ptr<const void> pFileData;
+
+    // Gets the position of the specified vertex, from either the positions array or the position
+    // attribute data.
+    glm::vec3 position(size_t index) const;
 };
 
 struct SceneInstanceData
@@ -13,10 +13,13 @@
 // limitations under the License.
 #include "pch.h"
 
+#include "Aurora/Foundation/Geometry.h"
 #include "Loaders.h"
 #include "SceneContents.h"
 
 #include <glm/gtx/quaternion.hpp>
+#include <map>
+#include <set>
 
 glm::mat4 getNodeTransform(const tinygltf::Node& node) {
     glm::mat4 transform(1.0f);
@@ -60,60 +63,951 @@ glm::mat4 getNodeTransform(const tinygltf::Node& node) {
     return transform;
 }
 
-void loadCameras(tinygltf::Model& model, SceneContents& sceneContents, std::vector<int>& nodes) {
-    for(int nodeIdx : nodes) {
-        tinygltf::Node& node = model.nodes[nodeIdx];
-        if(node.camera != -1) {
-            SceneCamera sceneCamera;
-            sceneCamera.name = node.name;
-            // TODO: Send the parent matrix down the recursive chain so that we support the scene hierarchy
-            // This will be wrong for children at the moment
-            sceneCamera.viewMatrix = glm::inverse(getNodeTransform(node));
-            tinygltf::Camera& camera = model.cameras[node.camera];
-            if(camera.type.compare("perspective") == 0) {
-                sceneCamera.cameraType = SCENE_CAMERA_TYPE_PERSPECTIVE;
-                sceneCamera.perspectiveProperties.yfov = static_cast<float>(camera.perspective.yfov);
-                sceneCamera.perspectiveProperties.aspectRatio = static_cast<float>(camera.perspective.aspectRatio);
-                sceneCamera.perspectiveProperties.znear = static_cast<float>(camera.perspective.znear);
-                sceneCamera.perspectiveProperties.zfar = static_cast<float>(camera.perspective.zfar);
-            }
-            else if(camera.type.compare("orthographic") == 0) {
-                sceneCamera.cameraType = SCENE_CAMERA_TYPE_ORTHOGRAPHIC;
-                sceneCamera.orthographicProperties.znear = static_cast<float>(camera.orthographic.zfar);
-                sceneCamera.orthographicProperties.zfar = static_cast<float>(camera.orthographic.zfar);
-                sceneCamera.orthographicProperties.xmag = static_cast<float>(camera.orthographic.xmag);
-                sceneCamera.orthographicProperties.ymag = static_cast<float>(camera.orthographic.ymag);
-            }
-            sceneContents.cameras.push_back(sceneCamera);
-        }
-        loadCameras(model, sceneContents, node.children);
+// The channels of a glTF image that are used by an Aurora image, as Aurora material properties read
+// fixed channels of their images.
+enum class glTFImageChannels
+{
+    // All channels, e.g. for a base color image.
+    RGBA,
+
+    // The green channel copied to all channels, for the roughness in a metallic-roughness image.
+    Green,
+
+    // The alpha channel copied to all channels, for the opacity in a base color image.
+    Alpha
+};
+
+// Gets the address of the first element of an accessor, and the stride between elements, returning
+// null if the accessor has no buffer view or its elements are outside the buffer.
+static const uint8_t* getAccessorData(
+    const tinygltf::Model& model, const tinygltf::Accessor& accessor, size_t& strideOut)
+{
+    int componentCount = tinygltf::GetNumComponentsInType(accessor.type);
+    int componentSize  = tinygltf::GetComponentSizeInBytes(accessor.componentType);
+    int viewCount      = static_cast<int>(model.bufferViews.size());
+    if (accessor.bufferView < 0 || accessor.bufferView >= viewCount || componentCount <= 0 ||
+        componentSize <= 0)
+    {
+        return nullptr;
+    }
+    const tinygltf::BufferView& view = model.bufferViews[accessor.bufferView];
+    int stride                       = accessor.ByteStride(view);
+    if (view.buffer < 0 || view.buffer >= static_cast<int>(model.buffers.size()) || stride <= 0)
+    {
+        return nullptr;
+    }
+
+    // Check that the last element is inside the buffer.
+    const vector<unsigned char>& buffer = model.buffers[view.buffer].data;
+    size_t offset                       = view.byteOffset + accessor.byteOffset;
+    size_t elementSize                  = static_cast<size_t>(componentCount) * componentSize;
+    if (accessor.count > 0 && offset + (accessor.count - 1) * stride + elementSize > buffer.size())
+    {
+        return nullptr;
+    }
+    strideOut = static_cast<size_t>(stride);
+
+    return buffer.data() + offset;
+}
+
+// Reads a component of an accessor element, converting it to the specified type, with
+// normalization to [0, 1] or [-1, 1] if needed.
+template <typename T>
+static T readComponent(const uint8_t* pData, int componentType, bool normalized)
+{
+    double value = 0.0;
+    double scale = 1.0;
+    switch (componentType)
+    {
+    case TINYGLTF_COMPONENT_TYPE_BYTE:
+        value = *reinterpret_cast<const int8_t*>(pData);
+        scale = 127.0;
+        break;
+    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+        value = *pData;
+        scale = 255.0;
+        break;
+    case TINYGLTF_COMPONENT_TYPE_SHORT:
+        value = *reinterpret_cast<const int16_t*>(pData);
+        scale = 32767.0;
+        break;
+    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+        value = *reinterpret_cast<const uint16_t*>(pData);
+        scale = 65535.0;
+        break;
+    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+        value = *reinterpret_cast<const uint32_t*>(pData);
+        break;
+    case TINYGLTF_COMPONENT_TYPE_FLOAT:
+        value = *reinterpret_cast<const float*>(pData);
+        break;
+    default:
+        break;
+    }
+    if (normalized && scale != 1.0)
+    {
+        value /= scale;
+        value = value < -1.0 ? -1.0 : value;
+    }
+
+    return static_cast<T>(value);
+}
+
+// Reads all the components of an accessor into an array of the specified type, converting them
+// from the component type of the accessor, and applying any sparse values. Returns false if the
+// accessor data is invalid.
+template <typename T>
+static bool readAccessor(
+    const tinygltf::Model& model, const tinygltf::Accessor& accessor, vector<T>& valuesOut)
+{
+    int count = tinygltf::GetNumComponentsInType(accessor.type);
+    int size  = tinygltf::GetComponentSizeInBytes(accessor.componentType);
+    if (count <= 0 || size <= 0)
+    {
+        return false;
+    }
+    size_t componentCount = static_cast<size_t>(count);
+    size_t componentSize  = static_cast<size_t>(size);
+    valuesOut.assign(accessor.count * componentCount, T(0));
+
+    // Read the values from the buffer view, if there is one. Otherwise the values are zero, except
+    // for any sparse values.
+    if (accessor.bufferView >= 0)
+    {
+        size_t stride        = 0;
+        const uint8_t* pData = getAccessorData(model, accessor, stride);
+        if (!pData)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < accessor.count; i++)
+        {
+            for (size_t j = 0; j < componentCount; j++)
+            {
+                const uint8_t* pComponent = pData + i * stride + j * componentSize;
+                valuesOut[i * componentCount + j] =
+                    readComponent<T>(pComponent, accessor.componentType, accessor.normalized);
+            }
+        }
+    }
+
+    // Replace the elements with sparse values, which have their own arrays of indices and values.
+    const auto& sparse = accessor.sparse;
+    if (sparse.isSparse)
+    {
+        tinygltf::Accessor indices;
+        indices.bufferView    = sparse.indices.bufferView;
+        indices.byteOffset    = sparse.indices.byteOffset;
+        indices.componentType = sparse.indices.componentType;
+        indices.type          = TINYGLTF_TYPE_SCALAR;
+        indices.count         = sparse.count;
+        tinygltf::Accessor values;
+        values.bufferView    = sparse.values.bufferView;
+        values.byteOffset    = sparse.values.byteOffset;
+        values.componentType = accessor.componentType;
+        values.normalized    = accessor.normalized;
+        values.type          = accessor.type;
+        values.count         = sparse.count;
+        vector<uint32_t> sparseIndices;
+        vector<T> sparseValues;
+        if (!readAccessor(model, indices, sparseIndices) ||
+            !readAccessor(model, values, sparseValues))
+        {
+            return false;
+        }
+        for (size_t i = 0; i < sparseIndices.size(); i++)
+        {
+            if (sparseIndices[i] >= accessor.count)
+            {
+                return false;
+            }
+            for (size_t j = 0; j < componentCount; j++)
+            {
+                valuesOut[sparseIndices[i] * componentCount + j] =
+                    sparseValues[i * componentCount + j];
+            }
+        }
+    }
+
+    return true;
+}
+
+// Gets attribute data that points directly into the buffer of an accessor, without copying it,
+// which is possible if the accessor has the specified type and float components, and no sparse
+// values. Any stride between the elements (i.e. interleaved vertex data) is preserved.
+static bool getDirectAttributeData(const tinygltf::Model& model, const tinygltf::Accessor& accessor,
+    int type, int componentType, Aurora::AttributeData& dataOut)
+{
+    if (accessor.type != type || accessor.componentType != componentType ||
+        accessor.normalized || accessor.sparse.isSparse || accessor.count == 0)
+    {
+        return false;
+    }
+    size_t stride        = 0;
+    const uint8_t* pData = getAccessorData(model, accessor, stride);
+    if (!pData)
+    {
+        return false;
+    }
+    size_t elementSize = static_cast<size_t>(tinygltf::GetNumComponentsInType(type)) *
+        tinygltf::GetComponentSizeInBytes(componentType);
+    dataOut.address = pData;
+    dataOut.offset  = 0;
+    dataOut.size    = (accessor.count - 1) * stride + elementSize;
+    dataOut.stride  = stride;
+
+    return true;
+}
+
+// Gets attribute data for an array of values, with the specified number of values per element.
+template <typename T>
+static Aurora::AttributeData getArrayAttributeData(const vector<T>& values, size_t componentCount)
+{
+    Aurora::AttributeData data;
+    data.address = values.data();
+    data.size    = values.size() * sizeof(T);
+    data.stride  = componentCount * sizeof(T);
+
+    return data;
+}
+
+// Gets the Aurora address mode for a glTF sampler wrap mode.
+static const string& getAddressMode(int wrapMode)
+{
+    switch (wrapMode)
+    {
+    case TINYGLTF_TEXTURE_WRAP_CLAMP_TO_EDGE:
+        return Aurora::Names::AddressModes::kClamp;
+    case TINYGLTF_TEXTURE_WRAP_MIRRORED_REPEAT:
+        return Aurora::Names::AddressModes::kMirror;
+    default:
+        return Aurora::Names::AddressModes::kWrap;
+    }
+}
+
+// Gets a number from a glTF extension, e.g. the IOR from KHR_materials_ior, or the default value if
+// the extension or the number is not present.
+static float getExtensionNumber(const tinygltf::ExtensionMap& extensions,
+    const string& extension, const string& name, float defaultValue)
+{
+    auto it = extensions.find(extension);
+    if (it == extensions.end() || !it->second.Has(name) || !it->second.Get(name).IsNumber())
+    {
+        return defaultValue;
     }
+
+    return static_cast<float>(it->second.Get(name).GetNumberAsDouble());
 }
 
+// Imports the contents of a loaded glTF model into an Aurora scene: the meshes, materials, and
+// textures used by the node hierarchy, and the cameras.
+//
+// The attribute data of the geometry points directly into the model buffers where possible, and
+// the model is kept alive by the geometry and images that use it. Each mesh primitive is created
+// once as an Aurora geometry, with all the instances of it (from nodes that share the mesh, and
+// the EXT_mesh_gpu_instancing extension) added with a single call.
+class glTFImporter
+{
+public:
+    glTFImporter(const shared_ptr<const tinygltf::Model>& pModel, Aurora::IScene* pScene,
+        const string& filePath, SceneContents& sceneContents) :
+        _pModel(pModel), _model(*pModel), _pScene(pScene), _filePath(filePath),
+        _sceneContents(sceneContents)
+    {
+    }
+
+    // Imports the nodes of the default scene, or the first scene if there is no default. If the
+    // model has no scenes, all the root nodes are imported.
+    void importScene()
+    {
+        vector<int> rootNodes;
+        if (!_model.scenes.empty())
+        {
+            int sceneIndex = _model.defaultScene;
+            sceneIndex = sceneIndex >= 0 && sceneIndex < static_cast<int>(_model.scenes.size())
+                ? sceneIndex
+                : 0;
+            rootNodes = _model.scenes[sceneIndex].nodes;
+        }
+        else
+        {
+            vector<bool> isChild(_model.nodes.size(), false);
+            for (const tinygltf::Node& node : _model.nodes)
+            {
+                for (int child : node.children)
+                {
+                    isChild[child] = true;
+                }
+            }
+            for (size_t i = 0; i < _model.nodes.size(); i++)
+            {
+                if (!isChild[i])
+                {
+                    rootNodes.push_back(static_cast<int>(i));
+                }
+            }
+        }
+        for (int nodeIndex : rootNodes)
+        {
+            importNode(nodeIndex, mat4(1.0f));
+        }
+
+        // Add the instances of each geometry to the scene, with a single call for each geometry.
+        for (auto& mesh : _meshes)
+        {
+            for (Primitive& primitive : mesh.second)
+            {
+                if (primitive.instances.empty())
+                {
+                    continue;
+                }
+                _pScene->addInstances(primitive.geomPath, primitive.instances);
+                for (const Aurora::InstanceDefinition& definition : primitive.instances)
+                {
+                    _sceneContents.instances.push_back({ definition, primitive.geomPath });
+                }
+                uint32_t instanceCount = static_cast<uint32_t>(primitive.instances.size());
+                _sceneContents.vertexCount += primitive.vertexCount * instanceCount;
+                _sceneContents.triangleCount += primitive.triangleCount * instanceCount;
+            }
+        }
+    }
+
+private:
+    // An Aurora geometry created for a glTF mesh primitive, with the instances of it.
+    struct Primitive
+    {
+        Aurora::Path geomPath;
+        int material           = -1;
+        vec3 min               = vec3(0.0f);
+        vec3 max               = vec3(0.0f);
+        uint32_t vertexCount   = 0;
+        uint32_t triangleCount = 0;
+        Aurora::InstanceDefinitions instances;
+    };
+
+    // Imports a node and its children, with the specified parent transform.
+    void importNode(int nodeIndex, const mat4& parentTransform)
+    {
+        if (nodeIndex < 0 || nodeIndex >= static_cast<int>(_model.nodes.size()))
+        {
+            return;
+        }
+        const tinygltf::Node& node = _model.nodes[nodeIndex];
+        mat4 transform             = parentTransform * getNodeTransform(node);
+
+        // Add a camera, with a view matrix from the node transform, including its parents.
+        if (node.camera >= 0 && node.camera < static_cast<int>(_model.cameras.size()))
+        {
+            const tinygltf::Camera& camera = _model.cameras[node.camera];
+            SceneCamera sceneCamera;
+            sceneCamera.name       = node.name;
+            sceneCamera.viewMatrix = glm::inverse(transform);
+            if (camera.type.compare("perspective") == 0)
+            {
+                ScenePerspectiveCamera& properties = sceneCamera.perspectiveProperties;
+                sceneCamera.cameraType             = SCENE_CAMERA_TYPE_PERSPECTIVE;
+                properties.yfov        = static_cast<float>(camera.perspective.yfov);
+                properties.aspectRatio = static_cast<float>(camera.perspective.aspectRatio);
+                properties.znear       = static_cast<float>(camera.perspective.znear);
+                properties.zfar        = static_cast<float>(camera.perspective.zfar);
+            }
+            else if (camera.type.compare("orthographic") == 0)
+            {
+                SceneOrthographicCamera& properties = sceneCamera.orthographicProperties;
+                sceneCamera.cameraType              = SCENE_CAMERA_TYPE_ORTHOGRAPHIC;
+                properties.znear = static_cast<float>(camera.orthographic.znear);
+                properties.zfar  = static_cast<float>(camera.orthographic.zfar);
+                properties.xmag  = static_cast<float>(camera.orthographic.xmag);
+                properties.ymag  = static_cast<float>(camera.orthographic.ymag);
+            }
+            _sceneContents.cameras.push_back(sceneCamera);
+        }
+
+        // Add an instance of each primitive of the mesh for each instance transform, and add the
+        // instance bounds to the scene bounds.
+        if (node.mesh >= 0 && node.mesh < static_cast<int>(_model.meshes.size()))
+        {
+            vector<mat4> instanceTransforms = getInstanceTransforms(node, transform);
+            for (Primitive& primitive : getMesh(node.mesh))
+            {
+                Aurora::Path materialPath = getMaterial(primitive.material);
+                for (const mat4& instanceTransform : instanceTransforms)
+                {
+                    Aurora::InstanceDefinition definition = { _filePath + "-" + node.name +
+                            ":glTFInstance-" + to_string(_instanceCount++),
+                        { { Aurora::Names::InstanceProperties::kTransform, instanceTransform } } };
+                    if (!materialPath.empty())
+                    {
+                        definition.properties[Aurora::Names::InstanceProperties::kMaterial] =
+                            materialPath;
+                    }
+                    primitive.instances.push_back(definition);
+
+                    for (int corner = 0; corner < 8; corner++)
+                    {
+                        vec3 point((corner & 1) ? primitive.max.x : primitive.min.x,
+                            (corner & 2) ? primitive.max.y : primitive.min.y,
+                            (corner & 4) ? primitive.max.z : primitive.min.z);
+                        _sceneContents.bounds.add(vec3(instanceTransform * vec4(point, 1.0f)));
+                    }
+                }
+            }
+        }
+
+        for (int child : node.children)
+        {
+            importNode(child, transform);
+        }
+    }
+
+    // Gets the transforms of the instances of the mesh of a node: the node transform combined with
+    // each transform from the EXT_mesh_gpu_instancing extension, or just the node transform.
+    vector<mat4> getInstanceTransforms(const tinygltf::Node& node, const mat4& nodeTransform)
+    {
+        auto it = node.extensions.find("EXT_mesh_gpu_instancing");
+        if (it == node.extensions.end() || !it->second.Has("attributes"))
+        {
+            return { nodeTransform };
+        }
+
+        // Read the translation, rotation, and scale arrays, each of which is optional.
+        const tinygltf::Value& attributes = it->second.Get("attributes");
+        size_t instanceCount              = 0;
+        auto readAttribute = [&](const char* name, int type, vector<float>& valuesOut) {
+            if (!attributes.Has(name))
+            {
+                return;
+            }
+            int accessorIndex = attributes.Get(name).GetNumberAsInt();
+            if (accessorIndex < 0 || accessorIndex >= static_cast<int>(_model.accessors.size()) ||
+                _model.accessors[accessorIndex].type != type ||
+                !readAccessor(_model, _model.accessors[accessorIndex], valuesOut))
+            {
+                AU_WARN("Invalid %s instancing attribute in glTF file %s", name, _filePath.c_str());
+                valuesOut.clear();
+                return;
+            }
+            instanceCount = _model.accessors[accessorIndex].count;
+        };
+        vector<float> translations;
+        vector<float> rotations;
+        vector<float> scales;
+        readAttribute("TRANSLATION", TINYGLTF_TYPE_VEC3, translations);
+        readAttribute("ROTATION", TINYGLTF_TYPE_VEC4, rotations);
+        readAttribute("SCALE", TINYGLTF_TYPE_VEC3, scales);
+
+        vector<mat4> transforms;
+        transforms.reserve(instanceCount);
+        for (size_t i = 0; i < instanceCount; i++)
+        {
+            mat4 transform = nodeTransform;
+            if (translations.size() >= (i + 1) * 3)
+            {
+                transform = glm::translate(transform, glm::make_vec3(&translations[i * 3]));
+            }
+            if (rotations.size() >= (i + 1) * 4)
+            {
+                const float* pRotation = &rotations[i * 4];
+                transform *=
+                    glm::toMat4(glm::quat(pRotation[3], pRotation[0], pRotation[1], pRotation[2]));
+            }
+            if (scales.size() >= (i + 1) * 3)
+            {
+                transform = glm::scale(transform, glm::make_vec3(&scales[i * 3]));
+            }
+            transforms.push_back(transform);
+        }
+
+        return transforms;
+    }
+
+    // Gets the primitives of a mesh, creating a geometry for each one the first time the mesh is
+    // used. Primitives that can't be created (e.g. lines or points) are skipped.
+    vector<Primitive>& getMesh(int meshIndex)
+    {
+        auto it = _meshes.find(meshIndex);
+        if (it != _meshes.end())
+        {
+            return it->second;
+        }
+
+        vector<Primitive>& primitives = _meshes[meshIndex];
+        const tinygltf::Mesh& mesh    = _model.meshes[meshIndex];
+        for (size_t i = 0; i < mesh.primitives.size(); i++)
+        {
+            Primitive primitive;
+            primitive.geomPath = _filePath + "-" + mesh.name + ":glTFGeom-" +
+                to_string(meshIndex) + "-" + to_string(i);
+            primitive.material = mesh.primitives[i].material;
+            if (createGeometry(mesh.primitives[i], primitive))
+            {
+                primitives.push_back(primitive);
+            }
+        }
+
+        return primitives;
+    }
+
+    // Creates an Aurora geometry for a mesh primitive. The position, normal, tangent, texture
+    // coordinate, and index data point directly into the model buffers if they have a suitable
+    // type, and are otherwise converted to arrays in the scene geometry data.
+    bool createGeometry(const tinygltf::Primitive& primitive, Primitive& result)
+    {
+        // Get an attribute accessor of the primitive, or null if there is none.
+        auto getAccessor = [&](const string& name) -> const tinygltf::Accessor* {
+            auto it = primitive.attributes.find(name);
+            return it != primitive.attributes.end() && it->second >= 0 &&
+                    it->second < static_cast<int>(_model.accessors.size())
+                ? &_model.accessors[it->second]
+                : nullptr;
+        };
+        const tinygltf::Accessor* pPositions = getAccessor("POSITION");
+        const tinygltf::Accessor* pNormals   = getAccessor("NORMAL");
+        const tinygltf::Accessor* pTangents  = getAccessor("TANGENT");
+        const tinygltf::Accessor* pTexCoords = getAccessor("TEXCOORD_0");
+        const tinygltf::Accessor* pIndices   = primitive.indices >= 0 &&
+                primitive.indices < static_cast<int>(_model.accessors.size())
+              ? &_model.accessors[primitive.indices]
+              : nullptr;
+
+        // Only indexed or non-indexed triangle lists with at least one triangle are supported.
+        if (primitive.mode != TINYGLTF_MODE_TRIANGLES && primitive.mode != -1)
+        {
+            return false;
+        }
+        if (!pPositions || pPositions->type != TINYGLTF_TYPE_VEC3 || pPositions->count < 3 ||
+            (pIndices && pIndices->count < 3))
+        {
+            AU_WARN("Skipped invalid glTF mesh primitive in %s", _filePath.c_str());
+            return false;
+        }
+
+        SceneGeometryData& geometryData       = _sceneContents.addGeometry(result.geomPath);
+        Aurora::AttributeDataMap& attributes  = geometryData.attributes;
+        Aurora::GeometryDescriptor& geomDesc  = geometryData.descriptor;
+        Aurora::VertexDescription& vertexDesc = geomDesc.vertexDesc;
+        geometryData.pFileData                = _pModel;
+        size_t vertexCount                    = pPositions->count;
+        bool isValid                          = true;
+
+        // Get an attribute, pointing directly to the model buffer, or converting it to an array of
+        // floats with the specified number of components.
+        auto addAttribute = [&](const tinygltf::Accessor& accessor, const string& name,
+                                int componentCount, vector<float>& values) {
+            int type = componentCount == 2 ? TINYGLTF_TYPE_VEC2 : TINYGLTF_TYPE_VEC3;
+            if (!getDirectAttributeData(
+                    _model, accessor, type, TINYGLTF_COMPONENT_TYPE_FLOAT, attributes[name]))
+            {
+                isValid = isValid && accessor.type == type && accessor.count == vertexCount &&
+                    readAccessor(_model, accessor, values);
+                attributes[name] = getArrayAttributeData(values, componentCount);
+            }
+            vertexDesc.attributes[name] = componentCount == 2 ? Aurora::AttributeFormat::Float2
+                                                              : Aurora::AttributeFormat::Float3;
+        };
+        addAttribute(*pPositions, Aurora::Names::VertexAttributes::kPosition, 3,
+            geometryData.positions);
+        if (pTexCoords)
+        {
+            addAttribute(*pTexCoords, Aurora::Names::VertexAttributes::kTexCoord0, 2,
+                geometryData.texCoords);
+        }
+
+        // Add the indices, which must be 32-bit to be used directly. Also check they are in range.
+        size_t indexCount = 0;
+        if (pIndices)
+        {
+            indexCount = pIndices->count;
+            Aurora::AttributeData& indexData =
+                attributes[Aurora::Names::VertexAttributes::kIndices];
+            if (!getDirectAttributeData(_model, *pIndices, TINYGLTF_TYPE_SCALAR,
+                    TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT, indexData))
+            {
+                isValid   = isValid && readAccessor(_model, *pIndices, geometryData.indices);
+                indexData = getArrayAttributeData(geometryData.indices, 1);
+            }
+            for (size_t i = 0; i < indexCount && isValid; i++)
+            {
+                const uint8_t* pIndex = static_cast<const uint8_t*>(indexData.address) + i * 4;
+                isValid = *reinterpret_cast<const uint32_t*>(pIndex) < vertexCount;
+            }
+        }
+
+        // Add the normals, or calculate them if there are none, which requires the positions and
+        // indices as arrays. Tangents are only used with normals from the file.
+        if (pNormals)
+        {
+            addAttribute(*pNormals, Aurora::Names::VertexAttributes::kNormal, 3,
+                geometryData.normals);
+            Aurora::AttributeData& tangentData =
+                attributes[Aurora::Names::VertexAttributes::kTangent];
+            if (pTangents && pTangents->count == vertexCount &&
+                getDirectAttributeData(_model, *pTangents, TINYGLTF_TYPE_VEC4,
+                    TINYGLTF_COMPONENT_TYPE_FLOAT, tangentData))
+            {
+                vertexDesc.attributes[Aurora::Names::VertexAttributes::kTangent] =
+                    Aurora::AttributeFormat::Float3;
+            }
+            else
+            {
+                attributes.erase(Aurora::Names::VertexAttributes::kTangent);
+            }
+        }
+        else if (isValid)
+        {
+            vector<float> positions;
+            vector<uint32_t> indices;
+            isValid = readAccessor(_model, *pPositions, positions);
+            if (pIndices)
+            {
+                isValid = isValid && readAccessor(_model, *pIndices, indices);
+            }
+            else
+            {
+                indices.resize(vertexCount - vertexCount % 3);
+                iota(indices.begin(), indices.end(), 0);
+            }
+            geometryData.normals.resize(vertexCount * 3);
+            if (isValid)
+            {
+                Foundation::calculateNormals(vertexCount, positions.data(), indices.size() / 3,
+                    indices.data(), geometryData.normals.data());
+            }
+            attributes[Aurora::Names::VertexAttributes::kNormal] =
+                getArrayAttributeData(geometryData.normals, 3);
+            vertexDesc.attributes[Aurora::Names::VertexAttributes::kNormal] =
+                Aurora::AttributeFormat::Float3;
+        }
+
+        if (!isValid)
+        {
+            AU_WARN("Skipped glTF mesh primitive with invalid data in %s", _filePath.c_str());
+            _sceneContents.geometry.erase(result.geomPath);
+
+            return false;
+        }
+
+        // Get the bounds from the minimum and maximum position values, which glTF requires, or
+        // compute them from the positions if they are missing.
+        if (pPositions->minValues.size() == 3 && pPositions->maxValues.size() == 3)
+        {
+            result.min = vec3(pPositions->minValues[0], pPositions->minValues[1],
+                pPositions->minValues[2]);
+            result.max = vec3(pPositions->maxValues[0], pPositions->maxValues[1],
+                pPositions->maxValues[2]);
+        }
+        else
+        {
+            Foundation::BoundingBox bounds;
+            for (size_t i = 0; i < vertexCount; i++)
+            {
+                bounds.add(geometryData.position(i));
+            }
+            result.min = bounds.min();
+            result.max = bounds.max();
+        }
+        result.vertexCount   = static_cast<uint32_t>(vertexCount);
+        result.triangleCount = static_cast<uint32_t>((pIndices ? indexCount : vertexCount) / 3);
+
+        // Create the geometry, with a function that provides the attribute data. The function keeps
+        // the model alive, as the attribute data may point into its buffers.
+        geomDesc.type             = Aurora::PrimitiveType::Triangles;
+        vertexDesc.count          = vertexCount;
+        geomDesc.indexCount       = indexCount;
+        geomDesc.getAttributeData = [attributes, pFileData = geometryData.pFileData](
+                                        Aurora::AttributeDataMap& buffers, size_t /* firstVertex*/,
+                                        size_t /* vertexCount*/, size_t /* firstIndex*/,
+                                        size_t /* indexCount*/) {
+            if (!pFileData)
+            {
+                return false;
+            }
+            for (const auto& attribute : attributes)
+            {
+                buffers[attribute.first] = attribute.second;
+            }
+
+            return true;
+        };
+        _pScene->setGeometryDescriptor(result.geomPath, geomDesc);
+
+        return true;
+    }
+
+    // Gets the Aurora material for a glTF material, creating it the first time it is used. Returns
+    // an empty path if there is no material, so the default material is used.
+    //
+    // NOTE: Standard Surface images replace the corresponding factors rather than being multiplied
+    // by them, and there is no metalness image, so metallic-roughness images only provide the
+    // roughness. Alpha masks are treated as blended opacity.
+    Aurora::Path getMaterial(int materialIndex)
+    {
+        if (materialIndex < 0 || materialIndex >= static_cast<int>(_model.materials.size()))
+        {
+            return "";
+        }
+        auto it = _materials.find(materialIndex);
+        if (it != _materials.end())
+        {
+            return it->second;
+        }
+
+        // Get the material factors, including those from the IOR, transmission, and emissive
+        // strength extensions.
+        const tinygltf::Material& material        = _model.materials[materialIndex];
+        const tinygltf::PbrMetallicRoughness& pbr = material.pbrMetallicRoughness;
+        const vector<double>& baseColorFactor     = pbr.baseColorFactor;
+        const vector<double>& emissiveFactor      = material.emissiveFactor;
+        vec4 baseColor(1.0f);
+        vec3 emissionColor(0.0f);
+        if (baseColorFactor.size() == 4)
+        {
+            baseColor = vec4(baseColorFactor[0], baseColorFactor[1], baseColorFactor[2],
+                baseColorFactor[3]);
+        }
+        if (emissiveFactor.size() == 3)
+        {
+            emissionColor = vec3(emissiveFactor[0], emissiveFactor[1], emissiveFactor[2]);
+        }
+        bool hasEmission = length(emissionColor) > 0.0f || material.emissiveTexture.index >= 0;
+        bool isOpaque    = material.alphaMode.empty() || material.alphaMode == "OPAQUE";
+        float ior =
+            getExtensionNumber(material.extensions, "KHR_materials_ior", "ior", 1.5f);
+        float transmission = getExtensionNumber(
+            material.extensions, "KHR_materials_transmission", "transmissionFactor", 0.0f);
+        float emissiveStrength = getExtensionNumber(
+            material.extensions, "KHR_materials_emissive_strength", "emissiveStrength", 1.0f);
+
+        // Create an Aurora material, assign the properties and images.
+        // clang-format off
+        Aurora::Properties properties =
+        {
+            { "base_color",         vec3(baseColor) },
+            { "metalness",          static_cast<float>(pbr.metallicFactor) },
+            { "specular_roughness", static_cast<float>(pbr.roughnessFactor) },
+            { "specular_IOR",       ior },
+            { "transmission",       transmission },
+            { "emission",           hasEmission ? emissiveStrength : 0.0f },
+            { "emission_color",     emissionColor },
+            { "opacity",            vec3(isOpaque ? 1.0f : baseColor.a) }
+        };
+        // clang-format on
+        setImage(properties, "base_color_image", pbr.baseColorTexture.index,
+            glTFImageChannels::RGBA, true, Aurora::ImageUsage::Color);
+        setImage(properties, "specular_roughness_image", pbr.metallicRoughnessTexture.index,
+            glTFImageChannels::Green, false, Aurora::ImageUsage::Scalar);
+        setImage(properties, "emission_color_image", material.emissiveTexture.index,
+            glTFImageChannels::RGBA, true, Aurora::ImageUsage::Color);
+        setImage(properties, "normal_image", material.normalTexture.index,
+            glTFImageChannels::RGBA, false, Aurora::ImageUsage::Normal);
+        if (!isOpaque)
+        {
+            setImage(properties, "opacity_image", pbr.baseColorTexture.index,
+                glTFImageChannels::Alpha, false, Aurora::ImageUsage::Scalar);
+        }
+
+        Aurora::Path materialPath = _filePath + "-" + material.name + ":glTFMaterial-" +
+            to_string(materialIndex);
+        _pScene->setMaterialProperties(materialPath, properties);
+        _materials[materialIndex] = materialPath;
+
+        return materialPath;
+    }
+
+    // Sets an image material property (and its sampler property if needed) to an image created
+    // for a glTF texture, if the texture is valid.
+    void setImage(Aurora::Properties& properties, const string& name, int textureIndex,
+        glTFImageChannels channels, bool linearize, Aurora::ImageUsage usage)
+    {
+        if (textureIndex < 0 || textureIndex >= static_cast<int>(_model.textures.size()))
+        {
+            return;
+        }
+        const tinygltf::Texture& texture = _model.textures[textureIndex];
+        Aurora::Path imagePath           = getImage(texture.source, channels, linearize, usage);
+        if (imagePath.empty())
+        {
+            return;
+        }
+        properties[name] = imagePath;
+
+        Aurora::Path samplerPath = getSampler(texture.sampler);
+        if (!samplerPath.empty())
+        {
+            properties[name + "_sampler"] = samplerPath;
+        }
+    }
+
+    // Gets an Aurora image for the specified channels of a glTF image, creating it the first time
+    // it is used. The image pixels are provided directly from the decoded glTF image if they are
+    // 8-bit RGBA, and are otherwise converted when the image is activated.
+    Aurora::Path getImage(
+        int imageIndex, glTFImageChannels channels, bool linearize, Aurora::ImageUsage usage)
+    {
+        if (imageIndex < 0 || imageIndex >= static_cast<int>(_model.images.size()))
+        {
+            return "";
+        }
+        const tinygltf::Image& image = _model.images[imageIndex];
+        if (image.image.empty() || image.width <= 0 || image.height <= 0 ||
+            image.component <= 0 || image.component > 4 || (image.bits != 8 && image.bits != 16))
+        {
+            AU_WARN("Unsupported image %d in glTF file %s", imageIndex, _filePath.c_str());
+            return "";
+        }
+
+        Aurora::Path imagePath = _filePath + ":glTFImage-" + to_string(imageIndex) + "-" +
+            to_string(static_cast<int>(channels)) + "-" + to_string(linearize) + "-" +
+            to_string(static_cast<int>(usage));
+        if (!_images.insert(imagePath).second)
+        {
+            return imagePath;
+        }
+
+        Aurora::ImageDescriptor descriptor;
+        descriptor.linearize = linearize;
+        descriptor.usage     = usage;
+        descriptor.getData   = [pModel = _pModel, imageIndex, channels](
+                                 Aurora::ImageData& dataOut, Aurora::AllocateBufferFunction alloc) {
+            const tinygltf::Image& image = pModel->images[imageIndex];
+            size_t pixelCount            = static_cast<size_t>(image.width) * image.height;
+            dataOut.dimensions           = { image.width, image.height };
+            dataOut.format               = Aurora::ImageFormat::Integer_RGBA;
+            dataOut.bytesPerRow          = static_cast<size_t>(image.width) * 4;
+            dataOut.bufferSize           = pixelCount * 4;
+
+            // Use the decoded pixels directly if they are already 8-bit RGBA.
+            if (channels == glTFImageChannels::RGBA && image.component == 4 && image.bits == 8)
+            {
+                dataOut.pPixelBuffer = image.image.data();
+
+                return true;
+            }
+
+            // Otherwise convert the pixels to 8-bit RGBA, using the most significant byte of 16-bit
+            // (little-endian) components, and copying a single channel to all channels if needed.
+            // Images with one or two components are luminance, with alpha for two.
+            uint8_t* pPixels         = static_cast<uint8_t*>(alloc(dataOut.bufferSize));
+            size_t componentSize     = image.bits / 8;
+            size_t componentCount    = image.component;
+            const uint8_t* pSource   = image.image.data() + componentSize - 1;
+            bool hasAlpha            = componentCount == 2 || componentCount == 4;
+            for (size_t i = 0; i < pixelCount; i++)
+            {
+                const uint8_t* pPixel = pSource + i * componentCount * componentSize;
+                uint8_t* pOutput      = pPixels + i * 4;
+                uint8_t luminance     = pPixel[0];
+                uint8_t rgba[4]       = { luminance,
+                    componentCount >= 3 ? pPixel[componentSize] : luminance,
+                    componentCount >= 3 ? pPixel[2 * componentSize] : luminance,
+                    hasAlpha ? pPixel[(componentCount - 1) * componentSize] : uint8_t(255) };
+                if (channels == glTFImageChannels::Green || channels == glTFImageChannels::Alpha)
+                {
+                    uint8_t value = rgba[channels == glTFImageChannels::Green ? 1 : 3];
+                    rgba[0] = rgba[1] = rgba[2] = value;
+                    rgba[3]                     = 255;
+                }
+                memcpy(pOutput, rgba, 4);
+            }
+            dataOut.pPixelBuffer = pPixels;
+
+            return true;
+        };
+        _pScene->setImageDescriptor(imagePath, descriptor);
+
+        return imagePath;
+    }
+
+    // Gets an Aurora sampler for a glTF sampler, creating it the first time it is used. Returns an
+    // empty path for the default sampler, which repeats in both directions like the Aurora default.
+    Aurora::Path getSampler(int samplerIndex)
+    {
+        if (samplerIndex < 0 || samplerIndex >= static_cast<int>(_model.samplers.size()))
+        {
+            return "";
+        }
+        const tinygltf::Sampler& sampler = _model.samplers[samplerIndex];
+        if (sampler.wrapS == TINYGLTF_TEXTURE_WRAP_REPEAT &&
+            sampler.wrapT == TINYGLTF_TEXTURE_WRAP_REPEAT)
+        {
+            return "";
+        }
+        auto it = _samplers.find(samplerIndex);
+        if (it != _samplers.end())
+        {
+            return it->second;
+        }
+
+        Aurora::Path samplerPath = _filePath + ":glTFSampler-" + to_string(samplerIndex);
+        _pScene->setSamplerProperties(samplerPath,
+            { { Aurora::Names::SamplerProperties::kAddressModeU, getAddressMode(sampler.wrapS) },
+                { Aurora::Names::SamplerProperties::kAddressModeV,
+                    getAddressMode(sampler.wrapT) } });
+        _samplers[samplerIndex] = samplerPath;
+
+        return samplerPath;
+    }
+
+    shared_ptr<const tinygltf::Model> _pModel;
+    const tinygltf::Model& _model;
+    Aurora::IScene* _pScene = nullptr;
+    string _filePath;
+    SceneContents& _sceneContents;
+    map<int, vector<Primitive>> _meshes;
+    map<int, Aurora::Path> _materials;
+    set<Aurora::Path> _images;
+    map<int, Aurora::Path> _samplers;
+    uint32_t _instanceCount = 0;
+};
+
 // Loads a glTF file into the specified renderer and scene, from the specified file path.
-bool loadglTFFile(Aurora::IRenderer* /* pRenderer */, Aurora::IScene* /* pScene */,
+bool loadglTFFile(Aurora::IRenderer* /* pRenderer */, Aurora::IScene* pScene,
     const string& filePath, SceneContents& sceneContents)
 {
+    sceneContents.reset();
     sceneContents.cameras.clear();
-    
-    tinygltf::TinyGLTF loader;
-    tinygltf::Model model;
-    string warnings, errors;
+
+    // Start a timer for reading the glTF file.
+    Foundation::CPUTimer timer;
+    ::infoMessage("Reading glTF file \"" + filePath + "\"...");
 
     // Attempt to load the file as a binary glTF file, which is (quickly) identified from the file
-    // header. If that fails, instead try to load it as an ASCII file.
-    bool result = loader.LoadBinaryFromFile(&model, &errors, &warnings, filePath);
-    if(!result) {
-        result = loader.LoadASCIIFromFile(&model, &errors, &errors, filePath);
+    // header. If that fails, instead try to load it as an ASCII file. The model is shared with the
+    // geometry and images that use its data.
+    tinygltf::TinyGLTF loader;
+    auto pModel = make_shared<tinygltf::Model>();
+    string warnings, errors;
+    bool result = loader.LoadBinaryFromFile(pModel.get(), &errors, &warnings, filePath);
+    if (!result)
+    {
+        errors.clear();
+        warnings.clear();
+        result = loader.LoadASCIIFromFile(pModel.get(), &errors, &warnings, filePath);
+    }
+    if (!warnings.empty())
+    {
+        AU_WARN("LoadglTFFile Warnings: %s", warnings.c_str());
+    }
+    if (!result)
+    {
+        AU_WARN("LoadglTFFile Errors: %s", errors.c_str());
+        return false;
     }
 
-    // glTF is supported in a limited way just to load cameras
+    // Report the file read time.
+    ::infoMessage("... completed in " + to_string(static_cast<int>(timer.elapsed())) + " ms.");
 
-    for(tinygltf::Scene& scene : model.scenes) {
-        loadCameras(model, sceneContents, scene.nodes);
-    }
-    
-    return true;
+    // Import the scene, including the cameras.
+    timer.reset();
+    ::infoMessage("Translating glTF scene data...");
+    glTFImporter importer(pModel, pScene, filePath, sceneContents);
+    importer.importScene();
+    ::infoMessage("... completed in " + to_string(static_cast<int>(timer.elapsed())) + " ms.");
+
+    // The file is loaded if it has any instances or cameras, as files with only cameras are used
+    // to set the camera of another scene.
+    return !sceneContents.instances.empty() || !sceneContents.cameras.empty();
 }
 
 bool saveglTFFile(Aurora::IRenderer* /* pRenderer */, Aurora::IScene* /* pScene */,
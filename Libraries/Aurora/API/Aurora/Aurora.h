@@ -15,6 +15,7 @@
 
 // Aurora headers.
 #include <Aurora/Foundation/Log.h>
+#include <Aurora/Foundation/Profiler.h>
 
 // STL headers.
 #include <array>
@@ -434,7 +435,36 @@ enum class ImageFormat : uint8_t
     Float_RGB,
 
     /// 32-bit per-channel, single channel float.
-    Float_R
+    Float_R,
+
+    /// Block compressed RGB, 4 bits per pixel. Alpha is always opaque.
+    BC1_RGBA,
+
+    /// Block compressed single channel (red), 4 bits per pixel.
+    BC4_R,
+
+    /// Block compressed two channels (red and green), 8 bits per pixel.
+    BC5_RG,
+
+    /// Block compressed RGBA, 8 bits per pixel.
+    BC7_RGBA
+};
+
+/// How an image is used, e.g. by material properties. This is used to choose a suitable compressed
+/// format for the image, if texture compression is enabled.
+enum class ImageUsage : uint8_t
+{
+    /// The usage is unknown, so the image is not compressed.
+    Unknown,
+
+    /// A color, such as the base color of a material, which may have an alpha channel.
+    Color,
+
+    /// A scalar value read from the red channel, such as roughness or metalness.
+    Scalar,
+
+    /// A tangent-space normal map.
+    Normal
 };
 
 /// Input vertex description. Defines which vertex attributes each vertex has, and the number of
@@ -570,6 +600,10 @@ struct ImageDescriptor
     /// Whether the image is to be used to represent an environment.
     bool isEnvironment = false;
 
+    /// How the image is used, which determines its compressed format if texture compression is
+    /// enabled.
+    ImageUsage usage = ImageUsage::Unknown;
+
     /// Callback for getting the pixel data, called when geometry resource is activated.
     GetImageDataFunction getData = nullptr;
 
@@ -737,6 +771,20 @@ public:
     /// Returns a class holding a handle to shareable GPU buffer memory.
     virtual IBufferPtr asShared() = 0;
 
+    /// Enables or disables denoising of the render buffer contents on the CPU with denoiseImage(),
+    /// which is applied when the contents are accessed with data() or asReadable(). This is
+    /// intended for previews with few samples per pixel, with renderers that have no GPU denoiser.
+    /// The optional guide render buffers must also be assigned to the kDiffuseAlbedo, kNormal, and
+    /// kDepthNDC AOVs with IRenderer::setTargets().
+    /// \return Whether CPU denoising is supported by the renderer and the render buffer format.
+    virtual bool setCPUDenoisingEnabled(bool /*enabled*/,
+        const std::shared_ptr<IRenderBuffer>& /*pAlbedo*/ = nullptr,
+        const std::shared_ptr<IRenderBuffer>& /*pNormal*/ = nullptr,
+        const std::shared_ptr<IRenderBuffer>& /*pDepth*/  = nullptr)
+    {
+        return false;
+    }
+
 protected:
     virtual ~IRenderBuffer() = default; // hidden destructor
 };
@@ -878,6 +926,66 @@ enum ResourceType
     Invalid
 };
 
+/// The memory used by a type of resource, as reported by MemoryStatistics.
+struct ResourceMemoryUsage
+{
+    /// The number of resources, and the number of those that are active, i.e. in use and with
+    /// their renderer objects created. Only active resources use device memory.
+    size_t count       = 0;
+    size_t activeCount = 0;
+
+    /// The memory used by the resources in bytes, in CPU memory and in device (GPU) memory.
+    size_t cpuBytes    = 0;
+    size_t deviceBytes = 0;
+
+    /// Adds the usage of another set of resources to this one.
+    ResourceMemoryUsage& operator+=(const ResourceMemoryUsage& other)
+    {
+        count += other.count;
+        activeCount += other.activeCount;
+        cpuBytes += other.cpuBytes;
+        deviceBytes += other.deviceBytes;
+
+        return *this;
+    }
+};
+
+/// The memory used by a scene and renderer, for each type of resource.
+///
+/// \note Device memory is an estimate from the sizes of the GPU resources created by the renderer,
+/// and may not include all of the padding or alignment added by the graphics driver.
+struct MemoryStatistics
+{
+    /// The memory used by the resources of the scene, indexed by resource type. The CPU memory
+    /// includes the copies of geometry data and material uniform data kept by the renderer.
+    ResourceMemoryUsage resources[ResourceType::Invalid];
+
+    /// The image files loaded with IScene::setImageFromFilePath() whose data is kept by the
+    /// scene until the image is created.
+    ResourceMemoryUsage loadedImages;
+
+    /// The alias maps used to sample environment light images.
+    ResourceMemoryUsage aliasMaps;
+
+    /// The shader transpiler sessions kept by the renderer, which are only counted.
+    ResourceMemoryUsage transpilerSessions;
+
+    /// Gets the total memory used by all of the above.
+    ResourceMemoryUsage total() const
+    {
+        ResourceMemoryUsage usage;
+        for (const ResourceMemoryUsage& resourceUsage : resources)
+        {
+            usage += resourceUsage;
+        }
+        usage += loadedImages;
+        usage += aliasMaps;
+        usage += transpilerSessions;
+
+        return usage;
+    }
+};
+
 /// A class representing a scene for rendering, consisting of instances of geometry, an environment,
 /// and a global directional light.
 class AURORA_API IScene
@@ -899,11 +1007,25 @@ public:
     /// Create an image with the given file path.  The image descriptor will be created using the
     /// default load callback provided by setLoadResourceFunction.
     ///
+    /// The image file starts loading on a background thread when this is called, so that it is
+    /// decoded while the rest of the scene is set up, and the image is created with the loaded data
+    /// when it is first used.
+    ///
     /// \param atPath The Aurora path at which the image will be created.
     /// \param filePath The path to the image file, if the string is empty, then atPath is used.
     virtual void setImageFromFilePath(const Path& atPath, const std::string& filePath = "",
         bool linearize = true, bool isEnvironment = false) = 0;
 
+    /// Removes the image at the given path from the scene, releasing its memory.
+    ///
+    /// The image is removed during the next scene update, and only if it is not used by any other
+    /// resource at that time, e.g. a material. An image must be created again with
+    /// setImageDescriptor() or setImageFromFilePath() before it can be used after it is removed.
+    ///
+    /// \param atPath The path of the image to remove. Nothing is done if there is no image at that
+    /// path.
+    virtual void removeImage(const Path& atPath) = 0;
+
     /// Set the properties for sampler with given path.
     /// This will create a new sampler (or force it to be recreated an sampler already exists at
     /// that path).
@@ -926,6 +1048,14 @@ public:
     /// \param desc A description of the geometry.
     virtual void setGeometryDescriptor(const Path& atPath, const GeometryDescriptor& desc) = 0;
 
+    /// Enables or disables geometry deduplication, which is disabled by default. When enabled,
+    /// geometry with identical vertex and index data to other geometry in the scene shares a single
+    /// renderer geometry object (and acceleration structure), instead of each path having a copy.
+    /// This requires the attribute data to be hashed when the geometry is activated.
+    ///
+    /// \note This applies to geometry descriptors that are set after it is changed.
+    virtual void setGeometryDeduplicationEnabled(bool enabled) = 0;
+
     /// Prevents the resource from being purged by the renderer if unused (can be nested).
     virtual void addPermanent(const Path& resource) = 0;
 
@@ -1027,6 +1157,9 @@ public:
     /// \return A smart pointer to the new lights.
     virtual ILightPtr addLightPointer(const std::string& lightType) = 0;
 
+    /// Gets the memory used by the resources of the scene, for each type of resource.
+    virtual MemoryStatistics memoryStatistics() = 0;
+
 protected:
     virtual ~IScene() = default; // hidden destructor
 };
@@ -1055,6 +1188,19 @@ enum class AOV
 /// A map of AOVs to targets, to indicate which targets should receive which AOVs.
 using TargetAssignments = std::unordered_map<AOV, ITargetPtr>;
 
+/// A rectangular region of pixels, with the origin at the top-left corner of an image. A region
+/// with zero width or height is empty.
+struct PixelRegion
+{
+    uint32_t x      = 0;
+    uint32_t y      = 0;
+    uint32_t width  = 0;
+    uint32_t height = 0;
+
+    /// Gets whether the region is empty, i.e. it has no pixels.
+    bool isEmpty() const { return width == 0 || height == 0; }
+};
+
 // A class for rendering images and creating objects associated with the renderer.
 class AURORA_API IRenderer
 {
@@ -1171,6 +1317,29 @@ public:
     // Render the current scene.
     virtual void render(uint32_t sampleStart = 0, uint32_t sampleCount = 1) = 0;
 
+    /// Sets the region of the targets that is rendered, e.g. the part of the image that changed,
+    /// or a region of interest selected by the user. Pixels outside the region are not written,
+    /// including by accumulation and post-processing. The region is clipped to the targets, and
+    /// the whole targets are rendered if it doesn't overlap them.
+    ///
+    /// \param region The region to render, or an empty region to render the whole targets.
+    /// \return Whether the region is supported by the renderer backend. If not, the whole targets
+    /// are rendered.
+    virtual bool setRenderRegion(const PixelRegion& region) = 0;
+
+    /// Sets the targets to be a tile of a larger image, for rendering images that are too large
+    /// for a single set of targets. The camera and sampling cover the whole image, and the
+    /// targets receive the pixels of the tile with its top-left corner at the specified position
+    /// in the image, with the size of the targets. The tiles from computeRenderTiles() can be
+    /// rendered one after the other, and copied into the image.
+    ///
+    /// \param imageWidth The width of the whole image, or zero to use the size of the targets.
+    /// \param imageHeight The height of the whole image, or zero to use the size of the targets.
+    /// \param tileX The horizontal position of the tile in the image.
+    /// \param tileY The vertical position of the tile in the image.
+    virtual void setRenderTile(
+        uint32_t imageWidth, uint32_t imageHeight, uint32_t tileX = 0, uint32_t tileY = 0) = 0;
+
     // Wait for all the currently executing render tasks on the GPU to complete.
     virtual void waitForTask() = 0;
 
@@ -1180,17 +1349,99 @@ public:
     virtual const std::vector<std::string>& builtInMaterials() = 0;
 
     /// \desc Set the callback function used to load resources, such as textures, from a URI.
+    /// \note Images are loaded on background threads, so the function must be thread-safe.
     /// \param func Callback function to be used for all subsequent loading.
     virtual void setLoadResourceFunction(LoadResourceFunction func) = 0;
 
+    /// Gets the CPU profiling statistics of the renderer, aggregated per named zone (e.g. scene
+    /// update or material generation) since profiling was last reset.
+    ///
+    /// \note Zones are only recorded while profiling is enabled, with the "isProfilingEnabled"
+    /// option.
+    /// \return The statistics for each zone, sorted by decreasing total time.
+    virtual Foundation::Profiler::Statistics profilingStatistics() = 0;
+
+    /// Writes the recorded CPU profiling zones to a file in the Chrome trace event (JSON) format,
+    /// which can be viewed with chrome://tracing or https://ui.perfetto.dev.
+    /// \param filePath The path of the file to write.
+    /// \return Whether the file was written successfully.
+    virtual bool writeProfilingTrace(const std::string& filePath) = 0;
+
+    /// Discards all recorded CPU profiling zones and statistics.
+    virtual void resetProfiling() = 0;
+
+    /// Gets the memory used by the renderer and its current scene, for each type of resource.
+    virtual MemoryStatistics memoryStatistics() = 0;
+
 protected:
     virtual ~IRenderer() = default; // hidden destructor
 };
 MAKE_AURORA_PTR(IRenderer);
 
+/// The images used by denoiseImage(). All images have the specified dimensions, with tightly
+/// packed rows of 32-bit float pixels. The guide images are optional (they can be null), and each
+/// one improves the preservation of different features:
+/// - pAlbedo: The diffuse albedo (RGBA), which preserves texture detail.
+/// - pNormal: The surface normal (RGBA, with XYZ used), which preserves geometric edges.
+/// - pDepth: The depth (one channel), which preserves silhouettes.
+struct DenoiserImages
+{
+    uint32_t width       = 0;
+    uint32_t height      = 0;
+    const float* pColor  = nullptr;
+    const float* pAlbedo = nullptr;
+    const float* pNormal = nullptr;
+    const float* pDepth  = nullptr;
+
+    /// The denoised color image (RGBA), which can be the same as the color image.
+    float* pOutput = nullptr;
+};
+
+/// Options for denoiseImage(). The sigma values control how much a difference in each image stops
+/// the filter: smaller values preserve more detail, but remove less noise.
+struct DenoiserOptions
+{
+    /// The number of filter iterations, each of which doubles the filter radius.
+    uint32_t iterationCount = 5;
+
+    /// The color sigma, for tone mapped color in the range [0.0, 1.0]. This is halved with each
+    /// iteration, as noise is reduced.
+    float colorSigma = 0.6f;
+
+    /// The sigma for the distance between normals.
+    float normalSigma = 0.2f;
+
+    /// The sigma for relative depth differences.
+    float depthSigma = 0.05f;
+
+    /// The sigma for albedo differences.
+    float albedoSigma = 0.1f;
+
+    /// The number of threads to use, or zero to use all available hardware threads.
+    uint32_t threadCount = 0;
+};
+
+/// Denoises a rendered image on the CPU, using an edge-aware "a-trous" wavelet filter guided by
+/// the optional albedo, normal, and depth images. When albedo is provided, the filter is applied to
+/// the illumination (color divided by albedo), so that texture detail is not blurred.
+AURORA_API void denoiseImage(
+    const DenoiserImages& images, const DenoiserOptions& options = DenoiserOptions());
+
+/// Computes the tiles for rendering an image in parts, each with at most the specified number of
+/// pixels, e.g. to bound the memory used by the targets or the duration of each render. The tiles
+/// are as close to square as possible, cover the image without overlapping, and are ordered by
+/// row from the top-left corner. A single tile covering the image is returned if it is within the
+/// limit, or if the limit is zero.
+AURORA_API std::vector<PixelRegion> computeRenderTiles(
+    uint32_t imageWidth, uint32_t imageHeight, size_t maxTilePixels);
+
 // Gets the logger for the Aurora library, used to report console output and errors.
 AURORA_API Foundation::Log& logger();
 
+// Gets the CPU profiler for the Aurora library, which other modules can use to record zones
+// alongside those of the renderer, e.g. with AU_PROFILE_TO(Aurora::profiler(), "Name").
+AURORA_API Foundation::Profiler& profiler();
+
 // Creates a renderer with the specified backend and number of simultaneously active tasks.
 AURORA_API IRendererPtr createRenderer(
     IRenderer::Backend type = IRenderer::Backend::Default, uint32_t taskCount = 3);
@@ -123,13 +123,38 @@ struct LightTypes
 {
     /// Distant (aka directional) light
     static AURORA_API const std::string kDistantLight;
+    /// Point light, emitting in all directions from a sphere with an optional radius.
+    static AURORA_API const std::string kPointLight;
+    /// Spot light, a point light with emission limited to a cone around its direction.
+    static AURORA_API const std::string kSpotLight;
+    /// Rectangular area light, emitting from one side in the direction of the light.
+    static AURORA_API const std::string kRectLight;
 };
 
 /// Light properties (only some will be valid properties for a given light type.)
 struct LightProperties
 {
-    /// Light direction (only valid for LightTypes::kDistantLight.)
+    /// Light direction (not valid for LightTypes::kPointLight.) For spot and rect lights this is
+    /// the direction of emission.
     static AURORA_API const std::string kDirection;
+    /// Light position (only valid for local lights, i.e. not LightTypes::kDistantLight.)
+    static AURORA_API const std::string kPosition;
+    /// The radius of the emitting sphere (only valid for LightTypes::kPointLight and
+    /// LightTypes::kSpotLight.)
+    static AURORA_API const std::string kRadius;
+    /// The angle in radians between the direction and the edge of the cone of emission (only valid
+    /// for LightTypes::kSpotLight.)
+    static AURORA_API const std::string kConeAngle;
+    /// The fraction of the cone angle over which the emission falls off to zero at the edge of the
+    /// cone, in the range [0, 1] (only valid for LightTypes::kSpotLight.)
+    static AURORA_API const std::string kConeSoftness;
+    /// The direction along the width of the light, perpendicular to the light direction (only
+    /// valid for LightTypes::kRectLight.)
+    static AURORA_API const std::string kTangent;
+    /// The width of the light (only valid for LightTypes::kRectLight.)
+    static AURORA_API const std::string kWidth;
+    /// The height of the light (only valid for LightTypes::kRectLight.)
+    static AURORA_API const std::string kHeight;
     /// The angular diameter of the light in radians (only valid for LightTypes::kDistantLight.)
     static AURORA_API const std::string kAngularDiameter;
     /// Light exposure (defines the power of the light with kIntensity.)
@@ -15,6 +15,8 @@
 
 #include "AliasMap.h"
 
+#include <Aurora/Foundation/PixelConversion.h>
+
 BEGIN_AURORA
 
 namespace AliasMap
@@ -28,8 +30,8 @@ static float computeLuminance(const vec3& value)
     return dot(value, kLuminanceFactors);
 }
 
-void build(const float* pPixels, uvec2 dimensions, Entry* pOutputBuffer, size_t outputBufferSize,
-    float& luminanceIntegralOut)
+void build(const void* pPixels, ImageFormat format, uvec2 dimensions, Entry* pOutputBuffer,
+    size_t outputBufferSize, float& luminanceIntegralOut)
 {
     // Calculate total number of pixels.
     unsigned int pixelCount = dimensions.x * dimensions.y;
@@ -55,8 +57,25 @@ void build(const float* pPixels, uvec2 dimensions, Entry* pOutputBuffer, size_t
     // The luminance integral is computed below, and used to compute probabilities and PDF.
     luminanceIntegralOut = 0.0f;
 
+    // Determine the number of channels for the image format. Half float pixels are converted to
+    // float one row at a time, so that the whole image is never stored at full precision.
+    size_t channelCount = 0;
+    switch (format)
+    {
+    case ImageFormat::Float_RGB:
+        channelCount = 3;
+        break;
+    case ImageFormat::Float_RGBA:
+    case ImageFormat::Half_RGBA:
+        channelCount = 4;
+        break;
+    default:
+        AU_FAIL("Unsupported environment image format:%x", format);
+    }
+    size_t rowValueCount = dimensions.x * channelCount;
+    vector<float> rowPixels(format == ImageFormat::Half_RGBA ? rowValueCount : 0);
+
     // Iterate the image pixels, storing the luminance and area-scaled luminance of each one.
-    const float* pPixel   = pPixels;
     size_t luminanceIndex = 0;
     auto lonIncrement     = static_cast<float>(2.0f * M_PI / dimensions.x); // vertical (lat)
     auto latIncrement     = static_cast<float>(M_PI / dimensions.y);        // horizontal (lon)
@@ -69,6 +88,20 @@ void build(const float* pPixels, uvec2 dimensions, Entry* pOutputBuffer, size_t
         float solidAngle = (sin(latAngle) - sin(latAngle - latIncrement)) * lonIncrement;
         latAngle -= latIncrement;
 
+        // Get the float pixels of the current row, converting from half floats if needed.
+        const float* pPixel;
+        if (format == ImageFormat::Half_RGBA)
+        {
+            Foundation::convertHalfToFloat(
+                static_cast<const uint16_t*>(pPixels) + y * rowValueCount, rowPixels.data(),
+                rowValueCount);
+            pPixel = rowPixels.data();
+        }
+        else
+        {
+            pPixel = static_cast<const float*>(pPixels) + y * rowValueCount;
+        }
+
         // Iterate the pixels of the current row, computing and accumulating luminance for each.
         for (unsigned int x = 0; x < dimensions.x; x++)
         {
@@ -83,7 +116,7 @@ void build(const float* pPixels, uvec2 dimensions, Entry* pOutputBuffer, size_t
             luminanceIntegralOut += luminanceAndArea;
 
             // Advance to the next pixel and luminance entry.
-            pPixel += 3;
+            pPixel += channelCount;
             luminanceIndex++;
         }
     }
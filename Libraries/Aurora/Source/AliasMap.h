@@ -30,10 +30,10 @@ struct Entry
 
 // Creates an alias map from the pixel data for an environment image with lat-long layout. This is
 // used for importance sampling from the environment image, by treating it as a discrete probability
-// distribution.
+// distribution. The pixels must have one of the float formats: Float_RGB, Float_RGBA, or Half_RGBA.
 // The luminance integral is also computed as part of alias map calculation.
-void build(const float* pPixels, uvec2 dimensions, Entry* pOutputBuffer, size_t outputBufferSize,
-    float& luminanceIntegralOut);
+void build(const void* pPixels, ImageFormat format, uvec2 dimensions, Entry* pOutputBuffer,
+    size_t outputBufferSize, float& luminanceIntegralOut);
 
 } // namespace AliasMap
 
@@ -15,6 +15,8 @@
 
 #include "AssetManager.h"
 
+#include <Aurora/Foundation/PixelConversion.h>
+
 // Include STB for image loading.
 // TODO: Image loading will eventually be handled by clients.
 #pragma warning(push)
@@ -130,9 +132,9 @@ bool defaultLoadResourceFunction(
 }
 
 // Default process image function.
-// Has extra flipImageY argument that must be filled in.
+// Has extra flipImageY and halfFloat arguments that must be filled in.
 bool defaultProcessImageFunction(const vector<unsigned char>& buffer, const string& filename,
-    ImageAsset* pImageOut, bool flipImageY)
+    ImageAsset* pImageOut, bool flipImageY, bool halfFloat)
 {
     // Use STB to decode the image buffer.
     // TODO: Image loading will eventually be handled by clients.
@@ -143,10 +145,7 @@ bool defaultProcessImageFunction(const vector<unsigned char>& buffer, const stri
 
     if (isHDR)
     {
-        // Don't flip HDR images.
-        stbi_set_flip_vertically_on_load(false);
-
-        // Load HDR image as floats.
+        // Load HDR image as floats. HDR images are not flipped.
         float* pPixels =
             stbi_loadf_from_memory(&buffer[0], (int)buffer.size(), &width, &height, &components, 0);
 
@@ -158,51 +157,61 @@ bool defaultProcessImageFunction(const vector<unsigned char>& buffer, const stri
         pImageOut->data.height    = height;
         pImageOut->data.name      = filename;
         pImageOut->data.linearize = false;
+        size_t pixelCount         = static_cast<size_t>(width) * static_cast<size_t>(height);
+        if (halfFloat)
+        {
+            // Store the pixels as RGBA half floats, which halves the memory required for RGBA
+            // images (and more for RGB images, which are padded to RGBA). The conversion is done
+            // directly from the pixels allocated by STB, without a full precision copy.
+            pImageOut->data.format = ImageFormat::Half_RGBA;
+            size_t sizeBytes       = pixelCount * 4 * sizeof(uint16_t);
+            pImageOut->pixels      = make_unique<unsigned char[]>(sizeBytes);
+            pImageOut->sizeBytes   = sizeBytes;
+            Foundation::convertFloatToHalfRGBA(pPixels, components,
+                reinterpret_cast<uint16_t*>(pImageOut->pixels.get()), pixelCount);
+        }
+        else
+        {
 #if defined(__APPLE__)
-        // only support 4 component float
-        pImageOut->data.format = ImageFormat::Float_RGBA;
-        size_t sizeBytes       = static_cast<size_t>(width) * static_cast<size_t>(height)
-            * static_cast<size_t>(4) * sizeof(float); // components = 4
+            // only support 4 component float
+            int outputComponents = 4;
 #else
-        pImageOut->data.format = components == 3 ? ImageFormat::Float_RGB : ImageFormat::Float_RGBA;
-        size_t sizeBytes       = static_cast<size_t>(width) * static_cast<size_t>(height)
-            * static_cast<size_t>(components) * sizeof(float);
+            int outputComponents = components;
 #endif
-        pImageOut->pixels      = make_unique<unsigned char[]>(sizeBytes);
-        pImageOut->data.pImageData = pImageOut->pixels.get();
-        pImageOut->sizeBytes       = sizeBytes;
+            pImageOut->data.format =
+                outputComponents == 3 ? ImageFormat::Float_RGB : ImageFormat::Float_RGBA;
+            size_t sizeBytes = pixelCount * static_cast<size_t>(outputComponents) * sizeof(float);
+            pImageOut->pixels    = make_unique<unsigned char[]>(sizeBytes);
+            pImageOut->sizeBytes = sizeBytes;
 
-#if defined(__APPLE__)
-        if(components == 3) {
-            float* dstPixels = reinterpret_cast<float*>(pImageOut->pixels.get());
-            float* srcPixels = reinterpret_cast<float*>(pPixels);
-            
-            const size_t numPixels = static_cast<size_t>(width) * static_cast<size_t>(height);
-            for(size_t pixelIdx = 0; pixelIdx < numPixels; ++pixelIdx) {
-                *dstPixels++ = *srcPixels++;
-                *dstPixels++ = *srcPixels++;
-                *dstPixels++ = *srcPixels++;
-                *dstPixels++ = 1.0f;
+            if (outputComponents != components)
+            {
+                // Pad RGB pixels to RGBA, with an alpha of one.
+                const float* pSrcPixel = pPixels;
+                float* pDstPixel       = reinterpret_cast<float*>(pImageOut->pixels.get());
+                for (size_t pixelIdx = 0; pixelIdx < pixelCount; ++pixelIdx)
+                {
+                    *pDstPixel++ = *pSrcPixel++;
+                    *pDstPixel++ = *pSrcPixel++;
+                    *pDstPixel++ = *pSrcPixel++;
+                    *pDstPixel++ = 1.0f;
+                }
+            }
+            else
+            {
+                // Copy pixels.
+                memcpy(pImageOut->pixels.get(), pPixels, sizeBytes);
             }
         }
-        else {
-#endif
-            // Copy pixels.
-            memcpy(pImageOut->pixels.get(), pPixels, sizeBytes);
-#if defined(__APPLE__)
-        }
-#endif
+        pImageOut->data.pImageData = pImageOut->pixels.get();
 
         // Free the pixels allocated by STB.
         stbi_image_free(pPixels);
     }
     else
     {
-
-        // Set the flipped flag based on static variable in AssetManager.
-        stbi_set_flip_vertically_on_load(flipImageY);
-
-        // Load LDR image as bytes.
+        // Load LDR image as bytes. The rows are flipped below if needed, rather than with the STB
+        // flip flag, as the flag is global and images may be decoded on multiple threads.
         unsigned char* pPixels =
             stbi_load_from_memory(&buffer[0], (int)buffer.size(), &width, &height, &components, 0);
 
@@ -221,46 +230,49 @@ bool defaultProcessImageFunction(const vector<unsigned char>& buffer, const stri
         pImageOut->data.pImageData = pImageOut->pixels.get();
         pImageOut->sizeBytes       = sizeBytes;
 
-        // Output images must have four components (RGBA) so fill out missing components as needed.
-        if (components == 1)
+        // Fail if unsupported component count.
+        if (components != 1 && components != 3 && components != 4)
         {
-            // Single-component (R) image: duplicate the R component to G and B, and set alpha to
-            // the maximum value.
-            unsigned char* pIn  = pPixels;
-            unsigned char* pOut = pImageOut->pixels.get();
-            const size_t imageSize = static_cast<size_t>(width) * static_cast<size_t>(height);
-            for (size_t i = 0; i < imageSize; i++)
-            {
-                unsigned char chIn = *(pIn++);
-                *(pOut++)          = chIn;
-                *(pOut++)          = chIn;
-                *(pOut++)          = chIn;
-                *(pOut++)          = 255;
-            }
+            AU_FAIL("%s invalid number of components %d", filename.c_str(), components);
         }
-        else if (components == 3)
+
+        // Output images must have four components (RGBA) so fill out missing components as needed,
+        // one row at a time, reading the rows in reverse order if the image is flipped.
+        const size_t rowPixels = static_cast<size_t>(width);
+        for (int row = 0; row < height; row++)
         {
-            // RGB image: set alpha to the maximum value.
-            unsigned char* pIn  = pPixels;
-            unsigned char* pOut = pImageOut->pixels.get();
-            const size_t imageSize = static_cast<size_t>(width) * static_cast<size_t>(height);
-            for (size_t i = 0; i < imageSize; i++)
+            int inRow           = flipImageY ? height - 1 - row : row;
+            unsigned char* pIn  = pPixels + inRow * rowPixels * components;
+            unsigned char* pOut = pImageOut->pixels.get() + row * rowPixels * 4;
+            if (components == 1)
             {
-                *(pOut++) = *(pIn++);
-                *(pOut++) = *(pIn++);
-                *(pOut++) = *(pIn++);
-                *(pOut++) = 255;
+                // Single-component (R) image: duplicate the R component to G and B, and set alpha
+                // to the maximum value.
+                for (size_t i = 0; i < rowPixels; i++)
+                {
+                    unsigned char chIn = *(pIn++);
+                    *(pOut++)          = chIn;
+                    *(pOut++)          = chIn;
+                    *(pOut++)          = chIn;
+                    *(pOut++)          = 255;
+                }
+            }
+            else if (components == 3)
+            {
+                // RGB image: set alpha to the maximum value.
+                for (size_t i = 0; i < rowPixels; i++)
+                {
+                    *(pOut++) = *(pIn++);
+                    *(pOut++) = *(pIn++);
+                    *(pOut++) = *(pIn++);
+                    *(pOut++) = 255;
+                }
+            }
+            else
+            {
+                // Just copy directly if the image already has RGBA components.
+                memcpy(pOut, pIn, rowPixels * 4);
             }
-        }
-        else if (components == 4)
-        {
-            // Just copy directly if the image already has RGBA components.
-            memcpy(pImageOut->pixels.get(), pPixels, sizeBytes);
-        }
-        else
-        {
-            // Fail if unsupported component count.
-            AU_FAIL("%s invalid number of components %d", filename.c_str(), components);
         }
 
         // Free the pixels allocated by STB.
@@ -277,17 +289,38 @@ AssetManager::AssetManager(
     _loadResourceFunction =
         loadResourceFunction ? loadResourceFunction : defaultLoadResourceFunction;
 
-    // Set the process image callback, use the default (getting the value of flipImageY from
-    // member variable) if argument is null.
+    // Set the process image callback, use the default (getting the values of flipImageY and
+    // halfFloat from member variables) if argument is null.
     if (processImageFunction)
         _processImageFunction = processImageFunction;
     else
         _processImageFunction = [this](const vector<unsigned char>& buffer, const string& filename,
                                     ImageAsset* pImageOut) {
-            return defaultProcessImageFunction(buffer, filename, pImageOut, _flipImageY);
+            return defaultProcessImageFunction(
+                buffer, filename, pImageOut, _flipImageY, _halfFloatImages);
         };
 }
 
+AssetManager::~AssetManager()
+{
+    // Stop the background loading threads, abandoning the images that have not started loading.
+    deque<ImageRequest> abandonedRequests;
+    {
+        lock_guard<mutex> lock(_imageRequestMutex);
+        _isStopping = true;
+        abandonedRequests.swap(_imageRequests);
+    }
+    _imageRequestCondition.notify_all();
+    for (thread& loaderThread : _imageLoaderThreads)
+    {
+        loaderThread.join();
+    }
+    for (ImageRequest& request : abandonedRequests)
+    {
+        request.result.set_value(nullptr);
+    }
+}
+
 shared_ptr<string> AssetManager::acquireTextFile(const string& uri)
 {
     // Use callback function to load buffer.
@@ -303,6 +336,8 @@ shared_ptr<string> AssetManager::acquireTextFile(const string& uri)
 
 shared_ptr<ImageAsset> AssetManager::acquireImage(const string& uri)
 {
+    AU_PROFILE("AssetManager::acquireImage");
+
     // Use callback function to load buffer.
     vector<unsigned char> buffer;
     string filename;
@@ -321,4 +356,55 @@ shared_ptr<ImageAsset> AssetManager::acquireImage(const string& uri)
     return pImageData;
 }
 
+ImageAssetFuture AssetManager::acquireImageAsync(const string& uri)
+{
+    // The maximum number of background loading threads. Loading is mostly decoding, so a few
+    // threads are enough to keep ahead of scene construction without competing with rendering.
+    constexpr unsigned int kMaxImageLoaderThreads = 4;
+
+    ImageRequest request;
+    request.uri             = uri;
+    ImageAssetFuture result = request.result.get_future().share();
+    {
+        lock_guard<mutex> lock(_imageRequestMutex);
+        _imageRequests.push_back(std::move(request));
+
+        // Start the background loading threads, if they have not been started yet.
+        if (_imageLoaderThreads.empty())
+        {
+            unsigned int threadCount =
+                std::clamp(thread::hardware_concurrency(), 1u, kMaxImageLoaderThreads);
+            for (unsigned int i = 0; i < threadCount; i++)
+            {
+                _imageLoaderThreads.emplace_back(&AssetManager::runImageLoader, this);
+            }
+        }
+    }
+    _imageRequestCondition.notify_one();
+
+    return result;
+}
+
+void AssetManager::runImageLoader()
+{
+    while (true)
+    {
+        // Wait for the next requested image, or for the threads to be stopped.
+        ImageRequest request;
+        {
+            unique_lock<mutex> lock(_imageRequestMutex);
+            _imageRequestCondition.wait(
+                lock, [this]() { return _isStopping || !_imageRequests.empty(); });
+            if (_isStopping)
+                return;
+
+            request = std::move(_imageRequests.front());
+            _imageRequests.pop_front();
+        }
+
+        // Load the image, and complete the future with it.
+        request.result.set_value(acquireImage(request.uri));
+    }
+}
+
 END_AURORA
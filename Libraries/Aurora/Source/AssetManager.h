@@ -13,6 +13,8 @@
 // limitations under the License.
 #pragma once
 
+#include "TextureCompressor.h"
+
 BEGIN_AURORA
 
 /// Image asset loaded by AssetManager::acquireImage.
@@ -39,6 +41,10 @@ struct ImageAsset
 using ProcessImageFunction = function<bool(
     const vector<unsigned char>& buffer, const string& filename, ImageAsset* pImageOut)>;
 
+/// A future for an image asset loaded in the background by AssetManager::acquireImageAsync, which
+/// has a null asset if loading failed.
+using ImageAssetFuture = shared_future<shared_ptr<ImageAsset>>;
+
 /// Asset manager class, used to load and cache external asset files.
 class AssetManager
 {
@@ -50,6 +56,10 @@ public:
     AssetManager(LoadResourceFunction loadResourceFunction = nullptr,
         ProcessImageFunction processImageFunction          = nullptr);
 
+    /// Destructor, which stops the background loading threads. Images that have not started
+    /// loading are abandoned, with a null asset.
+    ~AssetManager();
+
     /// Load a new text file from a Universal Resource Identifier(URI) string, or return existing
     /// one if already loaded.
     shared_ptr<string> acquireTextFile(const string& uri);
@@ -58,11 +68,29 @@ public:
     /// one if already loaded.
     shared_ptr<ImageAsset> acquireImage(const string& uri);
 
+    /// Start loading an image from a Universal Resource Identifier(URI) string on a background
+    /// thread, and return a future for the loaded image. Images are loaded in the order they are
+    /// requested, by a small pool of threads, so that their decoding overlaps with other work such
+    /// as scene construction.
+    ///
+    /// \note The load resource and process image functions are called on the background threads,
+    /// so they must be thread-safe.
+    ImageAssetFuture acquireImageAsync(const string& uri);
+
     /// Set the global flag to enable flipping images vertically in the default image decoding
     /// function
     /// \param enabled If true image rows loaded bottom-to-top.
     void enableVerticalFlipOnImageLoad(bool enabled) { _flipImageY = enabled; }
 
+    /// Set the global flag to store float (HDR) images as half floats in the default image decoding
+    /// function, which halves the memory required for those images.
+    /// \param enabled If true float images are loaded with the Half_RGBA format.
+    void enableHalfFloatImages(bool enabled) { _halfFloatImages = enabled; }
+
+    /// Gets the texture compressor, used to compress images when they are created, with a
+    /// persistent cache of the compressed images.
+    TextureCompressor& textureCompressor() { return _textureCompressor; }
+
     /// Set the callback function used to load all resources from a provided URI.
     ///
     /// \param The callback function to used for all resource loading.
@@ -72,8 +100,31 @@ protected:
     // Flipped vertically defaults to true, this matches traditional Aurora.
     bool _flipImageY = true;
 
+    // Float images are stored at full precision by default.
+    bool _halfFloatImages = false;
+
     LoadResourceFunction _loadResourceFunction;
     ProcessImageFunction _processImageFunction;
+    TextureCompressor _textureCompressor;
+
+private:
+    // An image waiting to be loaded by a background thread.
+    struct ImageRequest
+    {
+        string uri;
+        promise<shared_ptr<ImageAsset>> result;
+    };
+
+    // Runs a background loading thread, which loads requested images until it is stopped.
+    void runImageLoader();
+
+    // The requested images and the background loading threads, which are started when the first
+    // image is requested.
+    mutex _imageRequestMutex;
+    condition_variable _imageRequestCondition;
+    deque<ImageRequest> _imageRequests;
+    vector<thread> _imageLoaderThreads;
+    bool _isStopping = false;
 };
 
 END_AURORA
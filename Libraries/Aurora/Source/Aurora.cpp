@@ -28,6 +28,11 @@ Foundation::Log& logger()
     return Foundation::Log::logger();
 }
 
+Foundation::Profiler& profiler()
+{
+    return Foundation::Profiler::profiler();
+}
+
 IRendererPtr createRenderer(IRenderer::Backend type, [[maybe_unused]] uint32_t taskCount)
 {
     RendererBasePtr pRenderer;
@@ -59,11 +59,21 @@ const string Names::SamplerProperties::kAddressModeU("AddressModeU");
 const string Names::SamplerProperties::kAddressModeV("AddressModeV");
 
 const string Names::LightTypes::kDistantLight("DistantLight");
+const string Names::LightTypes::kPointLight("PointLight");
+const string Names::LightTypes::kSpotLight("SpotLight");
+const string Names::LightTypes::kRectLight("RectLight");
 
 const std::string Names::LightProperties::kDirection       = "direction";
 const std::string Names::LightProperties::kAngularDiameter = "angular_diameter_radians";
 const std::string Names::LightProperties::kExposure        = "exposure";
 const std::string Names::LightProperties::kIntensity       = "intensity";
 const std::string Names::LightProperties::kColor           = "color";
+const std::string Names::LightProperties::kPosition        = "position";
+const std::string Names::LightProperties::kRadius          = "radius";
+const std::string Names::LightProperties::kConeAngle       = "cone_angle_radians";
+const std::string Names::LightProperties::kConeSoftness    = "cone_softness";
+const std::string Names::LightProperties::kTangent         = "tangent";
+const std::string Names::LightProperties::kWidth           = "width";
+const std::string Names::LightProperties::kHeight          = "height";
 
 END_AURORA
@@ -0,0 +1,314 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include <thread>
+
+// Select the SIMD instruction set for pixel operations.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CPU_DENOISER_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CPU_DENOISER_NEON 1
+#include <arm_neon.h>
+#endif
+
+BEGIN_AURORA
+
+namespace
+{
+
+// The minimum number of rows processed by each thread, so that small images are not split into
+// more work than is worthwhile.
+constexpr uint32_t kMinRowsPerThread = 16;
+
+// The smallest albedo value used when dividing color by albedo, to avoid amplifying noise where the
+// albedo is black.
+constexpr float kMinAlbedo = 0.01f;
+
+// The 1D B3 spline kernel used by the a-trous filter. The 2D kernel is the outer product.
+constexpr float kKernel[5] = { 1.0f / 16.0f, 1.0f / 4.0f, 3.0f / 8.0f, 1.0f / 4.0f, 1.0f / 16.0f };
+
+// A four component vector of floats (e.g. an RGBA pixel), which uses a SIMD register if possible.
+struct Float4
+{
+#if defined(CPU_DENOISER_SSE2)
+    __m128 v;
+
+    static Float4 load(const float* p) { return { _mm_loadu_ps(p) }; }
+    static Float4 splat(float s) { return { _mm_set1_ps(s) }; }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+    Float4 operator+(const Float4& o) const { return { _mm_add_ps(v, o.v) }; }
+    Float4 operator-(const Float4& o) const { return { _mm_sub_ps(v, o.v) }; }
+    Float4 operator*(const Float4& o) const { return { _mm_mul_ps(v, o.v) }; }
+    Float4 operator/(const Float4& o) const { return { _mm_div_ps(v, o.v) }; }
+    Float4 max(const Float4& o) const { return { _mm_max_ps(v, o.v) }; }
+
+    // Returns the squared length of the first three components.
+    float lengthSquared3() const
+    {
+        __m128 squared = _mm_mul_ps(v, v);
+        __m128 y       = _mm_shuffle_ps(squared, squared, _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 z       = _mm_shuffle_ps(squared, squared, _MM_SHUFFLE(2, 2, 2, 2));
+
+        return _mm_cvtss_f32(_mm_add_ss(_mm_add_ss(squared, y), z));
+    }
+#elif defined(CPU_DENOISER_NEON)
+    float32x4_t v;
+
+    static Float4 load(const float* p) { return { vld1q_f32(p) }; }
+    static Float4 splat(float s) { return { vdupq_n_f32(s) }; }
+    void store(float* p) const { vst1q_f32(p, v); }
+    Float4 operator+(const Float4& o) const { return { vaddq_f32(v, o.v) }; }
+    Float4 operator-(const Float4& o) const { return { vsubq_f32(v, o.v) }; }
+    Float4 operator*(const Float4& o) const { return { vmulq_f32(v, o.v) }; }
+    Float4 operator/(const Float4& o) const { return { vdivq_f32(v, o.v) }; }
+    Float4 max(const Float4& o) const { return { vmaxq_f32(v, o.v) }; }
+
+    // Returns the squared length of the first three components.
+    float lengthSquared3() const
+    {
+        float32x4_t squared = vmulq_f32(v, v);
+
+        return vgetq_lane_f32(squared, 0) + vgetq_lane_f32(squared, 1) +
+            vgetq_lane_f32(squared, 2);
+    }
+#else
+    float v[4];
+
+    static Float4 load(const float* p) { return { { p[0], p[1], p[2], p[3] } }; }
+    static Float4 splat(float s) { return { { s, s, s, s } }; }
+    void store(float* p) const { std::copy(v, v + 4, p); }
+    Float4 operator+(const Float4& o) const
+    {
+        return { { v[0] + o.v[0], v[1] + o.v[1], v[2] + o.v[2], v[3] + o.v[3] } };
+    }
+    Float4 operator-(const Float4& o) const
+    {
+        return { { v[0] - o.v[0], v[1] - o.v[1], v[2] - o.v[2], v[3] - o.v[3] } };
+    }
+    Float4 operator*(const Float4& o) const
+    {
+        return { { v[0] * o.v[0], v[1] * o.v[1], v[2] * o.v[2], v[3] * o.v[3] } };
+    }
+    Float4 operator/(const Float4& o) const
+    {
+        return { { v[0] / o.v[0], v[1] / o.v[1], v[2] / o.v[2], v[3] / o.v[3] } };
+    }
+    Float4 max(const Float4& o) const
+    {
+        return { { std::max(v[0], o.v[0]), std::max(v[1], o.v[1]), std::max(v[2], o.v[2]),
+            std::max(v[3], o.v[3]) } };
+    }
+
+    // Returns the squared length of the first three components.
+    float lengthSquared3() const { return v[0] * v[0] + v[1] * v[1] + v[2] * v[2]; }
+#endif
+};
+
+// The denoiser for a single image, which holds the intermediate images.
+class CPUDenoiser
+{
+public:
+    CPUDenoiser(const DenoiserImages& images, const DenoiserOptions& options) :
+        _images(images),
+        _options(options),
+        _width(images.width),
+        _height(images.height),
+        _pixelCount(static_cast<size_t>(images.width) * images.height)
+    {
+        // Use all hardware threads by default.
+        _threadCount =
+            options.threadCount > 0 ? options.threadCount : std::thread::hardware_concurrency();
+        _threadCount = std::max(_threadCount, 1u);
+    }
+
+    void run()
+    {
+        // Copy the color image, dividing it by the albedo if there is one.
+        _color[0].resize(_pixelCount * 4);
+        _color[1].resize(_pixelCount * 4);
+        _toneMapped.resize(_pixelCount * 4);
+        parallelForRows([this](size_t begin, size_t end) {
+            for (size_t i = begin * _width; i < end * _width; i++)
+            {
+                Float4 color = Float4::load(_images.pColor + i * 4);
+                if (_images.pAlbedo)
+                {
+                    color = color / albedo(i);
+                }
+                color.store(&_color[0][i * 4]);
+            }
+        });
+
+        // Run the filter iterations, with the filter radius doubling and the color sigma halving
+        // with each iteration. The result of each iteration is the input to the next.
+        float colorSigma = _options.colorSigma;
+        for (uint32_t iteration = 0; iteration < _options.iterationCount; iteration++)
+        {
+            const float* pInput = _color[iteration % 2].data();
+            float* pOutput      = _color[(iteration + 1) % 2].data();
+            int step            = 1 << iteration;
+            float colorScale    = 1.0f / std::max(colorSigma * colorSigma, 1.0e-8f);
+            parallelForRows([&](size_t begin, size_t end) { toneMap(pInput, begin, end); });
+            parallelForRows([&](size_t begin, size_t end) {
+                filterRows(pInput, pOutput, step, colorScale, begin, end);
+            });
+            colorSigma *= 0.5f;
+        }
+        const float* pResult = _color[_options.iterationCount % 2].data();
+
+        // Write the result, multiplying it by the albedo if there is one.
+        parallelForRows([&](size_t begin, size_t end) {
+            for (size_t i = begin * _width; i < end * _width; i++)
+            {
+                Float4 color = Float4::load(pResult + i * 4);
+                if (_images.pAlbedo)
+                {
+                    color = color * albedo(i);
+                }
+                color.store(_images.pOutput + i * 4);
+            }
+        });
+    }
+
+private:
+    // Runs a function on ranges of rows of the images in parallel.
+    void parallelForRows(const function<void(size_t, size_t)>& func) const
+    {
+        Foundation::parallelForRanges(_height, _threadCount, func, kMinRowsPerThread);
+    }
+
+    // Returns the albedo of the specified pixel, limited to the minimum albedo.
+    Float4 albedo(size_t index) const
+    {
+        return Float4::load(_images.pAlbedo + index * 4).max(Float4::splat(kMinAlbedo));
+    }
+
+    // Tone maps the specified rows of the color image, so that color differences are in a
+    // consistent range for the edge-stopping function, regardless of the dynamic range.
+    void toneMap(const float* pInput, size_t begin, size_t end)
+    {
+        const Float4 kOne = Float4::splat(1.0f);
+        for (size_t i = begin * _width; i < end * _width; i++)
+        {
+            Float4 color = Float4::load(pInput + i * 4).max(Float4::splat(0.0f));
+            (color / (color + kOne)).store(&_toneMapped[i * 4]);
+        }
+    }
+
+    // Applies one iteration of the a-trous filter to the specified rows, with the specified
+    // spacing between the filter taps.
+    void filterRows(const float* pInput, float* pOutput, int step, float colorScale,
+        size_t begin, size_t end) const
+    {
+        const float normalScale = 1.0f / (_options.normalSigma * _options.normalSigma);
+        const float albedoScale = 1.0f / (_options.albedoSigma * _options.albedoSigma);
+        const float depthScale  = 1.0f / _options.depthSigma;
+        const int width         = static_cast<int>(_width);
+        const int height        = static_cast<int>(_height);
+
+        for (int y = static_cast<int>(begin); y < static_cast<int>(end); y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                // Load the guide values for the center pixel.
+                size_t center       = static_cast<size_t>(y) * width + x;
+                Float4 centerTone   = Float4::load(&_toneMapped[center * 4]);
+                Float4 centerNormal = Float4::splat(0.0f);
+                Float4 centerAlbedo = Float4::splat(0.0f);
+                float centerDepth   = 0.0f;
+                float depthFactor   = 0.0f;
+                if (_images.pNormal)
+                    centerNormal = Float4::load(_images.pNormal + center * 4);
+                if (_images.pAlbedo)
+                    centerAlbedo = Float4::load(_images.pAlbedo + center * 4);
+                if (_images.pDepth)
+                {
+                    centerDepth = _images.pDepth[center];
+                    depthFactor = depthScale / std::max(std::abs(centerDepth), 1.0e-3f);
+                }
+
+                // Accumulate the weighted color of the 5x5 taps, skipping any outside the image.
+                Float4 sum      = Float4::splat(0.0f);
+                float weightSum = 0.0f;
+                for (int j = 0; j < 5; j++)
+                {
+                    int tapY = y + (j - 2) * step;
+                    if (tapY < 0 || tapY >= height)
+                        continue;
+                    for (int i = 0; i < 5; i++)
+                    {
+                        int tapX = x + (i - 2) * step;
+                        if (tapX < 0 || tapX >= width)
+                            continue;
+                        size_t tap = static_cast<size_t>(tapY) * width + tapX;
+
+                        // Compute the edge-stopping weight from the differences with the center
+                        // pixel, combined into a single exponential.
+                        float exponent =
+                            (Float4::load(&_toneMapped[tap * 4]) - centerTone).lengthSquared3() *
+                            colorScale;
+                        if (_images.pNormal)
+                        {
+                            Float4 normal = Float4::load(_images.pNormal + tap * 4);
+                            exponent += (normal - centerNormal).lengthSquared3() * normalScale;
+                        }
+                        if (_images.pAlbedo)
+                        {
+                            Float4 albedo = Float4::load(_images.pAlbedo + tap * 4);
+                            exponent += (albedo - centerAlbedo).lengthSquared3() * albedoScale;
+                        }
+                        if (_images.pDepth)
+                        {
+                            exponent += std::abs(_images.pDepth[tap] - centerDepth) * depthFactor;
+                        }
+                        float weight = kKernel[i] * kKernel[j] * std::exp(-exponent);
+
+                        sum = sum + Float4::load(pInput + tap * 4) * Float4::splat(weight);
+                        weightSum += weight;
+                    }
+                }
+
+                // Normalize the result. The center tap always has a weight greater than zero.
+                (sum / Float4::splat(weightSum)).store(pOutput + center * 4);
+            }
+        }
+    }
+
+    const DenoiserImages& _images;
+    const DenoiserOptions& _options;
+    uint32_t _width       = 0;
+    uint32_t _height      = 0;
+    size_t _pixelCount    = 0;
+    uint32_t _threadCount = 1;
+    vector<float> _color[2];
+    vector<float> _toneMapped;
+};
+
+} // namespace
+
+void denoiseImage(const DenoiserImages& images, const DenoiserOptions& options)
+{
+    AU_PROFILE("Denoise image (CPU)");
+
+    AU_ASSERT(images.pColor && images.pOutput, "Color and output images are required.");
+    if (images.width == 0 || images.height == 0)
+        return;
+
+    CPUDenoiser denoiser(images, options);
+    denoiser.run();
+}
+
+END_AURORA
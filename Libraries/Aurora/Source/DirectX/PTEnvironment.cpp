@@ -75,4 +75,9 @@ void PTEnvironment::createDescriptors(CD3DX12_CPU_DESCRIPTOR_HANDLE& handle, UIN
     handle.Offset(increment);
 }
 
+void PTEnvironment::addMemoryUsage(MemoryStatistics& statistics) const
+{
+    statistics.resources[ResourceType::Environment].deviceBytes += _constantBuffer.size;
+}
+
 END_AURORA
\ No newline at end of file
@@ -40,6 +40,7 @@ public:
     ID3D12Resource* buffer() const { return _constantBuffer.pGPUBuffer.Get(); }
     ID3D12Resource* aliasMap() const;
     bool update();
+    void addMemoryUsage(MemoryStatistics& statistics) const override;
     void createDescriptors(CD3DX12_CPU_DESCRIPTOR_HANDLE& handle, UINT increment) const;
 
 private:
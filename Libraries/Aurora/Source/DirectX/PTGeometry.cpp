@@ -220,4 +220,19 @@ ID3D12ResourcePtr PTGeometry::buildBLAS()
     return pBLAS;
 }
 
+void PTGeometry::addMemoryUsage(MemoryStatistics& statistics) const
+{
+    GeometryBase::addMemoryUsage(statistics);
+
+    // The vertex buffers are sub-allocated from the vertex buffer pool, so only their own sizes
+    // are included.
+    size_t deviceBytes = _indexBuffer.size() + _positionBuffer.size() + _normalBuffer.size() +
+        _tangentBuffer.size() + _texCoordBuffer.size();
+    if (_pBLAS)
+    {
+        deviceBytes += _pBLAS->GetDesc().Width;
+    }
+    statistics.resources[ResourceType::Geometry].deviceBytes += deviceBytes;
+}
+
 END_AURORA
@@ -33,7 +33,7 @@ public:
     {
         return _pGPUBuffer ? _pGPUBuffer->GetGPUVirtualAddress() + _offset : 0;
     }
-    size_t size() { return _size; }
+    size_t size() const { return _size; }
 
 private:
     ID3D12ResourcePtr _pGPUBuffer;
@@ -76,6 +76,7 @@ public:
     ID3D12Resource* blas() { return _pBLAS.Get(); }
     bool update();
     bool updateBLAS();
+    void addMemoryUsage(MemoryStatistics& statistics) const override;
 
 private:
     /*** Private Functions ***/
@@ -17,6 +17,7 @@
 #include "PTImage.h"
 
 #include "PTRenderer.h"
+#include "TextureCompressor.h"
 
 BEGIN_AURORA
 
@@ -46,8 +47,8 @@ PTImage::PTImage(PTRenderer* pRenderer, const IImage::InitData& initData)
 
         // Build the alias map directly in the mapped buffer.
         AliasMap::Entry* pMappedData = reinterpret_cast<AliasMap::Entry*>(transferBuffer.map());
-        AliasMap::build(static_cast<const float*>(initData.pImageData), _dimensions, pMappedData,
-            bufferSize, _luminanceIntegral);
+        AliasMap::build(initData.pImageData, initData.format, _dimensions, pMappedData, bufferSize,
+            _luminanceIntegral);
         transferBuffer.unmap();
 
         // Retain the GPU buffer pointer from the transfer buffer (upload buffer will be deleted
@@ -56,7 +57,8 @@ PTImage::PTImage(PTRenderer* pRenderer, const IImage::InitData& initData)
     }
 }
 
-// Gets the number of bytes per pixel for the specified IImage format.
+// Gets the number of bytes per pixel for the specified IImage format. This is zero for block
+// compressed formats, which are not a whole number of bytes per pixel.
 size_t PTImage::getBytesPerPixel(ImageFormat format)
 {
     switch (format)
@@ -77,6 +79,11 @@ size_t PTImage::getBytesPerPixel(ImageFormat format)
         return 8;
     case ImageFormat::Byte_R:
         return 1;
+    case ImageFormat::BC1_RGBA:
+    case ImageFormat::BC4_R:
+    case ImageFormat::BC5_RG:
+    case ImageFormat::BC7_RGBA:
+        return 0;
     }
 
     return 0;
@@ -105,6 +112,14 @@ DXGI_FORMAT PTImage::getDXFormat(ImageFormat format, bool linearize)
         return DXGI_FORMAT_R32G32_UINT;
     case ImageFormat::Byte_R:
         return DXGI_FORMAT_R8_UNORM;
+    case ImageFormat::BC1_RGBA:
+        return linearize ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC1_UNORM;
+    case ImageFormat::BC4_R:
+        return DXGI_FORMAT_BC4_UNORM;
+    case ImageFormat::BC5_RG:
+        return DXGI_FORMAT_BC5_UNORM;
+    case ImageFormat::BC7_RGBA:
+        return linearize ? DXGI_FORMAT_BC7_UNORM_SRGB : DXGI_FORMAT_BC7_UNORM;
     }
 
     return DXGI_FORMAT_UNKNOWN;
@@ -148,6 +163,15 @@ void PTImage::initResource(const void* pImageData)
     textureData.RowPitch               = getBytesPerPixel(_format) * _dimensions.x;
     textureData.SlicePitch             = textureData.RowPitch * _dimensions.y;
 
+    // Block compressed images are uploaded as rows of 4x4 blocks.
+    if (isCompressedImageFormat(_format))
+    {
+        Foundation::BlockFormat format = blockFormat(_format);
+        textureData.RowPitch           = Foundation::compressedRowPitch(format, _dimensions.x);
+        textureData.SlicePitch =
+            Foundation::compressedImageSize(format, _dimensions.x, _dimensions.y);
+    }
+
     // Copy the temporary buffer data to the texture using a command list.
     ID3D12GraphicsCommandList4Ptr pCommandList = _pRenderer->beginCommandList();
     ::UpdateSubresources(
@@ -163,4 +187,24 @@ void PTImage::initResource(const void* pImageData)
     _pRenderer->waitForTask();
 }
 
+void PTImage::addMemoryUsage(MemoryStatistics& statistics) const
+{
+    // Get the size of the texture as allocated by the device, which includes any padding and
+    // the layout of compressed formats.
+    if (_pTexture)
+    {
+        D3D12_RESOURCE_DESC desc = _pTexture->GetDesc();
+        statistics.resources[ResourceType::Image].deviceBytes +=
+            _pRenderer->dxDevice()->GetResourceAllocationInfo(0, 1, &desc).SizeInBytes;
+    }
+
+    // The alias map is only created for images that represent an environment.
+    if (_pAliasMapBuffer)
+    {
+        statistics.aliasMaps.count++;
+        statistics.aliasMaps.activeCount++;
+        statistics.aliasMaps.deviceBytes += _pAliasMapBuffer->GetDesc().Width;
+    }
+}
+
 END_AURORA
@@ -55,6 +55,8 @@ public:
     // environment.
     float luminanceIntegral() { return _luminanceIntegral; }
 
+    void addMemoryUsage(MemoryStatistics& statistics) const override;
+
 private:
     /*** Private Functions ***/
 
@@ -13,7 +13,7 @@
 // limitations under the License.
 #pragma once
 
-#include "Properties.h"
+#include "LightBase.h"
 
 BEGIN_AURORA
 
@@ -21,7 +21,7 @@ BEGIN_AURORA
 class PTScene;
 
 // An internal implementation for ILight.
-class PTLight : public ILight, public FixedValues
+class PTLight : public LightBase
 {
 public:
     /*** Lifetime Management ***/
@@ -29,19 +29,10 @@ public:
     PTLight(PTScene* pScene, const string& lightType, int index);
     ~PTLight() {};
 
-    /*** Functions ***/
-    FixedValues& values() override { return *this; }
-
-    int index() const { return _index; }
-
-    bool isDirty() const { return _bIsDirty; }
-    void clearDirtyFlag() { _bIsDirty = false; }
-
 private:
     /*** Private Variables ***/
 
     PTScene* _pScene = nullptr;
-    int _index;
 };
 
 MAKE_AURORA_PTR(PTLight);
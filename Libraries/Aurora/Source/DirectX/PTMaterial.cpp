@@ -22,8 +22,8 @@
 BEGIN_AURORA
 
 PTMaterial::PTMaterial(PTRenderer* pRenderer, const string& name, MaterialShaderPtr pShader,
-    shared_ptr<MaterialDefinition> pDef) :
-    MaterialBase(name, pShader, pDef), _pRenderer(pRenderer)
+    shared_ptr<MaterialDefinition> pDef, shared_ptr<UniformArena> pArena, size_t headerSize) :
+    MaterialBase(name, pShader, pDef, pArena, headerSize), _pRenderer(pRenderer)
 {
 }
 
@@ -38,21 +38,18 @@ bool PTMaterial::update()
     // Run the type-specific update function on this material.
     definition()->updateFunction()(*this);
 
-    // Create a transfer buffer for the material data if it doesn't already exist.
-    if (!_constantBuffer.size)
-    {
-        _constantBuffer = _pRenderer->createTransferBuffer(
-            uniformBuffer().size(), std::to_string(uint64_t(this)) + "MaterialBuffer");
-    }
-
-    // Copy the data to the transfer buffer.
-    void* pMappedData = _constantBuffer.map(uniformBuffer().size());
-    ::memcpy_s(pMappedData, uniformBuffer().size(), uniformBuffer().data(), uniformBuffer().size());
-    _constantBuffer.unmap();
+    // NOTE: The uniform buffer is stored in the renderer's material arena, and the scene uploads
+    // the changed parts of the arena to the global material buffer.
 
     _bIsDirty = false;
 
     return true;
 }
 
+void PTMaterial::addMemoryUsage(MemoryStatistics& statistics) const
+{
+    MaterialBase::addMemoryUsage(statistics);
+    statistics.resources[ResourceType::Material].deviceBytes += arenaSize();
+}
+
 END_AURORA
@@ -42,15 +42,13 @@ public:
     /*** Lifetime Management ***/
 
     PTMaterial(PTRenderer* pRenderer, const string& name, MaterialShaderPtr pShader,
-        shared_ptr<MaterialDefinition> pDef);
+        shared_ptr<MaterialDefinition> pDef, shared_ptr<UniformArena> pArena, size_t headerSize);
     ~PTMaterial() {};
 
     /*** Functions ***/
 
-    // Gets the constant buffer for this material.
-    ID3D12Resource* buffer() const { return _constantBuffer.pGPUBuffer.Get(); }
-
     bool update();
+    void addMemoryUsage(MemoryStatistics& statistics) const override;
 
 private:
     /*** Private Types ***/
@@ -62,7 +60,6 @@ private:
     /*** Private Variables ***/
 
     PTRenderer* _pRenderer = nullptr;
-    TransferBuffer _constantBuffer;
 };
 MAKE_AURORA_PTR(PTMaterial);
 
@@ -28,6 +28,7 @@
 #include "PTMaterial.h"
 #include "PTScene.h"
 #include "PTShaderLibrary.h"
+#include "SampleSequence.h"
 
 #if ENABLE_MATERIALX
 #include "MaterialX/MaterialGenerator.h"
@@ -76,6 +77,9 @@ PTRenderer::PTRenderer(uint32_t taskCount) : RendererBase(taskCount)
     // Initialize a per-frame data buffer.
     initFrameData();
 
+    // Initialize the blue-noise mask, used by the blue-noise sampler.
+    initBlueNoise();
+
     // Initialize the shader table.
     initRayGenShaderTable();
 
@@ -128,6 +132,23 @@ IImagePtr PTRenderer::createImagePointer(const IImage::InitData& initData)
     return make_shared<PTImage>(this, initData);
 }
 
+bool PTRenderer::isCompressedImageFormatSupported(ImageFormat format, bool linearize) const
+{
+    // All the block compressed formats are supported by DirectX 12 devices, but BC4 and BC5 have
+    // no sRGB variants.
+    switch (format)
+    {
+    case ImageFormat::BC1_RGBA:
+    case ImageFormat::BC7_RGBA:
+        return true;
+    case ImageFormat::BC4_R:
+    case ImageFormat::BC5_RG:
+        return !linearize;
+    default:
+        return false;
+    }
+}
+
 ISamplerPtr PTRenderer::createSamplerPointer(const Properties& props)
 {
     // Create a return a new sampler object.
@@ -273,6 +294,22 @@ void PTRenderer::setLoadResourceFunction(LoadResourceFunction func)
     _pAssetMgr->setLoadResourceFunction(func);
 }
 
+MemoryStatistics PTRenderer::memoryStatistics()
+{
+    MemoryStatistics statistics = RendererBase::memoryStatistics();
+
+    // Count the transpiler sessions of the shader library, which belongs to the scene. Their
+    // memory is allocated by the transpiler, so it can't be measured here.
+    if (_pScene)
+    {
+        size_t transpilerCount                    = shaderLibrary().transpilerCount();
+        statistics.transpilerSessions.count       = transpilerCount;
+        statistics.transpilerSessions.activeCount = transpilerCount;
+    }
+
+    return statistics;
+}
+
 ID3D12ResourcePtr PTRenderer::createBuffer(size_t size, const string& name,
     D3D12_HEAP_TYPE heapType, D3D12_RESOURCE_FLAGS flags, D3D12_RESOURCE_STATES state)
 {
@@ -633,6 +670,19 @@ void PTRenderer::initFrameData()
     _frameDataBuffer           = createTransferBuffer(frameDataBufferSize, "FrameData");
 }
 
+void PTRenderer::initBlueNoise()
+{
+    // Create a buffer with the blue-noise mask, which is generated once and never changes.
+    vector<vec2> blueNoise = SampleSequence::buildBlueNoise(SampleSequence::kBlueNoiseSize, 0);
+
+    // Copy the mask to the buffer.
+    size_t blueNoiseBufferSize = sizeof(vec2) * blueNoise.size();
+    _blueNoiseBuffer           = createTransferBuffer(blueNoiseBufferSize, "BlueNoise");
+    uint8_t* pBlueNoiseData    = _blueNoiseBuffer.map(blueNoiseBufferSize);
+    ::memcpy_s(pBlueNoiseData, _blueNoiseBuffer.size, blueNoise.data(), blueNoiseBufferSize);
+    _blueNoiseBuffer.unmap();
+}
+
 void PTRenderer::initRayGenShaderTable()
 {
     // Compute the stride of each record in the shader table. The stride includes the shader
@@ -834,7 +884,7 @@ void PTRenderer::renderInternal(uint32_t sampleStart, uint32_t sampleCount)
 void PTRenderer::updateFrameData()
 {
     // Call base-class update function to get GPU frame data.
-    updateFrameDataGPUStruct();
+    updateFrameDataGPUStruct(_outputDimensions);
 
     // Get other options. Limit the trace depth to the range [1, kMaxTraceDepth].
     // TODO: Should be in base class too.
@@ -1094,9 +1144,10 @@ void PTRenderer::updateDenoisingResources()
 
 void PTRenderer::prepareRayDispatch(D3D12_DISPATCH_RAYS_DESC& dispatchRaysDesc)
 {
-    // Prepare a ray dispatch description, including the dimensions...
-    dispatchRaysDesc.Width  = _outputDimensions.x;
-    dispatchRaysDesc.Height = _outputDimensions.y;
+    // Prepare a ray dispatch description, including the dimensions of the rendered region...
+    PixelRegion region      = _renderRegion.clip(_outputDimensions);
+    dispatchRaysDesc.Width  = region.width;
+    dispatchRaysDesc.Height = region.height;
     dispatchRaysDesc.Depth  = 1;
 
     // ... the shader table for the ray generation shader...
@@ -1213,6 +1264,18 @@ void PTRenderer::submitRayDispatch(
         CD3DX12_GPU_DESCRIPTOR_HANDLE samplerHandle(
             _pSamplerDescriptorHeap->GetGPUDescriptorHandleForHeapStart());
         pCommandList->SetComputeRootDescriptorTable(13, samplerHandle);
+
+        // 14) The local light buffer
+        pCommandList->SetComputeRootShaderResourceView(
+            14, dxScene()->localLightBuffer().pGPUBuffer->GetGPUVirtualAddress());
+
+        // 15) The light tree buffer
+        pCommandList->SetComputeRootShaderResourceView(
+            15, dxScene()->lightTreeBuffer().pGPUBuffer->GetGPUVirtualAddress());
+
+        // 16) The blue-noise mask
+        pCommandList->SetComputeRootShaderResourceView(
+            16, _blueNoiseBuffer.pGPUBuffer->GetGPUVirtualAddress());
     }
 
     // Launch the ray generation shader with the dispatch, which performs path tracing.
@@ -1265,6 +1328,11 @@ bool PTRenderer::updateAccumulationGPUStruct(uint32_t sampleIndex, Accumulation*
     settings.sampleIndex        = sampleIndex;
     settings.isDenoisingEnabled = _values.asBoolean(kLabelIsDenoisingEnabled) ? 1 : 0;
 
+    // Only accumulate the rendered region of the targets.
+    PixelRegion region    = _renderRegion.clip(_outputDimensions);
+    settings.regionOffset = uvec2(region.x, region.y);
+    settings.regionSize   = uvec2(region.width, region.height);
+
     // If there are no changes compared local CPU copy, then do nothing and return false.
     if (memcmp(&_accumData, &settings, sizeof(Accumulation)) == 0)
         return false; // No changes.
@@ -1304,13 +1372,14 @@ void PTRenderer::submitAccumulation(uint32_t sampleIndex)
     pCommandList->SetComputeRootDescriptorTable(0, handle);
     pCommandList->SetComputeRoot32BitConstants(1, sizeof(Accumulation) / 4, &_accumData, 0);
 
-    // Dispatch the accumulation shader, which performs (optional) deferred shading and merges new
-    // path tracing samples with the previous results.
+    // Dispatch the accumulation shader over the rendered region, which performs (optional)
+    // deferred shading and merges new path tracing samples with the previous results.
     // NOTE: The dispatch is performed with thread group dimensions that provide good occupancy for
     // the current compute shader code. This must match the values in the compute shader.
     constexpr uvec2 kThreadGroupCount(16, 8);
-    pCommandList->Dispatch((_outputDimensions.x + kThreadGroupCount.x - 1) / kThreadGroupCount.x,
-        (_outputDimensions.y + kThreadGroupCount.y - 1) / kThreadGroupCount.y, 1);
+    uvec2 groupCount =
+        RenderRegion::threadGroupCount(_renderRegion.clip(_outputDimensions), kThreadGroupCount);
+    pCommandList->Dispatch(groupCount.x, groupCount.y, 1);
 
     // Submit the command list.
     submitCommandList();
@@ -1319,7 +1388,7 @@ void PTRenderer::submitAccumulation(uint32_t sampleIndex)
 void PTRenderer::submitPostProcessing()
 {
     // Update the post processing GPU struct by calling base class function.
-    updatePostProcessingGPUStruct();
+    updatePostProcessingGPUStruct(_outputDimensions);
 
     // Begin a command list.
     ID3D12GraphicsCommandList4Ptr pCommandList = beginCommandList();
@@ -1343,16 +1412,17 @@ void PTRenderer::submitPostProcessing()
     pCommandList->SetComputeRoot32BitConstants(
         1, sizeof(PostProcessing) / 4, &_postProcessingData, 0);
 
-    // Dispatch the post-processing shader, which tone maps(as needed) the accumulation texture
-    // (HDR) to the final texture (usually SDR).
+    // Dispatch the post-processing shader over the rendered region, which tone maps(as needed) the
+    // accumulation texture (HDR) to the final texture (usually SDR).
     // NOTE: This should be done even if the settings mean no post-processing is performed as there
     // is still an implicit format conversion, from the accumulation texture (UAV) format to the
     // output texture format, e.g. floating-point to integer.
     // NOTE: The dispatch is performed with thread group dimensions that provide good occupancy for
     // the current compute shader code. This must match the values in the compute shader.
     constexpr uvec2 kThreadGroupCount(16, 8);
-    pCommandList->Dispatch((_outputDimensions.x + kThreadGroupCount.x - 1) / kThreadGroupCount.x,
-        (_outputDimensions.y + kThreadGroupCount.y - 1) / kThreadGroupCount.y, 1);
+    uvec2 groupCount =
+        RenderRegion::threadGroupCount(_renderRegion.clip(_outputDimensions), kThreadGroupCount);
+    pCommandList->Dispatch(groupCount.x, groupCount.y, 1);
 
     // Copy the output textures to their associated targets, if any.
     copyTextureToTarget(_pTexFinal.Get(), _pTargetFinal.get());
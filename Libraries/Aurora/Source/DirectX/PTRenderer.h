@@ -76,6 +76,12 @@ public:
     void waitForTask() override;
     const vector<string>& builtInMaterials() override;
     void setLoadResourceFunction(LoadResourceFunction func) override;
+    MemoryStatistics memoryStatistics() override;
+
+    /*** RendererBase Functions ***/
+
+    bool isCompressedImageFormatSupported(ImageFormat format, bool linearize) const override;
+    bool isRenderRegionSupported() const override { return true; }
 
     /*** Functions ***/
 
@@ -119,6 +125,8 @@ private:
     {
         unsigned int sampleIndex;
         unsigned int isDenoisingEnabled;
+        uvec2 regionOffset;
+        uvec2 regionSize;
     };
 
     /*** Private Types ***/
@@ -130,6 +138,7 @@ private:
     bool initDevice();
     void initCommandList();
     void initFrameData();
+    void initBlueNoise();
     void initRayGenShaderTable();
     void initAccumulation();
     void initPostProcessing();
@@ -157,6 +166,7 @@ private:
     unique_ptr<PTDevice> _pDevice;
     bool _isCommandListOpen = false;
     TransferBuffer _frameDataBuffer;
+    TransferBuffer _blueNoiseBuffer;
     PTEnvironmentPtr _pEnvironment;
     uvec2 _outputDimensions;
     bool _isDimensionsChanged = true;
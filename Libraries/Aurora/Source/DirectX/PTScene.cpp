@@ -256,7 +256,11 @@ PTScene::PTScene(PTRenderer* pRenderer, uint32_t numRendererDescriptors) : Scene
     _pGroundPlane = pRenderer->defaultGroundPlane();
 
     // Create arbitrary sized material buffer (will be resized to fit material constants for scene.)
-    _globalMaterialBuffer = _pRenderer->createTransferBuffer(512, "GlobalMaterialBuffer");
+    // The buffer is a copy of the renderer's material arena, so the scene tracks the dirty ranges
+    // of the arena as its own consumer.
+    _globalMaterialBuffer  = _pRenderer->createTransferBuffer(512, "GlobalMaterialBuffer");
+    _pMaterialArena        = _pRenderer->materialArena();
+    _materialArenaConsumer = _pMaterialArena->addConsumer();
 
     // Create arbitrary sized instance buffer (will be resized to fit instance constants for scene.)
     _globalInstanceBuffer = _pRenderer->createTransferBuffer(512, "GlobalInstanceBuffer");
@@ -267,6 +271,10 @@ PTScene::PTScene(PTRenderer* pRenderer, uint32_t numRendererDescriptors) : Scene
     // Create arbitrary sized instance buffer (will be resized to fit layer geomtry for scene.)
     _layerGeometryBuffer = _pRenderer->createTransferBuffer(512, "LayerGeometryBuffer");
 
+    // Create arbitrary sized light buffers (will be resized to fit the local lights for scene.)
+    _localLightBuffer = _pRenderer->createTransferBuffer(512, "LocalLightBuffer");
+    _lightTreeBuffer  = _pRenderer->createTransferBuffer(512, "LightTreeBuffer");
+
     // Enable layer shaders.
     _pShaderLibrary->setOption("ENABLE_LAYERS", true);
 
@@ -281,6 +289,12 @@ PTScene::PTScene(PTRenderer* pRenderer, uint32_t numRendererDescriptors) : Scene
         "DISTANCE_UNIT", _pMaterialXGenerator->codeGenerator().units().indices.at("centimeter"));
 #endif
 }
+
+PTScene::~PTScene()
+{
+    _pMaterialArena->removeConsumer(_materialArenaConsumer);
+}
+
 void PTScene::setUnit(const string& unit)
 {
 #if ENABLE_MATERIALX
@@ -386,7 +400,8 @@ IMaterialPtr PTScene::createMaterialPointer(
         return nullptr;
 
     // Create the material object with the material shader and definition.
-    auto pNewMtl = make_shared<PTMaterial>(_pRenderer, name, pShader, pDef);
+    auto pNewMtl = make_shared<PTMaterial>(
+        _pRenderer, name, pShader, pDef, _pRenderer->materialArena(), kMaterialHeaderSize);
 
     // Set the default textures on the new material.
     for (int i = 0; i < pDef->defaults().textures.size(); i++)
@@ -526,10 +541,6 @@ shared_ptr<MaterialShader> PTScene::generateMaterialX([[maybe_unused]] const str
 
 ILightPtr PTScene::addLightPointer(const string& lightType)
 {
-    // Only distant lights are currently supported.
-    AU_ASSERT(lightType.compare(Names::LightTypes::kDistantLight) == 0,
-        "Only distant lights currently supported");
-
     // The remaining operations are not yet thread safe.
     std::lock_guard<std::mutex> lock(_mutex);
 
@@ -539,8 +550,8 @@ ILightPtr PTScene::addLightPointer(const string& lightType)
     // Create the light object.
     PTLightPtr pLight = make_shared<PTLight>(this, lightType, index);
 
-    // Add weak pointer to distant light map.
-    _distantLights[index] = pLight;
+    // Add to the active lights, which are updated with the scene.
+    addActiveLight(pLight);
 
     // Return the new light.
     return pLight;
@@ -587,15 +598,41 @@ ID3D12Resource* PTScene::getHitGroupShaderTable(size_t& recordStride, uint32_t&
 {
     // Set the shader record size and count.
     recordStride = HitGroupShaderRecord::stride();
-    recordCount  = static_cast<uint32_t>(_lstInstanceData.size());
+    recordCount  = static_cast<uint32_t>(_instanceDataTable.slotCount());
 
     return _pHitGroupShaderTable.Get();
 }
 
-// Sort function, used to sort lights to ensure deterministic ordering.
-bool compareLights(PTLight* first, PTLight* second)
+void PTScene::updateLightBuffers()
 {
-    return (first->index() < second->index());
+    // Nothing to upload if there are no local lights, as the shaders will not read the buffers.
+    const vector<LightTree::Light>& localLights = this->localLights();
+    const vector<LightTree::Node>& nodes        = lightTree().nodes();
+    if (localLights.empty())
+    {
+        return;
+    }
+
+    // Resize the light buffers if too small for all the local lights and light tree nodes.
+    size_t localLightBufferSize = sizeof(LightTree::Light) * localLights.size();
+    size_t lightTreeBufferSize  = sizeof(LightTree::Node) * nodes.size();
+    if (_localLightBuffer.size < localLightBufferSize)
+    {
+        _localLightBuffer =
+            _pRenderer->createTransferBuffer(localLightBufferSize, "LocalLightBuffer");
+    }
+    if (_lightTreeBuffer.size < lightTreeBufferSize)
+    {
+        _lightTreeBuffer = _pRenderer->createTransferBuffer(lightTreeBufferSize, "LightTreeBuffer");
+    }
+
+    // Copy the local lights and light tree nodes to the buffers.
+    uint8_t* pLocalLightData = _localLightBuffer.map(localLightBufferSize);
+    ::memcpy_s(pLocalLightData, _localLightBuffer.size, localLights.data(), localLightBufferSize);
+    _localLightBuffer.unmap();
+    uint8_t* pLightTreeData = _lightTreeBuffer.map(lightTreeBufferSize);
+    ::memcpy_s(pLightTreeData, _lightTreeBuffer.size, nodes.data(), lightTreeBufferSize);
+    _lightTreeBuffer.unmap();
 }
 
 void PTScene::update()
@@ -676,68 +713,11 @@ void PTScene::updateResources()
     // Update the ground plane.
     _pGroundPlane->update();
 
-    // See if any distant lights have been changed this frame, and build vector of active lights.
-    bool distantLightsUpdated = false;
-    vector<PTLight*> currLights;
-    vector<int> lightsToDelete;
-    for (auto iter = _distantLights.begin(); iter != _distantLights.end(); iter++)
-    {
-        // Get the light and ensure weak pointer still valid.
-        PTLightPtr pLight = iter->second.lock();
-        if (pLight)
-        {
-            // Add to currently active light vector.
-            currLights.push_back(pLight.get());
-
-            // If the dirty flag is set, GPU data must be updated.
-            if (pLight->isDirty())
-            {
-                distantLightsUpdated = true;
-                pLight->clearDirtyFlag();
-            }
-        }
-        else
-        {
-            // If the weak pointer is not valid, add it to the list to be removed.
-            lightsToDelete.push_back(iter->first);
-            distantLightsUpdated = true;
-        }
-    }
-
-    // Remove the invalid pointers from the map.
-    // Outside the iterator loop as it's not safe to call erase from inside the loop.
-    for (int i = 0; i < lightsToDelete.size(); i++)
+    // Update the light data and light tree, if any lights have changed, and upload the local
+    // lights and light tree nodes.
+    if (updateLights())
     {
-        _distantLights.erase(lightsToDelete[i]);
-    }
-
-    // If distant lights have changed update the LightData struct that is passed to the GPU.
-    if (distantLightsUpdated)
-    {
-        // Sort the lights by index, to ensure deterministic ordering.
-        sort(currLights.begin(), currLights.end(), compareLights);
-
-        // Set the distant light count to minimum of current light vector size and the max distant
-        // light limit.  Lights in the sorted array past LightLimits::kMaxDistantLights are ignored.
-        _lights.distantLightCount =
-            std::min(int(currLights.size()), int(LightLimits::kMaxDistantLights));
-
-        // Add to the light data buffer that is copied to the frame data for this frame.
-        for (int i = 0; i < _lights.distantLightCount; i++)
-        {
-            // Store the cosine of the radius for use in the shader.
-            _lights.distantLights[i].cosRadius =
-                cos(0.5f * currLights[i]->asFloat(Names::LightProperties::kAngularDiameter));
-
-            // Invert the direction for use in the shader.
-            _lights.distantLights[i].direction =
-                -currLights[i]->asFloat3(Names::LightProperties::kDirection);
-
-            // Store color in RGB and intensity in alpha.
-            _lights.distantLights[i].colorAndIntensity =
-                vec4(currLights[i]->asFloat3(Names::LightProperties::kColor),
-                    currLights[i]->asFloat(Names::LightProperties::kIntensity));
-        }
+        updateLightBuffers();
     }
 
     // If any active geometry resources have been modified, flush the vertex buffer pool in case
@@ -766,48 +746,25 @@ void PTScene::updateResources()
         int globalTextureCount, globalSamplerCount;
         computeMaterialTextureCount(globalTextureCount, globalSamplerCount);
 
-        // Starting at beginning of buffer, work out where each material is global byte address
-        // buffer.
-        size_t globalMaterialBufferSize = 0;
-
-        // Iterate through the all the active materials, even ones that have not changed.
+        // Iterate through the all the active materials, even ones that have not changed. Each
+        // material is stored in a block of the renderer's material arena, with a fixed-length
+        // header followed by the material's properties, so the arena has the layout of the global
+        // byte address buffer, and only the bytes that changed are marked dirty.
+        UniformArena& arena = *_pMaterialArena;
         for (PTMaterial& mtl : _materials.active().resources<PTMaterial>())
         {
             // Update the material.
             mtl.update();
 
             // Add the offset for this material to the lookup map.
-            _materialOffsetLookup[&mtl] = int(globalMaterialBufferSize);
-
-            // Increment by size of fixed-length header.
-            globalMaterialBufferSize += sizeof(MaterialHeader);
+            AU_ASSERT(mtl.isInArena(), "Material is not in the material arena");
+            _materialOffsetLookup[&mtl] = int(mtl.arenaOffset());
 
             AU_ASSERT(sizeof(MaterialHeader) == kMaterialHeaderSize, "Header size mismatch");
 
-            // Increment by size of this material's properties.
-            globalMaterialBufferSize += mtl.uniformBuffer().size();
-        }
-
-        // If the global material buffer too small recreate it.
-        if (globalMaterialBufferSize > _globalMaterialBuffer.size)
-        {
-            _globalMaterialBuffer =
-                _pRenderer->createTransferBuffer(globalMaterialBufferSize, "GlobalMaterialBuffer");
-        }
-
-        // Map the global material buffer.
-        uint8_t* pMtlDataStart = _globalMaterialBuffer.map();
-        uint8_t* pMtlData      = pMtlDataStart;
-        size_t sizeLeft        = _globalMaterialBuffer.size;
-        for (PTMaterial& mtl : _materials.active().resources<PTMaterial>())
-        {
-            // Ensure offset matches the lookup value.
-            int offset = _materialOffsetLookup[&mtl];
-            AU_ASSERT(pMtlDataStart + offset == pMtlData, "Offset mismatch");
-
-            // Get pointer to material header and add shader index.
-            MaterialHeader* pHdr = (MaterialHeader*)pMtlData;
-            pHdr->shaderIndex    = mtl.shader()->libraryIndex();
+            // Build the material header with the shader index.
+            MaterialHeader hdr;
+            hdr.shaderIndex = mtl.shader()->libraryIndex();
 
             // Add the material texture indices (fill in unused values as invalid)
             // TODO: No need for this to be fixed length.
@@ -815,46 +772,58 @@ void PTScene::updateResources()
             {
                 if (!mtl.textures().get(j).image)
                 {
-                    pHdr->textureIndices[j] = kInvalidOffset;
+                    hdr.textureIndices[j] = kInvalidOffset;
                 }
                 else
                 {
-                    pHdr->textureIndices[j] =
+                    hdr.textureIndices[j] =
                         _materialTextureIndexLookup[mtl.textures().get(j).image.get()];
                 }
 
                 if (!mtl.textures().get(j).sampler)
                 {
-                    pHdr->samplerIndices[j] = 0;
+                    hdr.samplerIndices[j] = 0;
                 }
                 else
                 {
-                    pHdr->samplerIndices[j] =
+                    hdr.samplerIndices[j] =
                         _materialSamplerIndexLookup[mtl.textures().get(j).sampler.get()];
                 }
             }
             for (int j = int(mtl.textures().count()); j < kMaterialMaxTextures; j++)
             {
-                pHdr->textureIndices[j] = kInvalidOffset;
-                pHdr->samplerIndices[j] = 0;
+                hdr.textureIndices[j] = kInvalidOffset;
+                hdr.samplerIndices[j] = 0;
             }
 
-            // Move pointer past header.
-            size_t headerSize = sizeof(MaterialHeader);
-            sizeLeft -= headerSize;
-            pMtlData += headerSize;
+            // Write the header to the arena, which marks it dirty only if it has changed. The
+            // properties are written to the arena by the material's uniform buffer.
+            arena.write(mtl.arenaOffset(), &hdr, sizeof(MaterialHeader));
+        }
 
-            // Write the properties from material's uniform buffer.
-            auto& uniformBuffer = mtl.uniformBuffer();
-            size_t bufferSize   = uniformBuffer.size();
-            float* pSrcData     = (float*)uniformBuffer.data();
-            ::memcpy_s(pMtlData, sizeLeft, pSrcData, bufferSize);
+        // If the global material buffer too small recreate it, and upload the whole arena.
+        if (arena.size() > _globalMaterialBuffer.size)
+        {
+            _globalMaterialBuffer =
+                _pRenderer->createTransferBuffer(arena.size(), "GlobalMaterialBuffer");
+            arena.markAllDirty(_materialArenaConsumer);
+        }
 
-            // Move pointer to next material.
-            sizeLeft -= bufferSize;
-            pMtlData += bufferSize;
+        // Copy the dirty ranges of the arena since this scene last updated to the global material
+        // buffer. The buffer is mapped once for the span of the ranges, as the renderer uploads a
+        // single span of each transfer buffer.
+        vector<UniformArena::Range> dirtyRanges = arena.takeDirtyRanges(_materialArenaConsumer);
+        if (!dirtyRanges.empty())
+        {
+            uint8_t* pMtlDataStart =
+                _globalMaterialBuffer.map(dirtyRanges.back().end(), dirtyRanges.front().offset);
+            for (const UniformArena::Range& range : dirtyRanges)
+            {
+                ::memcpy_s(pMtlDataStart + range.offset, _globalMaterialBuffer.size - range.offset,
+                    arena.data(range.offset), range.size);
+            }
+            _globalMaterialBuffer.unmap();
         }
-        _globalMaterialBuffer.unmap();
 
         // Wait for previous render tasks and then clear the descriptor heap.
         // TODO: Only do this if any texture parameters have changed.
@@ -875,29 +844,33 @@ void PTScene::updateResources()
         }
     }
 
-    // If any active instances have been modified or activated, update all the active instances.
-    if (_instances.changedThisFrame())
+    // If any instances have been activated or deactivated, update all the active instances,
+    // otherwise only update the modified instances.
+    if (_instances.active().changedThisFrame())
     {
         for (PTInstance& instance : _instances.active().resources<PTInstance>())
         {
             instance.update();
         }
     }
+    else if (_instances.changedThisFrame())
+    {
+        for (PTInstance& instance : _instances.modified().resources<PTInstance>())
+        {
+            instance.update();
+        }
+    }
 
-    // Update the acceleration structure if any geometry or instances have been modified.
+    // Ensure the acceleration structure is no longer being accessed, if any geometry or instances
+    // have been modified, as it will be updated or rebuilt.
+    // TODO: Is there a less drastic stall we can do here?
     if (_instances.changedThisFrame() || _geometry.changedThisFrame())
     {
-
-        // Ensure the acceleration structure is no longer being accessed.
-        // TODO: Is there a less drastic stall we can do here?
         _pRenderer->waitForTask();
-
-        // Release the acceleration structure.
-        _pAccelStructure.Reset();
     }
 
     // Update the scene resources: the acceleration structure, the descriptor heap, and the shader
-    // tables.  Will only do anything if the relevant pointers have been cleared.
+    // tables.  Will only do anything if the relevant resources have changed.
     updateAccelerationStructure();
     updateDescriptorHeap();
     updateShaderTables();
@@ -915,19 +888,33 @@ void PTScene::clearShaderData()
     _pMissShaderTable.Reset();
 }
 
-PTScene::InstanceData PTScene::createInstanceData(const PTInstance& instance)
+InstanceDataTable::Key PTScene::createInstanceData(const PTInstance& instance)
 {
-    InstanceData res(instance);
-    res.mtlBufferOffset = _materialOffsetLookup[instance.material().get()];
-    res.pGeometry       = instance.dxGeometry();
-    res.isOpaque        = instance.material() ? instance.material()->isOpaque() : true;
+    InstanceDataTable::Key res;
+    res.pGeometry      = instance.dxGeometry().get();
+    res.materialOffset = _materialOffsetLookup[instance.material().get()];
+    res.isOpaque       = instance.material() ? instance.material()->isOpaque() : true;
 
     for (int i = 0; i < instance.materialLayers().size(); i++)
     {
-        auto& layer    = instance.materialLayers()[i];
-        int mtlOffset  = _materialOffsetLookup[layer.first.get()];
-        int geomOffset = _layerGeometryOffsetLookup[layer.second.get()];
+        auto& layer = instance.materialLayers()[i];
+
+        // Add the layer geometry to the layer geometry buffer the first time it is used. Offsets
+        // are only appended, so that the offsets in existing instance data remain valid, until the
+        // buffer is rebuilt when any geometry is modified.
+        PTGeometryPtr pGeom = layer.second;
+        auto iter           = _layerGeometryOffsetLookup.find(pGeom.get());
+        if (iter == _layerGeometryOffsetLookup.end())
+        {
+            AU_ASSERT(instance.dxGeometry()->vertexCount() == pGeom->vertexCount(),
+                "Layer geometry vertex count does not match base geometry vertex count.");
+            _layerGeometry.push_back(pGeom);
+            _layerGeometryOffsetLookup[pGeom.get()] = int(_layerGeometryBufferSize);
+            _layerGeometryBufferSize += pGeom->vertexCount() * sizeof(float) * 2;
+        }
 
+        int mtlOffset  = _materialOffsetLookup[layer.first.get()];
+        int geomOffset = _layerGeometryOffsetLookup[pGeom.get()];
         res.layers.push_back(make_pair(mtlOffset, geomOffset));
     }
     return res;
@@ -935,100 +922,117 @@ PTScene::InstanceData PTScene::createInstanceData(const PTInstance& instance)
 
 void PTScene::updateAccelerationStructure()
 {
-    // Do nothing if the acceleration structure already exists.
-    if (_pAccelStructure)
+    // Do nothing if the acceleration structure already exists, and nothing it depends on has
+    // changed. The material offsets used by the instance data may change with the materials.
+    bool isGeometryChanged  = _geometry.changedThisFrame();
+    bool isActiveChanged    = _instances.active().changedThisFrame();
+    bool isMaterialsChanged = _materials.changedThisFrame() || _images.changedThisFrame();
+    if (_pAccelStructure && !isGeometryChanged && !_instances.changedThisFrame() &&
+        !isMaterialsChanged)
     {
         return;
     }
 
-    // Build a list of instance data in the global instance buffer.  As the buffer contains a copy
-    // of the transform matrix, there must be an entry (and a hit group) for every instance, even if
-    // they share all the same data other than transform matrix.
-    // TODO: If it was possible access the TLAS instance matrix from the ray generation shader we
-    // could remove this copy of the transform data, and share hit groups between instances.
-    _instanceDataIndexLookup.clear();
-    _layerGeometryOffsetLookup.clear();
-    _layerGeometry.clear();
-    _lstInstanceData.clear();
-    InstanceDataMap instanceDataMap;
-
-    // Iterate through all the active instances in the scene to compute instance data (the unique
-    // data for each instance, excluding transform matrix.).
-    int instanceBufferOffset     = 0;
-    int layerGeomtryBufferOffset = 0;
-    for (PTInstance& instance : _instances.active().resources<PTInstance>())
+    // The table of unique instance data (the data for each instance, excluding the transform
+    // matrix) is maintained incrementally, so that only the instances that have been added,
+    // removed, or modified are hashed. Each unique entry has an entry in the instance data buffer
+    // and a hit group shader record, which are shared by the instances that use it.
+    // If any geometry has been modified, its BLAS and texture coordinates may have changed, so the
+    // table and layer geometry are rebuilt from scratch.
+    bool isRebuildRequired = !_pAccelStructure || isActiveChanged || isGeometryChanged;
+    if (isGeometryChanged)
     {
-        // Compute the layer geometry offsets for any layers.
-        for (int j = 0; j < instance.materialLayers().size(); j++)
+        _instanceDataTable.clear();
+        _layerGeometryOffsetLookup.clear();
+        _layerGeometry.clear();
+        _layerGeometryBufferSize = 0;
+    }
+
+    // Remove the instances that are no longer active from the table.
+    const uint32_t kInactiveIndex = static_cast<uint32_t>(-1);
+    if (isActiveChanged)
+    {
+        for (const void* pInstance : _instanceDataTable.instances())
         {
-            PTGeometryPtr pGeom = instance.materialLayers()[j].second;
-            auto iter           = _layerGeometryOffsetLookup.find(pGeom.get());
-            if (iter == _layerGeometryOffsetLookup.end())
+            auto pPTInstance = static_cast<const PTInstance*>(pInstance);
+            if (_instances.active().findActiveIndex(pPTInstance) == kInactiveIndex)
             {
-                _layerGeometry.push_back(pGeom.get());
-                AU_ASSERT(instance.dxGeometry()->vertexCount() == pGeom->vertexCount(),
-                    "Layer geometry vertex count does not match base geometry vertex count.");
-                _layerGeometryOffsetLookup[pGeom.get()] = layerGeomtryBufferOffset;
-                layerGeomtryBufferOffset += pGeom->vertexCount() * sizeof(float) * 2;
+                _instanceDataTable.remove(pInstance);
             }
         }
+    }
 
-        // Compute the unique instance data for this instance, from the material, geometry, and
-        // layer data, but not the transform matrix.
-        InstanceData instanceData = createInstanceData(instance);
-
-        // Have we encountered this instance data before?
-        auto instanceIter = instanceDataMap.find(instanceData);
-        int instanceDataIndex;
-        if (instanceIter == instanceDataMap.end())
+    // Set the instance data for the instances that are not in the table yet, and the modified
+    // instances. If the materials have changed, the instance data is set for all the active
+    // instances, which only changes the entries of instances with different material offsets.
+    // Keep track of the instances that need their TLAS instance description updated.
+    vector<const PTInstance*> changedInstances;
+    bool isAllInstancesSet = isGeometryChanged || isMaterialsChanged;
+    if (isAllInstancesSet || isActiveChanged)
+    {
+        for (PTInstance& instance : _instances.active().resources<PTInstance>())
         {
-            // If this is first time we have seen this instance data, it will have an entry in the
-            // instance data buffer.
-
-            // Get the index of this instance data.
-            instanceDataIndex = int(_lstInstanceData.size());
-
-            // Get the offset within buffer.
-            instanceData.bufferOffset = instanceBufferOffset;
-
-            // Move offset past header.
-            instanceBufferOffset += kInstanceDataHeaderSize;
-            AU_ASSERT(kInstanceDataHeaderSize == sizeof(InstanceDataHeader),
-                "Instance header size mismatch");
-
-            // Move offset past layer information.
-            instanceBufferOffset += int(instance.materialLayers().size() * sizeof(int) * 2);
-
-            // Add instance data to list of unique instance data.
-            _lstInstanceData.push_back(instanceData);
-
-            // Set in the index in the data lookup table.
-            instanceDataMap[instanceData] = instanceDataIndex;
+            if (isAllInstancesSet || !_instanceDataTable.contains(&instance))
+            {
+                if (_instanceDataTable.set(&instance, createInstanceData(instance)))
+                {
+                    changedInstances.push_back(&instance);
+                }
+            }
         }
-        else
+    }
+    if (!isAllInstancesSet)
+    {
+        for (PTInstance& instance : _instances.modified().resources<PTInstance>())
         {
-            // We've seen this data before, so just get the index
-            instanceDataIndex = instanceIter->second;
+            if (_instances.active().findActiveIndex(&instance) != kInactiveIndex)
+            {
+                _instanceDataTable.set(&instance, createInstanceData(instance));
+                changedInstances.push_back(&instance);
+            }
         }
-
-        // Add the index to the look table for this instance.
-        _instanceDataIndexLookup[&instance] = instanceDataIndex;
     }
 
-    // Set the required instance buffer size.
-    _instanceBufferSize      = instanceBufferOffset;
-    _layerGeometryBufferSize = layerGeomtryBufferOffset;
-    _transformMatrixBufferSize =
-        _instances.active().resources<PTInstance>().size() * kTransformMatrixSize;
+    // Rebuild the top-level acceleration structure (TLAS) if the set of instances or their
+    // geometry has changed, or if it has been updated too many times, as the quality of the TLAS
+    // degrades with each update. Otherwise update (refit) the TLAS with the changed instances,
+    // e.g. when only their transforms have changed.
+    const uint32_t kMaxTLASUpdateCount = 64;
+    if (isRebuildRequired || _tlasUpdateCount >= kMaxTLASUpdateCount)
+    {
+        // Remove the unused slots from the table if most of them are unused, as the indices of the
+        // entries are reassigned in the new TLAS anyway.
+        if (_instanceDataTable.slotCount() > 2 * _instanceDataTable.entryCount())
+        {
+            _instanceDataTable.compact();
+        }
 
-    // Build the top-level acceleration structure (TLAS).
-    _pAccelStructure = buildTLAS();
+        // Set the required transform matrix buffer size.
+        _transformMatrixBufferSize =
+            _instances.active().resources<PTInstance>().size() * kTransformMatrixSize;
 
-    // If the acceleration structure was rebuilt, then the descriptor heap, as well as the miss and
-    // hit group shader tables must likewise be rebuilt, as they rely on the instance data.
-    _pDescriptorHeap.Reset();
-    _pHitGroupShaderTable.Reset();
-    _pMissShaderTable.Reset();
+        // Build the TLAS.
+        _pAccelStructure = buildTLAS();
+        _tlasUpdateCount = 0;
+
+        // If the acceleration structure was rebuilt, then the descriptor heap, as well as the miss
+        // and hit group shader tables must likewise be rebuilt, as they rely on the instance data.
+        _pDescriptorHeap.Reset();
+        _pHitGroupShaderTable.Reset();
+        _pMissShaderTable.Reset();
+    }
+    else if (!changedInstances.empty())
+    {
+        updateTLAS(changedInstances);
+        _tlasUpdateCount++;
+    }
+
+    // If any entries have been added to or released from the table, the instance data buffer and
+    // the hit group shader table must be rebuilt.
+    if (_instanceDataTable.isModified())
+    {
+        _pHitGroupShaderTable.Reset();
+    }
 }
 
 void PTScene::updateDescriptorHeap()
@@ -1112,13 +1116,33 @@ void PTScene::updateShaderTables()
     // Texture and sampler descriptors for unique materials in the scene.
     vector<CD3DX12_GPU_DESCRIPTOR_HANDLE> lstUniqueMaterialSamplerDescriptors;
 
-    if (!_pHitGroupShaderTable && _lstInstanceData.size() > 0)
+    if (!_pHitGroupShaderTable && _instanceDataTable.entryCount() > 0)
     {
+        // Compute the offset of each entry of the instance data table within the global instance
+        // buffer, and the required buffer size. Unused slots in the table have no instance data.
+        int slotCount = int(_instanceDataTable.slotCount());
+        vector<int> instanceBufferOffsets(slotCount, -1);
+        size_t instanceBufferSize = 0;
+        for (int i = 0; i < slotCount; i++)
+        {
+            const InstanceDataTable::Key* pInstData = _instanceDataTable.entry(i);
+            if (pInstData)
+            {
+                instanceBufferOffsets[i] = int(instanceBufferSize);
+
+                // Move offset past header and layer information.
+                instanceBufferSize += kInstanceDataHeaderSize;
+                instanceBufferSize += pInstData->layers.size() * sizeof(int) * 2;
+            }
+        }
+        AU_ASSERT(
+            kInstanceDataHeaderSize == sizeof(InstanceDataHeader), "Instance header size mismatch");
+
         // Resize the global instance buffer if too small for all the instances.
-        if (_globalInstanceBuffer.size < _instanceBufferSize)
+        if (_globalInstanceBuffer.size < instanceBufferSize)
         {
             _globalInstanceBuffer =
-                _pRenderer->createTransferBuffer(_instanceBufferSize, "GlobalInstanceBuffer");
+                _pRenderer->createTransferBuffer(instanceBufferSize, "GlobalInstanceBuffer");
         }
 
         // Resize the global instance buffer if too small for all the instances.
@@ -1150,21 +1174,24 @@ void PTScene::updateShaderTables()
 
         // Fill in the global instance data buffer.
         uint8_t* pInstanceDataStart = _globalInstanceBuffer.map();
-        int offset                  = 0;
-        for (InstanceData& instData : _lstInstanceData)
+        for (int i = 0; i < slotCount; i++)
         {
-            // Validate offset within buffer matches offset in instance lookup table.
-            AU_ASSERT(offset == instData.bufferOffset, "Offset incorrect");
+            const InstanceDataTable::Key* pInstData = _instanceDataTable.entry(i);
+            if (!pInstData)
+            {
+                continue;
+            }
 
             // Get pointer to instance data in buffer.
+            int offset                = instanceBufferOffsets[i];
             uint8_t* pInstanceData    = pInstanceDataStart + offset;
             InstanceDataHeader* pData = (InstanceDataHeader*)pInstanceData;
 
             // Set material buffer offset from value in material lookup table.
-            pData->materialBufferOffset = instData.mtlBufferOffset;
+            pData->materialBufferOffset = pInstData->materialOffset;
 
             // Set layer count.
-            pData->materialLayerCount = int(instData.layers.size());
+            pData->materialLayerCount = int(pInstData->layers.size());
 
             // Move offset past header.
             offset += kInstanceDataHeaderSize;
@@ -1175,15 +1202,12 @@ void PTScene::updateShaderTables()
             {
 
                 // Copy layer material offset to buffer.
-                *pLayerData = instData.layers[j].first;
+                *pLayerData = pInstData->layers[j].first;
                 pLayerData++;
 
                 // Copy UV offset to buffer.
-                *pLayerData = instData.layers[j].second;
+                *pLayerData = pInstData->layers[j].second;
                 pLayerData++;
-
-                // Move offset past layer information.
-                offset += sizeof(int) * 2;
             }
         }
 
@@ -1205,7 +1229,8 @@ void PTScene::updateShaderTables()
             for (int i = 0; i < _layerGeometry.size(); i++)
             {
                 // Validate offset within buffer matches offset in instance lookup table.
-                AU_ASSERT(layerGeometryOffset == _layerGeometryOffsetLookup[_layerGeometry[i]],
+                AU_ASSERT(
+                    layerGeometryOffset == _layerGeometryOffsetLookup[_layerGeometry[i].get()],
                     "Offset incorrect");
                 uint8_t* pLayerGeometryData = pLayerGeometryDataStart + layerGeometryOffset;
 
@@ -1224,7 +1249,7 @@ void PTScene::updateShaderTables()
         size_t recordStride = HitGroupShaderRecord::stride();
 
         // Create a transfer buffer for the shader table, and map it for writing.
-        size_t shaderTableSize = recordStride * _lstInstanceData.size();
+        size_t shaderTableSize = recordStride * slotCount;
         TransferBuffer hitGroupTransferBuffer =
             _pRenderer->createTransferBuffer(shaderTableSize, "HitGroupShaderTable");
         uint8_t* pShaderTableMappedData = hitGroupTransferBuffer.map();
@@ -1233,10 +1258,19 @@ void PTScene::updateShaderTables()
         // renderer once upload complete.
         _pHitGroupShaderTable = hitGroupTransferBuffer.pGPUBuffer;
 
-        // Iterate the instances, creating a hit group shader record for each one, and
-        // copying the shader record data to the shader table.
-        for (InstanceData& instData : _lstInstanceData)
+        // Iterate the slots of the instance data table, creating a hit group shader record for
+        // each entry, and copying the shader record data to the shader table. The records for
+        // unused slots are not referenced by any instance, and are left empty.
+        for (int i = 0; i < slotCount; i++)
         {
+            const InstanceDataTable::Key* pInstData = _instanceDataTable.entry(i);
+            if (!pInstData)
+            {
+                ::memset(pShaderTableMappedData, 0, recordStride);
+                pShaderTableMappedData += recordStride;
+                continue;
+            }
+
             // Get the hit group shader ID from the material shader, which will change if the shader
             // library is rebuilt.
             const DirectXShaderIdentifier hitGroupShaderID =
@@ -1244,16 +1278,20 @@ void PTScene::updateShaderTables()
 
             // Shader record data includes the geometry buffers, the instance constant buffer
             // offset, and opaque flag.
-            PTGeometry::GeometryBuffers geometryBuffers = instData.pGeometry->buffers();
-            int instanceBufferOffset                    = instData.bufferOffset;
+            const PTGeometry* pGeometry = static_cast<const PTGeometry*>(pInstData->pGeometry);
+            PTGeometry::GeometryBuffers geometryBuffers = pGeometry->buffers();
+            int instanceBufferOffset                    = instanceBufferOffsets[i];
             HitGroupShaderRecord record(
-                hitGroupShaderID, geometryBuffers, instanceBufferOffset, instData.isOpaque);
+                hitGroupShaderID, geometryBuffers, instanceBufferOffset, pInstData->isOpaque);
             record.copyTo(pShaderTableMappedData);
             pShaderTableMappedData += recordStride;
         }
 
         // Close the shader table buffer.
         hitGroupTransferBuffer.unmap();
+
+        // The entries of the instance data table have been uploaded.
+        _instanceDataTable.clearModified();
     }
 
     // Create and populate the miss shader table if necessary.
@@ -1299,67 +1337,81 @@ void PTScene::updateShaderTables()
     }
 }
 
+// Writes the TLAS instance description for an instance to the specified mapped buffer.
+static void writeInstanceDesc(uint8_t* pInstanceMappedData, const PTInstance& instance,
+    uint32_t instanceIndex, int instanceDataIndex)
+{
+    // Get the bottom-level acceleration structure (BLAS) from the instance geometry.
+    ID3D12ResourcePtr pBLAS = instance.dxGeometry()->blas();
+
+    // Get the transpose of the transform matrix of the instance. GLM has column-major
+    // matrices, but DXR expects (4x3) row-major matrices for instance descriptions.
+    mat4 matrix = transpose(instance.transform());
+
+    // Describe the instance. Specifically this includes:
+    // - A pointer to the BLAS.
+    // - The transform for the instance.
+    // - An identifier for the hit group data to use when the instance is hit by a ray.
+    // NOTE: The instance is not set as opaque here on the instance flags, so that the any
+    // hit shader can be called if needed. If the any hit shader is not needed, the shader
+    // will use the opaque ray flag when calling TraceRay().
+    // NOTE: Using memcpy() for the transform copy writes too much data (all 16 floats) in
+    // *release builds*, for an unknown reason. sizeof(instanceDesc.Transform) is only 12
+    // floats. Using memcpy_s() does not cause this problem, and it should be used
+    // everywhere to be safe!
+    D3D12_RAYTRACING_INSTANCE_DESC instanceDesc      = {};
+    instanceDesc.AccelerationStructure               = pBLAS->GetGPUVirtualAddress();
+    instanceDesc.InstanceID                          = instanceIndex;
+    instanceDesc.InstanceMask                        = 0xFF;
+    instanceDesc.InstanceContributionToHitGroupIndex = instanceDataIndex;
+    ::memcpy_s(instanceDesc.Transform, sizeof(instanceDesc.Transform), &matrix,
+        sizeof(instanceDesc.Transform));
+    instanceDesc.Flags = D3D12_RAYTRACING_INSTANCE_FLAG_NONE;
+
+    // Copy the instance description to the buffer.
+    ::memcpy_s(pInstanceMappedData, sizeof(D3D12_RAYTRACING_INSTANCE_DESC), &instanceDesc,
+        sizeof(D3D12_RAYTRACING_INSTANCE_DESC));
+}
+
 ID3D12ResourcePtr PTScene::buildTLAS()
 {
-    // Create and populate a buffer with instance data, if there are any instances.
+    // Create and populate a buffer with instance data, if there are any instances. The buffer is
+    // retained, so that the TLAS can be updated when only some of the instances have changed.
     auto instanceCount = static_cast<uint32_t>(_instances.active().count());
-    ID3D12ResourcePtr pInstanceBuffer;
+    _pTLASInstanceBuffer.Reset();
     if (instanceCount > 0)
     {
         // Create a buffer for the instance data.
         size_t bufferSize            = sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * instanceCount;
-        pInstanceBuffer              = _pRenderer->createBuffer(bufferSize);
+        _pTLASInstanceBuffer         = _pRenderer->createBuffer(bufferSize);
         uint8_t* pInstanceMappedData = nullptr;
-        checkHR(pInstanceBuffer->Map(0, nullptr, reinterpret_cast<void**>(&pInstanceMappedData)));
+        checkHR(_pTLASInstanceBuffer->Map(
+            0, nullptr, reinterpret_cast<void**>(&pInstanceMappedData)));
 
-        // Describe a set of instances with varying geometries and transforms.
+        // Describe a set of instances with varying geometries and transforms. The instance ID is
+        // the index of the instance in the transform matrix buffer, and the hit group is the
+        // index of the instance data in the instance data table.
         uint32_t instanceIndex = 0;
         for (PTInstance& instance : _instances.active().resources<PTInstance>())
         {
-            // Get the bottom-level acceleration structure (BLAS) from the instance geometry.
-            ID3D12ResourcePtr pBLAS = instance.dxGeometry()->blas();
-
-            // Get the transpose of the transform matrix of the instance. GLM has column-major
-            // matrices, but DXR expects (4x3) row-major matrices for instance descriptions.
-            mat4 matrix = transpose(instance.transform());
-
-            // Describe the instance. Specifically this includes:
-            // - A pointer to the BLAS.
-            // - The transform for the instance.
-            // - An identifier for the hit group data to use when the instance is hit by a ray.
-            // NOTE: The instance is not set as opaque here on the instance flags, so that the any
-            // hit shader can be called if needed. If the any hit shader is not needed, the shader
-            // will use the opaque ray flag when calling TraceRay().
-            // NOTE: Using memcpy() for the transform copy writes too much data (all 16 floats) in
-            // *release builds*, for an unknown reason. sizeof(instanceDesc.Transform) is only 12
-            // floats. Using memcpy_s() does not cause this problem, and it should be used
-            // everywhere to be safe!
-            D3D12_RAYTRACING_INSTANCE_DESC instanceDesc      = {};
-            instanceDesc.AccelerationStructure               = pBLAS->GetGPUVirtualAddress();
-            instanceDesc.InstanceID                          = instanceIndex++;
-            instanceDesc.InstanceMask                        = 0xFF;
-            instanceDesc.InstanceContributionToHitGroupIndex = _instanceDataIndexLookup[&instance];
-            ::memcpy_s(instanceDesc.Transform, sizeof(instanceDesc.Transform), &matrix,
-                sizeof(instanceDesc.Transform));
-            instanceDesc.Flags = D3D12_RAYTRACING_INSTANCE_FLAG_NONE;
-
-            // Copy the instance description to the buffer.
-            ::memcpy_s(pInstanceMappedData, sizeof(D3D12_RAYTRACING_INSTANCE_DESC), &instanceDesc,
-                sizeof(D3D12_RAYTRACING_INSTANCE_DESC));
+            writeInstanceDesc(pInstanceMappedData, instance, instanceIndex++,
+                _instanceDataTable.index(&instance));
             pInstanceMappedData += sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
         }
 
         // Close the instance buffer.
-        pInstanceBuffer->Unmap(0, nullptr); // no HRESULT
+        _pTLASInstanceBuffer->Unmap(0, nullptr); // no HRESULT
     }
 
-    // Describe the top-level acceleration structure (TLAS).
+    // Describe the top-level acceleration structure (TLAS). Allow it to be updated, which is much
+    // faster than rebuilding it when only the instance transforms have changed.
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS tlasInputs = {};
     tlasInputs.Type          = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL;
     tlasInputs.DescsLayout   = D3D12_ELEMENTS_LAYOUT_ARRAY;
-    tlasInputs.Flags         = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_NONE;
+    tlasInputs.Flags         = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE;
     tlasInputs.NumDescs      = instanceCount;
-    tlasInputs.InstanceDescs = pInstanceBuffer ? pInstanceBuffer->GetGPUVirtualAddress() : 0;
+    tlasInputs.InstanceDescs =
+        _pTLASInstanceBuffer ? _pTLASInstanceBuffer->GetGPUVirtualAddress() : 0;
 
     // Get the sizes required for the TLAS scratch and result buffers, and create them.
     // NOTE: The scratch buffer is obtained from the renderer and will be retained for the duration
@@ -1378,20 +1430,95 @@ ID3D12ResourcePtr PTScene::buildTLAS()
     tlasDesc.ScratchAccelerationStructureData                   = tlasScratchAddress;
     tlasDesc.DestAccelerationStructureData                      = pTLAS->GetGPUVirtualAddress();
 
+    // Build the TLAS.
+    executeTLASBuild(tlasDesc, pTLAS.Get());
+
+    return pTLAS;
+}
+
+void PTScene::updateTLAS(const vector<const PTInstance*>& changedInstances)
+{
+    AU_ASSERT(_pTLASInstanceBuffer, "TLAS instance buffer not created");
+
+    // Get the range of the changed instances in the active instance list, which is the range of
+    // the transform matrix buffer and TLAS instance buffer to update.
+    uint32_t firstIndex = static_cast<uint32_t>(_instances.active().count());
+    uint32_t lastIndex  = 0;
+    for (const PTInstance* pInstance : changedInstances)
+    {
+        uint32_t instanceIndex = _instances.active().findActiveIndex(pInstance);
+        firstIndex             = std::min(firstIndex, instanceIndex);
+        lastIndex              = std::max(lastIndex, instanceIndex);
+    }
+
+    // Write the transform matrices and instance descriptions of the changed instances only. The
+    // transform matrix buffer is mapped once for the range of changed instances.
+    uint8_t* pMatrixDataStart = _transformMatrixBuffer.map(
+        (lastIndex + 1) * kTransformMatrixSize, firstIndex * kTransformMatrixSize);
+
+    // Map the TLAS instance buffer, which is not a transfer buffer, so is mapped as a whole.
+    uint8_t* pInstanceMappedData = nullptr;
+    checkHR(_pTLASInstanceBuffer->Map(0, nullptr, reinterpret_cast<void**>(&pInstanceMappedData)));
+    for (const PTInstance* pInstance : changedInstances)
+    {
+        uint32_t instanceIndex = _instances.active().findActiveIndex(pInstance);
+
+        // Copy transposed transform matrix into buffer.
+        mat4 matrix = transpose(pInstance->transform());
+        ::memcpy_s(pMatrixDataStart + instanceIndex * kTransformMatrixSize, kTransformMatrixSize,
+            &matrix, kTransformMatrixSize);
+
+        // Write the instance description, which may also have a different hit group.
+        writeInstanceDesc(
+            pInstanceMappedData + instanceIndex * sizeof(D3D12_RAYTRACING_INSTANCE_DESC),
+            *pInstance, instanceIndex, _instanceDataTable.index(pInstance));
+    }
+    _pTLASInstanceBuffer->Unmap(0, nullptr); // no HRESULT
+    _transformMatrixBuffer.unmap();
+
+    // Describe an update of the existing TLAS, in place, with the same number of instances.
+    D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS tlasInputs = {};
+    tlasInputs.Type          = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL;
+    tlasInputs.DescsLayout   = D3D12_ELEMENTS_LAYOUT_ARRAY;
+    tlasInputs.Flags         = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE |
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE;
+    tlasInputs.NumDescs      = static_cast<uint32_t>(_instances.active().count());
+    tlasInputs.InstanceDescs = _pTLASInstanceBuffer->GetGPUVirtualAddress();
+
+    // Get the scratch buffer size required for the update.
+    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO tlasInfo = {};
+    _pRenderer->dxDevice()->GetRaytracingAccelerationStructurePrebuildInfo(&tlasInputs, &tlasInfo);
+    D3D12_GPU_VIRTUAL_ADDRESS tlasScratchAddress =
+        _pRenderer->getScratchBuffer(tlasInfo.UpdateScratchDataSizeInBytes);
+    D3D12_GPU_VIRTUAL_ADDRESS tlasAddress        = _pAccelStructure->GetGPUVirtualAddress();
+
+    // Describe the update for the TLAS, with the TLAS as both the source and destination.
+    D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC tlasDesc = {};
+    tlasDesc.Inputs                                             = tlasInputs;
+    tlasDesc.ScratchAccelerationStructureData                   = tlasScratchAddress;
+    tlasDesc.SourceAccelerationStructureData                    = tlasAddress;
+    tlasDesc.DestAccelerationStructureData                      = tlasAddress;
+
+    // Update the TLAS.
+    executeTLASBuild(tlasDesc, _pAccelStructure.Get());
+}
+
+void PTScene::executeTLASBuild(
+    const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC& tlasDesc, ID3D12Resource* pTLAS)
+{
     // Build the TLAS using a command list. Insert a UAV barrier so that it can't be used until
     // it is generated.
     ID3D12GraphicsCommandList4Ptr pCommandList = _pRenderer->beginCommandList();
     pCommandList->BuildRaytracingAccelerationStructure(&tlasDesc, 0, nullptr);
-    _pRenderer->addUAVBarrier(pTLAS.Get());
+    _pRenderer->addUAVBarrier(pTLAS);
 
     // Complete the command list and task, and wait for the work to complete.
-    // NOTE: This waits so that the instance buffer doesn't have to be retained beyond this
-    // function. Since there is only one TLAS for a scene, this is not a practical bottleneck.
+    // NOTE: This waits so that the scratch buffer doesn't have to be retained beyond this
+    // function, and the instance buffer is not written while it is in use. Since there is only one
+    // TLAS for a scene, this is not a practical bottleneck.
     _pRenderer->submitCommandList();
     _pRenderer->completeTask();
     _pRenderer->waitForTask();
-
-    return pTLAS;
 }
 
 END_AURORA
@@ -13,6 +13,7 @@
 // limitations under the License.
 #pragma once
 
+#include "InstanceDataTable.h"
 #include "PTEnvironment.h"
 #include "PTGeometry.h"
 #include "PTGroundPlane.h"
@@ -90,7 +91,7 @@ class PTScene : public SceneBase
 public:
     /*** Lifetime Management ***/
     PTScene(PTRenderer* pRenderer, uint32_t numRendererDescriptors);
-    ~PTScene() = default;
+    ~PTScene();
 
     /*** IScene Functions ***/
     void setGroundPlanePointer(const IGroundPlanePtr& pGroundPlane) override;
@@ -120,6 +121,8 @@ public:
     const TransferBuffer& globalInstanceBuffer() { return _globalInstanceBuffer; }
     const TransferBuffer& layerGeometryBuffer() { return _layerGeometryBuffer; }
     const TransferBuffer& transformMatrixBuffer() { return _transformMatrixBuffer; }
+    const TransferBuffer& localLightBuffer() { return _localLightBuffer; }
+    const TransferBuffer& lightTreeBuffer() { return _lightTreeBuffer; }
     PTShaderLibrary& shaderLibrary() { return *_pShaderLibrary.get(); }
     IMaterialPtr createMaterialPointer(
         const string& materialType, const string& document, const string& name);
@@ -130,94 +133,31 @@ public:
 private:
     /*** Private Types ***/
 
-    // A structure containing the contents of instance that uniquely identify it, for purposes
-    // of using it in a shader table.
-    struct InstanceData
-    {
-        InstanceData(const PTInstance& instance) :
-            pGeometry(nullptr),
-            mtlBufferOffset((int)-1),
-            layers({}),
-            bufferOffset(-1),
-            isOpaque(true),
-            pInstance(&instance)
-        {
-        }
-
-        bool operator==(const InstanceData& other) const
-        {
-            if (pGeometry != other.pGeometry || mtlBufferOffset != other.mtlBufferOffset ||
-                layers.size() != other.layers.size())
-                return false;
-
-            for (int i = 0; i < layers.size(); i++)
-            {
-                if (layers[i].first != other.layers[i].first)
-                    return false;
-                if (layers[i].second != other.layers[i].second)
-                    return false;
-            }
-            return true;
-        }
-
-        // Properties used to compute hash.
-        // Geometry for instance
-        PTGeometryPtr pGeometry;
-        // Offset in global material buffer and layer geometry buffer for each layer.
-        vector<pair<int, int>> layers;
-        // Offset into global material buffer for base layer material.
-        int mtlBufferOffset;
-
-        // Convenience properties, do not effect hash.
-        const PTInstance* pInstance;
-        bool isOpaque;
-        int bufferOffset;
-    };
-
-    // A functor that hashes the contents of an instance, i.e. the pointers to the geometry and
-    // material.
-    struct HashInstanceData
-    {
-        size_t operator()(const InstanceData& object) const
-        {
-            hash<const PTGeometry*> geomHasher;
-            hash<int> indexHasher;
-            size_t res =
-                geomHasher(object.pGeometry.get()) ^ (indexHasher(object.mtlBufferOffset) << 1);
-            for (int i = 0; i < object.layers.size(); i++)
-            {
-                size_t layerHash = indexHasher(object.layers[i].first) ^
-                    (indexHasher(object.layers[i].second) << 1);
-                res = res ^ (layerHash << (i + 1));
-            }
-            return res;
-        }
-    };
-
-    using InstanceList     = set<PTInstancePtr>;
-    using InstanceDataMap  = unordered_map<InstanceData, int, HashInstanceData>;
-    using InstanceDataList = vector<InstanceData>; // <set> not needed; known to be unique
+    using InstanceList = set<PTInstancePtr>;
 
     /*** Private Functions ***/
 
     void updateAccelerationStructure();
     void updateDescriptorHeap();
     void updateShaderTables();
+    void updateLightBuffers();
     ID3D12ResourcePtr buildTLAS();
-    InstanceData createInstanceData(const PTInstance& instance);
+    void updateTLAS(const vector<const PTInstance*>& changedInstances);
+    void executeTLASBuild(const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC& tlasDesc,
+        ID3D12Resource* pTLAS);
+    InstanceDataTable::Key createInstanceData(const PTInstance& instance);
 
     /*** Private Variables ***/
 
     PTRenderer* _pRenderer = nullptr;
     unique_ptr<PTShaderLibrary> _pShaderLibrary;
-    InstanceDataList _lstInstanceData;
+    InstanceDataTable _instanceDataTable;
     map<const PTMaterial*, int> _materialOffsetLookup;
-    map<const PTInstance*, int> _instanceDataIndexLookup;
     map<const PTGeometry*, int> _layerGeometryOffsetLookup;
-    vector<PTGeometry*> _layerGeometry;
-    size_t _instanceBufferSize        = 0;
+    vector<PTGeometryPtr> _layerGeometry;
     size_t _layerGeometryBufferSize   = 0;
     size_t _transformMatrixBufferSize = 0;
+    uint32_t _tlasUpdateCount         = 0;
     map<IImage*, int> _materialTextureIndexLookup;
     map<ISampler*, int> _materialSamplerIndexLookup;
     vector<PTImage*> _activeMaterialTextures;
@@ -225,16 +165,19 @@ private:
     PTGroundPlanePtr _pGroundPlane;
     PTEnvironmentPtr _pEnvironment;
     uint32_t _numRendererDescriptors = 0;
-    map<int, weak_ptr<PTLight>> _distantLights;
-    int _currentLightIndex = 0;
     TransferBuffer _globalMaterialBuffer;
+    shared_ptr<UniformArena> _pMaterialArena;
+    UniformArena::ConsumerID _materialArenaConsumer = 0;
     TransferBuffer _globalInstanceBuffer;
     TransferBuffer _layerGeometryBuffer;
     TransferBuffer _transformMatrixBuffer;
+    TransferBuffer _localLightBuffer;
+    TransferBuffer _lightTreeBuffer;
 
     /*** DirectX 12 Objects ***/
 
     ID3D12ResourcePtr _pAccelStructure;
+    ID3D12ResourcePtr _pTLASInstanceBuffer;
     ID3D12DescriptorHeapPtr _pDescriptorHeap;
     ID3D12DescriptorHeapPtr _pSamplerDescriptorHeap;
     ID3D12ResourcePtr _pMissShaderTable;
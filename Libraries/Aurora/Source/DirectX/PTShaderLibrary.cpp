@@ -395,7 +395,7 @@ void PTShaderLibrary::initRootSignatures(int globalTextureCount, int globalSampl
     // Create the global root signature.
     // Must match the root signature data setup in PTRenderer::submitRayDispatch and the GPU
     // version in GlobalRootSignature.slang.
-    array<CD3DX12_ROOT_PARAMETER, 14> globalRootParameters = {}; // NOLINT(modernize-avoid-c-arrays)
+    array<CD3DX12_ROOT_PARAMETER, 17> globalRootParameters = {}; // NOLINT(modernize-avoid-c-arrays)
     globalRootParameters[0].InitAsShaderResourceView(0);         // gScene: acceleration structure
     globalRootParameters[1].InitAsConstants(2, 0);               // sampleIndex + seedOffset
     globalRootParameters[2].InitAsConstantBufferView(1); // gFrameData: per-frame constant buffer
@@ -432,6 +432,10 @@ void PTShaderLibrary::initRootSignatures(int globalTextureCount, int globalSampl
     globalRootParameters[13].InitAsDescriptorTable(
         _countof(globalSamplerRanges), globalSamplerRanges);
 
+    globalRootParameters[14].InitAsShaderResourceView(0, 2); // gLocalLights: local lights.
+    globalRootParameters[15].InitAsShaderResourceView(1, 2); // gLightTreeNodes: light tree nodes.
+    globalRootParameters[16].InitAsShaderResourceView(2, 2); // gBlueNoise: blue-noise mask.
+
     // Create the global root signature object, there are no static samplers (all the samplers
     // including default sampler are stored in gSamplerArray.)
     CD3DX12_ROOT_SIGNATURE_DESC globalDesc(
@@ -701,6 +705,7 @@ void PTShaderLibrary::generateEvaluateMaterialFunction(CompileJob& job)
 
 void PTShaderLibrary::rebuild(int globalTextureCount, int globalSamplerCount)
 {
+    AU_PROFILE("PTShaderLibrary::rebuild");
 
     // Start timer.
     _timer.reset();
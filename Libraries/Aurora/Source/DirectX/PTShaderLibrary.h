@@ -149,6 +149,9 @@ public:
     /// Get the names of the built-in material types.
     const vector<string>& builtInMaterials() const { return _builtInMaterialNames; }
 
+    /// Get the number of shader transpiler sessions kept by the library for compiling shaders.
+    size_t transpilerCount() const { return _transpilerArray.size(); }
+
     /// Get the global root signature used by all shaders.
     ID3D12RootSignaturePtr globalRootSignature() const { return _pGlobalRootSignature; }
 
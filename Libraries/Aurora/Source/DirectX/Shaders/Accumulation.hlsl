@@ -18,7 +18,7 @@
 #define ROOT_SIGNATURE                                                                             \
     "RootFlags(0),"                                                                                \
     "DescriptorTable(UAV(u0, numDescriptors = 10, flags = DESCRIPTORS_VOLATILE)), "                \
-    "RootConstants(b0, num32BitConstants = 2)"
+    "RootConstants(b0, num32BitConstants = 6)"
 
 // Source (input) and destination (output) textures.
 RWTexture2D<float4> gAccumulation : register(u0);
@@ -37,6 +37,8 @@ struct Accumulation
 {
     uint sampleIndex;
     bool isDenoisingEnabled;
+    uint2 regionOffset;
+    uint2 regionSize;
 };
 
 // Constant buffer of accumulation values.
@@ -49,19 +51,18 @@ ConstantBuffer<Accumulation> gSettings : register(b0);
 [numthreads(16, 8, 1)]
 void Accumulation(uint3 threadID : SV_DispatchThreadID)
 {
-    // Skip any shader invocation where the thread ID is outside the screen dimensions, as the
+    // Skip any shader invocation where the thread ID is outside the rendered region, as the
     // shader will be invoked with more threads than pixels when the dimension are not evenly
     // divided by the thread group dimensions.
-    uint2 screenDims;
-    gAccumulation.GetDimensions(screenDims.x, screenDims.y);
-    if (any(threadID.xy >= screenDims))
+    if (any(threadID.xy >= gSettings.regionSize))
     {
         return;
     }
 
-    // Get the screen coordinates (2D) from the thread ID, and the color / alpha from the result of
-    // the most recent sample. Treat the result as the "extra" shading value, optionally used below.
-    float2 screenCoords = threadID.xy;
+    // Get the screen coordinates (2D) from the thread ID, offset by the rendered region, and the
+    // color / alpha from the result of the most recent sample. Treat the result as the "extra"
+    // shading value, optionally used below.
+    float2 screenCoords = threadID.xy + gSettings.regionOffset;
     float4 result       = gResult[screenCoords];
     float3 extra        = result.rgb;
 
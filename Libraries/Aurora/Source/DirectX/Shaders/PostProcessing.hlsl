@@ -20,7 +20,7 @@
 #define ROOT_SIGNATURE                                                                             \
     "RootFlags(0),"                                                                                \
     "DescriptorTable(UAV(u0, numDescriptors = 11, flags = DESCRIPTORS_VOLATILE)), "                \
-    "RootConstants(b0, num32BitConstants = 10)"
+    "RootConstants(b0, num32BitConstants = 14)"
 
 // Debug display modes.
 #define kDebugModeOff 0
@@ -58,6 +58,8 @@ struct PostProcessing
     int isToneMappingEnabled;
     int isGammaCorrectionEnabled;
     int isAlphaEnabled;
+    uint2 regionOffset;
+    uint2 regionSize;
 };
 
 // Constant buffer of post-processing values.
@@ -76,18 +78,16 @@ float normalizeDepthView(float depthView)
 [numthreads(16, 8, 1)]
 void PostProcessing(uint3 threadID : SV_DispatchThreadID)
 {
-    // Skip any shader invocation where the thread ID is outside the screen dimensions, as the
+    // Skip any shader invocation where the thread ID is outside the rendered region, as the
     // shader will be invoked with more threads than pixels when the dimension are not evenly
     // divided by the thread group dimensions.
-    uint2 screenDims;
-    gAccumulation.GetDimensions(screenDims.x, screenDims.y);
-    if (any(threadID.xy >= screenDims))
+    if (any(threadID.xy >= gSettings.regionSize))
     {
         return;
     }
 
-    // Get the screen coordinates (2D) from the thread ID.
-    float2 coords = threadID.xy;
+    // Get the screen coordinates (2D) from the thread ID, offset by the rendered region.
+    float2 coords = threadID.xy + gSettings.regionOffset;
 
     // Use the appropriate texture for output if a debug mode is enabled.
     float3 color                  = 0.0f;
@@ -29,6 +29,12 @@ public:
 
     FixedValues& values() override { return *this; }
 
+    /*** Functions ***/
+
+    // Adds the memory used by the environment to the memory statistics. Renderer implementations
+    // add the device memory of the environment data.
+    virtual void addMemoryUsage(MemoryStatistics& /* statistics */) const {}
+
 protected:
     struct EnvironmentData
     {
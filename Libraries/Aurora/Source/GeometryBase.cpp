@@ -70,6 +70,8 @@ static void copyVertexChannelData(vector<ComponentType>& dst, const AttributeDat
 GeometryBase::GeometryBase(const std::string& name, const GeometryDescriptor& descriptor) :
     _name(name)
 {
+    AU_PROFILE("GeometryBase::GeometryBase");
+
     // If there is vertex data provided, there must be three or more vertices.
     AU_ASSERT(descriptor.vertexDesc.count == 0 || descriptor.vertexDesc.count >= 3,
         "Invalid vertex data");
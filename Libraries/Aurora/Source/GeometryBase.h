@@ -41,6 +41,16 @@ public:
     const vector<float>& tangents() { return _tangents; }
     const vector<float>& texCoords() { return _texCoords; }
 
+    // Adds the memory used by the geometry to the memory statistics, i.e. the CPU copies of the
+    // vertex data. Renderer implementations add the device memory of their buffers.
+    virtual void addMemoryUsage(MemoryStatistics& statistics) const
+    {
+        size_t floatCount = _positions.capacity() + _normals.capacity() + _tangents.capacity() +
+            _texCoords.capacity();
+        statistics.resources[ResourceType::Geometry].cpuBytes += floatCount * sizeof(float) +
+            _indices.capacity() * sizeof(uint32_t) + _primitiveData.capacity() * sizeof(Triangle);
+    }
+
 protected:
     /*** Private Functions ***/
 
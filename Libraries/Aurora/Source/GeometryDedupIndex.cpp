@@ -0,0 +1,309 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "GeometryDedupIndex.h"
+
+#include <Aurora/Foundation/Utilities.h>
+
+BEGIN_AURORA
+
+// Gets the size in bytes of a single element with the specified format.
+static size_t getAttributeFormatSize(AttributeFormat format)
+{
+    switch (format)
+    {
+    case AttributeFormat::SInt8:
+    case AttributeFormat::UInt8:
+        return 1;
+    case AttributeFormat::SInt16:
+    case AttributeFormat::UInt16:
+        return 2;
+    case AttributeFormat::SInt32:
+    case AttributeFormat::UInt32:
+    case AttributeFormat::Float:
+        return 4;
+    case AttributeFormat::Float2:
+        return 8;
+    case AttributeFormat::Float3:
+        return 12;
+    case AttributeFormat::Float4:
+        return 16;
+    }
+
+    return 0;
+}
+
+// Hashes a block of bytes, processing eight bytes at a time. This is the mixing function of
+// MurmurHash64A, which is much faster than combining a hash for each element.
+static uint64_t hashBytes(const uint8_t* pData, size_t size, uint64_t seed)
+{
+    const uint64_t kMultiplier = 0xc6a4a7935bd1e995ull;
+    const int kShift           = 47;
+
+    uint64_t hash = seed ^ (size * kMultiplier);
+    size_t i      = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t value;
+        ::memcpy(&value, pData + i, sizeof(value));
+        value *= kMultiplier;
+        value ^= value >> kShift;
+        value *= kMultiplier;
+        hash ^= value;
+        hash *= kMultiplier;
+    }
+
+    // Hash any remaining bytes.
+    if (i < size)
+    {
+        uint64_t value = 0;
+        ::memcpy(&value, pData + i, size - i);
+        hash ^= value;
+        hash *= kMultiplier;
+    }
+    hash ^= hash >> kShift;
+    hash *= kMultiplier;
+    hash ^= hash >> kShift;
+
+    return hash;
+}
+
+// A copy of the attribute streams of a geometry descriptor, obtained with a single call to its
+// getAttributeData function. The data is returned to the client with the attributeUpdateComplete
+// function as soon as it has been copied, so the client callbacks are called exactly once, as they
+// would be when the geometry is created without the index. Each stream is copied as contiguous
+// elements, so that interleaved and separate layouts of the same content are identical.
+class AttributeSnapshot
+{
+public:
+    AttributeSnapshot(const GeometryDescriptor& descriptor) : _descriptor(descriptor)
+    {
+        if (!_descriptor.getAttributeData)
+        {
+            return;
+        }
+
+        AttributeDataMap buffers;
+        _isValid = _descriptor.getAttributeData(
+            buffers, 0, _descriptor.vertexDesc.count, 0, _descriptor.indexCount);
+        for (auto& buffer : buffers)
+        {
+            const string& name = buffer.first;
+            size_t size        = elementSize(name);
+            if (!buffer.second.address || size == 0)
+            {
+                continue;
+            }
+
+            // Copy the elements of the stream, which may be interleaved with other data.
+            const AttributeData& data = buffer.second;
+            const uint8_t* pSource    = static_cast<const uint8_t*>(data.address) + data.offset;
+            size_t stride             = data.stride == 0 ? size : data.stride;
+            size_t count              = elementCount(name);
+            vector<uint8_t>& bytes    = _streams[name];
+            bytes.resize(size * count);
+            for (size_t i = 0; i < count; i++)
+            {
+                ::memcpy(bytes.data() + i * size, pSource + i * stride, size);
+            }
+        }
+        if (_descriptor.attributeUpdateComplete)
+        {
+            _descriptor.attributeUpdateComplete(
+                buffers, 0, _descriptor.vertexDesc.count, 0, _descriptor.indexCount);
+        }
+    }
+
+    // Gets whether the attribute data was obtained from the descriptor.
+    bool isValid() const { return _isValid; }
+
+    // Computes a hash of the content, with the specified seed. The streams are sorted by name, as
+    // the stream map is ordered.
+    size_t hash(size_t seed) const
+    {
+        size_t hash = seed;
+        Foundation::hashCombine(hash, std::hash<size_t>()(_descriptor.vertexDesc.count));
+        Foundation::hashCombine(hash, std::hash<size_t>()(_descriptor.indexCount));
+        Foundation::hashCombine(hash, std::hash<int>()(static_cast<int>(_descriptor.type)));
+        for (auto& stream : _streams)
+        {
+            Foundation::hashCombine(hash, std::hash<string>()(stream.first));
+            Foundation::hashCombine(hash, std::hash<size_t>()(elementSize(stream.first)));
+            Foundation::hashCombine(hash,
+                static_cast<size_t>(hashBytes(stream.second.data(), stream.second.size(), hash)));
+        }
+
+        return hash;
+    }
+
+    // Gets a descriptor that provides the copied streams, without calling back into the client.
+    GeometryDescriptor descriptor() const
+    {
+        GeometryDescriptor result = _descriptor;
+        result.getAttributeData   = [this](AttributeDataMap& buffers, size_t, size_t, size_t,
+                                      size_t) {
+            for (auto& stream : _streams)
+            {
+                AttributeData& data = buffers[stream.first];
+                data.address        = stream.second.data();
+                data.size           = stream.second.size();
+                data.stride         = elementSize(stream.first);
+            }
+
+            return _isValid;
+        };
+        result.attributeUpdateComplete = nullptr;
+
+        return result;
+    }
+
+private:
+    // Gets the size of each element of a stream, which is zero for unknown streams.
+    size_t elementSize(const string& name) const
+    {
+        if (name == Names::VertexAttributes::kIndices)
+        {
+            return sizeof(uint32_t);
+        }
+        auto iter = _descriptor.vertexDesc.attributes.find(name);
+
+        return iter == _descriptor.vertexDesc.attributes.end()
+            ? 0
+            : getAttributeFormatSize(iter->second);
+    }
+
+    // Gets the number of elements in a stream.
+    size_t elementCount(const string& name) const
+    {
+        return name == Names::VertexAttributes::kIndices ? _descriptor.indexCount
+                                                         : _descriptor.vertexDesc.count;
+    }
+
+    const GeometryDescriptor& _descriptor;
+    map<string, vector<uint8_t>> _streams;
+    bool _isValid = false;
+};
+
+// The seeds of the two hashes of the content of a geometry descriptor. The first is used to look
+// up the geometry, and the second to confirm that the content is the same when the first matches.
+static const size_t kHashSeed      = 0;
+static const size_t kCheckHashSeed = 0x9e3779b97f4a7c15ull;
+
+bool GeometryDedupIndex::hashDescriptor(const GeometryDescriptor& descriptor, size_t& hashOut)
+{
+    AttributeSnapshot snapshot(descriptor);
+    if (!snapshot.isValid())
+    {
+        return false;
+    }
+    hashOut = snapshot.hash(kHashSeed);
+
+    return true;
+}
+
+IGeometryPtr GeometryDedupIndex::acquire(
+    const Path& path, const GeometryDescriptor& descriptor, const CreateFunction& create)
+{
+    release(path);
+
+    // Copy the content of the descriptor, which returns the data to the client. The geometry is
+    // created from the copy, so the client data is only requested once.
+    AttributeSnapshot snapshot(descriptor);
+
+    // Create the geometry without sharing it if its content can't be obtained.
+    if (!snapshot.isValid())
+    {
+        return create(snapshot.descriptor());
+    }
+
+    // Use existing geometry with the same hashes, which very probably has the same content. The
+    // client data of the other paths may have been freed, so the content can't be compared, and a
+    // second hash is compared instead, in case the first hashes collide.
+    size_t hash               = snapshot.hash(kHashSeed);
+    size_t checkHash          = snapshot.hash(kCheckHashSeed);
+    vector<EntryPtr>& entries = _entries[hash];
+    for (EntryPtr& pEntry : entries)
+    {
+        if (pEntry->checkHash == checkHash)
+        {
+            pEntry->paths.insert(path);
+            _pathEntries[path] = pEntry;
+
+            return pEntry->pGeometry;
+        }
+    }
+
+    // Otherwise create new geometry, and add it to the index.
+    IGeometryPtr pGeometry = create(snapshot.descriptor());
+    if (!pGeometry)
+    {
+        if (entries.empty())
+        {
+            _entries.erase(hash);
+        }
+
+        return nullptr;
+    }
+    EntryPtr pEntry   = make_shared<Entry>();
+    pEntry->hash      = hash;
+    pEntry->checkHash = checkHash;
+    pEntry->pGeometry = pGeometry;
+    pEntry->paths.insert(path);
+    entries.push_back(pEntry);
+    _pathEntries[path] = pEntry;
+    _entryCount++;
+
+    return pGeometry;
+}
+
+void GeometryDedupIndex::release(const Path& path)
+{
+    auto iter = _pathEntries.find(path);
+    if (iter == _pathEntries.end())
+    {
+        return;
+    }
+    EntryPtr pEntry = iter->second;
+    _pathEntries.erase(iter);
+
+    // Remove the entry when the last path that shares it is released.
+    pEntry->paths.erase(path);
+    if (pEntry->paths.empty())
+    {
+        vector<EntryPtr>& entries = _entries[pEntry->hash];
+        entries.erase(std::find(entries.begin(), entries.end(), pEntry));
+        if (entries.empty())
+        {
+            _entries.erase(pEntry->hash);
+        }
+        _entryCount--;
+    }
+}
+
+size_t GeometryDedupIndex::referenceCount(const Path& path) const
+{
+    auto iter = _pathEntries.find(path);
+
+    return iter == _pathEntries.end() ? 0 : iter->second->paths.size();
+}
+
+bool GeometryDedupIndex::isPrimary(const Path& path) const
+{
+    auto iter = _pathEntries.find(path);
+
+    return iter == _pathEntries.end() || *iter->second->paths.begin() == path;
+}
+
+END_AURORA
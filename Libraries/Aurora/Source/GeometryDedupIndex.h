@@ -0,0 +1,80 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+BEGIN_AURORA
+
+// An index of geometry by content, used to share a single renderer geometry object between paths
+// with identical vertex and index data, e.g. duplicated prototype meshes from CAD and USD
+// pipelines. Geometry is identified by a hash of the attribute streams returned by the descriptor's
+// getAttributeData function, and a second hash of the streams, with a different seed, is compared
+// when the first hashes match. The content itself is not compared, as the index does not keep the
+// descriptors or their data, which the client may free once it has been read. Geometry with
+// different content is therefore only shared if both hashes collide, which is extremely unlikely
+// with 64-bit hashes, but not impossible.
+// Each path holds a reference to the shared geometry, which is released from the index when the
+// last path is released.
+class GeometryDedupIndex
+{
+public:
+    // A function that creates a renderer geometry object from a descriptor, if there is no existing
+    // geometry with the same content. The descriptor provides a copy of the content of the acquired
+    // descriptor, and is only valid during the call.
+    using CreateFunction = function<IGeometryPtr(const GeometryDescriptor& descriptor)>;
+
+    // Computes a hash of the content of a geometry descriptor, i.e. the primitive type, vertex and
+    // index counts, attribute formats, and the attribute data. Returns false if the attribute data
+    // could not be obtained from the descriptor.
+    static bool hashDescriptor(const GeometryDescriptor& descriptor, size_t& hashOut);
+
+    // Acquires the geometry for a path with the specified descriptor, returning the existing
+    // geometry with the same content if there is one, or otherwise the geometry created with the
+    // specified function. If the path already has geometry, that is released first. Geometry with
+    // attribute data that can't be obtained is created without being added to the index. The
+    // attribute data is obtained from the descriptor, and returned to the client, exactly once.
+    IGeometryPtr acquire(
+        const Path& path, const GeometryDescriptor& descriptor, const CreateFunction& create);
+
+    // Releases the geometry for a path, if it has any.
+    void release(const Path& path);
+
+    // Gets the number of unique geometry objects in the index.
+    size_t uniqueCount() const { return _entryCount; }
+
+    // Gets the number of paths that share the geometry of the specified path, including the path
+    // itself, or zero if the path has no geometry in the index.
+    size_t referenceCount(const Path& path) const;
+
+    // Gets whether the path is the primary path of its geometry, i.e. the first of the paths that
+    // share it, which is used to count the memory of shared geometry once. Paths with no geometry
+    // in the index are considered primary.
+    bool isPrimary(const Path& path) const;
+
+private:
+    // Geometry shared by one or more paths, with the two hashes of its content.
+    struct Entry
+    {
+        size_t hash      = 0;
+        size_t checkHash = 0;
+        IGeometryPtr pGeometry;
+        set<Path> paths;
+    };
+    using EntryPtr = shared_ptr<Entry>;
+
+    map<size_t, vector<EntryPtr>> _entries;
+    map<Path, EntryPtr> _pathEntries;
+    size_t _entryCount = 0;
+};
+
+END_AURORA
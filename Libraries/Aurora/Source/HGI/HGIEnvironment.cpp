@@ -54,4 +54,9 @@ void HGIEnvironment::update()
     _pRenderer->hgi()->SubmitCmds(blitCmds.get());
 }
 
+void HGIEnvironment::addMemoryUsage(MemoryStatistics& statistics) const
+{
+    statistics.resources[ResourceType::Environment].deviceBytes += resourceByteSize(_ubo);
+}
+
 END_AURORA
@@ -31,6 +31,7 @@ public:
     ~HGIEnvironment() {}
 
     void update();
+    void addMemoryUsage(MemoryStatistics& statistics) const override;
     pxr::HgiBufferHandle ubo() { return _ubo->handle(); }
 
 private:
@@ -160,4 +160,15 @@ void HGIGeometry::update()
     _pRenderer->hgi()->SubmitCmds(accelStructCmds.get(), HgiSubmitWaitTypeWaitUntilCompleted);
 }
 
+void HGIGeometry::addMemoryUsage(MemoryStatistics& statistics) const
+{
+    GeometryBase::addMemoryUsage(statistics);
+
+    // The acceleration structures are not included, as HGI does not report their size.
+    statistics.resources[ResourceType::Geometry].deviceBytes += resourceByteSize(vertexBuffer) +
+        resourceByteSize(normalBuffer) + resourceByteSize(texCoordBuffer) +
+        resourceByteSize(indexBuffer) + resourceByteSize(transformBuffer) +
+        resourceByteSize(primitiveDataBuffer);
+}
+
 END_AURORA
@@ -39,6 +39,7 @@ public:
     ~HGIGeometry() {}
 
     void update();
+    void addMemoryUsage(MemoryStatistics& statistics) const override;
 
     HgiBufferHandleWrapper::Pointer vertexBuffer;
     HgiBufferHandleWrapper::Pointer normalBuffer;
@@ -85,4 +85,12 @@ using HgiShaderProgramHandleWrapper =
 using HgiRayTracingPipelineHandleWrapper =
     HgiHandleWrapper<pxr::HgiRayTracingPipelineHandle, destroyHgiRayTracingPipeline>;
 
+// Gets the size in bytes of the buffer or texture wrapped by a handle wrapper pointer, or zero if
+// the pointer or its handle is null.
+template <typename WrapperPointer>
+size_t resourceByteSize(const WrapperPointer& pWrapper)
+{
+    return pWrapper && pWrapper->handle() ? pWrapper->handle()->GetByteSizeOfResource() : 0;
+}
+
 END_AURORA
@@ -15,6 +15,7 @@
 
 #include "HGIImage.h"
 #include "HGIRenderer.h"
+#include "TextureCompressor.h"
 
 using namespace pxr;
 
@@ -37,6 +38,11 @@ HGIImage::HGIImage(HGIRenderer* pRenderer, const IImage::InitData& initData)
     imageTexDesc.pixelsByteSize = static_cast<size_t>(initData.width)
         * static_cast<size_t>(initData.height) * static_cast<size_t>(pixelSizeBytes);
     imageTexDesc.initialData    = initData.pImageData;
+    if (isCompressedImageFormat(initData.format))
+    {
+        imageTexDesc.pixelsByteSize = Foundation::compressedImageSize(
+            blockFormat(initData.format), initData.width, initData.height);
+    }
 
     // Create the texture.
     _texture = HgiTextureHandleWrapper::create(
@@ -53,34 +59,19 @@ HGIImage::HGIImage(HGIRenderer* pRenderer, const IImage::InitData& initData)
         aliasMapDataUboDesc.byteSize  = sizeof(AliasMap::Entry) * width * height;
         _pAliasMapBuffer = HgiBufferHandleWrapper::create(pRenderer->hgi()->CreateBuffer(aliasMapDataUboDesc), pRenderer->hgi());
         
-        // Create per instance data buffer
-        AliasMap::Entry* aliasMapDta = new AliasMap::Entry[width * height];
-                    
-        // Ensure CPU buffer is big enough for pixels.
-        size_t dataByteSize = width * height * 32;
-        std::vector<uint8_t> _mappedBuffer;
-        _mappedBuffer.resize(dataByteSize);
-        
-        // Setup commands to blit storage buffer contents to CPU buffer.
-        HgiBlitCmdsUniquePtr blitCmdsEnvMap = pRenderer->hgi()->CreateBlitCmds();
-        {
-            HgiTextureGpuToCpuOp copyOpEnvMap;
-            copyOpEnvMap.gpuSourceTexture          = texture();
-            copyOpEnvMap.sourceTexelOffset         = GfVec3i(0);
-            copyOpEnvMap.mipLevel                  = 0;
-            copyOpEnvMap.cpuDestinationBuffer      = _mappedBuffer.data();
-            copyOpEnvMap.destinationByteOffset     = 0;
-            copyOpEnvMap.destinationBufferByteSize = dataByteSize;
-            blitCmdsEnvMap->CopyTextureGpuToCpu(copyOpEnvMap);
-        }
-        pRenderer->hgi()->SubmitCmds(blitCmdsEnvMap.get(), HgiSubmitWaitTypeWaitUntilCompleted);
-        
-        AliasMap::build((const float*)_mappedBuffer.data(), uvec2(width, height), aliasMapDta, sizeof(AliasMap::Entry) * width * height, _luminanceIntegral);
+        // Build the alias map from the image data provided by the client, which avoids reading the
+        // texture back from the GPU. The image data is in the same format as the texture, e.g. half
+        // float pixels are converted by the alias map one row at a time.
+        vector<AliasMap::Entry> aliasMapData(width * height);
+        AliasMap::build(initData.pImageData, initData.format, uvec2(width, height),
+            aliasMapData.data(), sizeof(AliasMap::Entry) * width * height, _luminanceIntegral);
 
+        // NOTE: The CPU data is copied to a staging buffer when the copy is encoded, so the alias
+        // map data can be released before the commands complete.
         pxr::HgiBlitCmdsUniquePtr blitCmdsAliasMap = pRenderer->hgi()->CreateBlitCmds();
         pxr::HgiBufferCpuToGpuOp blitOpAliasMap;
         blitOpAliasMap.byteSize              = sizeof(AliasMap::Entry)  * width * height;
-        blitOpAliasMap.cpuSourceBuffer       = aliasMapDta;
+        blitOpAliasMap.cpuSourceBuffer       = aliasMapData.data();
         blitOpAliasMap.sourceByteOffset      = 0;
         blitOpAliasMap.gpuDestinationBuffer  = aliasMap();
         blitOpAliasMap.destinationByteOffset = 0;
@@ -100,9 +91,21 @@ HgiFormat HGIImage::getHGIFormat(ImageFormat format, bool linearize, uint32_t* p
     case ImageFormat::Float_RGBA:
         *pPixelByteSizeOut = 16;
         return HgiFormat::HgiFormatFloat32Vec4;
+    case ImageFormat::Half_RGBA:
+        *pPixelByteSizeOut = 8;
+        return HgiFormat::HgiFormatFloat16Vec4;
     case ImageFormat::Float_RGB:
         *pPixelByteSizeOut = 12;
         return HgiFormat::HgiFormatFloat32Vec3;
+    case ImageFormat::BC1_RGBA:
+        // Block compressed formats are not a whole number of bytes per pixel, so the image size
+        // is computed separately.
+        *pPixelByteSizeOut = 0;
+        return HgiFormat::HgiFormatBC1UNorm8Vec4;
+    case ImageFormat::BC7_RGBA:
+        *pPixelByteSizeOut = 0;
+        return linearize ? HgiFormat::HgiFormatBC7UNorm8Vec4srgb
+                         : HgiFormat::HgiFormatBC7UNorm8Vec4;
     default:
         break;
     }
@@ -111,4 +114,17 @@ HgiFormat HGIImage::getHGIFormat(ImageFormat format, bool linearize, uint32_t* p
     return (HgiFormat)-1;
 }
 
+void HGIImage::addMemoryUsage(MemoryStatistics& statistics) const
+{
+    statistics.resources[ResourceType::Image].deviceBytes += resourceByteSize(_texture);
+
+    // The alias map is only created for images that represent an environment.
+    if (_pAliasMapBuffer)
+    {
+        statistics.aliasMaps.count++;
+        statistics.aliasMaps.activeCount++;
+        statistics.aliasMaps.deviceBytes += resourceByteSize(_pAliasMapBuffer);
+    }
+}
+
 END_AURORA
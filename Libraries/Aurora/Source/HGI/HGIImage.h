@@ -32,6 +32,9 @@ public:
 
     // Gets the image alias map, if this image represents an environment.
     const pxr::HgiBufferHandle& aliasMap() { return _pAliasMapBuffer->handle(); }
+
+    void addMemoryUsage(MemoryStatistics& statistics) const override;
+
 private:
     HgiTextureHandleWrapper::Pointer _texture;
     HgiBufferHandleWrapper::Pointer  _pAliasMapBuffer;
@@ -19,39 +19,8 @@
 
 BEGIN_AURORA
 
-static PropertySetPtr g_pDistantLightPropertySet;
-
-static PropertySetPtr distantLightPropertySet()
-{
-    if (g_pDistantLightPropertySet)
-    {
-        return g_pDistantLightPropertySet;
-    }
-
-    // Create properties and defaults for distant lights.
-    g_pDistantLightPropertySet = make_shared<PropertySet>();
-    g_pDistantLightPropertySet->add(
-        Names::LightProperties::kDirection, normalize(vec3(-1.0f, -0.5f, -1.0f)));
-    g_pDistantLightPropertySet->add(Names::LightProperties::kColor, vec3(1, 1, 1));
-    g_pDistantLightPropertySet->add(Names::LightProperties::kAngularDiameter, 0.1f);
-    g_pDistantLightPropertySet->add(Names::LightProperties::kExposure, 0.0f);
-    g_pDistantLightPropertySet->add(Names::LightProperties::kIntensity, 1.0f);
-
-    return g_pDistantLightPropertySet;
-}
-
-// Return the property set for the provided light type.
-static PropertySetPtr propertySet(const string& type)
-{
-    if (type.compare(Names::LightTypes::kDistantLight) == 0)
-        return distantLightPropertySet();
-
-    AU_FAIL("Unknown light type:%s", type.c_str());
-    return nullptr;
-}
-
 HGILight::HGILight(HGIScene* pScene, const string& lightType, int index) :
-    FixedValues(propertySet(lightType)), _pScene(pScene), _index(index)
+    LightBase(lightType, index), _pScene(pScene)
 {
 }
 
@@ -13,7 +13,7 @@
 // limitations under the License.
 #pragma once
 
-#include "Properties.h"
+#include "LightBase.h"
 
 BEGIN_AURORA
 
@@ -21,7 +21,7 @@ BEGIN_AURORA
 class HGIScene;
 
 // An internal implementation for ILight.
-class HGILight : public ILight, public FixedValues
+class HGILight : public LightBase
 {
 public:
     /*** Lifetime Management ***/
@@ -29,19 +29,10 @@ public:
     HGILight(HGIScene* pScene, const string& lightType, int index);
     ~HGILight() { _pScene = nullptr; };
 
-    /*** Functions ***/
-    FixedValues& values() override { return *this; }
-
-    int index() const { return _index; }
-
-    bool isDirty() const { return _bIsDirty; }
-    void clearDirtyFlag() { _bIsDirty = false; }
-
 private:
     /*** Private Variables ***/
 
     HGIScene* _pScene = nullptr;
-    int _index;
 };
 
 MAKE_AURORA_PTR(HGILight);
@@ -21,8 +21,8 @@ using namespace pxr;
 BEGIN_AURORA
 
 HGIMaterial::HGIMaterial(HGIRenderer* pRenderer, const string& name, MaterialShaderPtr pShader,
-    shared_ptr<MaterialDefinition> pDef) :
-    MaterialBase(name, pShader, pDef), _pRenderer(pRenderer)
+    shared_ptr<MaterialDefinition> pDef, shared_ptr<UniformArena> pArena) :
+    MaterialBase(name, pShader, pDef, pArena), _pRenderer(pRenderer)
 {
     // Create buffer descriptor, passing material as initial data.
     HgiBufferDesc uboDesc;
@@ -36,22 +36,43 @@ HGIMaterial::HGIMaterial(HGIRenderer* pRenderer, const string& name, MaterialSha
         HgiBufferHandleWrapper::create(_pRenderer->hgi()->CreateBuffer(uboDesc), _pRenderer->hgi());
 }
 
-void HGIMaterial::update()
+void HGIMaterial::update(
+    pxr::HgiBlitCmds* pBlitCmds, const vector<UniformArena::Range>& dirtyRanges)
 {
-    // Build a structure from values map into staging buffer.
-    void* pStaging = _ubo->handle()->GetCPUStagingAddress();
-    memcpy(pStaging, uniformBuffer().data(), uniformBuffer().size());
-
-    // Transfer staging buffer to GPU.
-    pxr::HgiBlitCmdsUniquePtr blitCmds = _pRenderer->hgi()->CreateBlitCmds();
-    pxr::HgiBufferCpuToGpuOp blitOp;
-    blitOp.byteSize              = uniformBuffer().size();
-    blitOp.cpuSourceBuffer       = pStaging;
-    blitOp.sourceByteOffset      = 0;
-    blitOp.gpuDestinationBuffer  = _ubo->handle();
-    blitOp.destinationByteOffset = 0;
-    blitCmds->CopyBufferCpuToGpu(blitOp);
-    _pRenderer->hgi()->SubmitCmds(blitCmds.get());
+    const uint8_t* pSource = static_cast<const uint8_t*>(uniformBuffer().data());
+    uint8_t* pStaging      = static_cast<uint8_t*>(_ubo->handle()->GetCPUStagingAddress());
+    size_t begin           = arenaOffset();
+    size_t end             = begin + uniformBuffer().size();
+    for (const UniformArena::Range& range : dirtyRanges)
+    {
+        // Skip the ranges that do not intersect the uniform buffer, which are sorted by offset.
+        if (range.end() <= begin)
+        {
+            continue;
+        }
+        if (range.offset >= end)
+        {
+            break;
+        }
+
+        // Copy the intersection to the staging buffer, and transfer it to the GPU.
+        size_t copyBegin = std::max(range.offset, begin) - begin;
+        size_t copyEnd   = std::min(range.end(), end) - begin;
+        memcpy(pStaging + copyBegin, pSource + copyBegin, copyEnd - copyBegin);
+        pxr::HgiBufferCpuToGpuOp blitOp;
+        blitOp.byteSize              = copyEnd - copyBegin;
+        blitOp.cpuSourceBuffer       = pStaging;
+        blitOp.sourceByteOffset      = copyBegin;
+        blitOp.gpuDestinationBuffer  = _ubo->handle();
+        blitOp.destinationByteOffset = copyBegin;
+        pBlitCmds->CopyBufferCpuToGpu(blitOp);
+    }
+}
+
+void HGIMaterial::addMemoryUsage(MemoryStatistics& statistics) const
+{
+    MaterialBase::addMemoryUsage(statistics);
+    statistics.resources[ResourceType::Material].deviceBytes += resourceByteSize(_ubo);
 }
 
 END_AURORA
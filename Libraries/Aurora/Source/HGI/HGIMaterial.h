@@ -27,10 +27,13 @@ class HGIMaterial : public MaterialBase
 {
 public:
     HGIMaterial(HGIRenderer* pRenderer, const string& name, MaterialShaderPtr pShader,
-        shared_ptr<MaterialDefinition> pDef);
+        shared_ptr<MaterialDefinition> pDef, shared_ptr<UniformArena> pArena);
     ~HGIMaterial() {};
 
-    void update();
+    // Records copies of the parts of the material's block in the uniform arena that intersect the
+    // specified dirty ranges to the material's UBO, with the specified blit commands.
+    void update(pxr::HgiBlitCmds* pBlitCmds, const vector<UniformArena::Range>& dirtyRanges);
+    void addMemoryUsage(MemoryStatistics& statistics) const override;
 
     pxr::HgiBufferHandle ubo() { return _ubo->handle(); }
 
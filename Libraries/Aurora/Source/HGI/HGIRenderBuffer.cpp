@@ -15,6 +15,7 @@
 #include "pch.h"
 
 #include "HGIRenderBuffer.h"
+#include <Aurora/Foundation/PixelConversion.h>
 #include "pxr/imaging/hgi/blitCmds.h"
 #include "pxr/imaging/hgi/blitCmdsOps.h"
 
@@ -39,6 +40,10 @@ HGIRenderBuffer::HGIRenderBuffer(
             _format = HgiFormat::HgiFormatFloat32Vec4;
             break;
         }
+        case ImageFormat::Float_R: {
+            _format = HgiFormat::HgiFormatFloat32;
+            break;
+        }
         default: {
             // worst case default to rgba888
             _format = HgiFormat::HgiFormatUNorm8Vec4;
@@ -65,36 +70,30 @@ void HGIRenderBuffer::resize(uint32_t /*width*/, uint32_t /*height*/) {
     // TODO: Implement me!
 }
 
-const void* HGIRenderBuffer::data(size_t& stride, bool /*removePadding*/)
+size_t HGIRenderBuffer::pixelSizeBytes() const
 {
-    size_t pixelSizeBytes = 0;
-    switch(_format) {
-        case HgiFormat::HgiFormatUNorm8Vec4: {
-            pixelSizeBytes = 4;
-            break;
-        }
-        case HgiFormat::HgiFormatFloat16Vec4: {
-            pixelSizeBytes = 2 * 4;
-            break;
-        }
-        case HgiFormat::HgiFormatFloat32Vec4: {
-            pixelSizeBytes = 4 * 4;
-            break;
-        }
-        default: {
-            // worst case default to rgba888
-            pixelSizeBytes = 4;
-            assert(false);
-            break;
-        }
+    switch (_format)
+    {
+    case HgiFormat::HgiFormatUNorm8Vec4:
+        return 4;
+    case HgiFormat::HgiFormatFloat16Vec4:
+        return 2 * 4;
+    case HgiFormat::HgiFormatFloat32Vec4:
+        return 4 * 4;
+    case HgiFormat::HgiFormatFloat32:
+        return 4;
+    default:
+        // worst case default to rgba888
+        assert(false);
+        return 4;
     }
+}
 
-    // Stride is always just width*pixel-size.  No row padding.
-    stride                = _width * pixelSizeBytes;
-
+void HGIRenderBuffer::copyToCPU(std::vector<uint8_t>& buffer, HgiSubmitWaitType waitType)
+{
     // Ensure CPU buffer is big enough for pixels.
-    size_t dataByteSize = _width * _height * pixelSizeBytes;
-    _mappedBuffer.resize(dataByteSize);
+    size_t dataByteSize = _width * _height * pixelSizeBytes();
+    buffer.resize(dataByteSize);
 
     // Setup commands to blit storage buffer contents to CPU buffer.
     HgiBlitCmdsUniquePtr blitCmds = _pRenderer->hgi()->CreateBlitCmds();
@@ -103,17 +102,300 @@ const void* HGIRenderBuffer::data(size_t& stride, bool /*removePadding*/)
         copyOp.gpuSourceTexture          = _storageTex->handle();
         copyOp.sourceTexelOffset         = GfVec3i(0);
         copyOp.mipLevel                  = 0;
-        copyOp.cpuDestinationBuffer      = _mappedBuffer.data();
+        copyOp.cpuDestinationBuffer      = buffer.data();
         copyOp.destinationByteOffset     = 0;
         copyOp.destinationBufferByteSize = dataByteSize;
         blitCmds->CopyTextureGpuToCpu(copyOp);
     }
 
+    // Submit the commands, waiting for them if required.
+    _pRenderer->hgi()->SubmitCmds(blitCmds.get(), waitType);
+}
+
+const void* HGIRenderBuffer::data(size_t& stride, bool /*removePadding*/)
+{
+    // Stride is always just width*pixel-size.  No row padding.
+    stride = _width * pixelSizeBytes();
+
     // Submit blocking commands.
-    _pRenderer->hgi()->SubmitCmds(blitCmds.get(), HgiSubmitWaitTypeWaitUntilCompleted);
+    copyToCPU(_mappedBuffer, HgiSubmitWaitTypeWaitUntilCompleted);
+
+    // Denoise the buffer in place, if enabled.
+    if (_isCPUDenoisingEnabled)
+    {
+        denoise(_mappedBuffer.data(), _mappedBuffer.data(), false);
+    }
 
     // Return pointer to CPU buffer.
     return _mappedBuffer.data();
 }
 
+IRenderBuffer::IBufferPtr HGIRenderBuffer::asReadable(size_t& stride)
+{
+    // Stride is always just width*pixel-size.  No row padding.
+    stride = _width * pixelSizeBytes();
+
+    // Start reading back every frame from now on.
+    _isReadbackEnabled = true;
+
+    // Find the most recent frame. If it is still pending, return the previous completed frame
+    // instead, unless that was already done and no frame has been rendered since, i.e. rendering
+    // has stopped. In that case (or if there is no previous frame) wait for the pending frame with
+    // a blocking copy, so that the client always ends up with the latest frame.
+    ReadbackSlot* pLatest = latestReadbackSlot();
+    if (pLatest && pLatest->isPending)
+    {
+        ReadbackSlot* pCompleted = nullptr;
+        for (ReadbackSlot& slot : _readbackSlots)
+        {
+            if (slot.pData && !slot.isPending &&
+                (!pCompleted || slot.frameNumber > pCompleted->frameNumber))
+            {
+                pCompleted = &slot;
+            }
+        }
+        if (pCompleted && !_hasReturnedStaleFrame)
+        {
+            _hasReturnedStaleFrame = true;
+            return readableBuffer(*pCompleted);
+        }
+        copyToCPU(*pLatest->pData, HgiSubmitWaitTypeWaitUntilCompleted);
+        pLatest->isPending = false;
+    }
+    else if (!pLatest)
+    {
+        // No frame has been read back yet, so do a blocking copy.
+        pLatest = freeReadbackSlot();
+        copyToCPU(*pLatest->pData, HgiSubmitWaitTypeWaitUntilCompleted);
+        pLatest->frameNumber = ++_readbackFrameNumber;
+    }
+    _hasReturnedStaleFrame = false;
+
+    return readableBuffer(*pLatest);
+}
+
+IRenderBuffer::IBufferPtr HGIRenderBuffer::readableBuffer(const ReadbackSlot& slot)
+{
+    if (!_isCPUDenoisingEnabled)
+        return std::make_shared<HGIReadbackBuffer>(slot.pData);
+
+    // Denoise the frame, unless it was already denoised. A new buffer is allocated if the client
+    // is still holding the previous denoised frame.
+    if (!_pDenoisedData || _denoisedFrameNumber != slot.frameNumber)
+    {
+        if (!_pDenoisedData || _pDenoisedData.use_count() > 1)
+            _pDenoisedData = std::make_shared<std::vector<uint8_t>>();
+        _pDenoisedData->resize(slot.pData->size());
+        denoise(slot.pData->data(), _pDenoisedData->data(), true);
+        _denoisedFrameNumber = slot.frameNumber;
+    }
+
+    return std::make_shared<HGIReadbackBuffer>(_pDenoisedData);
+}
+
+void HGIRenderBuffer::queueReadback()
+{
+    if (!_isReadbackEnabled)
+        return;
+
+    // Any pending copy has completed, as the renderer waits for its own work each frame, and the
+    // commands are executed in order.
+    for (ReadbackSlot& slot : _readbackSlots)
+    {
+        slot.isPending = false;
+    }
+
+    // Copy the frame to a free readback buffer, without waiting. If the client is holding all the
+    // other buffers, the frame is skipped.
+    ReadbackSlot* pSlot = freeReadbackSlot();
+    if (!pSlot)
+        return;
+    copyToCPU(*pSlot->pData, HgiSubmitWaitTypeNoWait);
+    pSlot->frameNumber     = ++_readbackFrameNumber;
+    pSlot->isPending       = true;
+    _hasReturnedStaleFrame = false;
+}
+
+HGIRenderBuffer::ReadbackSlot* HGIRenderBuffer::latestReadbackSlot()
+{
+    ReadbackSlot* pLatest = nullptr;
+    for (ReadbackSlot& slot : _readbackSlots)
+    {
+        if (slot.pData && (!pLatest || slot.frameNumber > pLatest->frameNumber))
+        {
+            pLatest = &slot;
+        }
+    }
+
+    return pLatest;
+}
+
+HGIRenderBuffer::ReadbackSlot* HGIRenderBuffer::freeReadbackSlot()
+{
+    // Find the oldest slot that is not pending, is not the most recent completed frame, and is
+    // not held by the client. Unused slots have a frame number of zero so are chosen first.
+    ReadbackSlot* pLatestCompleted = nullptr;
+    for (ReadbackSlot& slot : _readbackSlots)
+    {
+        if (slot.pData && !slot.isPending &&
+            (!pLatestCompleted || slot.frameNumber > pLatestCompleted->frameNumber))
+        {
+            pLatestCompleted = &slot;
+        }
+    }
+    ReadbackSlot* pFree = nullptr;
+    for (ReadbackSlot& slot : _readbackSlots)
+    {
+        bool isHeld = slot.pData && slot.pData.use_count() > 1;
+        if (slot.isPending || &slot == pLatestCompleted || isHeld)
+            continue;
+        if (!pFree || slot.frameNumber < pFree->frameNumber)
+            pFree = &slot;
+    }
+    if (pFree && !pFree->pData)
+        pFree->pData = std::make_shared<std::vector<uint8_t>>();
+
+    return pFree;
+}
+
+bool HGIRenderBuffer::setCPUDenoisingEnabled(bool enabled, const IRenderBufferPtr& pAlbedo,
+    const IRenderBufferPtr& pNormal, const IRenderBufferPtr& pDepth)
+{
+    // Only four channel color formats can be denoised.
+    if (enabled && _format != HgiFormat::HgiFormatUNorm8Vec4 &&
+        _format != HgiFormat::HgiFormatFloat16Vec4 && _format != HgiFormat::HgiFormatFloat32Vec4)
+    {
+        AU_WARN("CPU denoising is not supported for the render buffer format.");
+        return false;
+    }
+
+    _isCPUDenoisingEnabled = enabled;
+    _pDenoiserAlbedo       = enabled ? pAlbedo : nullptr;
+    _pDenoiserNormal       = enabled ? pNormal : nullptr;
+    _pDenoiserDepth        = enabled ? pDepth : nullptr;
+    _pDenoisedData.reset();
+    _denoisedFrameNumber = 0;
+
+    return true;
+}
+
+void HGIRenderBuffer::denoise(const uint8_t* pSource, uint8_t* pDest, bool isReadable)
+{
+    // Convert the color to float, and read the guide images that are available.
+    size_t pixelCount = static_cast<size_t>(_width) * _height;
+    _denoiserColor.resize(pixelCount * 4);
+    convertToFloat(pSource, _denoiserColor.data());
+    bool hasAlbedo = readAsFloat(_pDenoiserAlbedo, isReadable, _denoiserAlbedo);
+    bool hasNormal = readAsFloat(_pDenoiserNormal, isReadable, _denoiserNormal);
+    bool hasDepth  = readAsFloat(_pDenoiserDepth, isReadable, _denoiserDepth);
+
+    // The denoiser uses a single channel for depth, so keep only the first channel.
+    if (hasDepth)
+    {
+        for (size_t i = 0; i < pixelCount; i++)
+        {
+            _denoiserDepth[i] = _denoiserDepth[i * 4];
+        }
+    }
+
+    // Denoise the color in place, and convert it back to the buffer format.
+    DenoiserImages images;
+    images.width   = _width;
+    images.height  = _height;
+    images.pColor  = _denoiserColor.data();
+    images.pAlbedo = hasAlbedo ? _denoiserAlbedo.data() : nullptr;
+    images.pNormal = hasNormal ? _denoiserNormal.data() : nullptr;
+    images.pDepth  = hasDepth ? _denoiserDepth.data() : nullptr;
+    images.pOutput = _denoiserColor.data();
+    denoiseImage(images);
+    convertFromFloat(_denoiserColor.data(), pDest);
+}
+
+bool HGIRenderBuffer::readAsFloat(
+    const IRenderBufferPtr& pBuffer, bool isReadable, std::vector<float>& pixels)
+{
+    // The guide must be an HGI render buffer with the same dimensions.
+    HGIRenderBuffer* pHGIBuffer = dynamic_cast<HGIRenderBuffer*>(pBuffer.get());
+    if (!pHGIBuffer)
+        return false;
+    if (pHGIBuffer->_width != _width || pHGIBuffer->_height != _height)
+    {
+        AU_WARN("CPU denoiser guide image dimensions do not match the render buffer.");
+        return false;
+    }
+
+    // Read the guide in the same way as the color, and convert it to float.
+    size_t stride = 0;
+    IBufferPtr pReadable;
+    const void* pData = nullptr;
+    if (isReadable)
+    {
+        pReadable = pHGIBuffer->asReadable(stride);
+        pData     = pReadable->data();
+    }
+    else
+    {
+        pData = pHGIBuffer->data(stride, true);
+    }
+    pixels.resize(static_cast<size_t>(_width) * _height * 4);
+    if (!pHGIBuffer->convertToFloat(static_cast<const uint8_t*>(pData), pixels.data()))
+    {
+        AU_WARN("CPU denoiser guide image format is not supported.");
+        return false;
+    }
+
+    return true;
+}
+
+bool HGIRenderBuffer::convertToFloat(const uint8_t* pSource, float* pDest) const
+{
+    size_t pixelCount = static_cast<size_t>(_width) * _height;
+    size_t count      = pixelCount * 4;
+    switch (_format)
+    {
+    case HgiFormat::HgiFormatUNorm8Vec4:
+        for (size_t i = 0; i < count; i++)
+        {
+            pDest[i] = pSource[i] / 255.0f;
+        }
+        return true;
+    case HgiFormat::HgiFormatFloat16Vec4:
+        Foundation::convertHalfToFloat(reinterpret_cast<const uint16_t*>(pSource), pDest, count);
+        return true;
+    case HgiFormat::HgiFormatFloat32Vec4:
+        std::memcpy(pDest, pSource, count * sizeof(float));
+        return true;
+    case HgiFormat::HgiFormatFloat32:
+    {
+        // Single channel data, e.g. depth, is stored in the first channel of each pixel.
+        const float* pFloatSource = reinterpret_cast<const float*>(pSource);
+        std::fill_n(pDest, count, 0.0f);
+        for (size_t i = 0; i < pixelCount; i++)
+        {
+            pDest[i * 4] = pFloatSource[i];
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+void HGIRenderBuffer::convertFromFloat(const float* pSource, uint8_t* pDest) const
+{
+    size_t count = static_cast<size_t>(_width) * _height * 4;
+    switch (_format)
+    {
+    case HgiFormat::HgiFormatFloat16Vec4:
+        Foundation::convertFloatToHalf(pSource, reinterpret_cast<uint16_t*>(pDest), count);
+        break;
+    case HgiFormat::HgiFormatFloat32Vec4:
+        std::memcpy(pDest, pSource, count * sizeof(float));
+        break;
+    default:
+        Foundation::convertFloatToUNorm8(pSource, pDest, count);
+        break;
+    }
+}
+
 END_AURORA
@@ -34,15 +34,63 @@ public:
     // ITarget function implementations.
     void resize(uint32_t width, uint32_t height) override;
 
-    IBufferPtr asReadable(size_t& /*stride*/) override { return nullptr; }
+    // Returns the most recent frame that has been completely read back to the CPU. If a later
+    // frame is still being read back, this returns the previous frame rather than waiting, so that
+    // the client can process it while the next frame renders.
+    IBufferPtr asReadable(size_t& stride) override;
 
     IBufferPtr asShared() override { return std::make_shared<HGIBuffer>(this); }
 
+    bool setCPUDenoisingEnabled(bool enabled, const IRenderBufferPtr& pAlbedo,
+        const IRenderBufferPtr& pNormal, const IRenderBufferPtr& pDepth) override;
+
     pxr::HgiTextureHandle storageTex() { return _storageTex->handle(); }
     uint32_t width() { return _width; }
     uint32_t height() { return _height; }
 
+    // Queues a copy of the storage texture to the next free readback buffer, without waiting for
+    // it to complete. This is called by the renderer after each frame, and does nothing until the
+    // client has called asReadable().
+    void queueReadback();
+
 private:
+    // The number of readback buffers: one being copied by the GPU, one holding the most recent
+    // completed frame, and one that may still be held by the client from the previous frame.
+    static constexpr int kReadbackBufferCount = 3;
+
+    // A CPU buffer that receives a copy of the storage texture.
+    struct ReadbackSlot
+    {
+        std::shared_ptr<std::vector<uint8_t>> pData;
+        uint64_t frameNumber = 0;
+        bool isPending       = false;
+    };
+
+    // An IBuffer that keeps a readback buffer alive while it is held by the client.
+    class HGIReadbackBuffer : public IRenderBuffer::IBuffer
+    {
+    public:
+        HGIReadbackBuffer(const std::shared_ptr<std::vector<uint8_t>>& pData) : _pData(pData) {}
+
+        const void* data() override { return _pData->data(); }
+
+    private:
+        std::shared_ptr<std::vector<uint8_t>> _pData;
+    };
+
+    size_t pixelSizeBytes() const;
+    void copyToCPU(std::vector<uint8_t>& buffer, pxr::HgiSubmitWaitType waitType);
+    ReadbackSlot* latestReadbackSlot();
+    ReadbackSlot* freeReadbackSlot();
+    IBufferPtr readableBuffer(const ReadbackSlot& slot);
+
+    // Functions for CPU denoising. The guide images are read in the same way as the color image,
+    // i.e. with data() or asReadable(), so that they are from the same frame.
+    void denoise(const uint8_t* pSource, uint8_t* pDest, bool isReadable);
+    bool readAsFloat(const IRenderBufferPtr& pBuffer, bool isReadable, std::vector<float>& pixels);
+    bool convertToFloat(const uint8_t* pSource, float* pDest) const;
+    void convertFromFloat(const float* pSource, uint8_t* pDest) const;
+
     class HGIBuffer : public IRenderBuffer::IBuffer
     {
     public:
@@ -62,6 +110,20 @@ private:
     uint32_t _height;
     pxr::HgiFormat _format;
     std::vector<uint8_t> _mappedBuffer;
+    ReadbackSlot _readbackSlots[kReadbackBufferCount];
+    uint64_t _readbackFrameNumber = 0;
+    bool _isReadbackEnabled       = false;
+    bool _hasReturnedStaleFrame   = false;
+    bool _isCPUDenoisingEnabled   = false;
+    IRenderBufferPtr _pDenoiserAlbedo;
+    IRenderBufferPtr _pDenoiserNormal;
+    IRenderBufferPtr _pDenoiserDepth;
+    std::shared_ptr<std::vector<uint8_t>> _pDenoisedData;
+    uint64_t _denoisedFrameNumber = 0;
+    std::vector<float> _denoiserColor;
+    std::vector<float> _denoiserAlbedo;
+    std::vector<float> _denoiserNormal;
+    std::vector<float> _denoiserDepth;
 };
 
 END_AURORA
@@ -26,6 +26,7 @@
 #include "HGIRenderer.h"
 #include "HGIScene.h"
 #include "HGIWindow.h"
+#include "SampleSequence.h"
 
 using namespace pxr;
 
@@ -71,7 +72,8 @@ HGIRenderer::~HGIRenderer()
     _frameDataUbo.reset();
     _sampleDataUbo.reset();
     _postProcessingUbo.reset();
-    _accumulationComputeResourceBindings.reset();
+    _blueNoiseBuffer.reset();
+    _lstAccumulationComputeResourceBindings.clear();
     _accumulationComputePipeline.reset();
     _postProcessComputeResourceBindings.reset();
     _postProcessComputePipeline.reset();
@@ -108,11 +110,13 @@ void HGIRenderer::createResources()
     // Create UBO buffer object.
     _frameDataUbo = HgiBufferHandleWrapper::create(hgi()->CreateBuffer(rtUboDesc), hgi());
 
-    // Create UBO buffer description for sample data.
+    // Create UBO buffer description for sample data, with a slot for each sample that can be
+    // submitted without waiting for the GPU.
+    static_assert(sizeof(SampleData) <= kSampleDataSlotStride, "Sample data slot too small");
     HgiBufferDesc sampleDataUboDesc;
     sampleDataUboDesc.debugName = "Raytracing sample data UBO";
     sampleDataUboDesc.usage     = HgiBufferUsageUniform;
-    sampleDataUboDesc.byteSize  = sizeof(SampleData);
+    sampleDataUboDesc.byteSize  = kSampleDataSlotCount * kSampleDataSlotStride;
 
     // Create UBO buffer object.
     _sampleDataUbo = HgiBufferHandleWrapper::create(hgi()->CreateBuffer(sampleDataUboDesc), hgi());
@@ -128,6 +132,17 @@ void HGIRenderer::createResources()
     _postProcessingUbo =
         HgiBufferHandleWrapper::create(hgi()->CreateBuffer(postProcUboDesc), hgi());
 
+    // Create a storage buffer with the blue-noise mask, which is used by the blue-noise sampler.
+    // This is generated once and never changes.
+    vector<vec2> blueNoise = SampleSequence::buildBlueNoise(SampleSequence::kBlueNoiseSize, 0);
+    HgiBufferDesc blueNoiseBufferDesc;
+    blueNoiseBufferDesc.debugName   = "Blue noise storage buffer";
+    blueNoiseBufferDesc.usage       = HgiBufferUsageStorage;
+    blueNoiseBufferDesc.initialData = blueNoise.data();
+    blueNoiseBufferDesc.byteSize    = sizeof(vec2) * blueNoise.size();
+    _blueNoiseBuffer =
+        HgiBufferHandleWrapper::create(hgi()->CreateBuffer(blueNoiseBufferDesc), hgi());
+
     // All render buffers are RGBA32f
     HgiFormat hgiFormat = HgiFormat::HgiFormatFloat32Vec4;
 
@@ -320,15 +335,21 @@ void HGIRenderer::createResources()
     bufferDesc1.resourceType = HgiBindResourceTypeUniformBuffer;
     bufferDesc1.stageUsage   = HgiShaderStageCompute;
 
-    // Create resource description for accumulation compute shader.
+    // Create resource description for accumulation compute shader, with resource bindings for
+    // each slot of the sample data ring.
     HgiResourceBindingsDesc resourceDesc;
     resourceDesc.debugName = "AccumulationComputeShaderResources";
     resourceDesc.buffers.push_back(std::move(bufferDesc0));
     resourceDesc.textures.push_back(accumTexBind);
     resourceDesc.textures.push_back(accumInTexBind);
     resourceDesc.textures.push_back(directTexBind);
-    _accumulationComputeResourceBindings = HgiResourceBindingsHandleWrapper::create(
-        hgi()->CreateResourceBindings(resourceDesc), hgi());
+    _lstAccumulationComputeResourceBindings.resize(kSampleDataSlotCount);
+    for (uint32_t slot = 0; slot < kSampleDataSlotCount; slot++)
+    {
+        resourceDesc.buffers[0].offsets               = { slot * kSampleDataSlotStride };
+        _lstAccumulationComputeResourceBindings[slot] = HgiResourceBindingsHandleWrapper::create(
+            hgi()->CreateResourceBindings(resourceDesc), hgi());
+    }
 
     // Create resource description for post-processing compute shader.
     HgiResourceBindingsDesc postProcessResourceDesc;
@@ -378,6 +399,20 @@ IImagePtr HGIRenderer::createImagePointer(const IImage::InitData& initData)
     return make_shared<HGIImage>(this, initData);
 }
 
+bool HGIRenderer::isCompressedImageFormatSupported(ImageFormat format, bool linearize) const
+{
+    // HGI has BC7 with and without sRGB, BC1 without sRGB, and no BC4 or BC5 formats.
+    switch (format)
+    {
+    case ImageFormat::BC7_RGBA:
+        return true;
+    case ImageFormat::BC1_RGBA:
+        return !linearize;
+    default:
+        return false;
+    }
+}
+
 IMaterialPtr HGIRenderer::createMaterialPointer(
     const std::string& materialType, const std::string& /*document*/, const std::string& name)
 {
@@ -392,7 +427,7 @@ IMaterialPtr HGIRenderer::createMaterialPointer(
 
     // Create and return a new material object.
     return make_shared<HGIMaterial>(
-        this, name, _pDefaultMaterialShader, _pDefaultMaterialDefinition);
+        this, name, _pDefaultMaterialShader, _pDefaultMaterialDefinition, _pMaterialArena);
 }
 
 IGeometryPtr HGIRenderer::createGeometryPointer(
@@ -431,96 +466,126 @@ void HGIRenderer::render(uint32_t sampleStart, uint32_t sampleCount)
     // Must have opaque shadows on HGI currently.
     _values.setValue(kLabelIsForceOpaqueShadowsEnabled, true);
 
-    // Render all the samples.
-    for (uint32_t i = 0; i < sampleCount; i++)
+    // Render all the samples as a single HGI frame, submitting them without waiting for the GPU
+    // between samples.
+    hgi()->StartFrame();
+    recordSampleBatch(*this, kSampleDataSlotCount, sampleStart, sampleCount);
+    hgi()->EndFrame();
+}
+
+void HGIRenderer::uploadFrameData()
+{
+    // Update the frame data and post processing data UBOs using their staging buffers, if needed,
+    // with a single set of blit commands. The whole render buffer is always rendered, as regions
+    // are not supported by this renderer, though it can be a tile of a larger image.
+    pxr::HgiBlitCmdsUniquePtr blitCmds = hgi()->CreateBlitCmds();
+    bool isUpdated                     = false;
+    uvec2 dimensions(_pRenderBuffer->width(), _pRenderBuffer->height());
+    FrameData* pFrameData = getStagingAddress<FrameData>(_frameDataUbo);
+    if (updateFrameDataGPUStruct(dimensions, pFrameData))
+    {
+        pxr::HgiBufferCpuToGpuOp blitOp;
+        blitOp.byteSize              = sizeof(FrameData);
+        blitOp.cpuSourceBuffer       = pFrameData;
+        blitOp.sourceByteOffset      = 0;
+        blitOp.gpuDestinationBuffer  = _frameDataUbo->handle();
+        blitOp.destinationByteOffset = 0;
+        blitCmds->CopyBufferCpuToGpu(blitOp);
+        isUpdated = true;
+    }
+    PostProcessing* pPostProcessing = getStagingAddress<PostProcessing>(_postProcessingUbo);
+    if (updatePostProcessingGPUStruct(dimensions, pPostProcessing))
     {
-        uint32_t sampleIndex = sampleStart + i;
-
-        // Each sample is a separate HGI frame.
-        hgi()->StartFrame();
-
-        // Update the frame data UBO using staging buffer, if needed.
-        if (updateFrameDataGPUStruct(getStagingAddress<FrameData>(_frameDataUbo)))
-        {
-            pxr::HgiBlitCmdsUniquePtr blitCmds = hgi()->CreateBlitCmds();
-            pxr::HgiBufferCpuToGpuOp blitOp;
-            blitOp.byteSize              = sizeof(FrameData);
-            blitOp.cpuSourceBuffer       = getStagingAddress<FrameData>(_frameDataUbo);
-            blitOp.sourceByteOffset      = 0;
-            blitOp.gpuDestinationBuffer  = _frameDataUbo->handle();
-            blitOp.destinationByteOffset = 0;
-            blitCmds->CopyBufferCpuToGpu(blitOp);
-            hgi()->SubmitCmds(blitCmds.get());
-        }
-
-        // Update the post processing data UBO using staging buffer, if needed.
-        if (updatePostProcessingGPUStruct(getStagingAddress<PostProcessing>(_postProcessingUbo)))
-        {
-            pxr::HgiBlitCmdsUniquePtr blitCmds = hgi()->CreateBlitCmds();
-            pxr::HgiBufferCpuToGpuOp blitOp;
-            blitOp.byteSize = sizeof(PostProcessing);
-            blitOp.cpuSourceBuffer =
-                getStagingAddress<PostProcessing>(_postProcessingUbo->handle());
-            blitOp.sourceByteOffset      = 0;
-            blitOp.gpuDestinationBuffer  = _postProcessingUbo->handle();
-            blitOp.destinationByteOffset = 0;
-            blitCmds->CopyBufferCpuToGpu(blitOp);
-            hgi()->SubmitCmds(blitCmds.get());
-        }
-
-        // Update the sample data with the current sample index.
-        SampleData* pSampleDataStaging  = getStagingAddress<SampleData>(_sampleDataUbo);
-        pSampleDataStaging->sampleIndex = sampleIndex;
-        pSampleDataStaging->seedOffset  = 0;
-
-        // Update the sample data on the GPU for every iteration of loop.
-        pxr::HgiBlitCmdsUniquePtr blitCmds = hgi()->CreateBlitCmds();
         pxr::HgiBufferCpuToGpuOp blitOp;
-        blitOp.byteSize              = sizeof(SampleData);
-        blitOp.cpuSourceBuffer       = pSampleDataStaging;
+        blitOp.byteSize              = sizeof(PostProcessing);
+        blitOp.cpuSourceBuffer       = pPostProcessing;
         blitOp.sourceByteOffset      = 0;
-        blitOp.gpuDestinationBuffer  = _sampleDataUbo->handle();
+        blitOp.gpuDestinationBuffer  = _postProcessingUbo->handle();
         blitOp.destinationByteOffset = 0;
         blitCmds->CopyBufferCpuToGpu(blitOp);
+        isUpdated = true;
+    }
+    if (isUpdated)
+    {
         hgi()->SubmitCmds(blitCmds.get());
+    }
+}
 
-        // Create ray tracing commands for frame.
-        HgiRayTracingCmdsUniquePtr rtCmds = hgi()->CreateRayTracingCmds();
-        rtCmds->PushDebugGroup("Frame Render RT commands");
-        rtCmds->BindPipeline(pHGIScene->rayTracingPipeline());
-        rtCmds->BindResources(pHGIScene->resourceBindings());
-        rtCmds->TraceRays(_pRenderBuffer->width(), _pRenderBuffer->height(), 1);
-        rtCmds->PopDebugGroup();
-
-        // Submit the ray tracing commands for frame.
-        hgi()->SubmitCmds(rtCmds.get());
-
-        // Create accumulation compute commands for frame.
-        HgiComputeCmdsUniquePtr computeCmds = hgi()->CreateComputeCmds({});
-        computeCmds->PushDebugGroup("Accumulation Compute Commands");
-        computeCmds->BindResources(_accumulationComputeResourceBindings->handle());
-        computeCmds->BindPipeline(_accumulationComputePipeline->handle());
-        computeCmds->Dispatch(_pRenderBuffer->width(), _pRenderBuffer->height());
-
-        // Submit the accumulation commands (which will update the accumulation buffer from the
-        // direct light buffer created by ray tracing)
-        hgi()->SubmitCmds(computeCmds.get(), HgiSubmitWaitTypeWaitUntilCompleted);
-
-        // If this is the last frame, run the post processing compute shader, to get final image.
-        if (i == sampleCount - 1)
-        {
-            HgiComputeCmdsUniquePtr postProcessComputeCmds = hgi()->CreateComputeCmds({});
-            postProcessComputeCmds->PushDebugGroup("Post Process Compute Commands");
-            postProcessComputeCmds->BindResources(_postProcessComputeResourceBindings->handle());
-            postProcessComputeCmds->BindPipeline(_postProcessComputePipeline->handle());
-            postProcessComputeCmds->Dispatch(_pRenderBuffer->width(), _pRenderBuffer->height());
-            hgi()->SubmitCmds(postProcessComputeCmds.get(), HgiSubmitWaitTypeWaitUntilCompleted);
-        }
-
-        // End HGI frame rendering.
-        hgi()->EndFrame();
+void HGIRenderer::uploadSampleData(uint32_t firstSlot, uint32_t firstSampleIndex, uint32_t count)
+{
+    // Write the sample data for each sample to its slot in the staging buffer.
+    uint8_t* pStaging = static_cast<uint8_t*>(_sampleDataUbo->handle()->GetCPUStagingAddress());
+    for (uint32_t i = 0; i < count; i++)
+    {
+        SampleData* pSampleData =
+            reinterpret_cast<SampleData*>(pStaging + (firstSlot + i) * kSampleDataSlotStride);
+        pSampleData->sampleIndex = firstSampleIndex + i;
+        pSampleData->seedOffset  = 0;
     }
 
+    // Copy the slots to the GPU with a single blit. The source and destination offsets match, so
+    // the data is copied directly from the staging buffer.
+    pxr::HgiBlitCmdsUniquePtr blitCmds = hgi()->CreateBlitCmds();
+    pxr::HgiBufferCpuToGpuOp blitOp;
+    blitOp.byteSize              = (count - 1) * kSampleDataSlotStride + sizeof(SampleData);
+    blitOp.cpuSourceBuffer       = pStaging;
+    blitOp.sourceByteOffset      = firstSlot * kSampleDataSlotStride;
+    blitOp.gpuDestinationBuffer  = _sampleDataUbo->handle();
+    blitOp.destinationByteOffset = firstSlot * kSampleDataSlotStride;
+    blitCmds->CopyBufferCpuToGpu(blitOp);
+    hgi()->SubmitCmds(blitCmds.get());
+}
+
+void HGIRenderer::renderSample(uint32_t slot, bool wait)
+{
+    HGIScenePtr pHGIScene = hgiScene();
+
+    // Create ray tracing commands for the sample, reading the sample data from the slot.
+    HgiRayTracingCmdsUniquePtr rtCmds = hgi()->CreateRayTracingCmds();
+    rtCmds->PushDebugGroup("Frame Render RT commands");
+    rtCmds->BindPipeline(pHGIScene->rayTracingPipeline());
+    rtCmds->BindResources(pHGIScene->resourceBindings(slot));
+    rtCmds->TraceRays(_pRenderBuffer->width(), _pRenderBuffer->height(), 1);
+    rtCmds->PopDebugGroup();
+
+    // Submit the ray tracing commands for the sample.
+    hgi()->SubmitCmds(rtCmds.get());
+
+    // Create accumulation compute commands for the sample. These end with a memory barrier, as
+    // the next sample overwrites the direct light texture that is read here.
+    HgiComputeCmdsUniquePtr computeCmds = hgi()->CreateComputeCmds({});
+    computeCmds->PushDebugGroup("Accumulation Compute Commands");
+    computeCmds->BindResources(_lstAccumulationComputeResourceBindings[slot]->handle());
+    computeCmds->BindPipeline(_accumulationComputePipeline->handle());
+    computeCmds->Dispatch(_pRenderBuffer->width(), _pRenderBuffer->height());
+    computeCmds->InsertMemoryBarrier(HgiMemoryBarrierAll);
+    computeCmds->PopDebugGroup();
+
+    // Submit the accumulation commands (which will update the accumulation buffer from the
+    // direct light buffer created by ray tracing), only waiting if requested.
+    hgi()->SubmitCmds(computeCmds.get(),
+        wait ? HgiSubmitWaitTypeWaitUntilCompleted : HgiSubmitWaitTypeNoWait);
+}
+
+void HGIRenderer::postProcess(bool wait)
+{
+    // Run the post processing compute shader, to get final image.
+    HgiComputeCmdsUniquePtr postProcessComputeCmds = hgi()->CreateComputeCmds({});
+    postProcessComputeCmds->PushDebugGroup("Post Process Compute Commands");
+    postProcessComputeCmds->BindResources(_postProcessComputeResourceBindings->handle());
+    postProcessComputeCmds->BindPipeline(_postProcessComputePipeline->handle());
+    postProcessComputeCmds->Dispatch(_pRenderBuffer->width(), _pRenderBuffer->height());
+    hgi()->SubmitCmds(postProcessComputeCmds.get(),
+        wait ? HgiSubmitWaitTypeWaitUntilCompleted : HgiSubmitWaitTypeNoWait);
+
+    // Start reading back the final image and AOVs, without waiting, so that the client can read
+    // the previous frame while the next one renders.
+    _pRenderBuffer->queueReadback();
+    for (HGIRenderBuffer* pAOVRenderBuffer : _lstAOVRenderBuffer)
+    {
+        if (pAOVRenderBuffer)
+            pAOVRenderBuffer->queueReadback();
+    }
 }
 
 void HGIRenderer::waitForTask()
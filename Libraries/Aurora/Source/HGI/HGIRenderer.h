@@ -18,6 +18,7 @@
 #include "HGIHandleWrapper.h"
 #include "HGIMaterial.h"
 #include "HGIScene.h"
+#include "SampleBatch.h"
 
 BEGIN_AURORA
 
@@ -36,9 +37,15 @@ BufferType* getStagingAddress(HgiBufferHandleWrapper::Pointer& pBuffer)
 }
 
 // An rasterization (HGI) implementation for IRenderer.
-class HGIRenderer : public RendererBase
+class HGIRenderer : public RendererBase, private ISampleBatchCommands
 {
 public:
+    // The number of slots in the ring of sample data, i.e. the number of samples that can be
+    // submitted without waiting for the GPU, and the distance between the slots in bytes, which is
+    // the largest uniform buffer offset alignment required by common GPUs.
+    static constexpr uint32_t kSampleDataSlotCount  = 16;
+    static constexpr uint32_t kSampleDataSlotStride = 256;
+
     /*** Lifetime Management ***/
 
     HGIRenderer(uint32_t activeFrameCount);
@@ -68,10 +75,12 @@ public:
     void setLoadResourceFunction(LoadResourceFunction) override {}
 
     const std::vector<std::string>& builtInMaterials() override;
+    bool isCompressedImageFormatSupported(ImageFormat format, bool linearize) const override;
     pxr::HgiUniquePtr& hgi() { return _hgi; }
     const pxr::HgiUniquePtr& hgi() const { return _hgi; }
     const pxr::HgiBufferHandle& frameDataUbo() { return _frameDataUbo->handle(); }
     const pxr::HgiBufferHandle& sampleDataUbo() { return _sampleDataUbo->handle(); }
+    const pxr::HgiBufferHandle& blueNoiseBuffer() { return _blueNoiseBuffer->handle(); }
 
     HGIRenderBuffer* renderBuffer() { return _pRenderBuffer; }
 
@@ -94,12 +103,21 @@ public:
 
 private:
     void createResources();
+
+    /*** ISampleBatchCommands Functions ***/
+
+    void uploadFrameData() override;
+    void uploadSampleData(uint32_t firstSlot, uint32_t firstSampleIndex, uint32_t count) override;
+    void renderSample(uint32_t slot, bool wait) override;
+    void postProcess(bool wait) override;
+
     pxr::HgiUniquePtr _hgi;
     HGIRenderBuffer* _pRenderBuffer;
     HgiBufferHandleWrapper::Pointer _frameDataUbo;
     HgiBufferHandleWrapper::Pointer _sampleDataUbo;
     HgiBufferHandleWrapper::Pointer _postProcessingUbo;
-    HgiResourceBindingsHandleWrapper::Pointer _accumulationComputeResourceBindings;
+    HgiBufferHandleWrapper::Pointer _blueNoiseBuffer;
+    vector<HgiResourceBindingsHandleWrapper::Pointer> _lstAccumulationComputeResourceBindings;
     HgiComputePipelineHandleWrapper::Pointer _accumulationComputePipeline;
     HgiResourceBindingsHandleWrapper::Pointer _postProcessComputeResourceBindings;
     HgiComputePipelineHandleWrapper::Pointer _postProcessComputePipeline;
@@ -44,12 +44,16 @@ HGIInstance::HGIInstance(HGIRenderer* pRenderer, shared_ptr<HGIMaterial> pMateri
 HGIScene::HGIScene(HGIRenderer* pRenderer) : SceneBase(pRenderer), _pRenderer(pRenderer)
 {
     createDefaultResources();
+
+    // Track the dirty ranges of the renderer's material arena as a consumer, so that the material
+    // UBOs of this scene are updated independently of any other scenes.
+    _pMaterialArena        = _pRenderer->materialArena();
+    _materialArenaConsumer = _pMaterialArena->addConsumer();
 }
 
-// Sort function, used to sort lights to ensure deterministic ordering.
-bool compareLights(HGILight* first, HGILight* second)
+HGIScene::~HGIScene()
 {
-    return (first->index() < second->index());
+    _pMaterialArena->removeConsumer(_materialArenaConsumer);
 }
 
 bool HGIScene::update()
@@ -69,68 +73,13 @@ bool HGIScene::update()
 //    // Update the ground plane.
 //    _pGroundPlane->update();
 
-    // See if any distant lights have been changed this frame, and build vector of active lights.
-    bool distantLightsUpdated = false;
-    vector<HGILight*> currLights;
-    vector<int> lightsToDelete;
-    for (auto iter = _distantLights.begin(); iter != _distantLights.end(); iter++)
-    {
-        // Get the light and ensure weak pointer still valid.
-        HGILightPtr pLight = iter->second.lock();
-        if (pLight)
-        {
-            // Add to currently active light vector.
-            currLights.push_back(pLight.get());
-
-            // If the dirty flag is set, GPU data must be updated.
-            if (pLight->isDirty())
-            {
-                distantLightsUpdated = true;
-                pLight->clearDirtyFlag();
-            }
-        }
-        else
-        {
-            // If the weak pointer is not valid, add it to the list to be removed.
-            lightsToDelete.push_back(iter->first);
-            distantLightsUpdated = true;
-        }
-    }
-
-    // Remove the invalid pointers from the map.
-    // Outside the iterator loop as it's not safe to call erase from inside the loop.
-    for (size_t i = 0; i < lightsToDelete.size(); i++)
+    // Update the light data and light tree, if any lights have changed, and upload the local
+    // lights and light tree nodes. The buffers are always created on the first update, as they are
+    // required by the resource bindings even if there are no local lights.
+    bool lightsUpdated = updateLights();
+    if (lightsUpdated || !_localLightBuffer)
     {
-        _distantLights.erase(lightsToDelete[i]);
-    }
-
-    // If distant lights have changed update the LightData struct that is passed to the GPU.
-    if (distantLightsUpdated)
-    {
-        // Sort the lights by index, to ensure deterministic ordering.
-        sort(currLights.begin(), currLights.end(), compareLights);
-
-        // Set the distant light count to minimum of current light vector size and the max distant
-        // light limit.  Lights in the sorted array past LightLimits::kMaxDistantLights are ignored.
-        _lights.distantLightCount =
-            std::min(int(currLights.size()), int(LightLimits::kMaxDistantLights));
-
-        // Add to the light data buffer that is copied to the frame data for this frame.
-        for (int i = 0; i < _lights.distantLightCount; i++)
-        {
-            // Store the cosine of the radius for use in the shader.
-            _lights.distantLights[i].cosRadius =
-                cos(0.5f * currLights[i]->asFloat(Names::LightProperties::kAngularDiameter));
-
-            // Invert the direction for use in the shader.
-            _lights.distantLights[i].direction =
-                -currLights[i]->asFloat3(Names::LightProperties::kDirection);
-
-            // Store color in RGB and intensity in alpha.
-            _lights.distantLights[i].colorAndIntensity =
-                vec4(currLights[i]->asFloat3(Names::LightProperties::kColor),
-                    currLights[i]->asFloat(Names::LightProperties::kIntensity));
-        }
+        updateLightBuffers();
     }
 
     // If any active geometry resources have been modified, flush the vertex buffer pool in case
@@ -148,10 +97,7 @@ bool HGIScene::update()
     // samplers for all the active materials.
     if (_materials.changedThisFrame())
     {
-        for (HGIMaterial& mtl : _materials.modified().resources<HGIMaterial>())
-        {
-            mtl.update();
-        }
+        updateMaterialBuffers();
     }
 
     // Update the acceleration structure if any geometry or instances have been modified.
@@ -172,7 +118,7 @@ bool HGIScene::update()
 
         return true;
     }
-    else if (_environments.changedThisFrame())
+    else if (_environments.changedThisFrame() || lightsUpdated)
     {
         rebuildResourceBindings();
         return true;
@@ -181,6 +127,66 @@ bool HGIScene::update()
     return false;
 }
 
+void HGIScene::updateMaterialBuffers()
+{
+    // Take the dirty ranges of the material arena since this scene last updated. These are not
+    // combined across gaps, as each material has its own UBO. Materials are created when they are
+    // activated, so every material of this scene with dirty bytes is in the modified list.
+    vector<UniformArena::Range> dirtyRanges =
+        _pMaterialArena->takeDirtyRanges(_materialArenaConsumer, 0);
+
+    // Record the copies for all the modified materials, and submit them together.
+    pxr::HgiBlitCmdsUniquePtr blitCmds = _pRenderer->hgi()->CreateBlitCmds();
+    for (HGIMaterial& mtl : _materials.modified().resources<HGIMaterial>())
+    {
+        mtl.update(blitCmds.get(), dirtyRanges);
+    }
+    _pRenderer->hgi()->SubmitCmds(blitCmds.get());
+}
+
+void HGIScene::updateLightBuffers()
+{
+    // Create storage buffers for the local lights and the light tree nodes, with at least one
+    // element, as empty buffers can't be bound.
+    auto& hgi = _pRenderer->hgi();
+    const vector<LightTree::Light>& localLights = this->localLights();
+    const vector<LightTree::Node>& nodes        = lightTree().nodes();
+    size_t localLightBufferSize = sizeof(LightTree::Light) * std::max<size_t>(localLights.size(), 1);
+    size_t lightTreeBufferSize  = sizeof(LightTree::Node) * std::max<size_t>(nodes.size(), 1);
+
+    HgiBufferDesc localLightBufferDesc;
+    localLightBufferDesc.debugName = "Local light storage buffer";
+    localLightBufferDesc.usage     = HgiBufferUsageStorage;
+    localLightBufferDesc.byteSize  = localLightBufferSize;
+    _localLightBuffer =
+        HgiBufferHandleWrapper::create(hgi->CreateBuffer(localLightBufferDesc), hgi);
+
+    HgiBufferDesc lightTreeBufferDesc;
+    lightTreeBufferDesc.debugName = "Light tree storage buffer";
+    lightTreeBufferDesc.usage     = HgiBufferUsageStorage;
+    lightTreeBufferDesc.byteSize  = lightTreeBufferSize;
+    _lightTreeBuffer = HgiBufferHandleWrapper::create(hgi->CreateBuffer(lightTreeBufferDesc), hgi);
+
+    // Copy the local lights and light tree nodes to the buffers, if there are any.
+    if (localLights.empty())
+    {
+        return;
+    }
+    pxr::HgiBlitCmdsUniquePtr blitCmds = hgi->CreateBlitCmds();
+    pxr::HgiBufferCpuToGpuOp blitOp;
+    blitOp.byteSize              = sizeof(LightTree::Light) * localLights.size();
+    blitOp.cpuSourceBuffer       = localLights.data();
+    blitOp.sourceByteOffset      = 0;
+    blitOp.gpuDestinationBuffer  = _localLightBuffer->handle();
+    blitOp.destinationByteOffset = 0;
+    blitCmds->CopyBufferCpuToGpu(blitOp);
+    blitOp.byteSize             = sizeof(LightTree::Node) * nodes.size();
+    blitOp.cpuSourceBuffer      = nodes.data();
+    blitOp.gpuDestinationBuffer = _lightTreeBuffer->handle();
+    blitCmds->CopyBufferCpuToGpu(blitOp);
+    hgi->SubmitCmds(blitCmds.get());
+}
+
 int HGIScene::findTexture(const string& name) const
 {
     auto iter = _imageNameLookup.find(name);
@@ -561,7 +567,11 @@ void HGIScene::rebuildResourceBindings()
     //  - environment data UBO
     //  - materials data UBO
     //  - instance data UBO
-    resourceBindingsDesc.buffers.resize(5);
+    //  - environment alias map
+    //  - local light storage buffer
+    //  - light tree storage buffer
+    //  - blue-noise storage buffer
+    resourceBindingsDesc.buffers.resize(8);
     resourceBindingsDesc.buffers[0].bindingIndex = 2;
     resourceBindingsDesc.buffers[0].buffers      = { _pRenderer->frameDataUbo() };
     resourceBindingsDesc.buffers[0].offsets      = { 0 };
@@ -592,11 +602,33 @@ void HGIScene::rebuildResourceBindings()
         resourceBindingsDesc.buffers[4].resourceType = HgiBindResourceTypeUniformBuffer;
         resourceBindingsDesc.buffers[4].stageUsage   = HgiShaderStageRayGen | HgiShaderStageClosestHit;
     }
+
+    resourceBindingsDesc.buffers[5].bindingIndex = 12;
+    resourceBindingsDesc.buffers[5].buffers      = { _localLightBuffer->handle() };
+    resourceBindingsDesc.buffers[5].offsets      = { 0 };
+    resourceBindingsDesc.buffers[5].resourceType = HgiBindResourceTypeStorageBuffer;
+    resourceBindingsDesc.buffers[5].stageUsage   = HgiShaderStageRayGen;
+    resourceBindingsDesc.buffers[6].bindingIndex = 13;
+    resourceBindingsDesc.buffers[6].buffers      = { _lightTreeBuffer->handle() };
+    resourceBindingsDesc.buffers[6].offsets      = { 0 };
+    resourceBindingsDesc.buffers[6].resourceType = HgiBindResourceTypeStorageBuffer;
+    resourceBindingsDesc.buffers[6].stageUsage   = HgiShaderStageRayGen;
+    resourceBindingsDesc.buffers[7].bindingIndex = 14;
+    resourceBindingsDesc.buffers[7].buffers      = { _pRenderer->blueNoiseBuffer() };
+    resourceBindingsDesc.buffers[7].offsets      = { 0 };
+    resourceBindingsDesc.buffers[7].resourceType = HgiBindResourceTypeStorageBuffer;
+    resourceBindingsDesc.buffers[7].stageUsage   = HgiShaderStageRayGen;
     
-    // Create the resource bindings.
-    auto& hgi    = _pRenderer->hgi();
-    _resBindings = HgiResourceBindingsHandleWrapper::create(
-        hgi->CreateResourceBindings(resourceBindingsDesc), hgi);
+    // Create the resource bindings for each slot of the sample data ring, which only differ in
+    // the offset of the sample data.
+    auto& hgi = _pRenderer->hgi();
+    _lstResBindings.resize(HGIRenderer::kSampleDataSlotCount);
+    for (uint32_t slot = 0; slot < HGIRenderer::kSampleDataSlotCount; slot++)
+    {
+        resourceBindingsDesc.buffers[1].offsets = { slot * HGIRenderer::kSampleDataSlotStride };
+        _lstResBindings[slot]                   = HgiResourceBindingsHandleWrapper::create(
+            hgi->CreateResourceBindings(resourceBindingsDesc), hgi);
+    }
 }
 
 void HGIScene::createResources()
@@ -921,18 +953,14 @@ void HGIScene::rebuildPipeline()
 
 ILightPtr HGIScene::addLightPointer(const string& lightType)
 {
-    // Only distant lights are currently supported.
-    AU_ASSERT(lightType.compare(Names::LightTypes::kDistantLight) == 0,
-        "Only distant lights currently supported");
-
     // Assign arbritary index to ensure deterministic ordering.
     int index = _currentLightIndex++;
 
     // Create the light object.
     HGILightPtr pLight = make_shared<HGILight>(this, lightType, index);
 
-    // Add weak pointer to distant light map.
-    _distantLights[index] = pLight;
+    // Add to the active lights, which are updated with the scene.
+    addActiveLight(pLight);
 
     // Return the new light.
     return pLight;
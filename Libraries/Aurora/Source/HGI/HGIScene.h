@@ -107,6 +107,7 @@ class HGIScene : public SceneBase
 public:
     // Constructor and destructor.
     HGIScene(HGIRenderer* pRenderer);
+    ~HGIScene();
 
     /*** IScene Functions ***/
     void setGroundPlanePointer(const IGroundPlanePtr& pGroundPlane) override;
@@ -122,7 +123,12 @@ public:
 
     pxr::HgiAccelerationStructureHandle tlas() { return _tlas->handle(); }
 
-    pxr::HgiResourceBindingsHandle resourceBindings() { return _resBindings->handle(); }
+    // Gets the resource bindings that read the sample data from the specified slot of the sample
+    // data ring.
+    pxr::HgiResourceBindingsHandle resourceBindings(uint32_t slot)
+    {
+        return _lstResBindings[slot]->handle();
+    }
     const pxr::HgiBufferHandle& instanceDataUbo() { return _instanceDataUbo->handle(); }
 
     IInstancePtr addInstancePointer(const Path& /* path*/, const IGeometryPtr& pGeom,
@@ -132,20 +138,23 @@ public:
 
 private:
     int findTexture(const string& name) const;
-    
-    map<int, weak_ptr<HGILight>> _distantLights;
-    int _currentLightIndex = 0;
+    void updateLightBuffers();
+    void updateMaterialBuffers();
 
     HGIRenderer* _pRenderer = nullptr;
+    shared_ptr<UniformArena> _pMaterialArena;
+    UniformArena::ConsumerID _materialArenaConsumer = 0;
     HgiRayTracingPipelineHandleWrapper::Pointer _rayTracingPipeline;
     HgiAccelerationStructureHandleWrapper::Pointer _tlas;
     HgiAccelerationStructureGeometryHandleWrapper::Pointer _tlasGeom;
     vector<InstanceData> _lstInstances;
     HgiBufferHandleWrapper::Pointer _instanceDataUbo;
+    HgiBufferHandleWrapper::Pointer _localLightBuffer;
+    HgiBufferHandleWrapper::Pointer _lightTreeBuffer;
     vector<shared_ptr<HGIImage>> _lstImages;
     vector<shared_ptr<HGISampler>> _lstSamplers;
     map<string, int> _imageNameLookup;
-    HgiResourceBindingsHandleWrapper::Pointer _resBindings;
+    vector<HgiResourceBindingsHandleWrapper::Pointer> _lstResBindings;
     HgiTextureHandleWrapper::Pointer _pDefaultImage;
     HgiShaderFunctionHandleWrapper::Pointer _rayGenShaderFunc;
     HgiShaderFunctionHandleWrapper::Pointer _shadowMissShaderFunc;
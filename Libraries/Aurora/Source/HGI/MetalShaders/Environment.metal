@@ -78,9 +78,11 @@ float2 computeEnvironmentUV(float4x4 transform, bool useScreen, float3 direction
     float2 uv;
     if (useScreen)
     {
-        // Compute the texture coordinates from the dispatch index and dimensions.
-        float2 screenCoords = float2(DispatchRaysIndex().xy);
-        float2 screenSize   = float2(DispatchRaysDimensions().xy);
+        // Compute the texture coordinates from the pixel coordinates in the whole image, which
+        // is larger than the dispatch when a region or tile of the image is rendered.
+        float2 screenCoords = float2(DispatchRaysIndex().xy + uint2(gFrameData.regionOffset) +
+            uint2(gFrameData.tileOffset));
+        float2 screenSize = float2(uint2(gFrameData.imageSize));
         uv                  = screenCoords / screenSize;
     }
     else
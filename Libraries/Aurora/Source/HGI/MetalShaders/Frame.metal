@@ -34,8 +34,11 @@ struct LightData
     // Number of active distant lights.
     int distantLightCount;// = 0;
 
+    // Number of active local (point, spot, and rect) lights, sampled with the light tree.
+    int localLightCount;// = 0;
+
     // Explicitly pad struct to 16-byte boundary.
-    packed_int3 pad;
+    packed_int2 pad;
 };
 
 struct FrameData
@@ -92,8 +95,26 @@ struct FrameData
     // The maximum luminance for path tracing samples, for simple firefly clamping.
     float maxLuminance;
 
-    // Pad to 16 byte boundary.
-    packed_float2 _padding1;
+    // Whether to randomly terminate paths with Russian roulette, based on path throughput.
+    int isRussianRouletteEnabled;
+
+    // The path depth (number of bounces) after which Russian roulette is applied.
+    int russianRouletteDepth;
+
+    // The sampler type used to generate random numbers, one of SAMPLER_TYPE_*.
+    int samplerType;
+
+    // Explicitly pad to 8-byte boundary.
+    int _padding1;
+
+    // The offset of the rendered region in the targets, which is added to the dispatch index to
+    // get the target coordinates of a pixel.
+    packed_uint2 regionOffset;
+
+    // The dimensions of the whole image, and the offset of the targets in the image, when the
+    // targets are a tile of a larger image. Otherwise these are the target dimensions and zero.
+    packed_uint2 imageSize;
+    packed_uint2 tileOffset;
 
     // Current light data for scene (duplicated each frame in flight.)
     LightData lights;
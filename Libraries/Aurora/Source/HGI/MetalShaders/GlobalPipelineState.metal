@@ -52,6 +52,45 @@ struct AliasEntry
     float _padding1;
 };
 
+// The types of local light.
+// Must match CPU enum LightType in LightTree.h.
+#define LOCAL_LIGHT_POINT 0
+#define LOCAL_LIGHT_SPOT 1
+#define LOCAL_LIGHT_RECT 2
+
+// Layout of a local (point, spot, or rect) light.
+// Must match CPU struct Light in LightTree.h.
+struct LocalLight
+{
+    packed_float3 position;
+    int type;
+    packed_float3 direction;
+    float radius;
+    packed_float3 tangent;
+    float cosOuterAngle;
+    float4 colorAndIntensity;
+    float width;
+    float height;
+    float cosInnerAngle;
+    float _padding1;
+};
+
+// Layout of a light tree node.
+// Must match CPU struct Node in LightTree.h.
+struct LightTreeNode
+{
+    packed_float3 boundsMin;
+    float power;
+    packed_float3 boundsMax;
+    float cosThetaO;
+    packed_float3 axis;
+    float cosThetaE;
+    int secondChild;
+    int lightIndex;
+    int _padding1;
+    int _padding2;
+};
+
 // Layout of ground plane properties.
 // Must match CPU struct GroundPlaneData in PTGroundPlane.h.
 struct GroundPlane
@@ -74,6 +113,10 @@ struct GroundPlane
 // setup in PTRenderer::submitRayDispatch.
 // =================================================================================================
 
+// The width and height of the blue-noise mask.
+// Must match CPU value SampleSequence::kBlueNoiseSize.
+#define BLUE_NOISE_SIZE 64
+
 #if __METAL__
 
 // The top-level acceleration structure with the scene contents.
@@ -95,6 +138,11 @@ uint2                            gRaysDimensions;
 //    // Instance properties for all scene instances are stored in this ByteAddressBuffer.  This is the instance transform matrix and layer properties, if any.
 constant InstanceRecord* gInstanceBuffer;
 constant AliasEntry*     gEnvironmentAliasMap;
+// Local lights, and the light tree used to sample them.
+constant LocalLight*     gLocalLights;
+constant LightTreeNode*  gLightTreeNodes;
+// The blue-noise mask, tiled across the screen, for the blue-noise sampler.
+constant float2*         gBlueNoise;
 // Material textures for all the scene materials.  Looked up using indices stored in material header.
 constant array<texture2d<float, access::sample>, TEXTURE_ARRAY_SIZE>* gGlobalMaterialTextures;
 
@@ -114,6 +162,13 @@ StructuredBuffer<AliasEntry> gEnvironmentAliasMap : register(t1);
 [[vk::binding(7)]] Texture2D<float4> gEnvironmentBackgroundTexture : register(t3);
 ConstantBuffer<GroundPlane> gGroundPlane : register(b3);
 RaytracingAccelerationStructure gNullScene : register(t4);
+
+// Local lights, and the light tree used to sample them.
+[[vk::binding(12)]] StructuredBuffer<LocalLight> gLocalLights : register(t0, space2);
+[[vk::binding(13)]] StructuredBuffer<LightTreeNode> gLightTreeNodes : register(t1, space2);
+
+// The blue-noise mask, tiled across the screen, for the blue-noise sampler.
+[[vk::binding(14)]] StructuredBuffer<float2> gBlueNoise : register(t2, space2);
 #endif
 
 #if DIRECTX
@@ -0,0 +1,188 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __LIGHTS_H__
+#define __LIGHTS_H__
+
+#include "Colors.metal"
+#include "GlobalPipelineState.metal"
+#include "Globals.metal"
+#include "Sampling.metal"
+
+// The largest float less than one, used to keep rescaled random numbers in the [0, 1) range.
+#define LIGHT_TREE_ONE_MINUS_EPSILON 0.99999994f
+
+// Computes the importance of a light tree node for a shading point with the specified position
+// and normal, which is a conservative estimate of the contribution of the lights in the node. The
+// normal may be zero to ignore the orientation of the shading point.
+// NOTE: This must match LightTree::importance() in LightTree.cpp.
+float lightTreeNodeImportance(LightTreeNode node, float3 position, float3 normal)
+{
+    // Compute the squared distance to the center of the node bounds, and the squared radius of a
+    // sphere around the bounds. The distance is clamped to the radius, so that the importance is
+    // finite inside the bounds.
+    float3 toCenter = (node.boundsMin + node.boundsMax) * 0.5f - position;
+    float3 size     = node.boundsMax - node.boundsMin;
+    float distance2 = dot(toCenter, toCenter);
+    float radius2   = dot(size, size) * 0.25f;
+
+    // Compute the angle subtended by the sphere from the shading point. Inside the sphere, lights
+    // can be in any direction.
+    float thetaU = M_PI;
+    if (distance2 > radius2)
+    {
+        thetaU = asin(sqrt(radius2 / distance2));
+    }
+    float3 direction = distance2 > 0.0f ? toCenter / sqrt(distance2) : float3(node.axis);
+    distance2        = max(distance2, max(radius2, 1.0e-8f));
+
+    // Compute the minimum angle between the emission directions of the lights and the direction
+    // to the shading point. If that is outside the emission angle, the lights can't contribute.
+    float theta      = acos(clamp(dot(node.axis, -direction), -1.0f, 1.0f));
+    float thetaO     = acos(clamp(node.cosThetaO, -1.0f, 1.0f));
+    float thetaE     = acos(clamp(node.cosThetaE, -1.0f, 1.0f));
+    float thetaPrime = max(theta - thetaO - thetaU, 0.0f);
+    if (thetaPrime >= thetaE)
+    {
+        return 0.0f;
+    }
+    float result = node.power * cos(thetaPrime) / distance2;
+
+    // Compute the minimum angle between the normal and the direction to the lights. If the lights
+    // are entirely below the surface, they can't contribute.
+    if (dot(normal, normal) > 0.0f)
+    {
+        float thetaI      = acos(clamp(dot(normal, direction), -1.0f, 1.0f));
+        float thetaIPrime = max(thetaI - thetaU, 0.0f);
+        if (thetaIPrime >= M_PI * 0.5f)
+        {
+            return 0.0f;
+        }
+        result *= cos(thetaIPrime);
+    }
+
+    return max(result, 0.0f);
+}
+
+// Chooses a local light for a shading point by traversing the light tree, choosing a child at each
+// node with a probability proportional to its importance. Returns the index of the light and the
+// probability of choosing it, or -1 if there are no lights that can illuminate the shading point.
+// NOTE: This must match LightTree::sample() in LightTree.cpp.
+int sampleLightTree(float3 position, float3 normal, float random, thread float& pdf)
+{
+    pdf = 0.0f;
+    if (gFrameData.lights.localLightCount == 0)
+    {
+        return -1;
+    }
+
+    // The random number is rescaled after each choice so that it can be reused for the next one.
+    int index     = 0;
+    float nodePdf = 1.0f;
+    while (gLightTreeNodes[index].secondChild >= 0)
+    {
+        int secondChild   = gLightTreeNodes[index].secondChild;
+        float importance0 = lightTreeNodeImportance(gLightTreeNodes[index + 1], position, normal);
+        float importance1 = lightTreeNodeImportance(gLightTreeNodes[secondChild], position, normal);
+        if (importance0 + importance1 <= 0.0f)
+        {
+            return -1;
+        }
+
+        float probability0 = importance0 / (importance0 + importance1);
+        if (random < probability0)
+        {
+            index  = index + 1;
+            random = random / probability0;
+            nodePdf *= probability0;
+        }
+        else
+        {
+            index  = secondChild;
+            random = (random - probability0) / (1.0f - probability0);
+            nodePdf *= 1.0f - probability0;
+        }
+        random = min(random, LIGHT_TREE_ONE_MINUS_EPSILON);
+    }
+
+    pdf = nodePdf;
+
+    return gLightTreeNodes[index].lightIndex;
+}
+
+// Computes the attenuation of a spot light in the specified direction from the light, with a smooth
+// falloff between the inner and outer cone angles.
+float spotLightFalloff(LocalLight light, float3 direction)
+{
+    float cosAngle = dot(light.direction, direction);
+    if (light.cosInnerAngle <= light.cosOuterAngle)
+    {
+        return cosAngle >= light.cosOuterAngle ? 1.0f : 0.0f;
+    }
+
+    return smoothstep(light.cosOuterAngle, light.cosInnerAngle, cosAngle);
+}
+
+// Samples a local light from a shading point, returning the radiance arriving from the light
+// divided by the probability density of the sampled direction, along with the direction and
+// distance to the sampled point on the light. Point and spot light intensities are radiant
+// intensities, and rect light intensities are radiances emitted from the front side of the light.
+float3 sampleLocalLight(
+    LocalLight light, float3 position, float2 random, thread float3& L, thread float& distance)
+{
+    float3 lightRadiance = light.colorAndIntensity.a * light.colorAndIntensity.rgb;
+    if (light.type == LOCAL_LIGHT_RECT)
+    {
+        // Sample a uniformly distributed point on the rectangle, and convert the probability
+        // density from area (one over the area) to solid angle.
+        float3 bitangent     = cross(float3(light.direction), float3(light.tangent));
+        float3 lightPosition = light.position + (random.x - 0.5f) * light.width * light.tangent +
+            (random.y - 0.5f) * light.height * bitangent;
+        float3 toLight  = lightPosition - position;
+        float distance2 = dot(toLight, toLight);
+        distance        = sqrt(distance2);
+        L               = distance > 0.0f ? toLight / distance : float3(light.direction);
+        float cosLight  = dot(light.direction, -L);
+        if (cosLight <= 0.0f || distance2 <= 0.0f)
+        {
+            return BLACK;
+        }
+
+        return lightRadiance * cosLight * light.width * light.height / distance2;
+    }
+
+    // For point and spot lights, sample a direction in the cone subtended by the sphere of the
+    // light, for soft shadows. The radiance is the intensity divided by the squared distance to the
+    // center of the light, as if the light was a point.
+    float3 toLight  = light.position - position;
+    float distance2 = max(dot(toLight, toLight), M_FLOAT_EPS);
+    distance        = sqrt(distance2);
+    float3 toCenter = toLight / distance;
+    L               = toCenter;
+    if (light.radius > 0.0f && distance > light.radius)
+    {
+        float cosRadius = sqrt(max(1.0f - light.radius * light.radius / distance2, 0.0f));
+        L               = sampleCone(random, toCenter, cosRadius);
+        distance -= light.radius;
+    }
+    float3 result = lightRadiance / distance2;
+    if (light.type == LOCAL_LIGHT_SPOT)
+    {
+        result *= spotLightFalloff(light, -toCenter);
+    }
+
+    return result;
+}
+
+#endif // __LIGHTS_H__
@@ -170,6 +170,9 @@ struct Buffers {
     device void* buf_9;
     constant InstanceRecord* instanceData;
     constant MetalContext::AliasEntry* aliasMapData;
+    constant MetalContext::LocalLight* localLightData;
+    constant MetalContext::LightTreeNode* lightTreeData;
+    constant float2* blueNoiseData;
 };
 
 using HandlerFuncSig = int(ray, thread RayPayload&);
@@ -207,6 +210,9 @@ kernel void RayGenShader(
     thread MetalContext context(accelerationStructure, *bufferBuf.environmentData, *bufferBuf.sampleData, *bufferBuf.frameData);
     context.gInstanceBuffer = bufferBuf.instanceData;
     context.gEnvironmentAliasMap = bufferBuf.aliasMapData;
+    context.gLocalLights = bufferBuf.localLightData;
+    context.gLightTreeNodes = bufferBuf.lightTreeData;
+    context.gBlueNoise = bufferBuf.blueNoiseData;
     context.gRaysIndex = tid;
     context.gRaysDimensions = uint2(dstTex.get_width(), dstTex.get_height());
     context.gInstanceBuffer = bufferBuf.instanceData;
@@ -217,14 +223,26 @@ kernel void RayGenShader(
     context.gDefaultSampler = s;
     context.gDefaultEnvSampler = envs;
     
-    // Get the dispatch dimensions (screen size), dispatch index (screen coordinates), and sample
-    // index.
-    uint2 screenSize = uint2(dstTex.get_width(), dstTex.get_height());
-    uint2 screenCoords = tid;
+    // Get the coordinates of the pixel in the targets, from the dispatch index over the rendered
+    // region, and the screen size and coordinates in the whole image, which differ from the targets
+    // when they are a tile of a larger image. The screen values are used for camera rays and
+    // sampling, so that the tiles of an image fit together seamlessly. Also get the sample index.
+    uint2 targetCoords = tid + uint2(gFrameData.regionOffset);
+    uint2 screenSize = uint2(gFrameData.imageSize);
+    uint2 screenCoords = targetCoords + uint2(gFrameData.tileOffset);
     uint sampleIndex = bufferBuf.sampleData->sampleIndex;
 
-    // Initialize a random number generator, so that each sample and pixel gets a unique seed.
-    MetalContext::Random rng = context.initRand(sampleIndex, screenSize, screenCoords);
+    // Initialize a random number generator, so that each sample and pixel gets a unique seed. The
+    // blue-noise mask is only read if it is used by the chosen sampler.
+    uint samplerType = gFrameData.samplerType;
+    float2 blueNoise = float2(0.0f, 0.0f);
+    if (samplerType == SAMPLER_TYPE_BLUE_NOISE)
+    {
+        uint2 maskCoords = screenCoords % BLUE_NOISE_SIZE;
+        blueNoise        = context.gBlueNoise[maskCoords.y * BLUE_NOISE_SIZE + maskCoords.x];
+    }
+    MetalContext::Random rng =
+        context.initRandom(samplerType, sampleIndex, screenSize, screenCoords, blueNoise);
 
     // Compute a camera ray (origin and direction) for the current screen coordinates. This applies
     // a random offset to support antialiasing and depth of field.
@@ -402,7 +420,7 @@ kernel void RayGenShader(
                             // Set the output normal from the first hit.
                             output.normal = materialNormal;
 #if defined(DEBUG_NORMALS)
-                            dstTex.write(float4((output.normal + 1.0f) * 0.5f, 1.0f), screenCoords);
+                            dstTex.write(float4((output.normal + 1.0f) * 0.5f, 1.0f), targetCoords);
                             return;
 #endif
                             // Clamp the output roughness for the ray path to a minimum, because the denoiser
@@ -496,12 +514,12 @@ kernel void RayGenShader(
 
                             float3 specAlbedo = float3(bias, bias, bias) + float3(scale, scale, scale) * specularF0;
                             
-                            depthTexture.write(float4(output.depthNDC, 0.0f, 0.0f, 1.0f), screenCoords);
-                            motionTexture.write(float4(0.0f, 0.0f, 0.0f, 1.0f), screenCoords);
-                            diffuseAlbedoTexture.write(float4(output.baseColor, 1.0f), screenCoords);
-                            specularAlbedoTexture.write(float4(specAlbedo, 1.0f), screenCoords);
-                            normalTexture.write(float4(output.normal, 1.0f), screenCoords);
-                            roughnessTexture.write(float4(output.roughness, 0.0f, 0.0f, 1.0f), screenCoords);
+                            depthTexture.write(float4(output.depthNDC, 0.0f, 0.0f, 1.0f), targetCoords);
+                            motionTexture.write(float4(0.0f, 0.0f, 0.0f, 1.0f), targetCoords);
+                            diffuseAlbedoTexture.write(float4(output.baseColor, 1.0f), targetCoords);
+                            specularAlbedoTexture.write(float4(specAlbedo, 1.0f), targetCoords);
+                            normalTexture.write(float4(output.normal, 1.0f), targetCoords);
+                            roughnessTexture.write(float4(output.roughness, 0.0f, 0.0f, 1.0f), targetCoords);
 #endif
                         }
 
@@ -514,6 +532,9 @@ kernel void RayGenShader(
                         float3 directionalShadowRayDirection = 0;
                         float3 directionalLightColor = 0;
                         bool hasDirectionalLight = false;
+                        float3 localShadowRayDirection = 0;
+                        float localShadowRayDistance = 0;
+                        float3 localLightColor = 0;
                         if (hitLayer)
                         {
                             // This ray struck opaque geometry, shade the collision as the next ray segment in the path.
@@ -551,6 +572,13 @@ kernel void RayGenShader(
                                 }
                             }
 
+                            // Shade with a local light chosen from the light tree, if there are any local lights.
+                            if (context.gFrameData.lights.localLightCount > 0)
+                            {
+                                localLightColor = context.shadeLocalLight(material, shading, V, rng,
+                                    localShadowRayDirection, localShadowRayDistance);
+                            }
+
                             // The multiple importance sampling (MIS) environment shade function will return these values.
                             // They will be used to emit shadow rays for MIS material and light at the end of the loop.
                             int misLobeID;
@@ -594,6 +622,13 @@ kernel void RayGenShader(
                                 direct += lightVisibility * directionalLightColor;
                             }
 
+                            // Trace shadow ray for the local light, up to the sampled point on the light.
+                            if (!context.isBlack(localLightColor))
+                            {
+                                lightVisibility = context.traceShadowRay(accelerationStructure, shadowRayOrigin, localShadowRayDirection, M_RAY_TMIN, onlyOpaqueShadowHits, rayDepth, maxTraceDepth, localShadowRayDistance);
+                                direct += lightVisibility * localLightColor;
+                            }
+
                             // Trace shadow rays for material and light component of MIS environment (if we have them.)
                             if (misEmitsLightShadowRay || misEmitsMaterialShadowRay)
                             {
@@ -703,6 +738,13 @@ kernel void RayGenShader(
         // Scale the contribution to be used in subsequent segments.
         rayContribution *= nextRayContribution;
 
+        // Randomly terminate the path with Russian roulette once the minimum depth is reached, based
+        // on how much the subsequent segments can contribute.
+        if (gFrameData.isRussianRouletteEnabled && !pathEnded && rayDepth + 1 >= gFrameData.russianRouletteDepth)
+        {
+            pathEnded = !context.continuePathWithRussianRoulette(rayContribution, context.random2D(rng).x);
+        }
+
         // Set the ray type for the next segment.
         rayType = nextRayType;
     }
@@ -716,5 +758,5 @@ kernel void RayGenShader(
     // the denoising AOVs below.
     float4 result = float4(finalRadiance, output.alpha);
     result.rgb = gFrameData.isDenoisingEnabled ? output.direct : result.rgb;
-    dstTex.write(result, screenCoords);
+    dstTex.write(result, targetCoords);
 }
@@ -31,12 +31,52 @@
 #define randomNext2D pcg2DNext2D
 #endif
 
+// The sampler types, i.e. how the random numbers for path tracing are generated:
+// - RANDOM: Pseudorandom numbers from the generator chosen above.
+// - SOBOL: An Owen-scrambled Sobol sequence, with a different scrambling for each pixel.
+// - BLUE_NOISE: An Owen-scrambled Sobol sequence shared by all pixels, offset for each pixel by a
+//   blue-noise mask so that the remaining error is distributed as blue noise.
+// Must match CPU definitions in SampleSequence::SamplerType.
+#define SAMPLER_TYPE_RANDOM 0
+#define SAMPLER_TYPE_SOBOL 1
+#define SAMPLER_TYPE_BLUE_NOISE 2
+
 // State used for random number generation (RNG).
 struct Random
 {
+    // The state of the pseudorandom number generator.
     uint2 state;
+
+    // The sampler type, one of SAMPLER_TYPE_*.
+    uint samplerType;
+
+    // The sample index, which is the index of the point in the low-discrepancy sequence.
+    uint sampleIndex;
+
+    // The seed used to scramble the low-discrepancy sequence.
+    uint seed;
+
+    // The next dimension (i.e. pair of numbers) to generate from the low-discrepancy sequence.
+    uint dimension;
+
+    // The per-pixel offset applied to the low-discrepancy sequence, for the blue-noise sampler.
+    float2 rotation;
 };
 
+// Creates a random number generator with default state, for pseudorandom numbers.
+Random createRandom()
+{
+    Random rng;
+    rng.state       = uint2(0, 0);
+    rng.samplerType = SAMPLER_TYPE_RANDOM;
+    rng.sampleIndex = 0;
+    rng.seed        = 0;
+    rng.dimension   = 0;
+    rng.rotation    = float2(0.0f, 0.0f);
+
+    return rng;
+}
+
 // Generates a random 32-bit integer from two seed values, with the Tiny Encryption Algorithm (TEA).
 // NOTE: Based on
 // https://github.com/nvpro-samples/vk_raytracing_tutorial_KHR/tree/master/ray_tracing_jitter_cam
@@ -66,7 +106,7 @@ uint lcg(uint p)
 // Initializes a random number generator for LCG.
 Random lcgInit(uint sampleIndex, uint2 screenSize, uint2 screenCoords)
 {
-    Random rng;
+    Random rng = createRandom();
 
     // Compute a random integer as a seed for LCG, because LCG does not behave well with consecutive
     // seeds. This is based on the pixel index and sample index, to prevent correlation across space
@@ -95,7 +135,7 @@ float2 lcgNext2D(thread Random& rng)
 // Initializes a random number generator for PCG2D.
 Random pcg2DInit(uint sampleIndex, uint2 screenSize, uint2 screenCoords)
 {
-    Random rng;
+    Random rng = createRandom();
 
     // Initialize the state based on the pixel location and sample index, to prevent correlation
     // across space and time.
@@ -136,12 +176,143 @@ float2 pcg2DNext2D(thread Random& rng)
     return float2(rng.state) / float(0xFFFFFFFFu);
 }
 
+// Hashes a 32-bit integer, using the PCG hash.
+// NOTE: Based on "Hash Functions for GPU Rendering" @ http://www.jcgt.org/published/0009/03/02.
+// This must match SampleSequence::hash() on the CPU.
+uint hashUint(uint value)
+{
+    uint state = value * 747796405u + 2891336453u;
+    uint word  = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+
+    return (word >> 22u) ^ word;
+}
+
+// Combines a seed with a value to produce a new seed.
+// NOTE: This must match SampleSequence::hashCombine() on the CPU.
+uint hashCombine(uint seed, uint value)
+{
+    return hashUint(seed ^ hashUint(value));
+}
+
+// Reverses the order of the bits of a 32-bit integer.
+uint reverseBits32(uint value)
+{
+    value = ((value >> 1) & 0x55555555u) | ((value & 0x55555555u) << 1);
+    value = ((value >> 2) & 0x33333333u) | ((value & 0x33333333u) << 2);
+    value = ((value >> 4) & 0x0F0F0F0Fu) | ((value & 0x0F0F0F0Fu) << 4);
+    value = ((value >> 8) & 0x00FF00FFu) | ((value & 0x00FF00FFu) << 8);
+
+    return (value >> 16) | (value << 16);
+}
+
+// Applies a nested uniform (Owen) scramble to an integer, where each bit only affects the less
+// significant bits. This reverses the bits around the Laine-Karras permutation, with the improved
+// constants from "Practical Hash-based Owen Scrambling" by Burley (2020).
+uint nestedUniformScramble(uint value, uint seed)
+{
+    value = reverseBits32(value);
+    value += seed;
+    value ^= value * 0x6c50b47cu;
+    value ^= value * 0xb82f1e52u;
+    value ^= value * 0xc7afe638u;
+    value ^= value * 0x8d22f6e6u;
+
+    return reverseBits32(value);
+}
+
+// Computes the second dimension of the (unscrambled) Sobol sequence. The first dimension is simply
+// the index with its bits reversed, i.e. the van der Corput sequence.
+uint sobolDimension1(uint index)
+{
+    uint result = 0;
+    for (uint v = 1u << 31; index != 0; index >>= 1, v ^= v >> 1)
+    {
+        if ((index & 1) != 0)
+        {
+            result ^= v;
+        }
+    }
+
+    return result;
+}
+
+// Computes a two-dimensional point of a shuffled, Owen-scrambled Sobol sequence, in the range
+// [0.0, 1.0), where each seed gives a different randomization of the sequence.
+// NOTE: This must match SampleSequence::sobol2D() on the CPU.
+float2 sobol2D(uint index, uint seed)
+{
+    // Shuffle the order of the points by scrambling the index, then scramble each dimension with a
+    // different seed. Only the upper 24 bits are used, so that the result is exactly representable
+    // as a float and never rounds up to one.
+    index  = nestedUniformScramble(index, seed);
+    uint x = nestedUniformScramble(reverseBits32(index), hashCombine(seed, 0));
+    uint y = nestedUniformScramble(sobolDimension1(index), hashCombine(seed, 1));
+
+    return float2(float(x >> 8), float(y >> 8)) / 16777216.0f;
+}
+
+// Initializes a random number generator with the specified sampler type, one of SAMPLER_TYPE_*. The
+// blue-noise value is the value of the blue-noise mask for the pixel, which is only used by the
+// blue-noise sampler.
+Random initRandom(
+    uint samplerType, uint sampleIndex, uint2 screenSize, uint2 screenCoords, float2 blueNoise)
+{
+    Random rng = initRand(sampleIndex, screenSize, screenCoords);
+    if (samplerType == SAMPLER_TYPE_RANDOM)
+    {
+        return rng;
+    }
+
+    rng.samplerType = samplerType;
+    rng.sampleIndex = sampleIndex;
+    if (samplerType == SAMPLER_TYPE_SOBOL)
+    {
+        // Use a different scrambling for each pixel, so that the error is uncorrelated across
+        // pixels.
+        rng.seed = hashUint(screenCoords.y * screenSize.x + screenCoords.x);
+    }
+    else
+    {
+        // Use the same sequence for every pixel, offset by the blue-noise value for the pixel, so
+        // that neighboring pixels have very different samples.
+        rng.seed     = 0;
+        rng.rotation = blueNoise;
+    }
+
+    return rng;
+}
+
+// Computes the next value pair from the low-discrepancy sequence, updating the specified RNG.
+float2 sobolNext2D(thread Random& rng)
+{
+    // Scramble the sequence differently for each dimension, so that the dimensions are not
+    // correlated with each other.
+    float2 value = sobol2D(rng.sampleIndex, hashCombine(rng.seed, rng.dimension));
+
+    // Apply the blue-noise offset with wrapping (a Cranley-Patterson rotation), which preserves
+    // the stratification of the sequence. The offset is shifted for each dimension by the R2
+    // sequence, so the dimensions don't share the same offset.
+    if (rng.samplerType == SAMPLER_TYPE_BLUE_NOISE)
+    {
+        const float2 kR2 = float2(0.7548776662f, 0.5698402910f);
+        value            = fract(value + rng.rotation + fract(float(rng.dimension) * kR2));
+    }
+    rng.dimension++;
+
+    return value;
+}
+
 // Generates two uniformly distributed numbers in the range [0.0, 1.0), using the specified random
 // number generator.
 // NOTE: The two numbers may be correlated to provide an even distribution across the 2D range,
 // which is why this is a single 2D function instead of two calls to a 1D function.
 float2 random2D(thread Random& rng)
 {
+    if (rng.samplerType != SAMPLER_TYPE_RANDOM)
+    {
+        return sobolNext2D(rng);
+    }
+
     return randomNext2D(rng);
 }
 
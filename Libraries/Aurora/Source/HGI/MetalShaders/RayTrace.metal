@@ -235,9 +235,10 @@ struct ShadowRayPayload
 };
 
 // Traces a shadow ray for the specified sample position and light direction, returning the
-// visibiliity of the light in that direction.
+// visibiliity of the light in that direction. The maximum distance is used for lights with a
+// position, so that geometry beyond the light does not block it.
 float3 traceShadowRay(RaytracingAccelerationStructure scene, float3 origin, float3 L, float tMin,
-                      bool onlyOpaqueHits, int depth, int maxDepth)
+                      bool onlyOpaqueHits, int depth, int maxDepth, float tMax = INFINITY)
 {
     // If the maximum trace recursion depth has been reached, treat the light as visible. This will
     // mean there is more light than expected, but that works better than blocking the light, for
@@ -262,7 +263,7 @@ float3 traceShadowRay(RaytracingAccelerationStructure scene, float3 origin, floa
     ray.origin    = origin;
     ray.direction = L;
     ray.min_distance = tMin;
-    ray.max_distance = INFINITY;
+    ray.max_distance = tMax;
 
     // Trace the shadow ray. This is different from standard tracing for performance and behavior,
     // as follows:
@@ -107,4 +107,24 @@ float computeMISWeight(int nf, float fPDF, int ng, float gPDF)
     return (f * f) / (f * f + g * g);
 }
 
+// The minimum probability of continuing a path with Russian roulette. This limits the increase in
+// variance from paths with very low throughput that happen to continue.
+#define RUSSIAN_ROULETTE_MIN_PROBABILITY 0.05f
+
+// Randomly terminates a path with Russian roulette, with a probability of continuing based on the
+// path throughput, so that paths which can only contribute a little to the result are likely to be
+// terminated. If the path continues, the throughput is divided by the probability of continuing,
+// which keeps the result unbiased. Returns whether the path continues.
+// NOTE: See PBRT 3E 13.7 for details.
+bool continuePathWithRussianRoulette(thread float3& throughput, float random)
+{
+    float probability = max(throughput.r, max(throughput.g, throughput.b));
+    probability       = clamp(probability, RUSSIAN_ROULETTE_MIN_PROBABILITY, 1.0f);
+    if (random >= probability)
+        return false;
+    throughput /= probability;
+
+    return true;
+}
+
 #endif // __SAMPLING_H__
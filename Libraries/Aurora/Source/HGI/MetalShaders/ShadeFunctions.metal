@@ -16,6 +16,7 @@
 #define __SHADE_FUNCTIONS_H__
 
 #include "BSDF.metal"
+#include "Lights.metal"
 
 // Compute shading from material emission.
 float3 shadeEmission(Material material)
@@ -56,6 +57,51 @@ float3 shadeDirectionalLight(float3 dir, float4 colorAndIntensity, float cosRadi
     return lightRadiance * bsdfAndCosine;
 }
 
+// Compute shading with a local (point, spot, or rect) light, chosen from the light tree with a
+// probability based on its estimated contribution to the shading point.
+float3 shadeLocalLight(Material material, ShadingData shading, float3 V, thread Random& rng,
+                       thread float3& shadowRayDirection, thread float& shadowRayDistance)
+{
+    shadowRayDirection = float3(0.f);
+    shadowRayDistance  = 0.0f;
+
+    // Choose a light using the normal on the view side of the surface, so lights below the surface
+    // are skipped. The normal is ignored for transmissive materials, which can be lit from behind.
+    float3 normal = dot(V, shading.normal) < 0.0f ? -shading.normal : shading.normal;
+    if (material.transmission > 0.0f)
+    {
+        normal = float3(0.0f);
+    }
+    float pdf;
+    int lightIndex = sampleLightTree(shading.position, normal, random2D(rng).x, pdf);
+    if (lightIndex < 0)
+    {
+        return BLACK;
+    }
+
+    // Sample a point on the light, and evaluate the BSDF of the material for the light direction.
+    float3 L;
+    float distance;
+    float3 lightResult =
+        sampleLocalLight(gLocalLights[lightIndex], shading.position, random2D(rng), L, distance);
+    if (isBlack(lightResult))
+    {
+        return BLACK;
+    }
+    float3 bsdfAndCosine = evaluateMaterial(material, shading, V, L);
+    if (isBlack(bsdfAndCosine))
+    {
+        return BLACK;
+    }
+
+    // The shadow ray is traced up to the sampled point on the light, which is emitted later.
+    shadowRayDirection = L;
+    shadowRayDistance  = distance;
+
+    // Divide by the probability of choosing the light.
+    return lightResult * bsdfAndCosine / pdf;
+}
+
 // Compute shading with an environment light as direct lighting.
 float3 shadeEnvironmentLightDirect(Environment environment,
                                    RaytracingAccelerationStructure scene, Material material, ShadingData shading, float3 V,
@@ -25,6 +25,10 @@ public:
 
     float luminanceIntegral() { return _luminanceIntegral; }
 
+    // Adds the memory used by the image to the memory statistics. Renderer implementations add the
+    // device memory of the texture, and of the alias map if the image represents an environment.
+    virtual void addMemoryUsage(MemoryStatistics& /* statistics */) const {}
+
 protected:
     float _luminanceIntegral = 0.0f;
 };
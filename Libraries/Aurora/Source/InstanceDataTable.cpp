@@ -0,0 +1,181 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "InstanceDataTable.h"
+
+#include <Aurora/Foundation/Utilities.h>
+
+BEGIN_AURORA
+
+size_t InstanceDataTable::HashKey::operator()(const Key& key) const
+{
+    size_t hash = std::hash<const void*>()(key.pGeometry);
+    Foundation::hashCombine(hash, std::hash<int>()(key.materialOffset));
+    Foundation::hashCombine(hash, std::hash<bool>()(key.isOpaque));
+    for (const auto& layer : key.layers)
+    {
+        Foundation::hashCombine(hash, std::hash<int>()(layer.first));
+        Foundation::hashCombine(hash, std::hash<int>()(layer.second));
+    }
+
+    return hash;
+}
+
+bool InstanceDataTable::set(const void* pInstance, const Key& key)
+{
+    // Do nothing if the instance already uses an entry with the same data, e.g. if only its
+    // transform has changed.
+    auto instanceIter = _instanceSlots.find(pInstance);
+    if (instanceIter != _instanceSlots.end() && _slots[instanceIter->second].key == key)
+    {
+        return false;
+    }
+
+    // Find the entry with the same data, or add a new one, reusing an unused slot if there is one.
+    int slotIndex;
+    auto slotIter = _slotLookup.find(key);
+    if (slotIter != _slotLookup.end())
+    {
+        slotIndex = slotIter->second;
+    }
+    else
+    {
+        if (_freeSlots.empty())
+        {
+            slotIndex = int(_slots.size());
+            _slots.emplace_back();
+        }
+        else
+        {
+            slotIndex = _freeSlots.back();
+            _freeSlots.pop_back();
+        }
+        _slots[slotIndex].key = key;
+        _slotLookup[key]      = slotIndex;
+        _isModified           = true;
+    }
+    _slots[slotIndex].refCount++;
+
+    // Release the previous entry of the instance, after the new one has been referenced.
+    if (instanceIter != _instanceSlots.end())
+    {
+        remove(pInstance);
+    }
+    _instanceSlots[pInstance] = slotIndex;
+
+    return true;
+}
+
+bool InstanceDataTable::remove(const void* pInstance)
+{
+    auto instanceIter = _instanceSlots.find(pInstance);
+    if (instanceIter == _instanceSlots.end())
+    {
+        return false;
+    }
+
+    // Release the entry, and make its slot available if it is no longer used by any instances.
+    int slotIndex = instanceIter->second;
+    _instanceSlots.erase(instanceIter);
+    Slot& slot = _slots[slotIndex];
+    if (--slot.refCount == 0)
+    {
+        _slotLookup.erase(slot.key);
+        slot.key = Key();
+        _freeSlots.push_back(slotIndex);
+        _isModified = true;
+    }
+
+    return true;
+}
+
+int InstanceDataTable::index(const void* pInstance) const
+{
+    auto iter = _instanceSlots.find(pInstance);
+
+    return iter == _instanceSlots.end() ? -1 : iter->second;
+}
+
+const InstanceDataTable::Key* InstanceDataTable::entry(int index) const
+{
+    if (index < 0 || index >= int(_slots.size()) || _slots[index].refCount == 0)
+    {
+        return nullptr;
+    }
+
+    return &_slots[index].key;
+}
+
+vector<const void*> InstanceDataTable::instances() const
+{
+    vector<const void*> instances;
+    instances.reserve(_instanceSlots.size());
+    for (const auto& instanceSlot : _instanceSlots)
+    {
+        instances.push_back(instanceSlot.first);
+    }
+
+    return instances;
+}
+
+bool InstanceDataTable::compact()
+{
+    if (_freeSlots.empty())
+    {
+        return false;
+    }
+
+    // Move the used slots down over the unused ones, recording the new index of each slot.
+    vector<int> newIndices(_slots.size(), -1);
+    int usedCount = 0;
+    for (int i = 0; i < int(_slots.size()); i++)
+    {
+        if (_slots[i].refCount == 0)
+        {
+            continue;
+        }
+        if (i != usedCount)
+        {
+            _slots[usedCount] = std::move(_slots[i]);
+        }
+        newIndices[i] = usedCount++;
+    }
+    _slots.resize(usedCount);
+    _freeSlots.clear();
+
+    // Update the indices in the lookups.
+    for (auto& slotLookup : _slotLookup)
+    {
+        slotLookup.second = newIndices[slotLookup.second];
+    }
+    for (auto& instanceSlot : _instanceSlots)
+    {
+        instanceSlot.second = newIndices[instanceSlot.second];
+    }
+    _isModified = true;
+
+    return true;
+}
+
+void InstanceDataTable::clear()
+{
+    _isModified = _isModified || !_slots.empty();
+    _slots.clear();
+    _freeSlots.clear();
+    _slotLookup.clear();
+    _instanceSlots.clear();
+}
+
+END_AURORA
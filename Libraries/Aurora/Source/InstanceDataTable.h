@@ -0,0 +1,115 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+BEGIN_AURORA
+
+// A table of the unique instance data in a scene, i.e. the geometry and material data of each
+// instance excluding its transform, which is used to share an entry in the instance data buffer and
+// a hit group shader record between instances. The table is maintained incrementally: setting the
+// data of an instance, or removing an instance, only touches the entry for that instance, and the
+// entries of other instances keep their indices. Each entry is reference counted by the instances
+// that use it, and the slot of an entry that is no longer used is reused by the next new entry.
+//
+// Instances and geometry are identified by opaque pointers, so that the table does not depend on
+// the renderer implementation.
+class InstanceDataTable
+{
+public:
+    // The data of an instance that identifies its entry in the table.
+    struct Key
+    {
+        // Geometry of the instance.
+        const void* pGeometry = nullptr;
+        // Offset of the base layer material in the global material buffer.
+        int materialOffset = -1;
+        // Whether the base layer material is opaque.
+        bool isOpaque = true;
+        // Offset in the global material buffer and layer geometry buffer for each layer.
+        vector<pair<int, int>> layers;
+
+        bool operator==(const Key& other) const
+        {
+            return pGeometry == other.pGeometry && materialOffset == other.materialOffset &&
+                isOpaque == other.isOpaque && layers == other.layers;
+        }
+    };
+
+    // Sets the data of an instance, adding the instance to the table if needed. Returns whether
+    // the index of the entry used by the instance has changed, i.e. the instance was added or its
+    // data is different.
+    bool set(const void* pInstance, const Key& key);
+
+    // Removes an instance from the table, releasing its entry. Returns false if the instance is
+    // not in the table.
+    bool remove(const void* pInstance);
+
+    // Gets whether an instance is in the table.
+    bool contains(const void* pInstance) const { return _instanceSlots.count(pInstance) > 0; }
+
+    // Gets the index of the entry used by an instance, or -1 if the instance is not in the table.
+    int index(const void* pInstance) const;
+
+    // Gets the entry with the specified index, or null if the slot is unused.
+    const Key* entry(int index) const;
+
+    // Gets the instances in the table, in no particular order.
+    vector<const void*> instances() const;
+
+    // Gets the number of instances in the table.
+    size_t instanceCount() const { return _instanceSlots.size(); }
+
+    // Gets the number of unique entries in the table.
+    size_t entryCount() const { return _slots.size() - _freeSlots.size(); }
+
+    // Gets the number of slots in the table, i.e. the number of entries plus the unused slots.
+    // This is the number of hit group shader records required for the table.
+    size_t slotCount() const { return _slots.size(); }
+
+    // Removes the unused slots, so that the entries have contiguous indices. This changes the
+    // indices of the entries, so should only be done when the instances are rebuilt anyway.
+    // Returns whether any indices changed.
+    bool compact();
+
+    // Gets whether any entries have been added or released since the modified flag was cleared.
+    bool isModified() const { return _isModified; }
+
+    // Clears the modified flag, after the entries have been uploaded.
+    void clearModified() { _isModified = false; }
+
+    // Removes all the instances and entries from the table.
+    void clear();
+
+private:
+    // A functor that hashes the data of an instance.
+    struct HashKey
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    // A slot of the table, with the entry and the number of instances that use it.
+    struct Slot
+    {
+        Key key;
+        size_t refCount = 0;
+    };
+
+    vector<Slot> _slots;
+    vector<int> _freeSlots;
+    unordered_map<Key, int, HashKey> _slotLookup;
+    unordered_map<const void*, int> _instanceSlots;
+    bool _isModified = false;
+};
+
+END_AURORA
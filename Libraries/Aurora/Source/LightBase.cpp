@@ -0,0 +1,169 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "LightBase.h"
+
+BEGIN_AURORA
+
+// Creates a property set with the properties and defaults common to all light types.
+static PropertySetPtr createPropertySet()
+{
+    PropertySetPtr pPropertySet = make_shared<PropertySet>();
+    pPropertySet->add(Names::LightProperties::kColor, vec3(1, 1, 1));
+    pPropertySet->add(Names::LightProperties::kExposure, 0.0f);
+    pPropertySet->add(Names::LightProperties::kIntensity, 1.0f);
+
+    return pPropertySet;
+}
+
+static PropertySetPtr distantLightPropertySet()
+{
+    static PropertySetPtr g_pPropertySet;
+    if (g_pPropertySet)
+    {
+        return g_pPropertySet;
+    }
+
+    // Create properties and defaults for distant lights.
+    g_pPropertySet = createPropertySet();
+    g_pPropertySet->add(Names::LightProperties::kDirection, normalize(vec3(-1.0f, -0.5f, -1.0f)));
+    g_pPropertySet->add(Names::LightProperties::kAngularDiameter, 0.1f);
+
+    return g_pPropertySet;
+}
+
+static PropertySetPtr pointLightPropertySet()
+{
+    static PropertySetPtr g_pPropertySet;
+    if (g_pPropertySet)
+    {
+        return g_pPropertySet;
+    }
+
+    // Create properties and defaults for point lights.
+    g_pPropertySet = createPropertySet();
+    g_pPropertySet->add(Names::LightProperties::kPosition, vec3(0, 0, 0));
+    g_pPropertySet->add(Names::LightProperties::kRadius, 0.0f);
+
+    return g_pPropertySet;
+}
+
+static PropertySetPtr spotLightPropertySet()
+{
+    static PropertySetPtr g_pPropertySet;
+    if (g_pPropertySet)
+    {
+        return g_pPropertySet;
+    }
+
+    // Create properties and defaults for spot lights.
+    g_pPropertySet = createPropertySet();
+    g_pPropertySet->add(Names::LightProperties::kPosition, vec3(0, 0, 0));
+    g_pPropertySet->add(Names::LightProperties::kDirection, vec3(0, 0, -1));
+    g_pPropertySet->add(Names::LightProperties::kRadius, 0.0f);
+    g_pPropertySet->add(Names::LightProperties::kConeAngle, static_cast<float>(M_PI_4));
+    g_pPropertySet->add(Names::LightProperties::kConeSoftness, 0.0f);
+
+    return g_pPropertySet;
+}
+
+static PropertySetPtr rectLightPropertySet()
+{
+    static PropertySetPtr g_pPropertySet;
+    if (g_pPropertySet)
+    {
+        return g_pPropertySet;
+    }
+
+    // Create properties and defaults for rect lights.
+    g_pPropertySet = createPropertySet();
+    g_pPropertySet->add(Names::LightProperties::kPosition, vec3(0, 0, 0));
+    g_pPropertySet->add(Names::LightProperties::kDirection, vec3(0, 0, -1));
+    g_pPropertySet->add(Names::LightProperties::kTangent, vec3(1, 0, 0));
+    g_pPropertySet->add(Names::LightProperties::kWidth, 1.0f);
+    g_pPropertySet->add(Names::LightProperties::kHeight, 1.0f);
+
+    return g_pPropertySet;
+}
+
+// Return the property set for the provided light type.
+static PropertySetPtr propertySet(const string& type)
+{
+    if (type.compare(Names::LightTypes::kDistantLight) == 0)
+        return distantLightPropertySet();
+    if (type.compare(Names::LightTypes::kPointLight) == 0)
+        return pointLightPropertySet();
+    if (type.compare(Names::LightTypes::kSpotLight) == 0)
+        return spotLightPropertySet();
+    if (type.compare(Names::LightTypes::kRectLight) == 0)
+        return rectLightPropertySet();
+
+    AU_FAIL("Unknown light type:%s", type.c_str());
+    return nullptr;
+}
+
+LightBase::LightBase(const string& lightType, int index) :
+    FixedValues(propertySet(lightType)), _type(lightType), _index(index)
+{
+}
+
+bool LightBase::isDistant() const
+{
+    return _type.compare(Names::LightTypes::kDistantLight) == 0;
+}
+
+LightTree::Light LightBase::localLightData() const
+{
+    AU_ASSERT(!isDistant(), "Distant lights do not have local light data");
+
+    // Store color in RGB and intensity in alpha, as with distant lights.
+    LightTree::Light light;
+    light.position          = _values.asFloat3(Names::LightProperties::kPosition);
+    light.colorAndIntensity = vec4(_values.asFloat3(Names::LightProperties::kColor),
+        _values.asFloat(Names::LightProperties::kIntensity));
+
+    if (_type.compare(Names::LightTypes::kRectLight) == 0)
+    {
+        // Ensure the tangent is perpendicular to the direction, so the light is a rectangle.
+        light.type      = LightTree::kRect;
+        light.direction = normalize(_values.asFloat3(Names::LightProperties::kDirection));
+        vec3 tangent    = _values.asFloat3(Names::LightProperties::kTangent);
+        light.tangent   = normalize(tangent - light.direction * dot(tangent, light.direction));
+        light.width     = _values.asFloat(Names::LightProperties::kWidth);
+        light.height    = _values.asFloat(Names::LightProperties::kHeight);
+    }
+    else
+    {
+        light.type   = LightTree::kPoint;
+        light.radius = glm::max(_values.asFloat(Names::LightProperties::kRadius), 0.0f);
+        if (_type.compare(Names::LightTypes::kSpotLight) == 0)
+        {
+            // Store the cosines of the cone angle, and the angle where the emission starts to fall
+            // off, for use in the shader.
+            float coneAngle = _values.asFloat(Names::LightProperties::kConeAngle);
+            coneAngle       = clamp(coneAngle, 0.0f, static_cast<float>(M_PI));
+            float softness =
+                clamp(_values.asFloat(Names::LightProperties::kConeSoftness), 0.0f, 1.0f);
+            light.type          = LightTree::kSpot;
+            light.direction     = normalize(_values.asFloat3(Names::LightProperties::kDirection));
+            light.cosOuterAngle = cos(coneAngle);
+            light.cosInnerAngle = cos(coneAngle * (1.0f - softness));
+        }
+    }
+
+    return light;
+}
+
+END_AURORA
@@ -0,0 +1,56 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include "LightTree.h"
+#include "Properties.h"
+
+BEGIN_AURORA
+
+// A base class for implementations of ILight.
+class LightBase : public ILight, public FixedValues
+{
+public:
+    /*** Lifetime Management ***/
+
+    LightBase(const string& lightType, int index);
+
+    /*** ILight Functions ***/
+
+    FixedValues& values() override { return *this; }
+
+    /*** Functions ***/
+
+    const string& type() const { return _type; }
+    int index() const { return _index; }
+
+    // Is this a distant light, as opposed to a local light with a position?
+    bool isDistant() const;
+
+    bool isDirty() const { return _bIsDirty; }
+    void clearDirtyFlag() { _bIsDirty = false; }
+
+    // Gets the GPU data for a local light, i.e. any light other than a distant light.
+    LightTree::Light localLightData() const;
+
+private:
+    /*** Private Variables ***/
+
+    string _type;
+    int _index;
+};
+
+MAKE_AURORA_PTR(LightBase);
+
+END_AURORA
@@ -0,0 +1,430 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "LightTree.h"
+
+BEGIN_AURORA
+
+// The number of buckets used to evaluate split positions along each axis when building the tree.
+static constexpr int kBucketCount = 12;
+
+// The largest float value less than one, used to keep rescaled random numbers in [0, 1).
+static constexpr float kOneMinusEpsilon = 0x1.fffffep-1f;
+
+static constexpr float kPi = static_cast<float>(M_PI);
+
+// Computes the perceived luminance of a color.
+static float computeLuminance(const vec3& value)
+{
+    static constexpr vec3 kLuminanceFactors = vec3(0.2125f, 0.7154f, 0.0721f);
+
+    return dot(value, kLuminanceFactors);
+}
+
+// Returns a unit vector perpendicular to the specified unit vector.
+static vec3 perpendicular(const vec3& v)
+{
+    return normalize(cross(v, abs(v.x) > 0.9f ? vec3(0, 1, 0) : vec3(1, 0, 0)));
+}
+
+void LightTree::Bounds::extend(const Bounds& other)
+{
+    // If these bounds are empty, simply take the other bounds.
+    if (min.x > max.x)
+    {
+        *this      = other;
+        lightIndex = -1;
+
+        return;
+    }
+
+    min = glm::min(min, other.min);
+    max = glm::max(max, other.max);
+    power += other.power;
+    thetaE = glm::max(thetaE, other.thetaE);
+
+    // Compute the union of the two orientation cones, as described by Conty Estevez and Kulla. If
+    // the wider cone already contains the other one, it is used as is.
+    vec3 axisA    = axis;
+    vec3 axisB    = other.axis;
+    float thetaOA = thetaO;
+    float thetaOB = other.thetaO;
+    if (thetaOB > thetaOA)
+    {
+        std::swap(axisA, axisB);
+        std::swap(thetaOA, thetaOB);
+    }
+    float thetaD = acos(clamp(dot(axisA, axisB), -1.0f, 1.0f));
+    axis         = axisA;
+    thetaO       = thetaOA;
+    if (glm::min(thetaD + thetaOB, kPi) <= thetaOA)
+    {
+        return;
+    }
+
+    // Otherwise the new cone just contains both cones, unless that covers all directions.
+    float newThetaO = (thetaOA + thetaD + thetaOB) * 0.5f;
+    if (newThetaO >= kPi)
+    {
+        thetaO = kPi;
+
+        return;
+    }
+
+    // Rotate the axis of the wider cone towards the other axis, to the center of the new cone.
+    float thetaR = newThetaO - thetaOA;
+    vec3 axisC   = axisB - axisA * dot(axisA, axisB);
+    axisC        = dot(axisC, axisC) > 1.0e-12f ? normalize(axisC) : perpendicular(axisA);
+    axis         = normalize(axisA * cos(thetaR) + axisC * sin(thetaR));
+    thetaO       = newThetaO;
+}
+
+float LightTree::Bounds::cost() const
+{
+    // Use the surface area of the bounds as the spatial measure, falling back to the length of the
+    // diagonal for flat or degenerate bounds.
+    vec3 size  = max - min;
+    float area = 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    if (area <= 0.0f)
+    {
+        area = length(size);
+    }
+
+    // Compute the orientation measure, which is the solid angle of the orientation cone weighted
+    // by the cosine falloff of the emission beyond the cone.
+    float thetaW      = glm::min(thetaO + thetaE, kPi);
+    float cosThetaO   = cos(thetaO);
+    float sinThetaO   = sin(thetaO);
+    float orientation = 2.0f * kPi * (1.0f - cosThetaO) +
+        kPi * 0.5f *
+            (2.0f * thetaW * sinThetaO - cos(thetaO - 2.0f * thetaW) - 2.0f * thetaO * sinThetaO +
+                cosThetaO);
+
+    return power * area * orientation;
+}
+
+void LightTree::build(const vector<Light>& lights)
+{
+    _nodes.clear();
+    _parents.clear();
+    _lightNodes.assign(lights.size(), -1);
+    _depth = 0;
+    if (lights.empty())
+    {
+        return;
+    }
+
+    // Compute the bounds of each light, from its type-specific properties.
+    vector<Bounds> lightBounds(lights.size());
+    for (size_t i = 0; i < lights.size(); i++)
+    {
+        const Light& light = lights[i];
+        Bounds& bounds     = lightBounds[i];
+        bounds.lightIndex  = static_cast<int>(i);
+        bounds.power       = power(light);
+        if (light.type == kRect)
+        {
+            // A rect light is bounded by its corners, and emits over the hemisphere around its
+            // direction.
+            vec3 halfWidth  = light.tangent * (light.width * 0.5f);
+            vec3 halfHeight = cross(light.direction, light.tangent) * (light.height * 0.5f);
+            vec3 extent     = abs(halfWidth) + abs(halfHeight);
+            bounds.min      = light.position - extent;
+            bounds.max      = light.position + extent;
+            bounds.axis     = light.direction;
+            bounds.thetaO   = 0.0f;
+            bounds.thetaE   = kPi * 0.5f;
+        }
+        else
+        {
+            // Point and spot lights are bounded by their spheres. A spot light emits within its
+            // cone, unless the cone is wider than a hemisphere, in which case it is treated like a
+            // point light so that the importance is never zero where the light can contribute.
+            bounds.min = light.position - vec3(light.radius);
+            bounds.max = light.position + vec3(light.radius);
+            if (light.type == kSpot && light.cosOuterAngle >= 0.0f)
+            {
+                bounds.axis   = light.direction;
+                bounds.thetaO = 0.0f;
+                bounds.thetaE = acos(glm::min(light.cosOuterAngle, 1.0f));
+            }
+            else
+            {
+                bounds.thetaO = kPi;
+                bounds.thetaE = kPi * 0.5f;
+            }
+        }
+    }
+
+    // Build the tree recursively from the root node.
+    _nodes.reserve(lights.size() * 2 - 1);
+    _parents.reserve(lights.size() * 2 - 1);
+    buildNode(lightBounds, 0, lightBounds.size(), -1, 1);
+}
+
+int LightTree::buildNode(
+    vector<Bounds>& lightBounds, size_t begin, size_t end, int parent, int depth)
+{
+    _depth    = glm::max(_depth, depth);
+    int index = static_cast<int>(_nodes.size());
+    _nodes.emplace_back();
+    _parents.push_back(parent);
+
+    // Compute the combined bounds of the lights, and the bounds of their centroids.
+    Bounds bounds;
+    vec3 centroidMin = vec3(numeric_limits<float>::max());
+    vec3 centroidMax = vec3(-numeric_limits<float>::max());
+    for (size_t i = begin; i < end; i++)
+    {
+        bounds.extend(lightBounds[i]);
+        centroidMin = glm::min(centroidMin, lightBounds[i].centroid());
+        centroidMax = glm::max(centroidMax, lightBounds[i].centroid());
+    }
+
+    // Create a leaf node if there is a single light.
+    if (end - begin == 1)
+    {
+        bounds.lightIndex              = lightBounds[begin].lightIndex;
+        _lightNodes[bounds.lightIndex] = index;
+    }
+
+    // Otherwise find the split with the lowest cost, using buckets along each axis. The cost is
+    // scaled by the relative extent of the axis, to avoid thin nodes.
+    else
+    {
+        vec3 extent      = centroidMax - centroidMin;
+        float maxExtent  = glm::max(extent.x, glm::max(extent.y, extent.z));
+        float bestCost   = numeric_limits<float>::max();
+        int bestAxis     = -1;
+        int bestBucket   = 0;
+        auto bucketIndex = [&](const Bounds& lightBound, int axis) {
+            float offset = (lightBound.centroid()[axis] - centroidMin[axis]) / extent[axis];
+            return glm::min(static_cast<int>(offset * kBucketCount), kBucketCount - 1);
+        };
+        for (int axis = 0; axis < 3; axis++)
+        {
+            if (extent[axis] <= 0.0f)
+            {
+                continue;
+            }
+
+            array<Bounds, kBucketCount> buckets;
+            for (size_t i = begin; i < end; i++)
+            {
+                buckets[bucketIndex(lightBounds[i], axis)].extend(lightBounds[i]);
+            }
+
+            for (int split = 1; split < kBucketCount; split++)
+            {
+                Bounds below;
+                Bounds above;
+                for (int i = 0; i < split; i++)
+                {
+                    below.extend(buckets[i]);
+                }
+                for (int i = split; i < kBucketCount; i++)
+                {
+                    above.extend(buckets[i]);
+                }
+
+                // Skip splits with an empty side.
+                if (below.min.x > below.max.x || above.min.x > above.max.x)
+                {
+                    continue;
+                }
+
+                float cost = (below.cost() + above.cost()) * maxExtent / extent[axis];
+                if (cost < bestCost)
+                {
+                    bestCost   = cost;
+                    bestAxis   = axis;
+                    bestBucket = split;
+                }
+            }
+        }
+
+        // Partition the lights at the best split. If there is no valid split, e.g. all the lights
+        // are at the same position, split the lights into two equal halves instead.
+        size_t middle = begin;
+        if (bestAxis >= 0)
+        {
+            auto pMiddle = partition(lightBounds.begin() + begin, lightBounds.begin() + end,
+                [&](const Bounds& lightBound) {
+                    return bucketIndex(lightBound, bestAxis) < bestBucket;
+                });
+            middle = pMiddle - lightBounds.begin();
+        }
+        if (middle == begin || middle == end)
+        {
+            middle = (begin + end) / 2;
+        }
+
+        // Build the child nodes. The first child immediately follows this node.
+        buildNode(lightBounds, begin, middle, index, depth + 1);
+        _nodes[index].secondChild = buildNode(lightBounds, middle, end, index, depth + 1);
+    }
+
+    // Store the combined bounds in the node.
+    Node& node      = _nodes[index];
+    node.boundsMin  = bounds.min;
+    node.boundsMax  = bounds.max;
+    node.power      = bounds.power;
+    node.axis       = bounds.axis;
+    node.cosThetaO  = cos(bounds.thetaO);
+    node.cosThetaE  = cos(bounds.thetaE);
+    node.lightIndex = bounds.lightIndex;
+
+    return index;
+}
+
+int LightTree::sample(const vec3& position, const vec3& normal, float random, float& pdfOut) const
+{
+    pdfOut = 0.0f;
+    if (_nodes.empty())
+    {
+        return -1;
+    }
+
+    // Traverse the tree from the root, choosing a child at each interior node with a probability
+    // proportional to its importance. The random number is rescaled after each choice so that it
+    // can be reused for the next one.
+    int index = 0;
+    float pdf = 1.0f;
+    while (_nodes[index].secondChild >= 0)
+    {
+        int secondChild   = _nodes[index].secondChild;
+        float importance0 = importance(_nodes[index + 1], position, normal);
+        float importance1 = importance(_nodes[secondChild], position, normal);
+        if (importance0 + importance1 <= 0.0f)
+        {
+            return -1;
+        }
+
+        float probability0 = importance0 / (importance0 + importance1);
+        if (random < probability0)
+        {
+            index  = index + 1;
+            random = random / probability0;
+            pdf *= probability0;
+        }
+        else
+        {
+            index  = secondChild;
+            random = (random - probability0) / (1.0f - probability0);
+            pdf *= 1.0f - probability0;
+        }
+        random = glm::min(random, kOneMinusEpsilon);
+    }
+
+    pdfOut = pdf;
+
+    return _nodes[index].lightIndex;
+}
+
+float LightTree::pdf(const vec3& position, const vec3& normal, int lightIndex) const
+{
+    if (lightIndex < 0 || lightIndex >= static_cast<int>(_lightNodes.size()))
+    {
+        return 0.0f;
+    }
+
+    // Walk up the tree from the leaf node of the light, multiplying the probabilities of choosing
+    // each node on the way.
+    int index = _lightNodes[lightIndex];
+    float pdf = 1.0f;
+    while (_parents[index] >= 0)
+    {
+        int parent        = _parents[index];
+        float importance0 = importance(_nodes[parent + 1], position, normal);
+        float importance1 = importance(_nodes[_nodes[parent].secondChild], position, normal);
+        if (importance0 + importance1 <= 0.0f)
+        {
+            return 0.0f;
+        }
+
+        pdf *= (index == parent + 1 ? importance0 : importance1) / (importance0 + importance1);
+        index = parent;
+    }
+
+    return pdf;
+}
+
+float LightTree::power(const Light& light)
+{
+    // Compute the power from the luminance of the light, and the solid angle and area over which it
+    // emits. This only needs to be proportional to the true power, for relative weighting.
+    float luminance =
+        light.colorAndIntensity.a * computeLuminance(vec3(light.colorAndIntensity));
+    switch (light.type)
+    {
+    case kSpot:
+        return 2.0f * kPi * (1.0f - glm::max(light.cosOuterAngle, -1.0f)) * luminance;
+    case kRect:
+        return kPi * light.width * light.height * luminance;
+    default:
+        return 4.0f * kPi * luminance;
+    }
+}
+
+float LightTree::importance(const Node& node, const vec3& position, const vec3& normal)
+{
+    // Compute the squared distance to the center of the node bounds, and the squared radius of a
+    // sphere around the bounds. The distance is clamped to the radius, so that the importance is
+    // finite inside the bounds.
+    static constexpr float kMinDistance2 = 1.0e-8f;
+    vec3 toCenter   = (node.boundsMin + node.boundsMax) * 0.5f - position;
+    vec3 size       = node.boundsMax - node.boundsMin;
+    float distance2 = dot(toCenter, toCenter);
+    float radius2   = dot(size, size) * 0.25f;
+
+    // Compute the angle subtended by the sphere from the shading point. Inside the sphere, lights
+    // can be in any direction.
+    float thetaU = kPi;
+    if (distance2 > radius2)
+    {
+        thetaU = asin(sqrt(radius2 / distance2));
+    }
+    vec3 direction = distance2 > 0.0f ? toCenter / sqrt(distance2) : node.axis;
+    distance2      = glm::max(distance2, glm::max(radius2, kMinDistance2));
+
+    // Compute the minimum angle between the emission directions of the lights and the direction
+    // to the shading point. If that is outside the emission angle, the lights can't contribute.
+    float theta      = acos(clamp(dot(node.axis, -direction), -1.0f, 1.0f));
+    float thetaO     = acos(clamp(node.cosThetaO, -1.0f, 1.0f));
+    float thetaE     = acos(clamp(node.cosThetaE, -1.0f, 1.0f));
+    float thetaPrime = glm::max(theta - thetaO - thetaU, 0.0f);
+    if (thetaPrime >= thetaE)
+    {
+        return 0.0f;
+    }
+    float result = node.power * cos(thetaPrime) / distance2;
+
+    // Compute the minimum angle between the normal and the direction to the lights. If the lights
+    // are entirely below the surface, they can't contribute.
+    if (normal != vec3(0.0f))
+    {
+        float thetaI      = acos(clamp(dot(normal, direction), -1.0f, 1.0f));
+        float thetaIPrime = glm::max(thetaI - thetaU, 0.0f);
+        if (thetaIPrime >= kPi * 0.5f)
+        {
+            return 0.0f;
+        }
+        result *= cos(thetaIPrime);
+    }
+
+    return glm::max(result, 0.0f);
+}
+
+END_AURORA
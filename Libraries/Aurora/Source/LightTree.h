@@ -0,0 +1,139 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+BEGIN_AURORA
+
+// A bounding volume hierarchy of local (point, spot, and rect) lights, built from the power,
+// spatial bounds, and emission directions of the lights. This is used to choose a light for a
+// shading point with a probability roughly proportional to its contribution, in time logarithmic
+// in the number of lights. See "Importance Sampling of Many Lights with Adaptive Tree Splitting"
+// by Conty Estevez and Kulla (2018).
+class LightTree
+{
+public:
+    // The types of local light.
+    // Must match GPU definitions in GlobalPipelineState.slang.
+    enum LightType
+    {
+        kPoint = 0,
+        kSpot  = 1,
+        kRect  = 2,
+    };
+
+    // Structure representing a single local light.
+    // Must match GPU struct LocalLight in GlobalPipelineState.slang.
+    struct Light
+    {
+        // Position of the light, which is the center of a rect light.
+        vec3 position;
+        // Type of the light, one of LightType.
+        int type = kPoint;
+        // Direction of emission, for spot and rect lights.
+        vec3 direction = vec3(0, 0, -1);
+        // Radius of the emitting sphere, for point and spot lights.
+        float radius = 0.0f;
+        // Direction along the width of a rect light.
+        vec3 tangent = vec3(1, 0, 0);
+        // Cosine of the angle at the edge of the cone of emission, for spot lights.
+        float cosOuterAngle = -1.0f;
+        // Light color (in RGB) and intensity (in alpha channel.)
+        vec4 colorAndIntensity = vec4(1.0f);
+        // Dimensions of a rect light.
+        float width  = 1.0f;
+        float height = 1.0f;
+        // Cosine of the angle where the emission starts to fall off, for spot lights.
+        float cosInnerAngle = -1.0f;
+        // Explicitly pad struct to 16-byte boundary.
+        float _padding1;
+    };
+
+    // A node of the tree. The nodes are stored in depth-first order, so the first child of an
+    // interior node immediately follows it.
+    // Must match GPU struct LightTreeNode in GlobalPipelineState.slang.
+    struct Node
+    {
+        // Bounds of the lights in the node.
+        vec3 boundsMin;
+        // Total power of the lights in the node.
+        float power = 0.0f;
+        vec3 boundsMax;
+        // Cosine of the angle around the axis which bounds the emission directions of the lights.
+        float cosThetaO = 1.0f;
+        // Axis of the cone which bounds the emission directions of the lights.
+        vec3 axis = vec3(0, 0, 1);
+        // Cosine of the angle beyond the emission directions over which the lights emit.
+        float cosThetaE = 0.0f;
+        // Index of the second child node, or -1 if this is a leaf node.
+        int secondChild = -1;
+        // Index of the light, if this is a leaf node.
+        int lightIndex = -1;
+        // Explicitly pad struct to 16-byte boundary.
+        int _padding1[2];
+    };
+
+    // Builds the tree for the specified lights, replacing any existing tree. Each light is stored
+    // in its own leaf node.
+    void build(const vector<Light>& lights);
+
+    // Gets the nodes of the tree, with the root as the first node.
+    const vector<Node>& nodes() const { return _nodes; }
+
+    // Gets the maximum depth of the tree, where a tree with a single node has a depth of one.
+    int depth() const { return _depth; }
+
+    // Chooses a light for a shading point with the specified position and normal, using a random
+    // number in the range [0, 1). Returns the index of the light and the probability of choosing
+    // it, or -1 if there are no lights that can illuminate the point. The normal may be zero to
+    // ignore the orientation of the shading point.
+    // NOTE: This must match sampleLightTree() in Lights.slang.
+    int sample(const vec3& position, const vec3& normal, float random, float& pdfOut) const;
+
+    // Gets the probability of sample() choosing the specified light.
+    float pdf(const vec3& position, const vec3& normal, int lightIndex) const;
+
+    // Computes the total power emitted by a light, which is used to weight the light for sampling.
+    static float power(const Light& light);
+
+    // Computes the importance of a node for a shading point with the specified position and
+    // normal, which is a conservative estimate of the contribution of the lights in the node.
+    // NOTE: This must match lightTreeNodeImportance() in Lights.slang.
+    static float importance(const Node& node, const vec3& position, const vec3& normal);
+
+private:
+    // Bounds of a light or a group of lights, used while building the tree.
+    struct Bounds
+    {
+        vec3 min       = vec3(numeric_limits<float>::max());
+        vec3 max       = vec3(-numeric_limits<float>::max());
+        vec3 axis      = vec3(0, 0, 1);
+        float thetaO   = 0.0f;
+        float thetaE   = 0.0f;
+        float power    = 0.0f;
+        int lightIndex = -1;
+
+        vec3 centroid() const { return (min + max) * 0.5f; }
+        void extend(const Bounds& other);
+        float cost() const;
+    };
+
+    int buildNode(vector<Bounds>& lightBounds, size_t begin, size_t end, int parent, int depth);
+
+    vector<Node> _nodes;
+    vector<int> _parents;
+    vector<int> _lightNodes;
+    int _depth = 0;
+};
+
+END_AURORA
@@ -169,15 +169,31 @@ vector<PropertyValue> StandardSurfaceDefaultProperties = {
 MaterialDefaultValues MaterialBase::StandardSurfaceDefaults(
     StandardSurfaceUniforms, StandardSurfaceDefaultProperties, StandardSurfaceDefaultTextures);
 
-MaterialBase::MaterialBase(
-    const string& name, MaterialShaderPtr pShader, MaterialDefinitionPtr pDef) :
+MaterialBase::MaterialBase(const string& name, MaterialShaderPtr pShader,
+    MaterialDefinitionPtr pDef, shared_ptr<UniformArena> pArena, size_t headerSize) :
     _pDef(pDef),
     _pShader(pShader),
     _uniformBuffer(pDef->defaults().propertyDefinitions, pDef->defaults().properties),
     _textures(pDef->defaults().textureNames),
-    _name(name)
+    _name(name),
+    _pArena(pArena)
 
 {
+    // Move the uniform buffer to a block of the arena, after the header.
+    if (_pArena)
+    {
+        _arenaSize   = headerSize + _uniformBuffer.size();
+        _arenaOffset = _pArena->allocate(_arenaSize);
+        _uniformBuffer.moveToArena(_pArena.get(), _arenaOffset + headerSize);
+    }
+}
+
+MaterialBase::~MaterialBase()
+{
+    if (_pArena)
+    {
+        _pArena->release(_arenaOffset);
+    }
 }
 
 void MaterialBase::updateBuiltInMaterial(MaterialBase& mtl)
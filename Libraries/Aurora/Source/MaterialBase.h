@@ -95,7 +95,11 @@ class MaterialBase : public IMaterial, public IValues
 public:
     /*** Lifetime Management ***/
 
-    MaterialBase(const string& name, MaterialShaderPtr pShader, MaterialDefinitionPtr pDef);
+    // If an arena is specified, the uniform buffer is stored in a block of the arena, after a
+    // header of the specified size that the renderer can use for its own per-material data.
+    MaterialBase(const string& name, MaterialShaderPtr pShader, MaterialDefinitionPtr pDef,
+        shared_ptr<UniformArena> pArena = nullptr, size_t headerSize = 0);
+    ~MaterialBase();
 
     /*** IMaterial Functions ***/
 
@@ -230,6 +234,23 @@ public:
     UniformBuffer& uniformBuffer() { return _uniformBuffer; }
     const UniformBuffer& uniformBuffer() const { return _uniformBuffer; }
 
+    // Gets whether the material is stored in a uniform arena.
+    bool isInArena() const { return _pArena != nullptr; }
+
+    // Gets the offset of the material's block in the uniform arena, i.e. the offset of the header,
+    // which is followed by the uniform buffer.
+    size_t arenaOffset() const { return _arenaOffset; }
+
+    // Gets the size of the material's block in the uniform arena, including the header.
+    size_t arenaSize() const { return _arenaSize; }
+
+    // Adds the memory used by the material to the memory statistics, i.e. the CPU copy of the
+    // uniform buffer. Renderer implementations add the device memory of the uniform buffer.
+    virtual void addMemoryUsage(MemoryStatistics& statistics) const
+    {
+        statistics.resources[ResourceType::Material].cpuBytes += _uniformBuffer.size();
+    }
+
     // Check if the material has a value for the specified name (either uniform buffer or texture)
     bool hasValue(const string& name) const
     {
@@ -283,6 +304,9 @@ private:
     UniformBuffer _uniformBuffer;
     TextureProperties _textures;
     string _name;
+    shared_ptr<UniformArena> _pArena;
+    size_t _arenaOffset = 0;
+    size_t _arenaSize   = 0;
 };
 
 END_AURORA
@@ -126,6 +126,8 @@ MaterialGenerator::MaterialGenerator(const string& mtlxFolder)
 
 shared_ptr<MaterialDefinition> MaterialGenerator::generate(const string& document)
 {
+    AU_PROFILE("MaterialGenerator::generate");
+
     shared_ptr<MaterialDefinition> pDef;
 
     // If we have already generated this material document, then just used cached material type.
@@ -0,0 +1,100 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "RenderRegion.h"
+
+BEGIN_AURORA
+
+PixelRegion RenderRegion::clip(uvec2 targetDimensions) const
+{
+    PixelRegion targets = { 0, 0, targetDimensions.x, targetDimensions.y };
+    if (_region.isEmpty())
+    {
+        return targets;
+    }
+
+    // Intersect the region with the targets, using the whole targets if there is no overlap.
+    uvec2 start = glm::min(uvec2(_region.x, _region.y), targetDimensions);
+    uvec2 end   = glm::min(uvec2(_region.x, _region.y) + uvec2(_region.width, _region.height),
+        targetDimensions);
+    PixelRegion clipped = { start.x, start.y, end.x - start.x, end.y - start.y };
+
+    return clipped.isEmpty() ? targets : clipped;
+}
+
+uvec2 RenderRegion::imageDimensions(uvec2 targetDimensions) const
+{
+    return _imageDimensions.x > 0 && _imageDimensions.y > 0 ? _imageDimensions : targetDimensions;
+}
+
+uvec2 RenderRegion::targetCoords(uvec2 dispatchIndex, uvec2 targetDimensions) const
+{
+    PixelRegion region = clip(targetDimensions);
+
+    return dispatchIndex + uvec2(region.x, region.y);
+}
+
+uvec2 RenderRegion::imageCoords(uvec2 dispatchIndex, uvec2 targetDimensions) const
+{
+    return targetCoords(dispatchIndex, targetDimensions) + _tileOffset;
+}
+
+uvec2 RenderRegion::threadGroupCount(const PixelRegion& region, uvec2 threadGroupSize)
+{
+    return (uvec2(region.width, region.height) + threadGroupSize - 1u) / threadGroupSize;
+}
+
+vector<PixelRegion> computeRenderTiles(
+    uint32_t imageWidth, uint32_t imageHeight, size_t maxTilePixels)
+{
+    vector<PixelRegion> tiles;
+    if (imageWidth == 0 || imageHeight == 0)
+    {
+        return tiles;
+    }
+
+    // Start with square tiles within the limit, limited to the image dimensions, so that a tile of
+    // a wide or tall image uses the rest of the limit along the other dimension.
+    uint64_t pixelCount = static_cast<uint64_t>(imageWidth) * imageHeight;
+    uvec2 tileSize(imageWidth, imageHeight);
+    if (maxTilePixels > 0 && pixelCount > maxTilePixels)
+    {
+        uint32_t side = std::max(1u, static_cast<uint32_t>(std::sqrt(double(maxTilePixels))));
+        tileSize.y    = std::min(imageHeight, side);
+        tileSize.x    = static_cast<uint32_t>(
+            std::min<uint64_t>(imageWidth, std::max<uint64_t>(1, maxTilePixels / tileSize.y)));
+    }
+
+    // Balance the tiles, so that the tiles at the right and bottom edges are not much smaller
+    // than the others. This doesn't change the number of tiles, and can only make them smaller.
+    uvec2 imageSize(imageWidth, imageHeight);
+    uvec2 tileCount = (imageSize + tileSize - 1u) / tileSize;
+    tileSize        = (imageSize + tileCount - 1u) / tileCount;
+
+    // Create the tiles by row, clipping the tiles at the edges to the image.
+    tiles.reserve(static_cast<size_t>(tileCount.x) * tileCount.y);
+    for (uint32_t y = 0; y < imageHeight; y += tileSize.y)
+    {
+        for (uint32_t x = 0; x < imageWidth; x += tileSize.x)
+        {
+            tiles.push_back({ x, y, std::min(tileSize.x, imageWidth - x),
+                std::min(tileSize.y, imageHeight - y) });
+        }
+    }
+
+    return tiles;
+}
+
+END_AURORA
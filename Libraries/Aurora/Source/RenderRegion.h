@@ -0,0 +1,70 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+BEGIN_AURORA
+
+// The part of the render targets that is rendered by a renderer, i.e. a region of the targets, and
+// the position of the targets in a larger image when they are a tile of that image. The region is
+// used for the dimensions of the ray dispatch, accumulation, and post-processing, and the tile is
+// used to generate camera rays and sample patterns for the whole image, so that tiles rendered
+// separately fit together seamlessly.
+//
+// The ray generation shader maps each dispatched pixel to the targets by adding the region offset,
+// and to the image by also adding the tile offset. The same mapping is provided here, so that the
+// bookkeeping can be tested on the CPU.
+class RenderRegion
+{
+public:
+    // Sets the region of the targets to render, or an empty region for the whole targets.
+    void setRegion(const PixelRegion& region) { _region = region; }
+
+    // Gets the region of the targets to render, as it was set.
+    const PixelRegion& region() const { return _region; }
+
+    // Sets the dimensions of the image that the targets are a tile of, or zero dimensions if the
+    // targets are the whole image, and the position of the tile in the image.
+    void setTile(uvec2 imageDimensions, uvec2 tileOffset)
+    {
+        _imageDimensions = imageDimensions;
+        _tileOffset      = tileOffset;
+    }
+
+    // Gets the position of the targets in the image.
+    uvec2 tileOffset() const { return _tileOffset; }
+
+    // Gets the region rendered for targets with the specified dimensions, i.e. the region clipped
+    // to the targets. This is the whole targets if the region is empty or doesn't overlap them.
+    PixelRegion clip(uvec2 targetDimensions) const;
+
+    // Gets the dimensions of the image for targets with the specified dimensions, which are the
+    // target dimensions unless the targets are a tile of a larger image.
+    uvec2 imageDimensions(uvec2 targetDimensions) const;
+
+    // Gets the target and image coordinates of the specified pixel of a dispatch over the region
+    // rendered for targets with the specified dimensions.
+    uvec2 targetCoords(uvec2 dispatchIndex, uvec2 targetDimensions) const;
+    uvec2 imageCoords(uvec2 dispatchIndex, uvec2 targetDimensions) const;
+
+    // Gets the number of thread groups needed to cover a region with a compute shader dispatch,
+    // with the specified thread group size.
+    static uvec2 threadGroupCount(const PixelRegion& region, uvec2 threadGroupSize);
+
+private:
+    PixelRegion _region;
+    uvec2 _imageDimensions = uvec2(0);
+    uvec2 _tileOffset      = uvec2(0);
+};
+
+END_AURORA
@@ -15,6 +15,7 @@
 
 #include "AssetManager.h"
 #include "RendererBase.h"
+#include "SampleSequence.h"
 #include "SceneBase.h"
 
 BEGIN_AURORA
@@ -37,6 +38,9 @@ static PropertySetPtr propertySet()
     gpPropertySet->add(kLabelDebugMode, 0);
     gpPropertySet->add(kLabelMaxLuminance, 1000.0f);
     gpPropertySet->add(kLabelTraceDepth, 5);
+    gpPropertySet->add(kLabelIsRussianRouletteEnabled, false);
+    gpPropertySet->add(kLabelRussianRouletteDepth, 3);
+    gpPropertySet->add(kLabelSamplerType, static_cast<int>(SampleSequence::kRandom));
     gpPropertySet->add(kLabelIsToneMappingEnabled, false);
 #if defined(__APPLE__)
     gpPropertySet->add(kLabelIsGammaCorrectionEnabled, false);
@@ -50,6 +54,10 @@ static PropertySetPtr propertySet()
     gpPropertySet->add(kLabelIsFlipImageYEnabled, true);
     gpPropertySet->add(kLabelIsReferenceBSDFEnabled, false);
     gpPropertySet->add(kLabelIsForceOpaqueShadowsEnabled, false);
+    gpPropertySet->add(kLabelIsProfilingEnabled, false);
+    gpPropertySet->add(kLabelIsHalfFloatImagesEnabled, false);
+    gpPropertySet->add(kLabelTextureCompression, kTextureCompressionNone);
+    gpPropertySet->add(kLabelTextureCompressionCachePath, string(""));
 
     return gpPropertySet;
 }
@@ -66,6 +74,31 @@ RendererBase::RendererBase(uint32_t taskCount) : FixedValues(propertySet()), _ta
 void RendererBase::setOptions(const Properties& options)
 {
     propertiesToValues(options, *this);
+
+    // Enable or disable the profiler if that option was specified. The profiler is shared by all
+    // renderers in the library, so it is not otherwise changed by setting unrelated options.
+    if (options.find(kLabelIsProfilingEnabled) != options.end())
+    {
+        Foundation::Profiler::profiler().setEnabled(_values.asBoolean(kLabelIsProfilingEnabled));
+    }
+
+    // Set whether float images are stored as half floats. This only affects images loaded (or
+    // created) after the option is set.
+    _pAssetMgr->enableHalfFloatImages(_values.asBoolean(kLabelIsHalfFloatImagesEnabled));
+}
+
+TextureCompressor& RendererBase::textureCompressor()
+{
+    // Apply the current texture compression options, as they can be set directly with options(),
+    // as well as with setOptions().
+    int mode                      = _values.asInt(kLabelTextureCompression);
+    TextureCompressor& compressor = _pAssetMgr->textureCompressor();
+    compressor.setOptions(mode != kTextureCompressionNone,
+        mode == kTextureCompressionHighQuality ? Foundation::CompressionQuality::High
+                                               : Foundation::CompressionQuality::Fast,
+        _values.asString(kLabelTextureCompressionCachePath));
+
+    return compressor;
 }
 
 void RendererBase::setCamera(
@@ -90,6 +123,53 @@ void RendererBase::setCamera(
     _lensRadius    = lensRadius;
 }
 
+Foundation::Profiler::Statistics RendererBase::profilingStatistics()
+{
+    return Foundation::Profiler::profiler().statistics();
+}
+
+bool RendererBase::writeProfilingTrace(const string& filePath)
+{
+    if (!Foundation::Profiler::profiler().writeChromeTrace(filePath))
+    {
+        AU_ERROR("Failed to write profiling trace to %s.", filePath.c_str());
+
+        return false;
+    }
+
+    return true;
+}
+
+void RendererBase::resetProfiling()
+{
+    Foundation::Profiler::profiler().reset();
+}
+
+MemoryStatistics RendererBase::memoryStatistics()
+{
+    // The resources are owned by the current scene, if any.
+    return _pScene ? _pScene->memoryStatistics() : MemoryStatistics();
+}
+
+bool RendererBase::setRenderRegion(const PixelRegion& region)
+{
+    // Keep rendering the whole targets if the renderer can't render a region of them.
+    if (!isRenderRegionSupported())
+    {
+        return region.isEmpty();
+    }
+
+    _renderRegion.setRegion(region);
+
+    return true;
+}
+
+void RendererBase::setRenderTile(
+    uint32_t imageWidth, uint32_t imageHeight, uint32_t tileX, uint32_t tileY)
+{
+    _renderRegion.setTile(uvec2(imageWidth, imageHeight), uvec2(tileX, tileY));
+}
+
 // Note that this handles strings differently than the implementation in SceneBase.
 void RendererBase::propertiesToValues(const Properties& properties, IValues& values)
 {
@@ -137,7 +217,7 @@ void RendererBase::propertiesToValues(const Properties& properties, IValues& val
     }
 }
 
-bool RendererBase::updateFrameDataGPUStruct(FrameData* pStaging)
+bool RendererBase::updateFrameDataGPUStruct(uvec2 targetDimensions, FrameData* pStaging)
 {
     FrameData frameData;
 
@@ -174,6 +254,17 @@ bool RendererBase::updateFrameDataGPUStruct(FrameData* pStaging)
     frameData.isDiffuseOnlyEnabled   = _values.asBoolean(kLabelIsDiffuseOnlyEnabled) ? 1 : 0;
     frameData.maxLuminance           = _values.asFloat(kLabelMaxLuminance);
     frameData.isDisplayErrorsEnabled = debugMode == kDebugModeErrors ? 1 : 0;
+    frameData.isRussianRouletteEnabled =
+        _values.asBoolean(kLabelIsRussianRouletteEnabled) ? 1 : 0;
+    frameData.russianRouletteDepth = glm::max(1, _values.asInt(kLabelRussianRouletteDepth));
+    frameData.samplerType          = glm::clamp(_values.asInt(kLabelSamplerType),
+        static_cast<int>(SampleSequence::kRandom), static_cast<int>(SampleSequence::kBlueNoise));
+
+    // Get the rendered region of the targets, and the image that the targets are a tile of.
+    PixelRegion region     = _renderRegion.clip(targetDimensions);
+    frameData.regionOffset = uvec2(region.x, region.y);
+    frameData.imageSize    = _renderRegion.imageDimensions(targetDimensions);
+    frameData.tileOffset   = _renderRegion.tileOffset();
 
     // If there are no changes compared local CPU copy, then do nothing and return false.
     if (memcmp(&_frameData, &frameData, sizeof(FrameData)) == 0)
@@ -189,7 +280,8 @@ bool RendererBase::updateFrameDataGPUStruct(FrameData* pStaging)
     return true;
 }
 
-bool RendererBase::updatePostProcessingGPUStruct(PostProcessing* pStaging)
+bool RendererBase::updatePostProcessingGPUStruct(
+    uvec2 targetDimensions, PostProcessing* pStaging)
 {
     PostProcessing settings;
 
@@ -208,6 +300,11 @@ bool RendererBase::updatePostProcessingGPUStruct(PostProcessing* pStaging)
     settings.isToneMappingEnabled     = _values.asBoolean(kLabelIsToneMappingEnabled);
     settings.isGammaCorrectionEnabled = _values.asBoolean(kLabelIsGammaCorrectionEnabled);
     settings.isAlphaEnabled           = _values.asBoolean(kLabelIsAlphaEnabled);
+
+    // Only post-process the rendered region of the targets.
+    PixelRegion region    = _renderRegion.clip(targetDimensions);
+    settings.regionOffset = uvec2(region.x, region.y);
+    settings.regionSize   = uvec2(region.width, region.height);
     
     // If there are no changes compared local CPU copy, then do nothing and return false.
     if (memcmp(&_postProcessingData, &settings, sizeof(PostProcessing)) == 0)
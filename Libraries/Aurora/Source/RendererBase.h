@@ -15,7 +15,9 @@
 
 #include "AssetManager.h"
 #include "Properties.h"
+#include "RenderRegion.h"
 #include "SceneBase.h"
+#include "UniformArena.h"
 
 BEGIN_AURORA
 
@@ -28,6 +30,9 @@ static const string kLabelIsDiffuseOnlyEnabled        = "isDiffuseOnlyEnabled";
 static const string kLabelDebugMode                   = "debugMode";
 static const string kLabelMaxLuminance                = "maxLuminance";
 static const string kLabelTraceDepth                  = "traceDepth";
+static const string kLabelIsRussianRouletteEnabled    = "isRussianRouletteEnabled";
+static const string kLabelRussianRouletteDepth        = "russianRouletteDepth";
+static const string kLabelSamplerType                 = "samplerType";
 static const string kLabelIsToneMappingEnabled        = "isToneMappingEnabled";
 static const string kLabelIsGammaCorrectionEnabled    = "isGammaCorrectionEnabled";
 static const string kLabelIsAlphaEnabled              = "alphaEnabled";
@@ -37,6 +42,10 @@ static const string kLabelImportanceSamplingMode      = "importanceSamplingMode"
 static const string kLabelIsFlipImageYEnabled         = "isFlipImageYEnabled";
 static const string kLabelIsReferenceBSDFEnabled      = "isReferenceBSDFEnabled";
 static const string kLabelIsForceOpaqueShadowsEnabled = "isForceOpaqueShadowsEnabled";
+static const string kLabelIsProfilingEnabled          = "isProfilingEnabled";
+static const string kLabelIsHalfFloatImagesEnabled    = "isHalfFloatImagesEnabled";
+static const string kLabelTextureCompression          = "textureCompression";
+static const string kLabelTextureCompressionCachePath = "textureCompressionCachePath";
 
 // The debug modes include:
 // - 0 Output (accumulation)
@@ -58,6 +67,11 @@ static const int kImportanceSamplingModeBSDF        = 0;
 static const int kImportanceSamplingModeEnvironment = 1;
 static const int kImportanceSamplingModeMIS         = 2;
 
+// Texture compression options as constants.
+static const int kTextureCompressionNone        = 0;
+static const int kTextureCompressionFast        = 1;
+static const int kTextureCompressionHighQuality = 2;
+
 // A base class for implementations of IRenderer.
 class RendererBase : public IRenderer, public FixedValues
 {
@@ -74,6 +88,13 @@ public:
         float lensRadius = 0.0f) override;
     void setCamera(
         const float* view, const float* proj, float focalDistance, float lensRadius) override;
+    Foundation::Profiler::Statistics profilingStatistics() override;
+    bool writeProfilingTrace(const string& filePath) override;
+    void resetProfiling() override;
+    MemoryStatistics memoryStatistics() override;
+    bool setRenderRegion(const PixelRegion& region) override;
+    void setRenderTile(
+        uint32_t imageWidth, uint32_t imageHeight, uint32_t tileX, uint32_t tileY) override;
 
     /*** Functions ***/
 
@@ -83,6 +104,27 @@ public:
 
     unique_ptr<AssetManager>& assetManager() { return _pAssetMgr; }
 
+    // Gets the arena that stores the uniform buffers of the materials created by the renderer.
+    const shared_ptr<UniformArena>& materialArena() const { return _pMaterialArena; }
+
+    // Gets the texture compressor of the asset manager, with the current texture compression
+    // options applied.
+    TextureCompressor& textureCompressor();
+
+    // Gets whether the renderer supports sampling images with the specified compressed format, with
+    // or without sRGB linearization.
+    virtual bool isCompressedImageFormatSupported(ImageFormat /*format*/, bool /*linearize*/) const
+    {
+        return false;
+    }
+
+    // Gets whether the renderer can render a region of the targets. Otherwise the whole targets
+    // are always rendered, though they can still be a tile of a larger image.
+    virtual bool isRenderRegionSupported() const { return false; }
+
+    // Gets the region and tile of the targets that are rendered.
+    const RenderRegion& renderRegion() const { return _renderRegion; }
+
 // TODO: Destruction via shared_ptr is not safe, we should have some kind of kill list system, but
 // can't seem to get it to work.
 #if 0
@@ -153,8 +195,27 @@ protected:
         // The maximum luminance for path tracing samples, for simple firefly clamping.
         float maxLuminance = 0.f;
 
-        // Pad to 16 byte boundary.
-        vec2 _padding1;
+        // Whether to randomly terminate paths with Russian roulette, based on path throughput.
+        int isRussianRouletteEnabled = 0;
+
+        // The path depth (number of bounces) after which Russian roulette is applied.
+        int russianRouletteDepth = 0;
+
+        // The sampler type used to generate random numbers, one of SampleSequence::SamplerType.
+        int samplerType = 0;
+
+        // Pad to 8 byte boundary.
+        int _padding1 = 0;
+
+        // The offset of the rendered region in the targets, which is added to the ray dispatch
+        // index to get the target coordinates of a pixel.
+        uvec2 regionOffset = uvec2(0);
+
+        // The dimensions of the whole image, and the offset of the targets in the image, which
+        // differ from the target dimensions and zero when the targets are a tile of a larger
+        // image. Camera rays and sample patterns are generated for the image coordinates.
+        uvec2 imageSize  = uvec2(0);
+        uvec2 tileOffset = uvec2(0);
 
         // Current light data for scene (duplicated each frame in flight.)
         SceneBase::LightData lights;
@@ -170,6 +231,8 @@ protected:
         int isToneMappingEnabled;
         int isGammaCorrectionEnabled;
         int isAlphaEnabled;
+        uvec2 regionOffset;
+        uvec2 regionSize;
     };
 
     // Sample settings GPU data.
@@ -186,8 +249,9 @@ protected:
     SampleData _sampleData;
     PostProcessing _postProcessingData;
 
-    bool updateFrameDataGPUStruct(FrameData* pStaging = nullptr);
-    bool updatePostProcessingGPUStruct(PostProcessing* pStaging = nullptr);
+    bool updateFrameDataGPUStruct(uvec2 targetDimensions, FrameData* pStaging = nullptr);
+    bool updatePostProcessingGPUStruct(
+        uvec2 targetDimensions, PostProcessing* pStaging = nullptr);
 
     /*** Protected Variables ***/
 
@@ -206,9 +270,14 @@ protected:
     mat4 _cameraProj;
     float _focalDistance = 1.0f;
     float _lensRadius    = 0.0f;
+    RenderRegion _renderRegion;
 
     // Asset manager for loading external assets.
     unique_ptr<AssetManager> _pAssetMgr;
+
+    // Arena for the uniform buffers of all materials, which is shared with the materials so that
+    // they can safely outlive the renderer.
+    shared_ptr<UniformArena> _pMaterialArena = make_shared<UniformArena>();
 };
 MAKE_AURORA_PTR(RendererBase);
 
@@ -467,4 +467,25 @@ void ResourceStub::deactivate()
     destroyResource();
 }
 
+void addMemoryUsage(const ResourceMap& resources, MemoryStatistics& statistics)
+{
+    for (auto iter = resources.begin(); iter != resources.end(); iter++)
+    {
+        ResourceStub* pStub = iter->second.get();
+        if (!pStub || pStub->type() >= ResourceType::Invalid)
+        {
+            continue;
+        }
+
+        // Count the resource, and add the memory used by its renderer resource if it is active.
+        ResourceMemoryUsage& usage = statistics.resources[pStub->type()];
+        usage.count++;
+        if (pStub->isActive())
+        {
+            usage.activeCount++;
+            pStub->addMemoryUsage(statistics);
+        }
+    }
+}
+
 END_AURORA
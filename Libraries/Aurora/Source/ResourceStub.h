@@ -110,6 +110,10 @@ public:
     /// Is this resource stub currently active?
     bool isActive() { return _permanentReferenceCount > 0 || _activeReferenceCount > 0; }
 
+    /// Adds the memory used by the actual renderer resource to the memory statistics, when the
+    /// stub is active. Should be overridden by resource sub-classes whose resources use memory.
+    virtual void addMemoryUsage(MemoryStatistics& /* statistics */) {}
+
     /// Increment the permanent reference count of this stub.  If the permanent reference count is
     /// currently zero, this will cause the resource stub to be activated.
     bool incrementPermanentRefCount();
@@ -330,4 +334,8 @@ private:
     static shared_ptr<ResourceTracker> _spDefaultTracker;
 };
 
+/// Adds the number of resource stubs of each type in a resource map to the memory statistics, and
+/// the memory used by the renderer resources of the active stubs.
+void addMemoryUsage(const ResourceMap& resources, MemoryStatistics& statistics);
+
 END_AURORA
@@ -69,6 +69,16 @@ public:
         return static_cast<uint32_t>(iter->second);
     }
 
+    // Get the index for the provided resource implementation pointer within active list.
+    // Will return -1 if resource not currently active.
+    uint32_t findActiveIndex(const ImplementationClass* pData) const
+    {
+        auto iter = _indexLookup.find(const_cast<ImplementationClass*>(pData));
+        if (iter == _indexLookup.end())
+            return static_cast<uint32_t>(-1);
+        return static_cast<uint32_t>(iter->second);
+    }
+
     // Get the active resource implementations.
     template <typename ImplementationSubClass = ImplementationClass>
     vector<PointerWrapper<ImplementationSubClass>>& resources()
@@ -92,6 +102,14 @@ public:
     void add(ImplementationClass* pDataPtr)
     {
         _changedThisFrame = true;
+
+        // Add each resource implementation once, as it may be shared by several resource stubs,
+        // e.g. deduplicated geometry.
+        if (_indexLookup.find(pDataPtr) != _indexLookup.end())
+        {
+            return;
+        }
+
         // Add resource implementation to data list, and add index to lookup.
         _indexLookup[pDataPtr] = _resourceData.size();
         _resourceData.push_back(PointerWrapper(pDataPtr));
@@ -147,6 +165,8 @@ public:
     // resource list) if no changes recorded in the tracker for this frame.
     bool update()
     {
+        AU_PROFILE("TypedResourceTracker::update");
+
         // Clear the modified notifier (whether anything changed or not.)
         _modifiedNotifier.clear();
 
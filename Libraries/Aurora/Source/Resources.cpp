@@ -13,9 +13,15 @@
 // limitations under the License.
 #include "pch.h"
 
+#include "EnvironmentBase.h"
+#include "GeometryBase.h"
+#include "ImageBase.h"
+#include "MaterialBase.h"
 #include "RendererBase.h"
 #include "Resources.h"
 
+#include <Aurora/Foundation/PixelConversion.h>
+
 BEGIN_AURORA
 
 EnvironmentResource::EnvironmentResource(const Aurora::Path& path, const ResourceMap& container,
@@ -87,6 +93,16 @@ void EnvironmentResource::createResource()
     _resource = _pRenderer->createEnvironmentPointer();
 }
 
+void EnvironmentResource::addMemoryUsage(MemoryStatistics& statistics)
+{
+    // The renderer resource may not be derived from the base class, e.g. in tests.
+    const EnvironmentBase* pEnvironment = dynamic_cast<const EnvironmentBase*>(_resource.get());
+    if (pEnvironment)
+    {
+        pEnvironment->addMemoryUsage(statistics);
+    }
+}
+
 MaterialResource::MaterialResource(const Aurora::Path& path, const ResourceMap& container,
     const TypedResourceTracker<MaterialResource, IMaterial>& tracker, IRenderer* pRenderer) :
     ResourceStub(path, container, tracker.tracker()), _pRenderer(pRenderer)
@@ -163,6 +179,16 @@ void MaterialResource::createResource()
     _resource = _pRenderer->createMaterialPointer(_type, _document, path());
 }
 
+void MaterialResource::addMemoryUsage(MemoryStatistics& statistics)
+{
+    // The renderer resource may not be derived from the base class, e.g. in tests.
+    const MaterialBase* pMaterial = dynamic_cast<const MaterialBase*>(_resource.get());
+    if (pMaterial)
+    {
+        pMaterial->addMemoryUsage(statistics);
+    }
+}
+
 SamplerResource::SamplerResource(const Aurora::Path& path, const ResourceMap& container,
     const TypedResourceTracker<SamplerResource, ISampler>& tracker, IRenderer* pRenderer) :
     ResourceStub(path, container, tracker.tracker()), _pRenderer(pRenderer)
@@ -230,6 +256,31 @@ void ImageResource::createResource()
         initData.pImageData = pixelData.pPixelBuffer;
         if (pixelData.overrideLinearize)
             initData.linearize = pixelData.linearize;
+
+        // Convert float images to half floats if that option is enabled. Images loaded by the
+        // asset manager are already converted, but this also applies to images from clients.
+        RendererBase* pRendererBase = static_cast<RendererBase*>(_pRenderer);
+        bool isFloat                = initData.format == ImageFormat::Float_RGB ||
+            initData.format == ImageFormat::Float_RGBA;
+        if (isFloat && pRendererBase->asBoolean(kLabelIsHalfFloatImagesEnabled))
+        {
+            size_t pixelCount   = static_cast<size_t>(initData.width) * initData.height;
+            size_t channelCount = initData.format == ImageFormat::Float_RGB ? 3 : 4;
+            auto* pHalfPixels =
+                static_cast<uint16_t*>(allocFunc(pixelCount * 4 * sizeof(uint16_t)));
+            Foundation::convertFloatToHalfRGBA(static_cast<const float*>(initData.pImageData),
+                channelCount, pHalfPixels, pixelCount);
+            initData.format     = ImageFormat::Half_RGBA;
+            initData.pImageData = pHalfPixels;
+        }
+
+        // Compress 8-bit images to a block compressed format if texture compression is enabled,
+        // with a format chosen from how the image is used and what the renderer supports.
+        pRendererBase->textureCompressor().compress(initData, _descriptor.usage,
+            [pRendererBase](ImageFormat format, bool linearize) {
+                return pRendererBase->isCompressedImageFormatSupported(format, linearize);
+            },
+            allocFunc);
     }
 
     // Create the actual renderer image resource.
@@ -251,6 +302,16 @@ void ImageResource::destroyResource()
 #endif
 }
 
+void ImageResource::addMemoryUsage(MemoryStatistics& statistics)
+{
+    // The renderer resource may not be derived from the base class, e.g. in tests.
+    const ImageBase* pImage = dynamic_cast<const ImageBase*>(_resource.get());
+    if (pImage)
+    {
+        pImage->addMemoryUsage(statistics);
+    }
+}
+
 GeometryResource::GeometryResource(const Aurora::Path& path, const ResourceMap& container,
     const TypedResourceTracker<GeometryResource, IGeometry>& tracker, IRenderer* pRenderer) :
     ResourceStub(path, container, tracker.tracker()), _pRenderer(pRenderer)
@@ -260,7 +321,46 @@ GeometryResource::GeometryResource(const Aurora::Path& path, const ResourceMap&
 void GeometryResource::createResource()
 {
     AU_ASSERT(_hasDescriptor, "No descriptor, can't create geometry");
-    _resource = _pRenderer->createGeometryPointer(_descriptor, path());
+    if (!_pDedupIndex)
+    {
+        _resource = _pRenderer->createGeometryPointer(_descriptor, path());
+        return;
+    }
+
+    // Share the geometry with any other geometry resource with the same content, as identified by
+    // its hashes, or create it if there is none.
+    _pAcquiredIndex = _pDedupIndex;
+    auto create     = [this](const GeometryDescriptor& descriptor) {
+        return _pRenderer->createGeometryPointer(descriptor, path());
+    };
+    _resource = _pDedupIndex->acquire(path(), _descriptor, create);
+}
+
+void GeometryResource::destroyResource()
+{
+    // Release the reference to shared geometry, using the index the geometry was acquired from.
+    if (_pAcquiredIndex)
+    {
+        _pAcquiredIndex->release(path());
+        _pAcquiredIndex = nullptr;
+    }
+    _resource.reset();
+}
+
+void GeometryResource::addMemoryUsage(MemoryStatistics& statistics)
+{
+    // Count the memory of shared geometry once, for the primary path that shares it.
+    if (_pAcquiredIndex && !_pAcquiredIndex->isPrimary(path()))
+    {
+        return;
+    }
+
+    // The renderer resource may not be derived from the base class, e.g. in tests.
+    const GeometryBase* pGeometry = dynamic_cast<const GeometryBase*>(_resource.get());
+    if (pGeometry)
+    {
+        pGeometry->addMemoryUsage(statistics);
+    }
 }
 
 InstanceResource::InstanceResource(const Path& path, const ResourceMap& container,
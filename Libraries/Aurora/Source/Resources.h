@@ -13,6 +13,7 @@
 // limitations under the License.
 #pragma once
 
+#include "GeometryDedupIndex.h"
 #include "ResourceStub.h"
 
 BEGIN_AURORA
@@ -38,6 +39,9 @@ public:
     /// Get the resource pointer.
     IMaterialPtr resource() const { return _resource; }
 
+    /// Override the addMemoryUsage method to add the memory used by the resource.
+    void addMemoryUsage(MemoryStatistics& statistics) override;
+
     /// Set the material type and document.
     /// If resource is active will make it invalid, forcing recreation of resource.
     /// \param type The Aurora material type string.
@@ -83,6 +87,9 @@ public:
     /// Get the resource pointer.
     IEnvironmentPtr resource() const { return _resource; }
 
+    /// Override the addMemoryUsage method to add the memory used by the resource.
+    void addMemoryUsage(MemoryStatistics& statistics) override;
+
     static constexpr ResourceType resourceType = ResourceType::Environment;
 
 private:
@@ -110,6 +117,9 @@ public:
     /// Get the resource pointer.
     IImagePtr resource() const { return _resource; }
 
+    /// Override the addMemoryUsage method to add the memory used by the resource.
+    void addMemoryUsage(MemoryStatistics& statistics) override;
+
     /// Set the material type and document.
     /// If resource is active will make it invalid, forcing recreation of resource.
     /// \param descriptor The Aurora image descriptor.
@@ -167,12 +177,15 @@ public:
     virtual ~GeometryResource() { shutdown(); }
 
     void createResource() override;
-    void destroyResource() override { _resource.reset(); }
+    void destroyResource() override;
 
     const ResourceType& type() override { return resourceType; }
 
     IGeometryPtr resource() const { return _resource; }
 
+    /// Override the addMemoryUsage method to add the memory used by the resource.
+    void addMemoryUsage(MemoryStatistics& statistics) override;
+
     void setDescriptor(const GeometryDescriptor& descriptor)
     {
         _descriptor    = descriptor;
@@ -180,13 +193,20 @@ public:
         invalidate();
     }
 
+    /// Sets the index used to share the renderer geometry with other geometry resources that have
+    /// identical content, or null to always create separate geometry. This takes effect the next
+    /// time the resource is created.
+    void setDedupIndex(GeometryDedupIndex* pDedupIndex) { _pDedupIndex = pDedupIndex; }
+
     static constexpr ResourceType resourceType = ResourceType::Geometry;
 
 private:
     IGeometryPtr _resource;
     IRenderer* _pRenderer;
     GeometryDescriptor _descriptor;
-    bool _hasDescriptor = false;
+    bool _hasDescriptor                 = false;
+    GeometryDedupIndex* _pDedupIndex    = nullptr;
+    GeometryDedupIndex* _pAcquiredIndex = nullptr;
 };
 
 /// ResourceStub sub-class that implements a  renderer instance resource.
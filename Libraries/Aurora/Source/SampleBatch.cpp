@@ -0,0 +1,53 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "SampleBatch.h"
+
+BEGIN_AURORA
+
+void recordSampleBatch(ISampleBatchCommands& commands, uint32_t slotCount, uint32_t sampleStart,
+    uint32_t sampleCount)
+{
+    AU_ASSERT(slotCount > 0, "The sample data ring must have at least one slot.");
+    if (sampleCount == 0)
+    {
+        return;
+    }
+
+    // The frame data is the same for every sample in the batch, so it is uploaded once.
+    commands.uploadFrameData();
+
+    // Fill the ring with the sample data for as many samples as possible, with a single upload,
+    // and render those samples. If there are samples left, wait for the last of these samples, so
+    // that the ring can be refilled from the first slot.
+    uint32_t sampleIndex = sampleStart;
+    uint32_t sampleEnd   = sampleStart + sampleCount;
+    while (sampleIndex < sampleEnd)
+    {
+        uint32_t count = std::min(slotCount, sampleEnd - sampleIndex);
+        commands.uploadSampleData(0, sampleIndex, count);
+        for (uint32_t slot = 0; slot < count; slot++)
+        {
+            bool isRingFull = slot == slotCount - 1 && sampleIndex + count < sampleEnd;
+            commands.renderSample(slot, isRingFull);
+        }
+        sampleIndex += count;
+    }
+
+    // Post-process the accumulated samples, and wait for the whole batch to complete.
+    commands.postProcess(true);
+}
+
+END_AURORA
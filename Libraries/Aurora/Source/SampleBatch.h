@@ -0,0 +1,55 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+BEGIN_AURORA
+
+// An interface for the GPU commands that render a batch of samples, implemented by a renderer
+// backend. The order of the commands is determined by recordSampleBatch(), so that it can be
+// tested on the CPU with a mock implementation.
+class ISampleBatchCommands
+{
+public:
+    virtual ~ISampleBatchCommands() = default;
+
+    // Uploads the frame data and post-processing data, if they have changed.
+    virtual void uploadFrameData() = 0;
+
+    // Writes the sample data for consecutive sample indices to consecutive slots of the sample
+    // data ring, starting at the specified slot, and uploads them with a single copy.
+    virtual void uploadSampleData(
+        uint32_t firstSlot, uint32_t firstSampleIndex, uint32_t count) = 0;
+
+    // Renders a sample (ray tracing and accumulation), reading its sample data from the specified
+    // slot. If wait is true, this waits until all submitted commands have completed on the GPU.
+    virtual void renderSample(uint32_t slot, bool wait) = 0;
+
+    // Post-processes the accumulated samples to produce the final image. If wait is true, this
+    // waits until all submitted commands have completed on the GPU.
+    virtual void postProcess(bool wait) = 0;
+};
+
+// Records the commands for rendering the samples in the range [sampleStart, sampleStart +
+// sampleCount) as one pipelined batch, using a ring of sample data slots with the specified number
+// of slots.
+//
+// Each sample reads its sample index from its own slot, so the samples are submitted without
+// waiting for the GPU between them, and the sample data is uploaded with one copy for each run of
+// consecutive slots. The only wait is after post-processing, unless there are more samples than
+// slots: a slot can't be rewritten until the GPU has finished with it, so there is also a wait
+// after every slotCount samples.
+void recordSampleBatch(ISampleBatchCommands& commands, uint32_t slotCount, uint32_t sampleStart,
+    uint32_t sampleCount);
+
+END_AURORA
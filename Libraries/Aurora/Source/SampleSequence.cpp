@@ -0,0 +1,253 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "SampleSequence.h"
+
+#include <random>
+
+BEGIN_AURORA
+
+namespace SampleSequence
+{
+
+// Reverses the order of the bits of a 32-bit integer.
+static uint32_t reverseBits(uint32_t value)
+{
+    value = ((value >> 1) & 0x55555555u) | ((value & 0x55555555u) << 1);
+    value = ((value >> 2) & 0x33333333u) | ((value & 0x33333333u) << 2);
+    value = ((value >> 4) & 0x0F0F0F0Fu) | ((value & 0x0F0F0F0Fu) << 4);
+    value = ((value >> 8) & 0x00FF00FFu) | ((value & 0x00FF00FFu) << 8);
+
+    return (value >> 16) | (value << 16);
+}
+
+// Applies a hash-based permutation to an integer, where each bit only affects the more significant
+// bits. This is the Laine-Karras permutation, with the improved constants from Burley (2020).
+static uint32_t laineKarrasPermutation(uint32_t value, uint32_t seed)
+{
+    value += seed;
+    value ^= value * 0x6c50b47cu;
+    value ^= value * 0xb82f1e52u;
+    value ^= value * 0xc7afe638u;
+    value ^= value * 0x8d22f6e6u;
+
+    return value;
+}
+
+// Applies a nested uniform (Owen) scramble to an integer, where each bit only affects the less
+// significant bits.
+static uint32_t nestedUniformScramble(uint32_t value, uint32_t seed)
+{
+    return reverseBits(laineKarrasPermutation(reverseBits(value), seed));
+}
+
+// Computes the second dimension of the (unscrambled) Sobol sequence. The first dimension is simply
+// the index with its bits reversed, i.e. the van der Corput sequence.
+static uint32_t sobolDimension1(uint32_t index)
+{
+    uint32_t result = 0;
+    for (uint32_t v = 1u << 31; index; index >>= 1, v ^= v >> 1)
+    {
+        if (index & 1)
+        {
+            result ^= v;
+        }
+    }
+
+    return result;
+}
+
+uint32_t hash(uint32_t value)
+{
+    // Use the PCG hash, from "Hash Functions for GPU Rendering" @
+    // http://www.jcgt.org/published/0009/03/02.
+    uint32_t state = value * 747796405u + 2891336453u;
+    uint32_t word  = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+
+    return (word >> 22u) ^ word;
+}
+
+uint32_t hashCombine(uint32_t seed, uint32_t value)
+{
+    return hash(seed ^ hash(value));
+}
+
+vec2 sobol2D(uint32_t index, uint32_t seed)
+{
+    // Shuffle the order of the points by scrambling the index, then scramble each dimension with a
+    // different seed. Only the upper 24 bits are used, so that the result is exactly representable
+    // as a float and never rounds up to one.
+    index      = nestedUniformScramble(index, seed);
+    uint32_t x = nestedUniformScramble(reverseBits(index), hashCombine(seed, 0));
+    uint32_t y = nestedUniformScramble(sobolDimension1(index), hashCombine(seed, 1));
+
+    return vec2(static_cast<float>(x >> 8), static_cast<float>(y >> 8)) / 16777216.0f;
+}
+
+// Creates a single channel of a blue-noise mask with the void-and-cluster method, returning the
+// rank of each pixel, i.e. the order in which the pixel is set when the mask is thresholded.
+static vector<uint32_t> buildBlueNoiseRanks(uint32_t size, uint32_t seed)
+{
+    const uint32_t pixelCount = size * size;
+
+    // Compute a Gaussian filter for each (wrapped) offset between two pixels. The "energy" of a
+    // pixel is the sum of the filter over the set pixels, which is high where the set pixels are
+    // clustered and low in the voids between them.
+    static constexpr float kSigma = 1.5f;
+    vector<float> filter(pixelCount);
+    for (uint32_t y = 0; y < size; y++)
+    {
+        for (uint32_t x = 0; x < size; x++)
+        {
+            float dx             = static_cast<float>(glm::min(x, size - x));
+            float dy             = static_cast<float>(glm::min(y, size - y));
+            filter[y * size + x] = exp(-(dx * dx + dy * dy) / (2.0f * kSigma * kSigma));
+        }
+    }
+
+    // The current binary pattern, and the energy of each pixel for that pattern.
+    vector<uint8_t> pattern(pixelCount, 0);
+    vector<float> energy(pixelCount, 0.0f);
+
+    // Sets or clears a pixel of the pattern, updating the energy of every pixel. The filter row is
+    // split in two to handle the wrapping, which avoids a modulo for each pixel.
+    auto setPixel = [&](uint32_t pixel, bool value) {
+        pattern[pixel] = value ? 1 : 0;
+        float sign     = value ? 1.0f : -1.0f;
+        uint32_t px    = pixel % size;
+        uint32_t py    = pixel / size;
+        for (uint32_t y = 0; y < size; y++)
+        {
+            const float* pFilterRow = &filter[((y + size - py) % size) * size];
+            float* pEnergyRow       = &energy[y * size];
+            for (uint32_t x = 0; x < px; x++)
+            {
+                pEnergyRow[x] += sign * pFilterRow[x + size - px];
+            }
+            for (uint32_t x = px; x < size; x++)
+            {
+                pEnergyRow[x] += sign * pFilterRow[x - px];
+            }
+        }
+    };
+
+    // Finds the set pixel with the highest energy, i.e. the tightest cluster, or the unset pixel
+    // with the lowest energy, i.e. the largest void.
+    auto findTightestCluster = [&]() {
+        uint32_t result = 0;
+        float maxEnergy = -numeric_limits<float>::max();
+        for (uint32_t i = 0; i < pixelCount; i++)
+        {
+            if (pattern[i] && energy[i] > maxEnergy)
+            {
+                maxEnergy = energy[i];
+                result    = i;
+            }
+        }
+
+        return result;
+    };
+    auto findLargestVoid = [&]() {
+        uint32_t result = 0;
+        float minEnergy = numeric_limits<float>::max();
+        for (uint32_t i = 0; i < pixelCount; i++)
+        {
+            if (!pattern[i] && energy[i] < minEnergy)
+            {
+                minEnergy = energy[i];
+                result    = i;
+            }
+        }
+
+        return result;
+    };
+
+    // Create an initial pattern with a tenth of the pixels set at random.
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<uint32_t> distribution(0, pixelCount - 1);
+    uint32_t initialCount = glm::max(pixelCount / 10, 1u);
+    for (uint32_t count = 0; count < initialCount;)
+    {
+        uint32_t pixel = distribution(random);
+        if (!pattern[pixel])
+        {
+            setPixel(pixel, true);
+            count++;
+        }
+    }
+
+    // Make the initial pattern evenly distributed, by repeatedly moving the pixel in the tightest
+    // cluster to the largest void, until that would move the pixel back to where it was. The
+    // iteration count is limited as a safeguard, though in practice this converges quickly.
+    for (uint32_t i = 0; i < pixelCount; i++)
+    {
+        uint32_t cluster = findTightestCluster();
+        setPixel(cluster, false);
+        uint32_t largestVoid = findLargestVoid();
+        setPixel(largestVoid, true);
+        if (largestVoid == cluster)
+        {
+            break;
+        }
+    }
+    vector<uint8_t> initialPattern = pattern;
+    vector<float> initialEnergy    = energy;
+
+    // Rank the pixels of the initial pattern, by removing the tightest cluster one at a time, so
+    // that the remaining pixels are always evenly distributed.
+    vector<uint32_t> ranks(pixelCount, 0);
+    for (uint32_t rank = initialCount; rank > 0; rank--)
+    {
+        uint32_t cluster = findTightestCluster();
+        setPixel(cluster, false);
+        ranks[cluster] = rank - 1;
+    }
+
+    // Rank the rest of the pixels, by filling the largest void one at a time, starting from the
+    // initial pattern.
+    // NOTE: The original method switches to removing the tightest cluster of unset pixels once half
+    // of the pixels are set. As the total energy of the set and unset pixels is the same for every
+    // pixel, that is equivalent to filling the largest void, so no switch is needed here.
+    pattern = initialPattern;
+    energy  = initialEnergy;
+    for (uint32_t rank = initialCount; rank < pixelCount; rank++)
+    {
+        uint32_t largestVoid = findLargestVoid();
+        setPixel(largestVoid, true);
+        ranks[largestVoid] = rank;
+    }
+
+    return ranks;
+}
+
+vector<vec2> buildBlueNoise(uint32_t size, uint32_t seed)
+{
+    // Build each channel with a different seed, so that they are independent, and convert the ranks
+    // to values centered in uniform intervals of [0.0, 1.0).
+    vector<uint32_t> ranksX = buildBlueNoiseRanks(size, seed);
+    vector<uint32_t> ranksY = buildBlueNoiseRanks(size, hashCombine(seed, 1));
+    vector<vec2> result(ranksX.size());
+    float scale = 1.0f / static_cast<float>(ranksX.size());
+    for (size_t i = 0; i < result.size(); i++)
+    {
+        result[i] = (vec2(ranksX[i], ranksY[i]) + 0.5f) * scale;
+    }
+
+    return result;
+}
+
+} // namespace SampleSequence
+
+END_AURORA
@@ -0,0 +1,63 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+BEGIN_AURORA
+
+// Functions for the low-discrepancy sample sequences used for path tracing, as an alternative to
+// pseudorandom numbers. These are CPU versions of the functions in Random.slang, along with the
+// generation of the blue-noise mask that is uploaded to the GPU.
+namespace SampleSequence
+{
+
+// The sampler types, i.e. how the random numbers for path tracing are generated.
+// Must match GPU definitions in Random.slang.
+enum SamplerType
+{
+    // Pseudorandom numbers (PCG), with no correlation between samples.
+    kRandom = 0,
+    // An Owen-scrambled Sobol sequence, with a different scrambling for each pixel.
+    kSobol = 1,
+    // An Owen-scrambled Sobol sequence shared by all pixels, offset for each pixel by a blue-noise
+    // mask so that the remaining error is distributed as blue noise.
+    kBlueNoise = 2,
+};
+
+// The width and height of the blue-noise mask, which is tiled across the screen.
+static const uint32_t kBlueNoiseSize = 64;
+
+// Hashes a 32-bit integer.
+// NOTE: This must match hashUint() in Random.slang.
+uint32_t hash(uint32_t value);
+
+// Combines a seed with a value to produce a new seed.
+// NOTE: This must match hashCombine() in Random.slang.
+uint32_t hashCombine(uint32_t seed, uint32_t value);
+
+// Computes a two-dimensional point of a shuffled, Owen-scrambled Sobol sequence, in the range
+// [0.0, 1.0). Each seed gives a different randomization of the sequence, which retains its
+// stratification for any power-of-two number of consecutive points starting from zero. See
+// "Practical Hash-based Owen Scrambling" by Burley (2020).
+// NOTE: This must match sobol2D() in Random.slang.
+vec2 sobol2D(uint32_t index, uint32_t seed);
+
+// Creates a blue-noise mask with the specified width and height, with two independent channels,
+// using the void-and-cluster method. Each channel has the values (i + 0.5) / N for the N pixels,
+// arranged so that similar values are far apart on the (tiled) mask. See "The void-and-cluster
+// method for dither array generation" by Ulichney (1993).
+vector<vec2> buildBlueNoise(uint32_t size, uint32_t seed);
+
+} // namespace SampleSequence
+
+END_AURORA
@@ -185,8 +185,18 @@ void SceneBase::setImageDescriptor(const Path& atPath, const ImageDescriptor& de
         _resources[atPath] = pImageRes;
     }
 
-    // Set the image descriptor.
+    // Set the image descriptor, which cancels any pending removal of the image.
     pImageRes->setDescriptor(desc);
+    _imagesToRemove.erase(atPath);
+}
+
+void SceneBase::removeImage(const Path& atPath)
+{
+    // Defer the removal to the next update, when it is known whether the image is still in use.
+    if (getResource<ImageResource>(atPath))
+    {
+        _imagesToRemove.insert(atPath);
+    }
 }
 
 ResourceType SceneBase::getResourceType(const Path& path)
@@ -223,7 +233,17 @@ void SceneBase::setImageFromFilePath(
 #else
     string pathToLoad = filePath;
 #endif
-    imageDesc.getData = [this, forceLinear, pathToLoad](
+
+    // Start loading the image in the background, so that it is decoded while the rest of the scene
+    // is set up, rather than when the image is first used. The future is shared by the copies of
+    // the descriptor, and is released once its image has been taken. There is no need to load an
+    // image that is already in the loaded images map.
+    auto pImageFuture = make_shared<ImageAssetFuture>();
+    if (_loadedImages.find(pathToLoad) == _loadedImages.end())
+    {
+        *pImageFuture = rendererBase()->assetManager()->acquireImageAsync(pathToLoad);
+    }
+    imageDesc.getData = [this, forceLinear, pathToLoad, pImageFuture](
                             Aurora::ImageData& dataOut, AllocateBufferFunction /* alloc*/) {
         shared_ptr<ImageAsset> pImageAsset;
 
@@ -231,11 +251,23 @@ void SceneBase::setImageFromFilePath(
         auto iter = _loadedImages.find(pathToLoad);
         if (iter != _loadedImages.end())
         {
-            pImageAsset = iter->second;
+            // Use the image already loaded for another path, releasing the background load.
+            pImageAsset   = iter->second;
+            *pImageFuture = ImageAssetFuture();
         }
         else
         {
-            pImageAsset = rendererBase()->assetManager()->acquireImage(pathToLoad);
+            // Wait for the image loaded in the background, unless it was not started or was
+            // already taken by an earlier update of the image, in which case it is loaded now.
+            if (pImageFuture->valid())
+            {
+                pImageAsset   = pImageFuture->get();
+                *pImageFuture = ImageAssetFuture();
+            }
+            else
+            {
+                pImageAsset = rendererBase()->assetManager()->acquireImage(pathToLoad);
+            }
 
             if (!pImageAsset)
             {
@@ -372,6 +404,7 @@ void SceneBase::setGeometryDescriptor(const Path& atPath, const GeometryDescript
 
     // Set descriptor on resource stub (this will trigger resource invalidation if it have an actual
     // geometry pointer)
+    pGeom->setDedupIndex(_isGeometryDeduplicationEnabled ? &_geometryDedupIndex : nullptr);
     pGeom->setDescriptor(desc);
 }
 
@@ -446,6 +479,8 @@ void SceneBase::preUpdate()
 
 void SceneBase::update()
 {
+    AU_PROFILE("SceneBase::update");
+
     // Update all the active resources, this will build the ResourceNotifier that stores the set of
     // active resources for this frame.
     _instances.update();
@@ -454,6 +489,115 @@ void SceneBase::update()
     _materials.update();
     _samplers.update();
     _images.update();
+
+    // Remove the images that are no longer used. This is done after the trackers are updated, as
+    // they keep pointers to the resource stubs that were activated or deactivated since the last
+    // update.
+    for (const Path& path : _imagesToRemove)
+    {
+        auto pImageRes = getResource<ImageResource>(path);
+        if (pImageRes && !pImageRes->isActive() && pImageRes != _pDefaultImageResource)
+        {
+            _resources.erase(path);
+        }
+    }
+    _imagesToRemove.clear();
+}
+
+void SceneBase::addActiveLight(const LightBasePtr& pLight)
+{
+    // Add weak pointer to the active light map, which is ordered by index so the lights have a
+    // deterministic order.
+    _activeLights[pLight->index()] = pLight;
+}
+
+bool SceneBase::updateLights()
+{
+    // See if any lights have been changed this frame, and build vector of active lights. The
+    // lights are kept alive by the vector until the light data is updated.
+    bool lightsUpdated = false;
+    vector<LightBasePtr> currLights;
+    vector<int> lightsToDelete;
+    for (auto iter = _activeLights.begin(); iter != _activeLights.end(); iter++)
+    {
+        // Get the light and ensure weak pointer still valid.
+        LightBasePtr pLight = iter->second.lock();
+        if (pLight)
+        {
+            // Add to currently active light vector.
+            currLights.push_back(pLight);
+
+            // If the dirty flag is set, GPU data must be updated.
+            if (pLight->isDirty())
+            {
+                lightsUpdated = true;
+                pLight->clearDirtyFlag();
+            }
+        }
+        else
+        {
+            // If the weak pointer is not valid, add it to the list to be removed.
+            lightsToDelete.push_back(iter->first);
+            lightsUpdated = true;
+        }
+    }
+
+    // Remove the invalid pointers from the map.
+    // Outside the iterator loop as it's not safe to call erase from inside the loop.
+    for (size_t i = 0; i < lightsToDelete.size(); i++)
+    {
+        _activeLights.erase(lightsToDelete[i]);
+    }
+
+    if (!lightsUpdated)
+    {
+        return false;
+    }
+
+    // Add the distant lights to the light data that is copied to the frame data for this frame, up
+    // to the distant light limit, and all other lights to the local light array.
+    _lights.distantLightCount = 0;
+    _localLights.clear();
+    int ignoredLightCount = 0;
+    for (const LightBasePtr& pLight : currLights)
+    {
+        if (!pLight->isDistant())
+        {
+            _localLights.push_back(pLight->localLightData());
+            continue;
+        }
+
+        if (_lights.distantLightCount == LightLimits::kMaxDistantLights)
+        {
+            ignoredLightCount++;
+            continue;
+        }
+
+        DistantLight& distantLight = _lights.distantLights[_lights.distantLightCount++];
+
+        // Store the cosine of the radius for use in the shader.
+        distantLight.cosRadius =
+            cos(0.5f * pLight->asFloat(Names::LightProperties::kAngularDiameter));
+
+        // Invert the direction for use in the shader.
+        distantLight.direction = -pLight->asFloat3(Names::LightProperties::kDirection);
+
+        // Store color in RGB and intensity in alpha.
+        distantLight.colorAndIntensity = vec4(pLight->asFloat3(Names::LightProperties::kColor),
+            pLight->asFloat(Names::LightProperties::kIntensity));
+    }
+
+    if (ignoredLightCount > 0)
+    {
+        AU_WARN("Only %d distant lights are supported, %d distant lights will be ignored.",
+            LightLimits::kMaxDistantLights, ignoredLightCount);
+    }
+
+    // Build the light tree for the local lights.
+    _lights.localLightCount = static_cast<int>(_localLights.size());
+    _lightTree.build(_localLights);
+
+    return true;
 }
 
 bool SceneBase::isPathValid(const Path& path)
@@ -461,4 +605,40 @@ bool SceneBase::isPathValid(const Path& path)
     return _resources.find(path) != _resources.end();
 }
 
+MemoryStatistics SceneBase::memoryStatistics()
+{
+    MemoryStatistics statistics;
+
+    // Add the resources in the resource map, which includes the memory used by the renderer
+    // resources of the active ones.
+    addMemoryUsage(_resources, statistics);
+
+    // Add the lights, which are not in the resource map. Only the local light data gathered for
+    // the light tree is counted.
+    ResourceMemoryUsage& lightUsage = statistics.resources[ResourceType::Light];
+    for (auto iter = _activeLights.begin(); iter != _activeLights.end(); iter++)
+    {
+        if (!iter->second.expired())
+        {
+            lightUsage.count++;
+            lightUsage.activeCount++;
+        }
+    }
+    lightUsage.cpuBytes += _localLights.capacity() * sizeof(LightTree::Light);
+
+    // Add the image files that have been loaded but whose images have not been created yet. These
+    // are released when the image is created, so a growing total indicates a leak.
+    for (auto iter = _loadedImages.begin(); iter != _loadedImages.end(); iter++)
+    {
+        statistics.loadedImages.count++;
+        if (iter->second)
+        {
+            statistics.loadedImages.activeCount++;
+            statistics.loadedImages.cpuBytes += iter->second->sizeBytes;
+        }
+    }
+
+    return statistics;
+}
+
 END_AURORA
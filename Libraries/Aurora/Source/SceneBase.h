@@ -13,6 +13,8 @@
 // limitations under the License.
 #pragma once
 
+#include "LightBase.h"
+#include "LightTree.h"
 #include "Properties.h"
 #include "Resources.h"
 
@@ -54,8 +56,12 @@ public:
         // Number of active distant lights.
         int distantLightCount = 0;
 
+        // Number of active local (point, spot, and rect) lights, which are stored in a separate
+        // buffer and sampled with the light tree.
+        int localLightCount = 0;
+
         // Explicitly pad struct to 16-byte boundary.
-        int pad[3];
+        int pad[2];
     };
 
     SceneBase(IRenderer* pRenderer) : _pRenderer(pRenderer) {}
@@ -69,6 +75,7 @@ public:
     void setImageDescriptor(const Path& atPath, const ImageDescriptor& desc) override;
     void setImageFromFilePath(
         const Path& atPath, const string& filePath, bool forceLinear, bool isEnvironment) override;
+    void removeImage(const Path& atPath) override;
     void setSamplerProperties(const Path& atPath, const Properties& props) override;
     void setMaterialType(
         const Path& atPath, const std::string& materialType, const std::string& document) override;
@@ -79,6 +86,10 @@ public:
     void setMaterialProperties(const Path& path, const Properties& materialProperties) override;
     void setInstanceProperties(const Path& path, const Properties& instanceProperties) override;
     void setGeometryDescriptor(const Path& atPath, const GeometryDescriptor& desc) override;
+    void setGeometryDeduplicationEnabled(bool enabled) override
+    {
+        _isGeometryDeduplicationEnabled = enabled;
+    }
 
     void addPermanent(const Path& resource) override;
     void removePermanent(const Path& resource) override;
@@ -88,6 +99,7 @@ public:
     void removeInstance(const Path& path) override;
     void removeInstances(const Paths& paths) override;
     void setInstanceProperties(const Paths& paths, const Properties& instanceProperties) override;
+    MemoryStatistics memoryStatistics() override;
 
     /*** Functions ***/
 
@@ -104,6 +116,12 @@ public:
 
     LightData& lights() { return _lights; }
 
+    // Gets the local lights, in the order referenced by the light tree.
+    const vector<LightTree::Light>& localLights() const { return _localLights; }
+
+    // Gets the light tree used to sample the local lights.
+    const LightTree& lightTree() const { return _lightTree; }
+
     // Create the default resources for the scene (default material, instance, image, etc.)
     // NOTE: Must be called *after* scene is attached to renderer via setScene.
     void createDefaultResources();
@@ -121,12 +139,28 @@ protected:
         return dynamic_pointer_cast<ResourceType>(iter->second);
     }
 
+    // Adds a light to the set of active lights, which are updated by updateLights().
+    void addActiveLight(const LightBasePtr& pLight);
+
+    // Updates the light data, local lights, and light tree from the active lights, if any of them
+    // have changed or been removed. Returns whether the lights changed.
+    bool updateLights();
+
     /*** Protected Variables ***/
 
     IRenderer* _pRenderer = nullptr;
     Foundation::BoundingBox _bounds;
 
     LightData _lights;
+    vector<LightTree::Light> _localLights;
+    LightTree _lightTree;
+    map<int, weak_ptr<LightBase>> _activeLights;
+    int _currentLightIndex = 0;
+
+    // Index of geometry by content, used to share geometry if deduplication is enabled. This is
+    // declared before the resources, so that it is destroyed after them.
+    GeometryDedupIndex _geometryDedupIndex;
+    bool _isGeometryDeduplicationEnabled = false;
 
     ResourceMap _resources;
 
@@ -147,6 +181,9 @@ protected:
     // Images loaded with setImageFromFilePath.
     map<string, shared_ptr<ImageAsset>> _loadedImages;
 
+    // Images to remove in the next scene update, with removeImage.
+    set<Path> _imagesToRemove;
+
     static Path kDefaultEnvironmentName;
     static Path kDefaultMaterialName;
     static Path kDefaultGeometryName;
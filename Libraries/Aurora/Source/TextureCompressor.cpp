@@ -0,0 +1,279 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "TextureCompressor.h"
+
+#include <cstdio>
+#include <filesystem>
+
+BEGIN_AURORA
+
+// The header of a cache file, which is followed by the compressed image data. The version must be
+// incremented whenever the encoder output changes, so that stale cache files are not used.
+struct CacheFileHeader
+{
+    char magic[4]     = { 'A', 'U', 'B', 'C' };
+    uint32_t version  = 1;
+    uint32_t format   = 0;
+    uint32_t width    = 0;
+    uint32_t height   = 0;
+    uint32_t reserved = 0;
+    uint64_t dataSize = 0;
+};
+
+// Computes a 64-bit FNV-1a hash of the specified data, combined with a seed. This is used for the
+// cache keys, as it must be the same on every platform and in every run.
+static uint64_t hashBytes(const void* pData, size_t size, uint64_t seed)
+{
+    static constexpr uint64_t kPrime = 0x100000001B3ull;
+
+    uint64_t hash        = seed;
+    const uint8_t* pByte = static_cast<const uint8_t*>(pData);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ pByte[i]) * kPrime;
+    }
+
+    return hash;
+}
+
+bool isCompressedImageFormat(ImageFormat format)
+{
+    return format == ImageFormat::BC1_RGBA || format == ImageFormat::BC4_R ||
+        format == ImageFormat::BC5_RG || format == ImageFormat::BC7_RGBA;
+}
+
+Foundation::BlockFormat blockFormat(ImageFormat format)
+{
+    switch (format)
+    {
+    case ImageFormat::BC1_RGBA:
+        return Foundation::BlockFormat::BC1;
+    case ImageFormat::BC4_R:
+        return Foundation::BlockFormat::BC4;
+    case ImageFormat::BC5_RG:
+        return Foundation::BlockFormat::BC5;
+    case ImageFormat::BC7_RGBA:
+        return Foundation::BlockFormat::BC7;
+    default:
+        break;
+    }
+
+    AU_FAIL("Image format %x is not block compressed.", format);
+    return Foundation::BlockFormat::BC7;
+}
+
+void TextureCompressor::setOptions(
+    bool enabled, Foundation::CompressionQuality quality, const string& cacheDirectory)
+{
+    if (enabled == _enabled && quality == _quality && cacheDirectory == _cacheDirectory)
+    {
+        return;
+    }
+    _enabled               = enabled;
+    _quality               = quality;
+    _cacheDirectory        = cacheDirectory;
+    _hasReportedCacheError = false;
+
+    // Create the cache directory if needed.
+    if (_enabled && !_cacheDirectory.empty())
+    {
+        std::error_code error;
+        std::filesystem::create_directories(_cacheDirectory, error);
+        if (error)
+        {
+            AU_WARN("Failed to create texture cache directory %s: %s", _cacheDirectory.c_str(),
+                error.message().c_str());
+        }
+    }
+}
+
+bool TextureCompressor::chooseFormat(ImageUsage usage, bool hasAlpha, bool linearize,
+    Foundation::CompressionQuality quality, const IsFormatSupportedFunction& isFormatSupported,
+    ImageFormat& formatOut)
+{
+    // List the suitable formats for the usage, in order of preference:
+    // - Color: BC1 is half the size of BC7 but has no alpha and lower quality, so it is only used
+    //   for opaque images with the fast preset.
+    // - Scalar: BC4 stores the red channel only, which is all that is read for scalar properties.
+    //   BC1 and BC7 are fallbacks where BC4 is not supported, e.g. with sRGB linearization.
+    // - Normal: BC7, as the shaders read all three components of the normal. BC5 would need the
+    //   Z component to be reconstructed when the normal is sampled.
+    vector<ImageFormat> candidates;
+    switch (usage)
+    {
+    case ImageUsage::Color:
+        if (!hasAlpha && quality == Foundation::CompressionQuality::Fast)
+        {
+            candidates.push_back(ImageFormat::BC1_RGBA);
+        }
+        candidates.push_back(ImageFormat::BC7_RGBA);
+        break;
+    case ImageUsage::Scalar:
+        candidates = { ImageFormat::BC4_R, ImageFormat::BC1_RGBA, ImageFormat::BC7_RGBA };
+        break;
+    case ImageUsage::Normal:
+        candidates = { ImageFormat::BC7_RGBA };
+        break;
+    default:
+        return false;
+    }
+
+    for (ImageFormat candidate : candidates)
+    {
+        if (isFormatSupported(candidate, linearize))
+        {
+            formatOut = candidate;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool TextureCompressor::compress(IImage::InitData& initData, ImageUsage usage,
+    const IsFormatSupportedFunction& isFormatSupported,
+    const AllocateBufferFunction& allocateBuffer)
+{
+    // Only compress 8-bit RGBA images whose dimensions are multiples of the block size, as
+    // graphics APIs require for the top level of a compressed texture.
+    if (!_enabled || initData.isEnvironment || initData.format != ImageFormat::Integer_RGBA ||
+        !initData.pImageData || initData.width % 4 != 0 || initData.height % 4 != 0)
+    {
+        return false;
+    }
+
+    // Choose the format, which depends on whether the image has any transparent pixels.
+    size_t pixelCount     = static_cast<size_t>(initData.width) * initData.height;
+    const uint8_t* pPixel = static_cast<const uint8_t*>(initData.pImageData);
+    bool hasAlpha         = false;
+    for (size_t i = 0; i < pixelCount && !hasAlpha; i++)
+    {
+        hasAlpha = pPixel[i * 4 + 3] != 255;
+    }
+    ImageFormat format;
+    if (!chooseFormat(usage, hasAlpha, initData.linearize, _quality, isFormatSupported, format))
+    {
+        return false;
+    }
+    Foundation::BlockFormat compressedFormat = blockFormat(format);
+    size_t size =
+        Foundation::compressedImageSize(compressedFormat, initData.width, initData.height);
+
+    // Look for the compressed image in the cache, with a key that includes the pixels, the
+    // dimensions, and the compression settings.
+    void* pData  = nullptr;
+    uint64_t key = 0;
+    if (!_cacheDirectory.empty())
+    {
+        uint32_t settings[] = { initData.width, initData.height, static_cast<uint32_t>(format),
+            static_cast<uint32_t>(_quality), CacheFileHeader().version };
+        key = hashBytes(initData.pImageData, pixelCount * 4, 0xCBF29CE484222325ull);
+        key = hashBytes(settings, sizeof(settings), key);
+        pData = readCache(key, initData, format, size, allocateBuffer);
+    }
+
+    // Encode the image if it was not in the cache, and add it to the cache.
+    if (!pData)
+    {
+        pData = allocateBuffer(size);
+        Foundation::compressImage(static_cast<const uint8_t*>(initData.pImageData),
+            initData.width, initData.height, compressedFormat, _quality,
+            static_cast<uint8_t*>(pData));
+        if (!_cacheDirectory.empty())
+        {
+            writeCache(key, initData, format, pData, size);
+        }
+    }
+
+    initData.format     = format;
+    initData.pImageData = pData;
+
+    return true;
+}
+
+string TextureCompressor::cacheFilePath(uint64_t key) const
+{
+    return (std::filesystem::path(_cacheDirectory) / (Foundation::sHash(key) + ".aubc")).string();
+}
+
+void* TextureCompressor::readCache(uint64_t key, const IImage::InitData& initData,
+    ImageFormat format, size_t size, const AllocateBufferFunction& allocateBuffer) const
+{
+    ifstream stream(cacheFilePath(key), ios::binary);
+    if (!stream)
+    {
+        return nullptr;
+    }
+
+    // Check that the header matches the image, in case of a hash collision or an old file.
+    CacheFileHeader expected;
+    expected.format   = static_cast<uint32_t>(format);
+    expected.width    = initData.width;
+    expected.height   = initData.height;
+    expected.dataSize = size;
+    CacheFileHeader header;
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!stream || memcmp(&header, &expected, sizeof(header)) != 0)
+    {
+        return nullptr;
+    }
+
+    void* pData = allocateBuffer(size);
+    stream.read(static_cast<char*>(pData), size);
+
+    return stream ? pData : nullptr;
+}
+
+void TextureCompressor::writeCache(uint64_t key, const IImage::InitData& initData,
+    ImageFormat format, const void* pData, size_t size)
+{
+    CacheFileHeader header;
+    header.format   = static_cast<uint32_t>(format);
+    header.width    = initData.width;
+    header.height   = initData.height;
+    header.dataSize = size;
+
+    // Write to a temporary file and then rename it, so that another process never reads a
+    // partially written file.
+    string filePath = cacheFilePath(key);
+    string tempPath = filePath + ".tmp";
+    {
+        ofstream stream(tempPath, ios::binary | ios::trunc);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(static_cast<const char*>(pData), size);
+        if (!stream)
+        {
+            stream.close();
+            std::remove(tempPath.c_str());
+            if (!_hasReportedCacheError)
+            {
+                AU_WARN("Failed to write to texture cache directory %s", _cacheDirectory.c_str());
+                _hasReportedCacheError = true;
+            }
+
+            return;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(tempPath, filePath, error);
+    if (error)
+    {
+        std::filesystem::remove(tempPath, error);
+    }
+}
+
+END_AURORA
@@ -0,0 +1,85 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <Aurora/Foundation/TextureCompression.h>
+
+BEGIN_AURORA
+
+/// Gets whether the specified image format is block compressed.
+bool isCompressedImageFormat(ImageFormat format);
+
+/// Gets the block format of a compressed image format, e.g. to compute the size of the image data.
+Foundation::BlockFormat blockFormat(ImageFormat format);
+
+/// Compresses 8-bit RGBA images to block compressed (BCn) formats when they are created, choosing
+/// the format from how the image is used, and caching the compressed images on disk so that they
+/// only need to be encoded once.
+class TextureCompressor
+{
+public:
+    /// Function that returns whether the renderer supports sampling a compressed format, with or
+    /// without sRGB linearization.
+    using IsFormatSupportedFunction = function<bool(ImageFormat format, bool linearize)>;
+
+    /// Sets the compression options. This does nothing if the options are unchanged.
+    ///
+    /// \param enabled Whether images are compressed.
+    /// \param quality The quality preset, which trades encoding speed for lower error.
+    /// \param cacheDirectory The directory for the cache of compressed images, which is created if
+    /// needed. The cache is not used if this is empty.
+    void setOptions(
+        bool enabled, Foundation::CompressionQuality quality, const string& cacheDirectory);
+
+    /// Gets whether images are compressed.
+    bool isEnabled() const { return _enabled; }
+
+    /// Compresses an image, if compression is enabled and the image is suitable, replacing the
+    /// image data and format of the specified image description. The compressed data is allocated
+    /// with the specified function, and the original image data is not modified.
+    ///
+    /// Only 8-bit RGBA images with a known usage, and dimensions that are multiples of the block
+    /// size, are compressed, and environment images are never compressed.
+    ///
+    /// \return Whether the image was compressed.
+    bool compress(IImage::InitData& initData, ImageUsage usage,
+        const IsFormatSupportedFunction& isFormatSupported,
+        const AllocateBufferFunction& allocateBuffer);
+
+    /// Chooses the compressed format for an image with the specified usage, as the first format
+    /// supported by the renderer from a list of suitable formats, in order of preference. Returns
+    /// false if there is no suitable format.
+    static bool chooseFormat(ImageUsage usage, bool hasAlpha, bool linearize,
+        Foundation::CompressionQuality quality, const IsFormatSupportedFunction& isFormatSupported,
+        ImageFormat& formatOut);
+
+private:
+    // Gets the path of the cache file for an image with the specified key.
+    string cacheFilePath(uint64_t key) const;
+
+    // Reads a compressed image from the cache, returning null if it is not in the cache.
+    void* readCache(uint64_t key, const IImage::InitData& initData, ImageFormat format,
+        size_t size, const AllocateBufferFunction& allocateBuffer) const;
+
+    // Writes a compressed image to the cache.
+    void writeCache(uint64_t key, const IImage::InitData& initData, ImageFormat format,
+        const void* pData, size_t size);
+
+    bool _enabled                           = false;
+    Foundation::CompressionQuality _quality = Foundation::CompressionQuality::Fast;
+    string _cacheDirectory;
+    bool _hasReportedCacheError = false;
+};
+
+END_AURORA
@@ -155,6 +155,8 @@ void Transpiler::setSource(const string& name, const string& code)
 bool Transpiler::transpileCode(const string& shaderCode, string& codeOut, string& errorOut,
     Language target, const map<string, string>& preprocessorDefines)
 {
+    AU_PROFILE("Transpiler::transpileCode");
+
 #if defined(__APPLE__)
     // TODO: We do actually want to be transpiling here eventually
     return true;
@@ -174,36 +176,14 @@ bool Transpiler::transpileCode(const string& shaderCode, string& codeOut, string
     return res;
 }
 
-bool Transpiler::transpile(const string& shaderName, string& codeOut, string& errorOut,
-    Language target, const map<string, string>& preprocessorDefines)
+// Compiles and links a shader (looked up from the file system) for the specified target, returning
+// the linked program, or null on failure with the diagnostics in errorOut.
+static Slang::ComPtr<slang::IComponentType> linkProgram(slang::IGlobalSession* pSession,
+    AuroraSlangFileSystem* pFileSystem, const string& shaderName, slang::TargetDesc& targetDesc,
+    const map<string, string>& preprocessorDefines, bool isDirectX, string& errorOut)
 {
-    // Clear result.
-    errorOut.clear();
-    codeOut.clear();
-
-    // TODO: Multithreading.
     using namespace slang;
 
-    // Create the target description for the session.
-    TargetDesc targetDesc;
-    switch (target)
-    {
-    case Language::HLSL:
-        targetDesc.format  = SLANG_HLSL;
-        targetDesc.profile = _pSession->findProfile("lib_6_3");
-        break;
-    case Language::GLSL:
-        targetDesc.format  = SLANG_GLSL;
-        targetDesc.profile = _pSession->findProfile("glsl_460");
-        break;
-    case Language::Metal:
-        targetDesc.format  = SLANG_METAL;
-        targetDesc.profile = _pSession->findProfile("metallib_2_3");
-        break;
-    default:
-        AU_FAIL("Unsupported target language for transpiler.");
-        return false;
-    }
     // Use standard line directives (with filename).
     targetDesc.lineDirectiveMode = SLANG_LINE_DIRECTIVE_MODE_STANDARD;
     // TODO: The buffer layout might be an issue, need to work out correct flags.
@@ -222,7 +202,7 @@ bool Transpiler::transpile(const string& shaderName, string& codeOut, string& er
     SessionDesc sessionDesc;
     sessionDesc.targets                 = &targetDesc;
     sessionDesc.targetCount             = 1;
-    sessionDesc.fileSystem              = _pFileSystem.get();
+    sessionDesc.fileSystem              = pFileSystem;
     sessionDesc.defaultMatrixLayoutMode = SLANG_MATRIX_LAYOUT_COLUMN_MAJOR;
     sessionDesc.allowGLSLSyntax         = true;
 
@@ -232,24 +212,24 @@ bool Transpiler::transpile(const string& shaderName, string& codeOut, string& er
     {
         preprocessorMacros.push_back({ key.c_str(), value.c_str() });
     }
-    preprocessorMacros.push_back({ "DIRECTX", target == Language::HLSL ? "1" : "0" });
+    preprocessorMacros.push_back({ "DIRECTX", isDirectX ? "1" : "0" });
     sessionDesc.preprocessorMacros     = preprocessorMacros.data();
     sessionDesc.preprocessorMacroCount = preprocessorMacros.size();
 
     // Create a session representing a scope for compilation with a consistent set of compiler
     // options.
     Slang::ComPtr<ISession> session;
-    _pSession->createSession(sessionDesc, session.writeRef());
+    pSession->createSession(sessionDesc, session.writeRef());
 
-    // Transpile the file.
+    // Compile the file.
     Slang::ComPtr<IBlob> diagnostics;
     const string fileName = shaderName + ".slang";
     Slang::ComPtr<IModule> sessionModule(session->loadModuleFromSource(shaderName.c_str(),
-        fileName.c_str(), _pFileSystem->getSource(shaderName), diagnostics.writeRef()));
+        fileName.c_str(), pFileSystem->getSource(shaderName), diagnostics.writeRef()));
     if (diagnostics)
     {
         errorOut = (const char*)diagnostics->getBufferPointer();
-        return false;
+        return nullptr;
     }
 
     // Link the module to get a program
@@ -258,10 +238,56 @@ bool Transpiler::transpile(const string& shaderName, string& codeOut, string& er
     if (diagnostics)
     {
         errorOut = (const char*)diagnostics->getBufferPointer();
+        return nullptr;
+    }
+
+    return linkedProgram;
+}
+
+bool Transpiler::transpile(const string& shaderName, string& codeOut, string& errorOut,
+    Language target, const map<string, string>& preprocessorDefines)
+{
+    AU_PROFILE("Transpiler::transpile");
+
+    // Clear result.
+    errorOut.clear();
+    codeOut.clear();
+
+    // TODO: Multithreading.
+    using namespace slang;
+
+    // Create the target description for the session.
+    TargetDesc targetDesc;
+    switch (target)
+    {
+    case Language::HLSL:
+        targetDesc.format  = SLANG_HLSL;
+        targetDesc.profile = _pSession->findProfile("lib_6_3");
+        break;
+    case Language::GLSL:
+        targetDesc.format  = SLANG_GLSL;
+        targetDesc.profile = _pSession->findProfile("glsl_460");
+        break;
+    case Language::Metal:
+        targetDesc.format  = SLANG_METAL;
+        targetDesc.profile = _pSession->findProfile("metallib_2_3");
+        break;
+    case Language::CPP:
+        targetDesc.format = SLANG_CPP_SOURCE;
+        break;
+    default:
+        AU_FAIL("Unsupported target language for transpiler.");
         return false;
     }
 
+    // Compile and link the shader.
+    Slang::ComPtr<IComponentType> linkedProgram = linkProgram(_pSession, _pFileSystem.get(),
+        shaderName, targetDesc, preprocessorDefines, target == Language::HLSL, errorOut);
+    if (!linkedProgram)
+        return false;
+
     // Get blob for result.
+    Slang::ComPtr<IBlob> diagnostics;
     Slang::ComPtr<ISlangBlob> outBlob;
     linkedProgram->getTargetCode(0 /* targetIndex */, outBlob.writeRef(), diagnostics.writeRef());
     if (diagnostics)
@@ -273,4 +299,53 @@ bool Transpiler::transpile(const string& shaderName, string& codeOut, string& er
     return true;
 }
 
+shared_ptr<HostShaderLibrary> Transpiler::compileHostCallable(const string& shaderCode,
+    string& errorOut, const map<string, string>& preprocessorDefines)
+{
+    AU_PROFILE("Transpiler::compileHostCallable");
+
+    using namespace slang;
+
+    errorOut.clear();
+
+    // Set the shader code "file".
+    const string codeFileName = "__hostShaderCode";
+    setSource(codeFileName, shaderCode);
+
+    // Compile and link the shader as a library of host callable functions, which Slang compiles to
+    // native code with the downstream C++ compiler.
+    TargetDesc targetDesc;
+    targetDesc.format = SLANG_HOST_HOST_CALLABLE;
+    Slang::ComPtr<IComponentType> linkedProgram = linkProgram(_pSession, _pFileSystem.get(),
+        codeFileName, targetDesc, preprocessorDefines, false, errorOut);
+    Slang::ComPtr<ISlangSharedLibrary> library;
+    if (linkedProgram)
+    {
+        Slang::ComPtr<IBlob> diagnostics;
+        linkedProgram->getTargetHostCallable(
+            0 /* targetIndex */, library.writeRef(), diagnostics.writeRef());
+        if (!library && diagnostics)
+        {
+            errorOut = (const char*)diagnostics->getBufferPointer();
+        }
+    }
+
+    // Clear the shader source to release memory.
+    setSource(codeFileName, "");
+
+    return library ? make_shared<HostShaderLibrary>(library.detach()) : nullptr;
+}
+
+HostShaderLibrary::HostShaderLibrary(ISlangSharedLibrary* pLibrary) : _pLibrary(pLibrary) {}
+
+HostShaderLibrary::~HostShaderLibrary()
+{
+    _pLibrary->release();
+}
+
+void* HostShaderLibrary::findFunction(const string& name) const
+{
+    return reinterpret_cast<void*>(_pLibrary->findFuncByName(name.c_str()));
+}
+
 END_AURORA
@@ -18,10 +18,39 @@ namespace slang
 {
 struct IGlobalSession;
 }
+struct ISlangSharedLibrary;
 BEGIN_AURORA
 
 struct AuroraSlangFileSystem;
 
+// A shader library compiled to native code for the host CPU, with exported functions that can be
+// called directly. This is used to test and benchmark shader code without a GPU.
+class HostShaderLibrary
+{
+public:
+    // Constructor takes ownership of the Slang shared library.
+    HostShaderLibrary(ISlangSharedLibrary* pLibrary);
+    ~HostShaderLibrary();
+
+    // The library can't be copied, as it releases the Slang shared library it owns.
+    HostShaderLibrary(const HostShaderLibrary&)            = delete;
+    HostShaderLibrary& operator=(const HostShaderLibrary&) = delete;
+
+    // Finds an exported function by name, returning null if it is not found. Functions must be
+    // declared with [DllExport] and __extern_cpp in the shader code, so their names are not mangled.
+    void* findFunction(const string& name) const;
+
+    // Finds an exported function by name, cast to the specified function type.
+    template <typename FunctionType>
+    FunctionType* findFunction(const string& name) const
+    {
+        return reinterpret_cast<FunctionType*>(findFunction(name));
+    }
+
+private:
+    ISlangSharedLibrary* _pLibrary;
+};
+
 class Transpiler
 {
 public:
@@ -30,7 +59,8 @@ public:
     {
         HLSL,
         GLSL,
-        Metal
+        Metal,
+        CPP
     };
 
     // Constructor take a map of file text strings.
@@ -45,6 +75,11 @@ public:
     bool transpileCode(const string& shaderCode, string& codeOut, string& errorOut, Language target,
         const map<string, string>& preprocessorDefines = {});
 
+    // Compile a string containing shader code to native code for the host CPU, returning null on
+    // failure. This requires a C++ compiler that Slang can find at runtime (e.g. gcc or clang).
+    shared_ptr<HostShaderLibrary> compileHostCallable(const string& shaderCode, string& errorOut,
+        const map<string, string>& preprocessorDefines = {});
+
     // Set a source file in the file text string map.
     void setSource(const string& name, const string& code);
 
@@ -0,0 +1,224 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "UniformArena.h"
+
+BEGIN_AURORA
+
+size_t UniformArena::allocate(size_t size)
+{
+    // Round the size up to the alignment, so that every block is aligned.
+    size = std::max<size_t>((size + kAlignment - 1) / kAlignment * kAlignment, kAlignment);
+
+    // Use the first released block that is large enough, splitting it if it is larger than needed.
+    size_t offset = _data.size();
+    auto iter     = std::find_if(_freeBlocks.begin(), _freeBlocks.end(),
+            [size](const pair<const size_t, size_t>& block) { return block.second >= size; });
+    if (iter != _freeBlocks.end())
+    {
+        offset           = iter->first;
+        size_t remaining = iter->second - size;
+        _freeBlocks.erase(iter);
+        if (remaining > 0)
+        {
+            _freeBlocks[offset + size] = remaining;
+        }
+        std::fill_n(_data.begin() + offset, size, uint8_t(0));
+    }
+    else
+    {
+        _data.resize(offset + size, 0);
+    }
+
+    _blocks[offset] = size;
+    _allocatedSize += size;
+    markDirty(offset, size);
+
+    return offset;
+}
+
+void UniformArena::release(size_t offset)
+{
+    auto iter = _blocks.find(offset);
+    if (iter == _blocks.end())
+    {
+        AU_ERROR("No uniform arena block at offset %zu.", offset);
+        return;
+    }
+    size_t size = iter->second;
+    _blocks.erase(iter);
+    _allocatedSize -= size;
+
+    // Merge the block with any adjacent released blocks.
+    auto next = _freeBlocks.lower_bound(offset);
+    if (next != _freeBlocks.end() && next->first == offset + size)
+    {
+        size += next->second;
+        next = _freeBlocks.erase(next);
+    }
+    if (next != _freeBlocks.begin())
+    {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == offset)
+        {
+            offset = previous->first;
+            size += previous->second;
+            _freeBlocks.erase(previous);
+        }
+    }
+
+    // Shrink the arena if the released block is at the end, otherwise keep it for reuse.
+    if (offset + size == _data.size())
+    {
+        _data.resize(offset);
+    }
+    else
+    {
+        _freeBlocks[offset] = size;
+    }
+}
+
+void UniformArena::write(size_t offset, const void* pData, size_t size)
+{
+    AU_ASSERT(offset + size <= _data.size(), "Write outside uniform arena");
+    if (::memcmp(_data.data() + offset, pData, size) == 0)
+    {
+        return;
+    }
+    ::memcpy(_data.data() + offset, pData, size);
+    markDirty(offset, size);
+}
+
+void UniformArena::markDirty(size_t offset, size_t size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    for (auto& consumerRanges : _dirtyRanges)
+    {
+        addDirtyRange(consumerRanges.second, offset, size);
+    }
+}
+
+void UniformArena::addDirtyRange(vector<Range>& ranges, size_t offset, size_t size)
+{
+    // Extend the last range if this is adjacent to it, which is common when an object writes
+    // several values in order.
+    if (!ranges.empty() && ranges.back().end() == offset)
+    {
+        ranges.back().size += size;
+        return;
+    }
+    ranges.push_back({ offset, size });
+
+    // Coalesce the ranges if there are many of them, doubling the gap until at most half the
+    // limit remain. This bounds the memory used, and means coalescing happens at most once per
+    // kMaxDirtyRanges / 2 writes, at the cost of uploading some unchanged bytes.
+    if (ranges.size() >= kMaxDirtyRanges)
+    {
+        size_t maxGap = kDefaultMaxGap;
+        coalesceRanges(ranges, maxGap);
+        while (ranges.size() > kMaxDirtyRanges / 2)
+        {
+            maxGap *= 2;
+            coalesceRanges(ranges, maxGap);
+        }
+    }
+}
+
+UniformArena::ConsumerID UniformArena::addConsumer()
+{
+    ConsumerID consumer = _nextConsumerID++;
+    markAllDirty(consumer);
+
+    return consumer;
+}
+
+void UniformArena::removeConsumer(ConsumerID consumer)
+{
+    _dirtyRanges.erase(consumer);
+}
+
+void UniformArena::markAllDirty(ConsumerID consumer)
+{
+    vector<Range>& ranges = _dirtyRanges[consumer];
+    ranges.clear();
+    if (!_data.empty())
+    {
+        ranges.push_back({ 0, _data.size() });
+    }
+}
+
+bool UniformArena::isDirty(ConsumerID consumer) const
+{
+    auto iter = _dirtyRanges.find(consumer);
+
+    return iter != _dirtyRanges.end() && !iter->second.empty();
+}
+
+vector<UniformArena::Range> UniformArena::takeDirtyRanges(ConsumerID consumer, size_t maxGap)
+{
+    vector<Range> ranges;
+    auto iter = _dirtyRanges.find(consumer);
+    if (iter == _dirtyRanges.end())
+    {
+        return ranges;
+    }
+    ranges.swap(iter->second);
+    coalesceRanges(ranges, maxGap);
+
+    // Clip the ranges to the current size, as the arena may have shrunk since they were marked.
+    while (!ranges.empty() && ranges.back().offset >= _data.size())
+    {
+        ranges.pop_back();
+    }
+    if (!ranges.empty() && ranges.back().end() > _data.size())
+    {
+        ranges.back().size = _data.size() - ranges.back().offset;
+    }
+
+    return ranges;
+}
+
+void UniformArena::coalesceRanges(vector<Range>& ranges, size_t maxGap)
+{
+    if (ranges.empty())
+    {
+        return;
+    }
+
+    std::sort(ranges.begin(), ranges.end(),
+        [](const Range& a, const Range& b) { return a.offset < b.offset; });
+
+    // Merge each range into the previous one if it overlaps, or is within the gap.
+    size_t count = 0;
+    for (size_t i = 1; i < ranges.size(); i++)
+    {
+        Range& last = ranges[count];
+        if (ranges[i].offset <= last.end() + maxGap)
+        {
+            last.size = std::max(last.end(), ranges[i].end()) - last.offset;
+        }
+        else
+        {
+            ranges[++count] = ranges[i];
+        }
+    }
+    ranges.resize(count + 1);
+}
+
+END_AURORA
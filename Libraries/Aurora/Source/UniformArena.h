@@ -0,0 +1,111 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+BEGIN_AURORA
+
+// An arena that packs the uniform data of many objects (e.g. the uniform buffers of all materials)
+// into a single contiguous block of memory, with a block at a fixed offset for each object.
+// Changes are recorded as dirty byte ranges, which renderers coalesce into a few large copies, so
+// the cost of uploading the arena is proportional to what changed rather than the object count.
+// The dirty ranges are recorded separately for each consumer, e.g. each scene with its own copy of
+// the arena, so that one consumer taking its ranges does not hide the changes from the others.
+class UniformArena
+{
+public:
+    // The ID of a consumer of the dirty ranges.
+    using ConsumerID = size_t;
+
+    // A range of bytes in the arena.
+    struct Range
+    {
+        size_t offset = 0;
+        size_t size   = 0;
+
+        size_t end() const { return offset + size; }
+    };
+
+    // The alignment of blocks in the arena, in bytes.
+    static constexpr size_t kAlignment = 16;
+
+    // The default maximum gap between dirty ranges that are combined into a single range. Copying a
+    // small gap is cheaper than issuing another copy.
+    static constexpr size_t kDefaultMaxGap = 256;
+
+    // The number of dirty ranges that are recorded for a consumer before they are coalesced, which
+    // bounds the memory used between updates.
+    static constexpr size_t kMaxDirtyRanges = 4096;
+
+    // Allocates a block of the specified size, returning the offset of the block. Released blocks
+    // are reused where possible, otherwise the arena grows, which can move its data. The block is
+    // cleared to zero and marked dirty.
+    size_t allocate(size_t size);
+
+    // Releases the block at the specified offset, so that it can be reused.
+    void release(size_t offset);
+
+    // Gets a pointer to the data at the specified offset. This is invalidated if the arena grows.
+    uint8_t* data(size_t offset = 0) { return _data.data() + offset; }
+    const uint8_t* data(size_t offset = 0) const { return _data.data() + offset; }
+
+    // Gets the size of the arena in bytes, including released blocks.
+    size_t size() const { return _data.size(); }
+
+    // Gets the total size of the allocated blocks in bytes.
+    size_t allocatedSize() const { return _allocatedSize; }
+
+    // Gets the number of allocated blocks.
+    size_t blockCount() const { return _blocks.size(); }
+
+    // Writes data at the specified offset, marking the bytes dirty only if they changed.
+    void write(size_t offset, const void* pData, size_t size);
+
+    // Marks a range of bytes as dirty for all the consumers.
+    void markDirty(size_t offset, size_t size);
+
+    // Adds a consumer of the dirty ranges, returning its ID. The whole arena is initially dirty for
+    // the new consumer.
+    ConsumerID addConsumer();
+
+    // Removes a consumer of the dirty ranges.
+    void removeConsumer(ConsumerID consumer);
+
+    // Marks the whole arena as dirty for a consumer, e.g. after it recreates its copy of the arena.
+    void markAllDirty(ConsumerID consumer);
+
+    // Gets whether any bytes are dirty for a consumer.
+    bool isDirty(ConsumerID consumer) const;
+
+    // Gets the dirty ranges for a consumer and clears them, leaving the ranges of the other
+    // consumers unchanged. The ranges are sorted and do not overlap, and ranges separated by no
+    // more than the specified gap (in bytes) are combined.
+    vector<Range> takeDirtyRanges(ConsumerID consumer, size_t maxGap = kDefaultMaxGap);
+
+    // Sorts and combines a list of ranges in place, where ranges separated by no more than the
+    // specified gap are combined.
+    static void coalesceRanges(vector<Range>& ranges, size_t maxGap);
+
+private:
+    // Adds a range to a list of dirty ranges.
+    static void addDirtyRange(vector<Range>& ranges, size_t offset, size_t size);
+
+    vector<uint8_t> _data;
+    map<size_t, size_t> _blocks;
+    map<size_t, size_t> _freeBlocks;
+    map<ConsumerID, vector<Range>> _dirtyRanges;
+    ConsumerID _nextConsumerID = 0;
+    size_t _allocatedSize      = 0;
+};
+
+END_AURORA
@@ -283,6 +283,20 @@ UniformBuffer::UniformBuffer(
 
     // Ensure the final padding fields are included in buffer size.
     _data.resize(bufferIndex);
+    _wordCount = bufferIndex;
+}
+
+void UniformBuffer::moveToArena(UniformArena* pArena, size_t offset)
+{
+    AU_ASSERT(!_pArena, "Uniform buffer is already in an arena");
+    AU_ASSERT(offset + size() <= pArena->size(), "Uniform arena block is too small");
+
+    // Copy the contents to the arena, and release the local copy.
+    ::memcpy(pArena->data(offset), _data.data(), size());
+    pArena->markDirty(offset, size());
+    vector<uint32_t>().swap(_data);
+    _pArena      = pArena;
+    _arenaOffset = offset;
 }
 
 const UniformBuffer::Field* UniformBuffer::findField(const string& name)
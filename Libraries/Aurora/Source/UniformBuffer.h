@@ -14,6 +14,7 @@
 #pragma once
 
 #include "Properties.h"
+#include "UniformArena.h"
 
 BEGIN_AURORA
 
@@ -102,7 +103,7 @@ public:
         }
         PropertyValue::Type type = _definition[pField->index].type;
         AU_ASSERT(getSizeOfType(type) == sizeof(ValType), "Type mismatch.");
-        res = *(ValType*)&_data[pField->bufferIndex];
+        res = *(const ValType*)(words() + pField->bufferIndex);
 
         return res;
     }
@@ -111,11 +112,16 @@ public:
     void reset(const string& name);
 
     // Gets the size of the buffer in bytes.
-    size_t size() const { return _data.size() * sizeof(_data[0]); }
+    size_t size() const { return _wordCount * sizeof(_data[0]); }
 
     // Gets the contents of the buffer.
-    void* data() { return _data.data(); }
-    const void* data() const { return _data.data(); }
+    void* data() { return words(); }
+    const void* data() const { return words(); }
+
+    // Moves the contents of the buffer to the specified offset in a uniform arena, which must have
+    // space for the buffer. Subsequent changes are written to the arena, and mark the changed bytes
+    // dirty in the arena.
+    void moveToArena(UniformArena* pArena, size_t offset);
 
     // Generates a HLSL struct from this buffer.
     string generateHLSLStruct() const;
@@ -164,10 +170,26 @@ private:
 
     void set(const string& name, const PropertyValue& val);
 
+    // Gets the words of the buffer, from the arena if the buffer has been moved to one.
+    uint32_t* words()
+    {
+        return _pArena ? reinterpret_cast<uint32_t*>(_pArena->data(_arenaOffset)) : _data.data();
+    }
+    const uint32_t* words() const
+    {
+        return _pArena ? reinterpret_cast<const uint32_t*>(_pArena->data(_arenaOffset))
+                       : _data.data();
+    }
+
     template <typename ValType>
     size_t copyToBuffer(const ValType& val, size_t bufferIndex)
     {
         size_t numWords = sizeof(ValType) / sizeof(_data[0]);
+        if (_pArena)
+        {
+            _pArena->write(_arenaOffset + bufferIndex * sizeof(_data[0]), &val, sizeof(ValType));
+            return bufferIndex + numWords;
+        }
         if (_data.size() < bufferIndex + numWords)
         {
             _data.resize(bufferIndex + numWords);
@@ -185,6 +207,9 @@ private:
     const Field* findField(const string& name);
     vector<Field> _fields;
     vector<uint32_t> _data;
+    size_t _wordCount     = 0;
+    UniformArena* _pArena = nullptr;
+    size_t _arenaOffset   = 0;
     map<string, size_t> _fieldMap;
     map<string, size_t> _fieldVariableMap;
     const UniformBufferDefinition& _definition;
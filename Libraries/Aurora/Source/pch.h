@@ -18,8 +18,11 @@
 #include <cassert>
 #include <cmath>
 #include <codecvt>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -30,6 +33,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -49,6 +53,7 @@ using namespace glm;
 // Aurora headers.
 #include <Aurora/Foundation/BoundingBox.h>
 #include <Aurora/Foundation/Log.h>
+#include <Aurora/Foundation/Profiler.h>
 #include <Aurora/Foundation/Timer.h>
 #include <Aurora/Foundation/Utilities.h>
 using namespace Aurora;
@@ -0,0 +1,127 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+/// An estimator of the remaining noise in a progressively rendered (accumulated) image, used to
+/// stop rendering early once the image has converged.
+///
+/// The error is estimated by comparing the accumulated image with a snapshot of the same image
+/// taken at an earlier sample count. The samples added after the snapshot are independent of those
+/// in the snapshot, so the difference between the two images gives an unbiased estimate of the
+/// variance, in the same way as comparing two "half" buffers that each accumulate every other
+/// sample. A new snapshot is taken each time the error is estimated, and the next estimate is made
+/// when the sample count has grown by a constant factor, so the cost of reading back the image is
+/// logarithmic in the total number of samples.
+///
+/// The error is computed for square tiles of the image, relative to the square root of the pixel
+/// brightness (as perceived noise is roughly proportional to that), and the image is converged when
+/// the error of every tile is below the threshold.
+class ConvergenceEstimator
+{
+public:
+    /// Statistics for the most recent error estimate.
+    struct Statistics
+    {
+        /// The sample count of the image used for the estimate.
+        uint32_t sampleCount = 0;
+
+        /// The largest error of any tile.
+        float maxError = 0.0f;
+
+        /// The average error of all the tiles.
+        float averageError = 0.0f;
+
+        /// The number of tiles, and the number of those with an error below the threshold.
+        size_t tileCount          = 0;
+        size_t convergedTileCount = 0;
+
+        /// Whether the error of every tile is below the threshold.
+        bool isConverged = false;
+    };
+
+    /// Constructor.
+    ///
+    /// /param threshold The error below which a tile is converged. Zero disables the estimator,
+    /// i.e. the image is never considered converged.
+    /// /param tileSize The width and height of the tiles, in pixels.
+    /// /param minSamples The minimum number of samples before the image can be converged, to avoid
+    /// stopping early based on an unreliable estimate.
+    ConvergenceEstimator(float threshold = 0.01f, uint32_t tileSize = 16, uint32_t minSamples = 16);
+
+    /// Resets the estimator, discarding the snapshot and the previous estimate. This must be called
+    /// when accumulation restarts, e.g. when the camera moves.
+    void reset();
+
+    /// Sets the error threshold, updating whether the image is converged based on the previous
+    /// estimate. Zero disables the estimator.
+    void setThreshold(float threshold);
+
+    /// Gets the error threshold.
+    float threshold() const { return _threshold; }
+
+    /// Gets whether the estimator is enabled, i.e. the threshold is greater than zero.
+    bool isEnabled() const { return _threshold > 0.0f; }
+
+    /// Gets whether the accumulated image with the specified sample count is needed for the next
+    /// estimate (or snapshot). The image only needs to be read back when this returns true.
+    bool needsImage(uint32_t sampleCount) const;
+
+    /// Updates the estimate with the accumulated image, which has the specified sample count.
+    ///
+    /// The image has 32-bit float pixels, with the specified row stride (in bytes) and number of
+    /// channels; only the first three (color) channels are used. If there is no snapshot, or the
+    /// image is not compatible with the snapshot, this only takes a snapshot of the image.
+    ///
+    /// /return Whether a new estimate was made.
+    bool update(const float* pPixels, size_t stride, uint32_t width, uint32_t height,
+        uint32_t channelCount, uint32_t sampleCount);
+
+    /// Gets whether the image is converged, based on the most recent estimate.
+    bool isConverged() const { return _statistics.isConverged; }
+
+    /// Gets the statistics for the most recent estimate.
+    const Statistics& statistics() const { return _statistics; }
+
+    /// Gets the error of each tile from the most recent estimate, in row-major order.
+    const std::vector<float>& tileErrors() const { return _tileErrors; }
+
+    /// Gets the number of tiles in each row, for the most recent estimate.
+    uint32_t tileCountX() const { return _tileCountX; }
+
+private:
+    void updateStatistics();
+
+    float _threshold;
+    uint32_t _tileSize;
+    uint32_t _minSamples;
+    uint32_t _width           = 0;
+    uint32_t _height          = 0;
+    uint32_t _tileCountX      = 0;
+    uint32_t _snapshotSamples = 0;
+    std::vector<float> _snapshot;
+    std::vector<float> _tileErrors;
+    Statistics _statistics;
+};
+
+} // namespace Foundation
+} // namespace Aurora
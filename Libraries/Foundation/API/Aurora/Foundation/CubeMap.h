@@ -0,0 +1,45 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <cstdint>
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+/// A face of a cube map, as 32-bit float pixels with rows of width * channelCount values. A face is
+/// usually faceSize pixels square, but may be a pixel wider, as cut from some cross layouts.
+struct CubeMapFace
+{
+    const float* pPixels = nullptr;
+    uint32_t width       = 0;
+    uint32_t height      = 0;
+};
+
+/// Converts the six faces of a cube map, in the order +X, -X, +Y, -Y, +Z, -Z, to an image with a
+/// lat-long (equirectangular) layout, of 4 * faceSize by 2 * faceSize float pixels. Each output
+/// pixel is the nearest face pixel in the direction of the pixel, or zero if that is outside the
+/// face.
+///
+/// The per-column and per-row trig values are computed once, the directions and face coordinates
+/// are computed with SIMD instructions where available (SSE2), and rows are converted in parallel,
+/// with the specified maximum number of threads, or all hardware threads if that is zero. The
+/// result is identical to converting each pixel separately with scalar code.
+void convertCubeMapToLatLong(const CubeMapFace faces[6], uint32_t faceSize, uint32_t channelCount,
+    float* pDest, uint32_t threadCount = 0);
+
+} // namespace Foundation
+} // namespace Aurora
@@ -13,9 +13,15 @@
 // limitations under the License.
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 // undefine snprintf (which is defined to _snprintf on some systems)
@@ -55,6 +61,11 @@
 //
 // AU_DEBUG_BREAK: Use this to break into the attached debugger, if any. This only works in debug
 // builds.
+//
+// Events from a single call site (file and line) are rate limited, so that an event triggered in a
+// tight loop, e.g. once per pixel or per instance, cannot dominate the frame time. Output to the
+// console can also be made asynchronous with Log::enableAsyncOutput(), in which case events are
+// queued in a fixed-size lock-free buffer and formatted and written by a background thread.
 
 // Set the ADD_FILE_AND_LINE_TO_LOGS symbol to 0 to remove file and line information from log
 // output.
@@ -149,9 +160,26 @@ public:
     using CBFunction =
         std::function<bool(const std::string& file, int line, Level level, const std::string& msg)>;
 
+    /*** Constants ***/
+
+    /// The default maximum number of events written per second from a single call site.
+    static constexpr uint32_t kDefaultRateLimit = 1000;
+
+    /// The default memory budget for events queued for asynchronous output, in bytes.
+    static constexpr size_t kDefaultAsyncMemoryBudget = 1024 * 1024;
+
+    /*** Lifetime Management ***/
+
+    Log();
+    ~Log();
+
     /*** Functions ***/
 
     /// Sets a custom logging callback function.
+    ///
+    /// The callback is always called synchronously, on the thread that triggered the event, with
+    /// the formatted message. It is called for every event at or above the log level, regardless of
+    /// the rate limit. If it returns false, the event is not written to the console.
     void setLogFunction(CBFunction cb) { _logCB = cb; }
 
     /// Sets the minimum log level.
@@ -162,6 +190,34 @@ public:
     /// Enables displaying a dialog box on failure events.
     void enableFailureDialog(bool enabled) { _failureDialogEnabled = enabled; }
 
+    /// Sets the maximum number of events written to the console per second from a single call site
+    /// (file and line), or zero for no limit.
+    ///
+    /// Events over the limit are not written, and the number discarded is reported when the call
+    /// site is next written. They are still passed to the log callback, if there is one, otherwise
+    /// they are discarded before they are formatted. Failure events are never discarded.
+    void setRateLimit(uint32_t maxEventsPerSecond) { _rateLimit = maxEventsPerSecond; }
+
+    /// Enables asynchronous console output.
+    ///
+    /// When enabled, events are queued and written by a background thread, with formatting
+    /// deferred to that thread when the arguments allow it. Consecutive identical messages are
+    /// written once, with a repeat count. The queue uses at most the specified number of bytes;
+    /// events are discarded (and counted) if it is full. Failure events are always written
+    /// synchronously, after the queue is flushed.
+    ///
+    /// \note This must not be called while other threads are logging.
+    void enableAsyncOutput(bool enabled, size_t memoryBudget = kDefaultAsyncMemoryBudget);
+
+    /// Gets whether asynchronous console output is enabled.
+    bool isAsyncOutputEnabled() const { return static_cast<bool>(_pAsyncWriter); }
+
+    /// Waits until all events queued for asynchronous output have been written.
+    void flush();
+
+    /// Gets the number of events discarded because the asynchronous output queue was full.
+    uint64_t droppedEventCount() const;
+
     /// Performs a catastrophic abort, with an optional failure dialog to cancel the abort.
     template <typename... Args>
     void abort(const std::string& file, int line, const std::string& format, Args... args)
@@ -186,22 +242,45 @@ public:
             return false;
         }
 
-        // Format the message with the variable arguments.
-        std::string formattedMsg = stringFormat(format, args...);
+        // If there is a callback, format the message now, as the callback requires it. Do nothing
+        // if the log callback returns false. The callback gets every event, and the rate limit
+        // only applies to writing the event.
+        if (_logCB)
+        {
+            std::string formattedMsg = stringFormat(format, args...);
+            if (!_logCB(file, line, messageLevel, formattedMsg))
+            {
+                return false;
+            }
+            if (!isRateLimited(messageLevel, stream, file, line))
+            {
+                write(messageLevel, stream, file, line, formattedMsg);
+            }
+
+            return true;
+        }
 
-        // Do nothing if the log callback returns false.
-        if (_logCB && !_logCB(file, line, messageLevel, formattedMsg))
+        // Do nothing if the call site has exceeded the rate limit.
+        if (isRateLimited(messageLevel, stream, file, line))
         {
             return false;
         }
 
-        // Get the file and line prefix for non-zero lines and the expanded format string.
-        std::string prefix = line > 0 ? (file + " (" + std::to_string(line) + "):\t") : "";
-        std::string msg    = prefix + formattedMsg;
+        // Queue the event for asynchronous output if enabled, with formatting deferred to the
+        // writer thread. This requires arguments that can be copied into the queue, which is the
+        // case for all the types supported by printf-style formatting.
+        if constexpr ((std::is_trivially_copyable_v<Args> && ...))
+        {
+            if (_pAsyncWriter && messageLevel != Level::kFail)
+            {
+                enqueue(messageLevel, stream, file, line, format, args...);
+
+                return true;
+            }
+        }
 
-        // Output to the debug console and the specified output stream.
-        writeToConsole(msg);
-        stream << msg;
+        // Format the message with the variable arguments, and write it.
+        write(messageLevel, stream, file, line, stringFormat(format, args...));
 
         return true;
     }
@@ -263,11 +342,180 @@ public:
     static void writeToConsole(const std::string& msg);
 
 private:
+    /*** Private Types ***/
+
+    // The asynchronous output queue and writer thread, defined in the source file.
+    class AsyncWriter;
+
+    // The size of the data buffer of a queued record, which limits the size of the encoded file,
+    // format string and arguments.
+    static constexpr size_t kRecordDataSize = 448;
+
+    // An event queued for asynchronous output. The data buffer contains the null-terminated file
+    // name, followed by either the formatted message (if there is no format function) or the
+    // null-terminated format string and the encoded arguments.
+    struct Record
+    {
+        // A function that formats the message from the data following the file name.
+        using FormatFunction = std::string (*)(const char* pData);
+
+        std::atomic<size_t> sequence;
+        size_t position;
+        Level level;
+        int line;
+        std::ostream* pStream;
+        FormatFunction formatFunction;
+        char data[kRecordDataSize];
+    };
+
+    // Encodes and decodes a trivially-copyable argument in a record data buffer.
+    template <typename T>
+    struct ArgCodec
+    {
+        static bool encode(char*& pData, const char* pEnd, const T& value)
+        {
+            if (pData + sizeof(T) > pEnd)
+            {
+                return false;
+            }
+            std::memcpy(pData, &value, sizeof(T));
+            pData += sizeof(T);
+
+            return true;
+        }
+
+        static T decode(const char*& pData)
+        {
+            T value;
+            std::memcpy(&value, pData, sizeof(T));
+            pData += sizeof(T);
+
+            return value;
+        }
+    };
+
+    // Encodes and decodes a string argument in a record data buffer. The string contents are
+    // copied, as the string may not exist when the record is formatted.
+    template <typename T>
+    struct StringCodec
+    {
+        static bool encode(char*& pData, const char* pEnd, const char* value)
+        {
+            value       = value ? value : "(null)";
+            size_t size = std::strlen(value) + 1;
+            if (pData + size > pEnd)
+            {
+                return false;
+            }
+            std::memcpy(pData, value, size);
+            pData += size;
+
+            return true;
+        }
+
+        static T decode(const char*& pData)
+        {
+            T value = const_cast<T>(pData);
+            pData += std::strlen(pData) + 1;
+
+            return value;
+        }
+    };
+
+    // The lock-free hash table entry used for rate limiting a call site. The state contains the
+    // current one-second window in the upper 32 bits and the event count in the lower 32 bits.
+    struct RateLimitSite
+    {
+        std::atomic<uint64_t> state     = 0;
+        std::atomic<uint32_t> discarded = 0;
+    };
+
+    // The number of call sites tracked for rate limiting. Call sites with the same hash share a
+    // limit, which is acceptable as this is only used to limit excessive logging.
+    static constexpr size_t kRateLimitSiteCount = 1024;
+
     /*** Private Functions ***/
 
+    // Returns whether an event from the call site is within the rate limit, reporting the number of
+    // events previously discarded from the call site if any.
+    bool checkRateLimit(Level level, std::ostream& stream, const std::string& file, int line);
+
+    // Gets whether an event from a call site is discarded by the rate limit. Failures are never
+    // discarded.
+    bool isRateLimited(Level level, std::ostream& stream, const std::string& file, int line)
+    {
+        return level != Level::kFail && _rateLimit > 0 &&
+            !checkRateLimit(level, stream, file, line);
+    }
+
+    // Writes a formatted message, either synchronously or by queueing it for asynchronous output.
+    void write(Level level, std::ostream& stream, const std::string& file, int line,
+        const std::string& msg);
+
+    // Claims a record in the asynchronous output queue, or returns null if the queue is full.
+    Record* beginRecord();
+
+    // Makes a claimed record available to the writer thread.
+    void commitRecord(Record* pRecord);
+
+    // Stores the file name and formatted message in a record, truncating them if needed.
+    static void encodeMessage(Record* pRecord, const std::string& file, const std::string& msg);
+
+    // Queues an event for asynchronous output, encoding the format string and arguments so that
+    // formatting is deferred to the writer thread.
+    template <typename... Args>
+    void enqueue(Level level, std::ostream& stream, const std::string& file, int line,
+        const std::string& format, Args... args)
+    {
+        // Claim a record, doing nothing if the queue is full (the event is counted as dropped).
+        Record* pRecord = beginRecord();
+        if (!pRecord)
+        {
+            return;
+        }
+        pRecord->level   = level;
+        pRecord->line    = line;
+        pRecord->pStream = &stream;
+
+        // Encode the file, format string, and arguments. If they don't fit in the record, format
+        // the message now and store it instead.
+        char* pData      = pRecord->data;
+        const char* pEnd = pRecord->data + kRecordDataSize;
+        if (StringCodec<const char*>::encode(pData, pEnd, file.c_str()) &&
+            StringCodec<const char*>::encode(pData, pEnd, format.c_str()) &&
+            (Codec<Args>::encode(pData, pEnd, args) && ...))
+        {
+            pRecord->formatFunction = &formatRecord<Args...>;
+        }
+        else
+        {
+            encodeMessage(pRecord, file, stringFormat(format, args...));
+        }
+
+        commitRecord(pRecord);
+    }
+
+    // Formats a message from a record data buffer containing a format string and the encoded
+    // arguments, in the same order they were encoded.
+    template <typename... Args>
+    static std::string formatRecord(const char* pData)
+    {
+        std::string format = pData;
+        pData += format.size() + 1;
+        std::tuple<Args...> args { Codec<Args>::decode(pData)... };
+
+        return std::apply(
+            [&format](auto... values) { return stringFormat(format, values...); }, args);
+    }
+
+    // Selects the codec for an argument type: strings are copied, other values are copied as-is.
+    template <typename T>
+    using Codec = std::conditional_t<std::is_same_v<T, const char*> || std::is_same_v<T, char*>,
+        StringCodec<T>, ArgCodec<T>>;
+
     /// Creates a string from variable arguments.
     template <typename... Args>
-    std::string stringFormat(const std::string& format, Args... args)
+    static std::string stringFormat(const std::string& format, Args... args)
     {
         // Disable the Clang security warning.
         // TODO: Implement a better workaround for this warning.
@@ -338,6 +586,15 @@ private:
 #else
     bool _failureDialogEnabled = true;
 #endif
+
+    // The maximum number of events per second from a single call site, or zero for no limit.
+    uint32_t _rateLimit = kDefaultRateLimit;
+
+    // The rate limiting state of the call sites, indexed by a hash of the file and line.
+    RateLimitSite _rateLimitSites[kRateLimitSiteCount];
+
+    // The asynchronous output queue and writer thread, if asynchronous output is enabled.
+    std::unique_ptr<AsyncWriter> _pAsyncWriter;
 };
 
 } // namespace Foundation
@@ -0,0 +1,74 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+// Pixel conversion functions, used to convert image data between formats, e.g. when reading back
+// render buffers. These use SIMD instructions where available (SSE2 and F16C on x86, NEON on ARM),
+// with a scalar fallback that produces identical results.
+
+/// Converts a 32-bit float to a 16-bit (half) float, rounding to the nearest even value. Values
+/// that are too large become infinity, and NaN is preserved.
+uint16_t floatToHalf(float value);
+
+/// Converts a 16-bit (half) float to a 32-bit float.
+float halfToFloat(uint16_t value);
+
+/// Converts an array of 32-bit floats to 16-bit (half) floats.
+void convertFloatToHalf(const float* pSource, uint16_t* pDest, size_t count);
+
+/// Converts an array of 16-bit (half) floats to 32-bit floats.
+void convertHalfToFloat(const uint16_t* pSource, float* pDest, size_t count);
+
+/// Converts an array of RGB or RGBA 32-bit float pixels (with the specified channel count) to RGBA
+/// 16-bit (half) float pixels. The alpha channel is set to one for RGB pixels. This is used to store
+/// float images at half precision, as three channel half float textures are not widely supported.
+void convertFloatToHalfRGBA(
+    const float* pSource, size_t channelCount, uint16_t* pDest, size_t pixelCount);
+
+/// Converts an array of 32-bit floats to 8-bit unsigned normalized values. The values are clamped
+/// to the [0.0, 1.0] range and rounded to the nearest integer.
+void convertFloatToUNorm8(const float* pSource, uint8_t* pDest, size_t count);
+
+/// Copies the rows of an image, where the source and destination can have different row strides
+/// (in bytes). This is used to remove (or add) row padding, and uses a single copy if the strides
+/// are both equal to the row size.
+void copyImageRows(const void* pSource, size_t sourceStride, void* pDest, size_t destStride,
+    size_t rowBytes, size_t height);
+
+/// Converts an image of 32-bit floats to 16-bit (half) floats, with the specified row strides (in
+/// bytes). This removes any source row padding in the same pass.
+void convertImageFloatToHalf(const float* pSource, size_t sourceStride, uint16_t* pDest,
+    size_t destStride, size_t width, size_t height, size_t channelCount);
+
+/// Converts an image of 16-bit (half) floats to 32-bit floats, with the specified row strides (in
+/// bytes). This removes any source row padding in the same pass.
+void convertImageHalfToFloat(const uint16_t* pSource, size_t sourceStride, float* pDest,
+    size_t destStride, size_t width, size_t height, size_t channelCount);
+
+/// Converts an image of 32-bit floats to 8-bit unsigned normalized values, with the specified row
+/// strides (in bytes). This removes any source row padding in the same pass. If dither is true,
+/// an ordered (4x4 Bayer) dither is applied per pixel, which avoids banding in smooth gradients.
+void convertImageFloatToUNorm8(const float* pSource, size_t sourceStride, uint8_t* pDest,
+    size_t destStride, size_t width, size_t height, size_t channelCount, bool dither = false);
+
+} // namespace Foundation
+} // namespace Aurora
@@ -0,0 +1,226 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// CPU profiling is supported by a set of macros defined here, all of which have the "AU_PROFILE"
+// prefix. Each macro opens a named zone which is closed at the end of the enclosing scope, so zones
+// nest naturally and form a hierarchy per thread. Zones are recorded into thread-local buffers, so
+// recording does not contend across threads, and cost only a single atomic load when profiling is
+// disabled (the default).
+//
+// AU_PROFILE: Records a zone with the specified name, into the profiler of the current module.
+//
+// AU_PROFILE_TO: Records a zone with the specified name, into the specified profiler. Use this
+// from modules that need to record into the profiler of another module, e.g. Aurora::profiler().
+//
+// Zone names must be string literals, or otherwise outlive the profiler, as only the pointer is
+// stored while recording.
+
+// Helpers to build a unique local variable name for a profiler zone.
+#define AU_PROFILE_CONCAT_IMPL(_a, _b) _a##_b
+#define AU_PROFILE_CONCAT(_a, _b) AU_PROFILE_CONCAT_IMPL(_a, _b)
+
+/// Records a named profiler zone from this point to the end of the enclosing scope, into the
+/// specified profiler.
+#define AU_PROFILE_TO(_profiler, _name)                                                            \
+    Aurora::Foundation::Profiler::Zone AU_PROFILE_CONCAT(_auProfileZone, __LINE__)(_profiler, _name)
+
+/// Records a named profiler zone from this point to the end of the enclosing scope.
+#define AU_PROFILE(_name) AU_PROFILE_TO(Aurora::Foundation::Profiler::profiler(), _name)
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+/// A hierarchical CPU profiler, which records named zones with nanosecond resolution.
+///
+/// Recorded zones can be queried as aggregated per-zone statistics, or exported as a trace in the
+/// Chrome trace event format, which can be viewed with chrome://tracing or https://ui.perfetto.dev.
+class Profiler
+{
+    // Per-thread storage for recorded zones, and the list of buffers returned by threads that have
+    // exited, defined in the implementation.
+    struct ThreadBuffer;
+    struct FreeThreadBuffers;
+
+public:
+    /*** Types ***/
+
+    /// The clock used for zone timestamps, which is monotonic with nanosecond resolution.
+    using clock = std::chrono::steady_clock;
+
+    /// A single recorded zone, with times in nanoseconds.
+    struct Event
+    {
+        /// The name of the zone.
+        const char* name = nullptr;
+
+        /// The start time, relative to the profiler epoch.
+        uint64_t start = 0;
+
+        /// The duration of the zone.
+        uint64_t duration = 0;
+
+        /// The index of the thread that recorded the zone. Threads that do not overlap in time may
+        /// share an index, as the storage of a thread is reused by new threads once it exits.
+        uint32_t thread = 0;
+
+        /// The nesting depth of the zone, where zero is a top-level zone on its thread.
+        uint32_t depth = 0;
+    };
+
+    /// Aggregated statistics for all recorded zones with the same name, with times in
+    /// milliseconds.
+    struct ZoneStatistics
+    {
+        /// The name of the zone.
+        std::string name;
+
+        /// The number of times the zone was recorded.
+        uint64_t count = 0;
+
+        /// The total time spent in the zone, including nested zones.
+        double totalTime = 0.0;
+
+        /// The total time spent in the zone, excluding nested zones.
+        double selfTime = 0.0;
+
+        /// The shortest time spent in a single recording of the zone.
+        double minTime = 0.0;
+
+        /// The longest time spent in a single recording of the zone.
+        double maxTime = 0.0;
+    };
+
+    /// A list of zone statistics, sorted by decreasing total time.
+    using Statistics = std::vector<ZoneStatistics>;
+
+    /// A scoped object which records a zone from construction to destruction.
+    class Zone
+    {
+    public:
+        /// Constructor, which starts the zone if the specified profiler is enabled.
+        Zone(Profiler& profiler, const char* name) :
+            _pBuffer(profiler.isEnabled() ? profiler.beginZone() : nullptr), _name(name)
+        {
+            if (_pBuffer)
+            {
+                _pProfiler = &profiler;
+                _start     = profiler.now();
+            }
+        }
+
+        /// Destructor, which ends the zone and records it.
+        ~Zone()
+        {
+            if (_pBuffer)
+            {
+                _pProfiler->endZone(_pBuffer, _name, _start, _pProfiler->now());
+            }
+        }
+
+        Zone(const Zone&)            = delete;
+        Zone& operator=(const Zone&) = delete;
+
+    private:
+        ThreadBuffer* _pBuffer = nullptr;
+        Profiler* _pProfiler   = nullptr;
+        const char* _name      = nullptr;
+        uint64_t _start        = 0;
+    };
+
+    /*** Functions ***/
+
+    /// Constructor.
+    ///
+    /// /param maxEventsPerThread The maximum number of events stored per thread for trace export.
+    /// When this is exceeded, further events are dropped from the trace, but are still included in
+    /// the statistics. This bounds the memory used by a long profiling session.
+    Profiler(size_t maxEventsPerThread = kDefaultMaxEventsPerThread);
+
+    /// Destructor.
+    ~Profiler();
+
+    Profiler(const Profiler&)            = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /// Gets the singleton profiler instance for the current module.
+    static Profiler& profiler();
+
+    /// Enables or disables recording of zones. Zones that are already open when recording is
+    /// disabled are still recorded when they end.
+    void setEnabled(bool enabled) { _isEnabled.store(enabled, std::memory_order_relaxed); }
+
+    /// Gets whether recording of zones is enabled.
+    bool isEnabled() const { return _isEnabled.load(std::memory_order_relaxed); }
+
+    /// Gets the current time in nanoseconds, relative to the profiler epoch.
+    uint64_t now() const
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - _epoch).count());
+    }
+
+    /// Discards all recorded events and statistics.
+    void reset();
+
+    /// Gets the aggregated statistics for all zones recorded since the last reset.
+    Statistics statistics() const;
+
+    /// Gets a copy of all events stored since the last reset, sorted by thread and start time.
+    std::vector<Event> events() const;
+
+    /// Gets the number of events that were dropped from the trace, due to the per-thread limit.
+    uint64_t droppedEventCount() const;
+
+    /// Writes all events stored since the last reset to a stream, in the Chrome trace event (JSON)
+    /// format.
+    void writeChromeTrace(std::ostream& stream) const;
+
+    /// Writes all events stored since the last reset to a file, in the Chrome trace event (JSON)
+    /// format.
+    ///
+    /// /return Whether the file was written successfully.
+    bool writeChromeTrace(const std::string& filePath) const;
+
+    /// The default maximum number of events stored per thread.
+    static const size_t kDefaultMaxEventsPerThread = 1 << 20;
+
+private:
+    ThreadBuffer* beginZone();
+    void endZone(ThreadBuffer* pBuffer, const char* name, uint64_t start, uint64_t end);
+    ThreadBuffer* threadBuffer();
+
+    const uint64_t _id;
+    const size_t _maxEventsPerThread;
+    const clock::time_point _epoch;
+    std::atomic<bool> _isEnabled     = false;
+    std::atomic<uint64_t> _resetTime = 0;
+    mutable std::mutex _mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> _threadBuffers;
+    std::shared_ptr<FreeThreadBuffers> _pFreeThreadBuffers;
+};
+
+} // namespace Foundation
+} // namespace Aurora
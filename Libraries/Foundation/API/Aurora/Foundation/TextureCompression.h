@@ -0,0 +1,79 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+// Block compression (BCn) functions, used to encode 8-bit RGBA images into the block compressed
+// formats supported by GPUs, which sample them directly at a fraction of the memory. Each format
+// encodes blocks of 4x4 pixels, so an image is stored as rows of blocks, with the blocks at the
+// right and bottom edges padded by repeating the edge pixels.
+
+/// The block compressed formats.
+enum class BlockFormat
+{
+    /// RGB with 5:6:5 endpoints and two-bit indices, 8 bytes per block. Alpha is always opaque.
+    BC1,
+
+    /// A single (red) channel with 8-bit endpoints and three-bit indices, 8 bytes per block.
+    BC4,
+
+    /// Two (red and green) channels, each encoded as BC4, 16 bytes per block.
+    BC5,
+
+    /// RGBA with 7-bit endpoints and four-bit indices (mode 6), 16 bytes per block.
+    BC7
+};
+
+/// The quality of the compression, which trades encoding speed for lower error.
+enum class CompressionQuality
+{
+    /// Endpoints are fitted to the principal axis of each block.
+    Fast,
+
+    /// Endpoints are also refined with a least-squares fit to the chosen indices, and alternative
+    /// encodings are tried where the format has them.
+    High
+};
+
+/// Gets the size in bytes of a single block of the specified format.
+size_t compressedBlockSize(BlockFormat format);
+
+/// Gets the size in bytes of a row of blocks, for an image with the specified width.
+size_t compressedRowPitch(BlockFormat format, uint32_t width);
+
+/// Gets the size in bytes of a block compressed image with the specified dimensions.
+size_t compressedImageSize(BlockFormat format, uint32_t width, uint32_t height);
+
+/// Compresses an image of 8-bit RGBA pixels (with rows of width * 4 bytes) to the specified format,
+/// writing compressedImageSize() bytes to the output. Rows of blocks are encoded in parallel, with
+/// the specified maximum number of threads, or all hardware threads if that is zero.
+void compressImage(const uint8_t* pPixels, uint32_t width, uint32_t height, BlockFormat format,
+    CompressionQuality quality, uint8_t* pOutput, uint32_t threadCount = 0);
+
+/// Decompresses a block compressed image to 8-bit RGBA pixels (with rows of width * 4 bytes). Green
+/// and blue are zero for BC4, blue is zero for BC5, and alpha is opaque except for BC7. This is
+/// mainly intended to measure the compression error, so only the BC7 mode produced by
+/// compressImage() is supported.
+void decompressImage(const uint8_t* pInput, uint32_t width, uint32_t height, BlockFormat format,
+    uint8_t* pPixels);
+
+} // namespace Foundation
+} // namespace Aurora
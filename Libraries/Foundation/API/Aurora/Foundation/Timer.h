@@ -14,6 +14,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
@@ -28,7 +29,9 @@ namespace Foundation
 class CPUTimer
 {
 public:
-    using clock = std::chrono::high_resolution_clock;
+    // NOTE: A steady clock is used as it is monotonic, unlike the high resolution clock on some
+    // platforms, which may be an alias of the system clock.
+    using clock = std::chrono::steady_clock;
 
     /// Constructor.
     CPUTimer() { reset(); };
@@ -68,16 +71,31 @@ public:
 
     /// Gets the time since the CPU timer was reset, in milliseconds.
     ///
-    /// This does not include the time spent while the timer is suspended.
+    /// This does not include the time spent while the timer is suspended. The result includes
+    /// fractional milliseconds, i.e. it is not truncated to whole milliseconds.
     float elapsed() const
     {
-        auto duration   = (_isSuspended ? _suspendTime : clock::now()) - _startTime;
-        auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+        auto durationMs = std::chrono::duration<float, std::milli>(elapsedDuration());
 
-        return static_cast<float>(durationMs.count());
+        return durationMs.count();
+    }
+
+    /// Gets the time since the CPU timer was reset, in nanoseconds.
+    ///
+    /// This does not include the time spent while the timer is suspended.
+    uint64_t elapsedNanoseconds() const
+    {
+        auto durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsedDuration());
+
+        return static_cast<uint64_t>(durationNs.count());
     }
 
 private:
+    clock::duration elapsedDuration() const
+    {
+        return (_isSuspended ? _suspendTime : clock::now()) - _startTime;
+    }
+
     clock::time_point _startTime;
     clock::time_point _suspendTime;
     bool _isSuspended;
@@ -125,6 +143,7 @@ public:
         _idleTimer.reset();
         _records[0].samples = 1;
         _isFull             = false;
+        _isConverged        = false;
         _currentTimeIndex   = 0;
         _sampleStart        = 0;
         _storedSamples      = 0;
@@ -135,8 +154,14 @@ public:
     /// of samples.
     uint32_t currentSamples() const { return _sampleStart; }
 
-    /// Gets whether rendering is complete, i.e. the maximum number of samples has been reached.
-    bool isComplete() const { return _sampleStart == _maxSamples; }
+    /// Gets whether rendering is complete, i.e. the maximum number of samples has been reached, or
+    /// the accumulated result has been marked as converged.
+    bool isComplete() const { return _isConverged || _sampleStart == _maxSamples; }
+
+    /// Sets whether the accumulated result has converged, e.g. based on an estimate of the
+    /// remaining noise. Rendering is complete while this is set, so that no further samples are
+    /// requested; it is cleared when the counter is restarted or reset.
+    void setConverged(bool isConverged) { _isConverged = isConverged; }
 
     /// Sets the maximum number of samples, at which point rendering is complete.
     ///
@@ -168,8 +193,9 @@ public:
         // Handle a request to restart the counter.
         if (restart)
         {
-            // Set the start sample to zero and reset the idle timer.
+            // Set the start sample to zero, clear the converged state, and reset the idle timer.
             _sampleStart = 0;
+            _isConverged = false;
             _idleTimer.reset();
 
             // If rendering was previously complete, reset the timer and return a sample count to
@@ -189,7 +215,7 @@ public:
         // If rendering is already complete, return zero samples (nothing to do).
         if (isDone)
         {
-            sampleStart = _maxSamples;
+            sampleStart = _sampleStart;
 
             return 0;
         }
@@ -279,6 +305,7 @@ private:
     float _idleFrameTime     = 250.0f;
     uint32_t _maxSamples     = 0;
     bool _isFull             = false;
+    bool _isConverged        = false;
     size_t _currentTimeIndex = 0;
     uint32_t _sampleStart    = 0;
     uint32_t _storedSamples  = 0;
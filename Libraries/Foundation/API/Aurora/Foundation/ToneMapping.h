@@ -0,0 +1,51 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+// Inverse tone mapping functions, used to linearize images that were tone mapped for display, e.g.
+// by the image processing resolver.
+
+/// Applies the inverse of the Canon spectrum tone mapping curve to a single value, returning the
+/// linear value for the specified exposure (in stops). This is the reference implementation,
+/// evaluated with the standard library power function.
+float canonInverse(float value, float exposure);
+
+/// Applies canonInverse() to an image of 32-bit floats, with rows of width * channelCount values.
+/// The source and destination may be the same.
+///
+/// This uses SIMD instructions where available (SSE2), with a scalar fallback that produces
+/// identical results, and rows are processed in parallel with the specified maximum number of
+/// threads, or all hardware threads if that is zero. The power function is replaced with a
+/// polynomial approximation, so the results have a relative error of less than 1e-6 compared to
+/// canonInverse(). NaN values are treated as zero.
+void canonInverseImage(const float* pSource, float* pDest, size_t width, size_t height,
+    size_t channelCount, float exposure, uint32_t threadCount = 0);
+
+/// Applies canonInverse() to an image of 8-bit unsigned normalized values, with rows of width *
+/// channelCount values, producing 32-bit floats. This uses a lookup table of the result for each of
+/// the 256 possible values, so the results are identical to canonInverse(), and rows are processed
+/// in parallel as above.
+void canonInverseImage(const uint8_t* pSource, float* pDest, size_t width, size_t height,
+    size_t channelCount, float exposure, uint32_t threadCount = 0);
+
+} // namespace Foundation
+} // namespace Aurora
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <codecvt>
 #include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <locale>
@@ -154,5 +155,17 @@ inline int iwrap(int x, int y)
 std::string replace(
     const std::string& str, const std::string& searchTerm, const std::string& replaceTerm);
 
+/// Runs a function on contiguous ranges of the indices [0, count) in parallel, e.g. on the rows of
+/// an image, with the specified maximum number of threads, or all hardware threads if that is
+/// zero. Each range has at least the specified minimum number of indices, so that small inputs are
+/// not split into more work than is worthwhile. The calling thread processes the first range.
+void parallelForRanges(size_t count, uint32_t threadCount,
+    const std::function<void(size_t begin, size_t end)>& func, size_t minRangeSize = 1);
+
+/// Calls a function for each index in the range [0, count) from multiple threads, with the
+/// specified maximum number of threads, or all hardware threads if that is zero. The indices are
+/// handed out one at a time, so work items of very different sizes are balanced across the threads.
+void parallelFor(size_t count, uint32_t threadCount, const std::function<void(size_t)>& func);
+
 } // namespace Foundation
 } // namespace Aurora
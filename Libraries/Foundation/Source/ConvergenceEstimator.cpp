@@ -0,0 +1,201 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Aurora/Foundation/ConvergenceEstimator.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+// The factor by which the sample count must grow after a snapshot before the next estimate. With
+// a factor of 1.5, the snapshot has two thirds of the samples of the image it is compared with.
+static const float kSampleGrowthFactor = 1.5f;
+
+// The number of color channels used to estimate the error.
+static const uint32_t kColorChannelCount = 3;
+
+// A small value added to the denominator of the relative error, so that the error of black pixels
+// is finite.
+static const float kErrorEpsilon = 1.0e-4f;
+
+ConvergenceEstimator::ConvergenceEstimator(
+    float threshold, uint32_t tileSize, uint32_t minSamples) :
+    _threshold(threshold), _tileSize(tileSize), _minSamples(minSamples)
+{
+    assert(threshold >= 0.0f && tileSize > 0);
+}
+
+void ConvergenceEstimator::reset()
+{
+    _width           = 0;
+    _height          = 0;
+    _tileCountX      = 0;
+    _snapshotSamples = 0;
+    _snapshot.clear();
+    _tileErrors.clear();
+    _statistics = Statistics();
+}
+
+void ConvergenceEstimator::setThreshold(float threshold)
+{
+    assert(threshold >= 0.0f);
+
+    _threshold = threshold;
+    updateStatistics();
+}
+
+bool ConvergenceEstimator::needsImage(uint32_t sampleCount) const
+{
+    if (!isEnabled())
+    {
+        return false;
+    }
+
+    // Take the first snapshot halfway to the minimum sample count, so that the first estimate can
+    // be made at the minimum sample count. If there is a snapshot, wait until the sample count has
+    // grown enough that the difference is a reliable estimate, or take a new snapshot if the sample
+    // count is lower than the snapshot, i.e. accumulation was restarted.
+    if (_snapshot.empty())
+    {
+        return sampleCount >= std::max(_minSamples / 2, 1u);
+    }
+    if (sampleCount < _snapshotSamples)
+    {
+        return true;
+    }
+    uint32_t nextSamples = static_cast<uint32_t>(std::ceil(_snapshotSamples * kSampleGrowthFactor));
+
+    return sampleCount >= std::max({ nextSamples, _snapshotSamples + 1, _minSamples });
+}
+
+bool ConvergenceEstimator::update(const float* pPixels, size_t stride, uint32_t width,
+    uint32_t height, uint32_t channelCount, uint32_t sampleCount)
+{
+    assert(pPixels && channelCount > 0);
+
+    // The snapshot can only be compared with an image of the same size that has more samples.
+    uint32_t usedChannelCount = std::min(channelCount, kColorChannelCount);
+    bool isCompatible         = !_snapshot.empty() && width == _width && height == _height &&
+        sampleCount > _snapshotSamples;
+    if (!isCompatible)
+    {
+        _tileErrors.clear();
+        _statistics = Statistics();
+    }
+    else
+    {
+        // The difference between the image and the snapshot has (m - n) / (m * n) times the
+        // variance of a single sample, for an image with m samples and a snapshot with n samples,
+        // and the image itself has 1 / m times that variance. Scale the difference to get the
+        // expected error of the image.
+        float errorScale = std::sqrt(static_cast<float>(_snapshotSamples) /
+            static_cast<float>(sampleCount - _snapshotSamples));
+
+        // Compute the average relative error of the pixels in each tile. The error of each pixel
+        // is relative to the square root of its brightness, so that the noise is measured roughly
+        // as it is perceived.
+        _tileCountX         = (width + _tileSize - 1) / _tileSize;
+        uint32_t tileCountY = (height + _tileSize - 1) / _tileSize;
+        _tileErrors.assign(static_cast<size_t>(_tileCountX) * tileCountY, 0.0f);
+        for (uint32_t y = 0; y < height; y++)
+        {
+            const float* pRow = reinterpret_cast<const float*>(
+                reinterpret_cast<const uint8_t*>(pPixels) + y * stride);
+            const float* pSnapshotRow =
+                &_snapshot[static_cast<size_t>(y) * width * kColorChannelCount];
+            float* pTileErrorRow = &_tileErrors[static_cast<size_t>(y / _tileSize) * _tileCountX];
+            for (uint32_t x = 0; x < width; x++)
+            {
+                const float* pPixel         = pRow + x * channelCount;
+                const float* pSnapshotPixel = pSnapshotRow + x * kColorChannelCount;
+                float difference            = 0.0f;
+                float brightness            = 0.0f;
+                for (uint32_t c = 0; c < usedChannelCount; c++)
+                {
+                    difference += std::abs(pPixel[c] - pSnapshotPixel[c]);
+                    brightness += std::max(pPixel[c], 0.0f);
+                }
+                pTileErrorRow[x / _tileSize] +=
+                    difference / (kErrorEpsilon + std::sqrt(brightness));
+            }
+        }
+
+        // Convert the sums to averages, accounting for partial tiles at the right and bottom edges.
+        for (uint32_t tileY = 0; tileY < tileCountY; tileY++)
+        {
+            uint32_t tileHeight = std::min(_tileSize, height - tileY * _tileSize);
+            for (uint32_t tileX = 0; tileX < _tileCountX; tileX++)
+            {
+                uint32_t tileWidth = std::min(_tileSize, width - tileX * _tileSize);
+                _tileErrors[tileY * _tileCountX + tileX] *= errorScale / (tileWidth * tileHeight);
+            }
+        }
+        _statistics.sampleCount = sampleCount;
+        updateStatistics();
+    }
+
+    // Take a snapshot of the color channels of the image, for the next estimate.
+    _width           = width;
+    _height          = height;
+    _snapshotSamples = sampleCount;
+    _snapshot.resize(static_cast<size_t>(width) * height * kColorChannelCount);
+    for (uint32_t y = 0; y < height; y++)
+    {
+        const float* pRow = reinterpret_cast<const float*>(
+            reinterpret_cast<const uint8_t*>(pPixels) + y * stride);
+        float* pSnapshotRow = &_snapshot[static_cast<size_t>(y) * width * kColorChannelCount];
+        for (uint32_t x = 0; x < width; x++)
+        {
+            for (uint32_t c = 0; c < kColorChannelCount; c++)
+            {
+                pSnapshotRow[x * kColorChannelCount + c] =
+                    c < usedChannelCount ? pRow[x * channelCount + c] : 0.0f;
+            }
+        }
+    }
+
+    return isCompatible;
+}
+
+void ConvergenceEstimator::updateStatistics()
+{
+    _statistics.tileCount          = _tileErrors.size();
+    _statistics.convergedTileCount = 0;
+    _statistics.maxError           = 0.0f;
+    _statistics.averageError       = 0.0f;
+    for (float error : _tileErrors)
+    {
+        _statistics.convergedTileCount += error < _threshold ? 1 : 0;
+        _statistics.maxError = std::max(_statistics.maxError, error);
+        _statistics.averageError += error;
+    }
+    if (!_tileErrors.empty())
+    {
+        _statistics.averageError /= static_cast<float>(_tileErrors.size());
+    }
+
+    // The image is converged when every tile is converged, once the minimum number of samples has
+    // been reached. A disabled estimator never reports convergence.
+    _statistics.isConverged = isEnabled() && !_tileErrors.empty() &&
+        _statistics.convergedTileCount == _statistics.tileCount &&
+        _statistics.sampleCount >= _minSamples;
+}
+
+} // namespace Foundation
+} // namespace Aurora
@@ -0,0 +1,221 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Aurora/Foundation/CubeMap.h>
+#include <Aurora/Foundation/Utilities.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+// Select the SIMD instruction set. SSE2 is always available on x64.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CUBE_MAP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+namespace
+{
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Finds the face and the face pixel coordinates in the specified direction, for faces of the
+// specified size. The precision of each expression (float or double) is significant, as the SIMD
+// path must produce the same coordinates.
+inline void findFacePixel(
+    float x, float y, float z, int faceSize, int& face, int& coordX, int& coordY)
+{
+    if (std::abs(x) >= std::abs(y) && std::abs(x) >= std::abs(z))
+    {
+        coordX = static_cast<int>(faceSize * (1.0 - z / x) / 2.0);
+        coordY = static_cast<int>(faceSize * (1.0 + y / x) / 2.0);
+        face   = x < 0.0f ? 1 : 0;
+    }
+    else if (std::abs(y) > std::abs(z))
+    {
+        coordX = static_cast<int>(faceSize * (1 + x / y) / 2.0);
+        coordY = static_cast<int>(faceSize * (1 - z / y) / 2.0);
+        face   = y < 0.0f ? 3 : 2;
+    }
+    else
+    {
+        coordX = static_cast<int>(faceSize * (1 + x / z) / 2.0);
+        coordY = static_cast<int>(faceSize * (1 + z / std::abs(z) * y / z) / 2.0);
+        face   = z < 0.0f ? 5 : 4;
+    }
+}
+
+#if defined(CUBE_MAP_SSE2)
+// Selects the bits of a where the mask is set, and the bits of b elsewhere.
+inline __m128 select(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+inline __m128i select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Computes faceSize * (1.0 + sign * value) / 2.0 in double precision for four floats, truncated
+// to integers. This matches the scalar code for the X faces, where the float quotient is promoted
+// to double.
+inline __m128i faceCoordDouble(__m128 value, __m128d sign, __m128d faceSize)
+{
+    const __m128d kOne  = _mm_set1_pd(1.0);
+    const __m128d kHalf = _mm_set1_pd(0.5);
+    __m128d low         = _mm_add_pd(kOne, _mm_mul_pd(sign, _mm_cvtps_pd(value)));
+    __m128d high = _mm_add_pd(kOne, _mm_mul_pd(sign, _mm_cvtps_pd(_mm_movehl_ps(value, value))));
+    low          = _mm_mul_pd(_mm_mul_pd(faceSize, low), kHalf);
+    high         = _mm_mul_pd(_mm_mul_pd(faceSize, high), kHalf);
+
+    return _mm_unpacklo_epi64(_mm_cvttpd_epi32(low), _mm_cvttpd_epi32(high));
+}
+
+// Finds the faces and the face pixel coordinates in four directions. This is the same algorithm as
+// findFacePixel(), with the branches replaced by selection masks. The subtraction and division by
+// two in the scalar code are exact as a negation and a multiplication by one half.
+inline void findFacePixelsSSE2(
+    __m128 x, __m128 y, __m128 z, int faceSize, int faces[4], int coordsX[4], int coordsY[4])
+{
+    const __m128 kAbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 kZero    = _mm_setzero_ps();
+    const __m128 kOne     = _mm_set1_ps(1.0f);
+    const __m128 kHalf    = _mm_set1_ps(0.5f);
+    __m128 size           = _mm_set1_ps(static_cast<float>(faceSize));
+    __m128d sizeDouble    = _mm_set1_pd(static_cast<double>(faceSize));
+
+    // Classify the dominant axis of each direction.
+    __m128 absX = _mm_and_ps(x, kAbsMask);
+    __m128 absY = _mm_and_ps(y, kAbsMask);
+    __m128 absZ = _mm_and_ps(z, kAbsMask);
+    __m128 isX  = _mm_and_ps(_mm_cmpge_ps(absX, absY), _mm_cmpge_ps(absX, absZ));
+    __m128 isY  = _mm_andnot_ps(isX, _mm_cmpgt_ps(absY, absZ));
+
+    // Compute the coordinates for the X faces, in double precision.
+    __m128i xFaceX = faceCoordDouble(_mm_div_ps(z, x), _mm_set1_pd(-1.0), sizeDouble);
+    __m128i xFaceY = faceCoordDouble(_mm_div_ps(y, x), _mm_set1_pd(1.0), sizeDouble);
+
+    // Compute the coordinates for the Y and Z faces, in single precision. Lanes that are not used
+    // may divide by zero, which is harmless as they are not selected.
+    __m128 yFaceX   = _mm_mul_ps(size, _mm_add_ps(kOne, _mm_div_ps(x, y)));
+    __m128 yFaceY   = _mm_mul_ps(size, _mm_sub_ps(kOne, _mm_div_ps(z, y)));
+    __m128 zSign    = _mm_div_ps(z, absZ);
+    __m128 zFaceX   = _mm_mul_ps(size, _mm_add_ps(kOne, _mm_div_ps(x, z)));
+    __m128 zFaceY   = _mm_mul_ps(size, _mm_add_ps(kOne, _mm_div_ps(_mm_mul_ps(zSign, y), z)));
+    __m128i yzFaceX = _mm_cvttps_epi32(_mm_mul_ps(select(isY, yFaceX, zFaceX), kHalf));
+    __m128i yzFaceY = _mm_cvttps_epi32(_mm_mul_ps(select(isY, yFaceY, zFaceY), kHalf));
+
+    // Select the coordinates and the face, which is odd for the negative axis.
+    __m128i isXInt = _mm_castps_si128(isX);
+    __m128i isYInt = _mm_castps_si128(isY);
+    __m128i face =
+        select(isXInt, _mm_setzero_si128(), select(isYInt, _mm_set1_epi32(2), _mm_set1_epi32(4)));
+    __m128 axis        = select(isX, x, select(isY, y, z));
+    __m128i isNegative = _mm_castps_si128(_mm_cmplt_ps(axis, kZero));
+    face               = _mm_add_epi32(face, _mm_and_si128(isNegative, _mm_set1_epi32(1)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(faces), face);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(coordsX), select(isXInt, xFaceX, yzFaceX));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(coordsY), select(isXInt, xFaceY, yzFaceY));
+}
+#endif
+
+// Copies the pixel at the specified coordinates of a face, or zero if the coordinates are outside
+// the face.
+inline void fetchFacePixel(
+    const CubeMapFace& face, int coordX, int coordY, uint32_t channelCount, float* pDest)
+{
+    if (coordX < 0 || coordY < 0 || static_cast<uint32_t>(coordX) >= face.width ||
+        static_cast<uint32_t>(coordY) >= face.height)
+    {
+        std::memset(pDest, 0, channelCount * sizeof(float));
+
+        return;
+    }
+
+    size_t index = (static_cast<size_t>(coordY) * face.width + coordX) * channelCount;
+    std::memcpy(pDest, face.pPixels + index, channelCount * sizeof(float));
+}
+
+} // namespace
+
+void convertCubeMapToLatLong(const CubeMapFace faces[6], uint32_t faceSize, uint32_t channelCount,
+    float* pDest, uint32_t threadCount)
+{
+    assert(faces && pDest && faceSize > 0 && channelCount > 0);
+
+    // Compute the longitude (theta) terms of each column, from -pi to pi, which are the same for
+    // every row.
+    int size        = static_cast<int>(faceSize);
+    uint32_t width  = 4 * faceSize;
+    uint32_t height = 2 * faceSize;
+    std::vector<float> sinTheta(width);
+    std::vector<float> cosTheta(width);
+    for (int w = 0; w < static_cast<int>(width); w++)
+    {
+        float theta = static_cast<float>(kPi * (w - 2 * size) / (2 * size));
+        sinTheta[w] = std::sin(theta);
+        cosTheta[w] = std::cos(theta);
+    }
+
+    // Convert each row, from the latitude (phi) terms of the row, from -pi/2 to pi/2. The direction
+    // of each pixel is on the circumscribed sphere of the cube, expanded along zero longitude.
+    size_t rowSize = static_cast<size_t>(width) * channelCount;
+    parallelForRanges(height, threadCount, [&](size_t begin, size_t end) {
+        int faceIndices[4];
+        int coordsX[4];
+        int coordsY[4];
+        for (int h = static_cast<int>(begin); h < static_cast<int>(end); h++)
+        {
+            float phi    = static_cast<float>(kPi * (h - size) / (2 * size));
+            float sinPhi = std::sin(phi);
+            float cosPhi = std::cos(phi);
+            float* pRow  = pDest + h * rowSize;
+            uint32_t w   = 0;
+#if defined(CUBE_MAP_SSE2)
+            __m128 cosPhi4 = _mm_set1_ps(cosPhi);
+            __m128 y       = _mm_set1_ps(sinPhi);
+            for (; w + 4 <= width; w += 4)
+            {
+                __m128 x = _mm_mul_ps(cosPhi4, _mm_loadu_ps(sinTheta.data() + w));
+                __m128 z = _mm_mul_ps(cosPhi4, _mm_loadu_ps(cosTheta.data() + w));
+                findFacePixelsSSE2(x, y, z, size, faceIndices, coordsX, coordsY);
+                for (uint32_t i = 0; i < 4; i++)
+                {
+                    fetchFacePixel(faces[faceIndices[i]], coordsX[i], coordsY[i], channelCount,
+                        pRow + (w + i) * channelCount);
+                }
+            }
+#endif
+            for (; w < width; w++)
+            {
+                float x = cosPhi * sinTheta[w];
+                float z = cosPhi * cosTheta[w];
+                findFacePixel(x, sinPhi, z, size, faceIndices[0], coordsX[0], coordsY[0]);
+                fetchFacePixel(faces[faceIndices[0]], coordsX[0], coordsY[0], channelCount,
+                    pRow + w * channelCount);
+            }
+        }
+    });
+}
+
+} // namespace Foundation
+} // namespace Aurora
@@ -16,6 +16,11 @@
 
 #include <Aurora/Foundation/Utilities.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #if _WIN32
 #include <Windows.h>
 #endif
@@ -25,6 +30,263 @@ namespace Aurora
 namespace Foundation
 {
 
+// Adds the file and line prefix for non-zero lines to a formatted message.
+static std::string prefixMessage(const std::string& file, int line, const std::string& msg)
+{
+    std::string prefix = line > 0 ? (file + " (" + std::to_string(line) + "):\t") : "";
+
+    return prefix + msg;
+}
+
+// The asynchronous output queue and writer thread. This is a bounded multiple-producer single-
+// consumer queue: producers claim a record with an atomic compare-and-swap on the enqueue position,
+// and hand it to the writer thread by updating the sequence number of the record, so logging
+// threads never block on a lock or on output.
+class Log::AsyncWriter
+{
+public:
+    AsyncWriter(size_t memoryBudget)
+    {
+        // Use the largest power of two number of records that fits in the memory budget.
+        size_t capacity = 2;
+        while (capacity * 2 * sizeof(Record) <= memoryBudget)
+        {
+            capacity *= 2;
+        }
+        _mask     = capacity - 1;
+        _pRecords = std::make_unique<Record[]>(capacity);
+        for (size_t i = 0; i < capacity; i++)
+        {
+            _pRecords[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        // Start the writer thread.
+        _thread = std::thread(&AsyncWriter::run, this);
+    }
+
+    ~AsyncWriter()
+    {
+        // Stop the writer thread, which writes all the queued records first.
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopping = true;
+        }
+        _wakeCondition.notify_one();
+        _thread.join();
+    }
+
+    Record* beginRecord()
+    {
+        size_t position = _enqueuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            // The record is free if its sequence number matches the position. If it is behind the
+            // position, the queue is full.
+            Record& record     = _pRecords[position & _mask];
+            size_t sequence    = record.sequence.load(std::memory_order_acquire);
+            intptr_t available = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (available == 0)
+            {
+                if (_enqueuePosition.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed))
+                {
+                    record.position = position;
+
+                    return &record;
+                }
+            }
+            else if (available < 0)
+            {
+                _droppedCount.fetch_add(1, std::memory_order_relaxed);
+
+                return nullptr;
+            }
+            else
+            {
+                position = _enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void commitRecord(Record* pRecord)
+    {
+        // Publish the record to the writer thread, and wake it if it is waiting. A wake-up may be
+        // missed here, but the writer thread also wakes periodically.
+        pRecord->sequence.store(pRecord->position + 1, std::memory_order_release);
+        if (_isWaiting.load(std::memory_order_relaxed))
+        {
+            _wakeCondition.notify_one();
+        }
+    }
+
+    void flush()
+    {
+        // Wait until the writer thread has written everything queued before this call.
+        std::unique_lock<std::mutex> lock(_mutex);
+        size_t target     = _enqueuePosition.load(std::memory_order_acquire);
+        _isFlushRequested = true;
+        _wakeCondition.notify_one();
+        _flushedCondition.wait(lock, [this, target]() { return _flushedPosition >= target; });
+    }
+
+    uint64_t droppedCount() const { return _droppedCount.load(std::memory_order_relaxed); }
+
+private:
+    // The time after which a pending repeat count is written, and the maximum time the writer
+    // thread waits before checking for records.
+    static constexpr std::chrono::milliseconds kRepeatInterval = std::chrono::milliseconds(1000);
+    static constexpr std::chrono::milliseconds kWaitInterval   = std::chrono::milliseconds(10);
+
+    // Returns whether the next record has been published by a producer.
+    bool hasRecord() const
+    {
+        const Record& record = _pRecords[_dequeuePosition & _mask];
+
+        return record.sequence.load(std::memory_order_acquire) == _dequeuePosition + 1;
+    }
+
+    // The writer thread function.
+    void run()
+    {
+        while (true)
+        {
+            // Write all the available records.
+            while (hasRecord())
+            {
+                writeNextRecord();
+            }
+
+            // Report events that were dropped because the queue was full.
+            uint64_t droppedCount = _droppedCount.load(std::memory_order_relaxed);
+            if (droppedCount > _reportedDroppedCount)
+            {
+                writeRepeats();
+                output(std::cerr, "", 0,
+                    std::to_string(droppedCount - _reportedDroppedCount) +
+                        " log events were discarded as the asynchronous log queue was full.\n");
+                _reportedDroppedCount = droppedCount;
+            }
+
+            // Write a pending repeat count if it has been pending for a while.
+            if (_repeatCount > 0 &&
+                std::chrono::steady_clock::now() - _firstRepeatTime > kRepeatInterval)
+            {
+                writeRepeats();
+            }
+
+            // Complete any flush request once there are no more records, and stop if requested.
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (hasRecord())
+            {
+                continue;
+            }
+            if (_isFlushRequested || _isStopping)
+            {
+                writeRepeats();
+                std::cout.flush();
+                std::cerr.flush();
+                _isFlushRequested = false;
+                _flushedPosition  = _dequeuePosition;
+                _flushedCondition.notify_all();
+            }
+            if (_isStopping)
+            {
+                break;
+            }
+
+            // Wait for more records.
+            _isWaiting = true;
+            _wakeCondition.wait_for(lock, kWaitInterval,
+                [this]() { return _isStopping || _isFlushRequested || hasRecord(); });
+            _isWaiting = false;
+        }
+    }
+
+    // Formats and writes the next record, collapsing consecutive identical messages.
+    void writeNextRecord()
+    {
+        // Format the message, then release the record for reuse by producers.
+        Record& record        = _pRecords[_dequeuePosition & _mask];
+        std::string file      = record.data;
+        const char* pData     = record.data + file.size() + 1;
+        std::string msg       = record.formatFunction ? record.formatFunction(pData) : pData;
+        std::ostream* pStream = record.pStream;
+        int line              = record.line;
+        record.sequence.store(_dequeuePosition + _mask + 1, std::memory_order_release);
+        _dequeuePosition++;
+
+        // Count a message identical to the previous one, instead of writing it.
+        if (line == _lastLine && pStream == _pLastStream && msg == _lastMessage &&
+            file == _lastFile)
+        {
+            if (_repeatCount++ == 0)
+            {
+                _firstRepeatTime = std::chrono::steady_clock::now();
+            }
+
+            return;
+        }
+
+        // Write the message, after the repeat count of the previous message.
+        writeRepeats();
+        output(*pStream, file, line, msg);
+        _lastFile    = std::move(file);
+        _lastLine    = line;
+        _lastMessage = std::move(msg);
+        _pLastStream = pStream;
+    }
+
+    // Writes the repeat count of the previous message, if it was repeated.
+    void writeRepeats()
+    {
+        if (_repeatCount > 0)
+        {
+            output(*_pLastStream, _lastFile, _lastLine,
+                "Last message repeated " + std::to_string(_repeatCount) + " times.\n");
+            _repeatCount = 0;
+        }
+    }
+
+    // Writes a message to the debug console and the specified output stream.
+    void output(std::ostream& stream, const std::string& file, int line, const std::string& msg)
+    {
+        std::string fullMsg = prefixMessage(file, line, msg);
+        writeToConsole(fullMsg);
+        stream << fullMsg;
+    }
+
+    // The queue, with a power of two number of records.
+    std::unique_ptr<Record[]> _pRecords;
+    size_t _mask = 0;
+
+    // The positions of the next record to claim (by producers) and to write (by the writer).
+    std::atomic<size_t> _enqueuePosition = 0;
+    size_t _dequeuePosition              = 0;
+
+    // The number of events dropped because the queue was full, and the number reported so far.
+    std::atomic<uint64_t> _droppedCount = 0;
+    uint64_t _reportedDroppedCount      = 0;
+
+    // The state of the previous message written, used to collapse repeated messages.
+    std::string _lastFile;
+    int _lastLine = 0;
+    std::string _lastMessage;
+    std::ostream* _pLastStream = nullptr;
+    uint32_t _repeatCount      = 0;
+    std::chrono::steady_clock::time_point _firstRepeatTime;
+
+    // Synchronization with the writer thread. The mutex is only used for waiting and flushing,
+    // never by producers.
+    std::mutex _mutex;
+    std::condition_variable _wakeCondition;
+    std::condition_variable _flushedCondition;
+    std::atomic<bool> _isWaiting = false;
+    bool _isFlushRequested       = false;
+    bool _isStopping             = false;
+    size_t _flushedPosition      = 0;
+    std::thread _thread;
+};
+
 // The singleton logger instance.
 Log theLogger;
 
@@ -34,6 +296,153 @@ Log& Log::logger()
     return theLogger;
 }
 
+Log::Log() {}
+
+Log::~Log()
+{
+    // Stop asynchronous output, which writes any queued events.
+    _pAsyncWriter.reset();
+}
+
+void Log::enableAsyncOutput(bool enabled, size_t memoryBudget)
+{
+    // Destroy any existing writer (which writes its queued events) and create a new one if needed.
+    _pAsyncWriter.reset();
+    if (enabled)
+    {
+        _pAsyncWriter = std::make_unique<AsyncWriter>(memoryBudget);
+    }
+}
+
+void Log::flush()
+{
+    if (_pAsyncWriter)
+    {
+        _pAsyncWriter->flush();
+    }
+}
+
+uint64_t Log::droppedEventCount() const
+{
+    return _pAsyncWriter ? _pAsyncWriter->droppedCount() : 0;
+}
+
+bool Log::checkRateLimit(Level level, std::ostream& stream, const std::string& file, int line)
+{
+    // Find the call site in the hash table.
+    uint64_t lineHash   = static_cast<uint64_t>(line) * 0x9E3779B97F4A7C15ull;
+    uint64_t hash       = std::hash<std::string>()(file) ^ lineHash;
+    RateLimitSite& site = _rateLimitSites[hash % kRateLimitSiteCount];
+
+    // Get the current one-second window.
+    auto time       = std::chrono::steady_clock::now().time_since_epoch();
+    uint64_t window = std::chrono::duration_cast<std::chrono::seconds>(time).count() & 0xFFFFFFFF;
+
+    uint64_t state = site.state.load(std::memory_order_relaxed);
+    while (true)
+    {
+        // If this is a new window, reset the count and report any events discarded in previous
+        // windows.
+        if ((state >> 32) != window)
+        {
+            uint64_t newState = (window << 32) | 1;
+            if (site.state.compare_exchange_weak(state, newState, std::memory_order_relaxed))
+            {
+                uint32_t discarded = site.discarded.exchange(0, std::memory_order_relaxed);
+                if (discarded > 0)
+                {
+                    write(level, stream, file, line,
+                        std::to_string(discarded) +
+                            " events from this location were discarded by the log rate limit.\n");
+                }
+
+                return true;
+            }
+            continue;
+        }
+
+        // Discard the event if the limit has been reached in this window, otherwise count it.
+        if ((state & 0xFFFFFFFF) >= _rateLimit)
+        {
+            site.discarded.fetch_add(1, std::memory_order_relaxed);
+
+            return false;
+        }
+        if (site.state.compare_exchange_weak(state, state + 1, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+}
+
+void Log::write(
+    Level level, std::ostream& stream, const std::string& file, int line, const std::string& msg)
+{
+    if (_pAsyncWriter)
+    {
+        // Queue the formatted message, unless this is a failure.
+        if (level != Level::kFail)
+        {
+            Record* pRecord = beginRecord();
+            if (pRecord)
+            {
+                pRecord->level   = level;
+                pRecord->line    = line;
+                pRecord->pStream = &stream;
+                encodeMessage(pRecord, file, msg);
+                commitRecord(pRecord);
+            }
+
+            return;
+        }
+
+        // Write the queued output before a failure, which is written synchronously as the
+        // application is about to abort.
+        flush();
+    }
+
+    // Output to the debug console and the specified output stream.
+    std::string fullMsg = prefixMessage(file, line, msg);
+    writeToConsole(fullMsg);
+    stream << fullMsg;
+}
+
+Log::Record* Log::beginRecord()
+{
+    return _pAsyncWriter->beginRecord();
+}
+
+void Log::commitRecord(Record* pRecord)
+{
+    _pAsyncWriter->commitRecord(pRecord);
+}
+
+void Log::encodeMessage(Record* pRecord, const std::string& file, const std::string& msg)
+{
+    // Store the file name, truncated to a quarter of the buffer.
+    char* pData     = pRecord->data;
+    size_t fileSize = std::min(file.size(), kRecordDataSize / 4 - 1);
+    std::memcpy(pData, file.data(), fileSize);
+    pData[fileSize] = 0;
+    pData += fileSize + 1;
+
+    // Store the message in the remaining space, truncated with an ellipsis if needed.
+    static const char kEllipsis[] = "...\n";
+    size_t available              = kRecordDataSize - (fileSize + 1) - 1;
+    if (msg.size() <= available)
+    {
+        std::memcpy(pData, msg.data(), msg.size());
+        pData[msg.size()] = 0;
+    }
+    else
+    {
+        size_t size = available - (sizeof(kEllipsis) - 1);
+        std::memcpy(pData, msg.data(), size);
+        std::memcpy(pData + size, kEllipsis, sizeof(kEllipsis));
+    }
+    pRecord->formatFunction = nullptr;
+}
+
 void Log::debugBreak()
 {
 #if !defined(NDEBUG)
@@ -0,0 +1,529 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Aurora/Foundation/PixelConversion.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Select the SIMD instruction set. SSE2 is always available on x64, and F16C is used for half
+// float conversion if the compiler targets it (e.g. with -mf16c or /arch:AVX2). NEON is always
+// available on ARM64, including half float conversion.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PIXEL_CONVERSION_SSE2 1
+#include <emmintrin.h>
+#if defined(__F16C__) || defined(__AVX2__)
+#define PIXEL_CONVERSION_F16C 1
+#include <immintrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define PIXEL_CONVERSION_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+namespace
+{
+
+// Bit patterns used for half float conversion, following the approach described by Fabian Giesen
+// ("Half to float done quick"), which is exact and handles all special values.
+// - kHalfOverflow: the smallest float that is infinity when converted to half.
+// - kHalfNormalMin: the smallest float that is a normalized half (2^-14).
+// - kSubnormalMagic: a float (0.5) that aligns the half mantissa bits to the bottom of the float
+//   mantissa when added to a small value, using the FPU for round-to-nearest-even.
+// - kNormalRebias: adjusts the exponent bias from float to half, plus the rounding bias.
+constexpr uint32_t kFloatInfinity  = 0x7F800000u;
+constexpr uint32_t kHalfOverflow   = (127u + 16u) << 23;
+constexpr uint32_t kHalfNormalMin  = 113u << 23;
+constexpr uint32_t kSubnormalMagic = 126u << 23;
+constexpr uint32_t kNormalRebias   = 0xC8000FFFu;
+
+// The 4x4 Bayer matrix used for ordered dithering.
+constexpr int kBayerMatrix[4][4] = {
+    { 0, 8, 2, 10 },
+    { 12, 4, 14, 6 },
+    { 3, 11, 1, 9 },
+    { 15, 7, 13, 5 },
+};
+
+inline uint32_t floatBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    return bits;
+}
+
+inline float bitsFloat(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+#if defined(PIXEL_CONVERSION_SSE2)
+// Selects the bits of a where the mask is set, and the bits of b elsewhere.
+inline __m128i select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Converts four floats to half floats, in the low 16 bits of each (sign extended) 32-bit value.
+// This is the same algorithm as floatToHalf(), with the branches replaced by selection masks.
+inline __m128i floatToHalfSSE2(__m128 value)
+{
+    __m128i bits = _mm_castps_si128(value);
+    __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+    bits         = _mm_xor_si128(bits, sign);
+
+    // Compute the result for infinity and NaN.
+    __m128i isOverflow = _mm_cmpgt_epi32(bits, _mm_set1_epi32(kHalfOverflow - 1));
+    __m128i isNaN      = _mm_cmpgt_epi32(bits, _mm_set1_epi32(kFloatInfinity));
+    __m128i special =
+        _mm_or_si128(_mm_set1_epi32(0x7C00), _mm_and_si128(isNaN, _mm_set1_epi32(0x0200)));
+
+    // Compute the result for subnormals and zero.
+    __m128i isSubnormal = _mm_cmpgt_epi32(_mm_set1_epi32(kHalfNormalMin), bits);
+    __m128i magic       = _mm_set1_epi32(kSubnormalMagic);
+    __m128 sum          = _mm_add_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(magic));
+    __m128i subnormal   = _mm_sub_epi32(_mm_castps_si128(sum), magic);
+
+    // Compute the result for normalized values.
+    __m128i rebias      = _mm_set1_epi32(static_cast<int>(kNormalRebias));
+    __m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1));
+    __m128i normal      = _mm_add_epi32(_mm_add_epi32(bits, rebias), mantissaOdd);
+    normal              = _mm_srli_epi32(normal, 13);
+
+    // Select the result for each value, and add the sign.
+    __m128i result = select(isOverflow, special, select(isSubnormal, subnormal, normal));
+    result         = _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+
+    // Sign extend the 16-bit values, so that they are not saturated when packed.
+    return _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+}
+
+// Converts four half floats, in the low 16 bits of each 32-bit value, to floats. This is the same
+// algorithm as halfToFloat(), with the branches replaced by selection masks.
+inline __m128 halfToFloatSSE2(__m128i halves)
+{
+    const __m128i kExponentMask = _mm_set1_epi32(0x7C00 << 13);
+
+    // Shift the exponent and mantissa into place, and adjust the exponent bias.
+    __m128i bits     = _mm_slli_epi32(_mm_and_si128(halves, _mm_set1_epi32(0x7FFF)), 13);
+    __m128i exponent = _mm_and_si128(bits, kExponentMask);
+    bits             = _mm_add_epi32(bits, _mm_set1_epi32((127 - 15) << 23));
+
+    // Adjust the exponent for infinity and NaN.
+    __m128i isSpecial = _mm_cmpeq_epi32(exponent, kExponentMask);
+    bits = _mm_add_epi32(bits, _mm_and_si128(isSpecial, _mm_set1_epi32((128 - 16) << 23)));
+
+    // Renormalize subnormals and zero.
+    __m128i isSubnormal = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+    __m128 normalMin    = _mm_castsi128_ps(_mm_set1_epi32(kHalfNormalMin));
+    __m128 renormalized = _mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1 << 23)));
+    renormalized        = _mm_sub_ps(renormalized, normalMin);
+    bits                = select(isSubnormal, _mm_castps_si128(renormalized), bits);
+
+    // Add the sign.
+    bits = _mm_or_si128(bits, _mm_slli_epi32(_mm_and_si128(halves, _mm_set1_epi32(0x8000)), 16));
+
+    return _mm_castsi128_ps(bits);
+}
+#endif
+
+// Converts a single float to an 8-bit unsigned normalized value, with the specified bias added
+// before truncation: 0.5 for rounding, or a dither threshold. NaN is converted to zero.
+inline uint8_t floatToUNorm8(float value, float bias)
+{
+    float clamped = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+
+    return static_cast<uint8_t>(clamped * 255.0f + bias);
+}
+
+// Converts a row of floats to 8-bit unsigned normalized values, using a table of biases that
+// repeats every 16 * channelCount values, which is a multiple of the SIMD width.
+void convertRowFloatToUNorm8(
+    const float* pSource, uint8_t* pDest, size_t count, const float* pBiases, size_t biasCount)
+{
+    size_t i = 0;
+#if defined(PIXEL_CONVERSION_SSE2)
+    const __m128 kZero = _mm_setzero_ps();
+    const __m128 kOne  = _mm_set1_ps(1.0f);
+    const __m128 kMax  = _mm_set1_ps(255.0f);
+    for (; i + 16 <= count; i += 16)
+    {
+        // Clamp, scale, and add the bias to 16 values. The max() is first so that NaN becomes zero.
+        const float* pBias = pBiases + (i % biasCount);
+        __m128i values[4];
+        for (int j = 0; j < 4; j++)
+        {
+            __m128 value = _mm_max_ps(_mm_loadu_ps(pSource + i + j * 4), kZero);
+            value        = _mm_min_ps(value, kOne);
+            value        = _mm_add_ps(_mm_mul_ps(value, kMax), _mm_loadu_ps(pBias + j * 4));
+            values[j]    = _mm_cvttps_epi32(value);
+        }
+
+        // Pack the 32-bit integers to 8-bit, and store them.
+        __m128i packed = _mm_packus_epi16(
+            _mm_packs_epi32(values[0], values[1]), _mm_packs_epi32(values[2], values[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + i), packed);
+    }
+#elif defined(PIXEL_CONVERSION_NEON)
+    const float32x4_t kZero = vdupq_n_f32(0.0f);
+    const float32x4_t kOne  = vdupq_n_f32(1.0f);
+    const float32x4_t kMax  = vdupq_n_f32(255.0f);
+    for (; i + 16 <= count; i += 16)
+    {
+        // Clamp, scale, and add the bias to 16 values. The maxnm() converts NaN to zero.
+        const float* pBias = pBiases + (i % biasCount);
+        uint32x4_t values[4];
+        for (int j = 0; j < 4; j++)
+        {
+            float32x4_t value = vmaxnmq_f32(vld1q_f32(pSource + i + j * 4), kZero);
+            value             = vminq_f32(value, kOne);
+            value             = vaddq_f32(vmulq_f32(value, kMax), vld1q_f32(pBias + j * 4));
+            values[j]         = vcvtq_u32_f32(value);
+        }
+
+        // Narrow the 32-bit integers to 8-bit, and store them.
+        uint16x8_t low  = vcombine_u16(vmovn_u32(values[0]), vmovn_u32(values[1]));
+        uint16x8_t high = vcombine_u16(vmovn_u32(values[2]), vmovn_u32(values[3]));
+        vst1q_u8(pDest + i, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+#endif
+
+    // Convert any remaining values.
+    for (; i < count; i++)
+    {
+        pDest[i] = floatToUNorm8(pSource[i], pBiases[i % biasCount]);
+    }
+}
+
+// Returns true if an image with the specified strides can be processed as a single row.
+inline bool isContiguous(size_t sourceStride, size_t destStride, size_t sourceRowBytes,
+    size_t destRowBytes)
+{
+    return sourceStride == sourceRowBytes && destStride == destRowBytes;
+}
+
+// Returns a pointer offset by the specified number of bytes.
+template <typename T>
+inline T* offsetBytes(T* pointer, size_t bytes)
+{
+    using ByteType =
+        typename std::conditional<std::is_const<T>::value, const uint8_t, uint8_t>::type;
+
+    return reinterpret_cast<T*>(reinterpret_cast<ByteType*>(pointer) + bytes);
+}
+
+} // namespace
+
+uint16_t floatToHalf(float value)
+{
+    // Separate the sign, so that the remaining bits can be compared as an unsigned value.
+    uint32_t bits = floatBits(value);
+    uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    uint32_t result;
+    if (bits >= kHalfOverflow)
+    {
+        // Infinity or NaN: NaN becomes a quiet NaN.
+        result = bits > kFloatInfinity ? 0x7E00u : 0x7C00u;
+    }
+    else if (bits < kHalfNormalMin)
+    {
+        // Subnormal or zero: let the FPU do the rounding with a magic value.
+        result = floatBits(bitsFloat(bits) + bitsFloat(kSubnormalMagic)) - kSubnormalMagic;
+    }
+    else
+    {
+        // Normalized: adjust the exponent and round to nearest even.
+        uint32_t mantissaOdd = (bits >> 13) & 1u;
+        result               = (bits + kNormalRebias + mantissaOdd) >> 13;
+    }
+
+    return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+float halfToFloat(uint16_t value)
+{
+    // Shift the exponent and mantissa into place, and adjust the exponent bias.
+    uint32_t bits     = (static_cast<uint32_t>(value) & 0x7FFFu) << 13;
+    uint32_t exponent = bits & (0x7C00u << 13);
+    bits += (127u - 15u) << 23;
+
+    if (exponent == (0x7C00u << 13))
+    {
+        // Infinity or NaN: use the maximum exponent.
+        bits += (128u - 16u) << 23;
+    }
+    else if (exponent == 0)
+    {
+        // Subnormal or zero: renormalize with the FPU.
+        bits = floatBits(bitsFloat(bits + (1u << 23)) - bitsFloat(kHalfNormalMin));
+    }
+
+    return bitsFloat(bits | ((static_cast<uint32_t>(value) & 0x8000u) << 16));
+}
+
+void convertFloatToHalf(const float* pSource, uint16_t* pDest, size_t count)
+{
+    size_t i = 0;
+#if defined(PIXEL_CONVERSION_F16C)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i low  = _mm_cvtps_ph(_mm_loadu_ps(pSource + i), _MM_FROUND_TO_NEAREST_INT);
+        __m128i high = _mm_cvtps_ph(_mm_loadu_ps(pSource + i + 4), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + i), _mm_unpacklo_epi64(low, high));
+    }
+#elif defined(PIXEL_CONVERSION_SSE2)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i low  = floatToHalfSSE2(_mm_loadu_ps(pSource + i));
+        __m128i high = floatToHalfSSE2(_mm_loadu_ps(pSource + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + i), _mm_packs_epi32(low, high));
+    }
+#elif defined(PIXEL_CONVERSION_NEON)
+    for (; i + 8 <= count; i += 8)
+    {
+        vst1_u16(pDest + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(pSource + i))));
+        vst1_u16(pDest + i + 4, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(pSource + i + 4))));
+    }
+#endif
+
+    // Convert any remaining values.
+    for (; i < count; i++)
+    {
+        pDest[i] = floatToHalf(pSource[i]);
+    }
+}
+
+void convertHalfToFloat(const uint16_t* pSource, float* pDest, size_t count)
+{
+    size_t i = 0;
+#if defined(PIXEL_CONVERSION_F16C)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + i));
+        _mm_storeu_ps(pDest + i, _mm_cvtph_ps(halves));
+        _mm_storeu_ps(pDest + i + 4, _mm_cvtph_ps(_mm_unpackhi_epi64(halves, halves)));
+    }
+#elif defined(PIXEL_CONVERSION_SSE2)
+    const __m128i kZero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + i));
+        _mm_storeu_ps(pDest + i, halfToFloatSSE2(_mm_unpacklo_epi16(halves, kZero)));
+        _mm_storeu_ps(pDest + i + 4, halfToFloatSSE2(_mm_unpackhi_epi16(halves, kZero)));
+    }
+#elif defined(PIXEL_CONVERSION_NEON)
+    for (; i + 8 <= count; i += 8)
+    {
+        vst1q_f32(pDest + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSource + i))));
+        vst1q_f32(pDest + i + 4, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSource + i + 4))));
+    }
+#endif
+
+    // Convert any remaining values.
+    for (; i < count; i++)
+    {
+        pDest[i] = halfToFloat(pSource[i]);
+    }
+}
+
+void convertFloatToHalfRGBA(
+    const float* pSource, size_t channelCount, uint16_t* pDest, size_t pixelCount)
+{
+    assert(channelCount == 3 || channelCount == 4);
+
+    // RGBA pixels are converted directly.
+    if (channelCount == 4)
+    {
+        convertFloatToHalf(pSource, pDest, pixelCount * 4);
+        return;
+    }
+
+    // Convert RGB pixels four at a time, i.e. three vectors of interleaved RGB values, adding the
+    // alpha channel to each pixel before conversion.
+    size_t i = 0;
+#if defined(PIXEL_CONVERSION_SSE2)
+    const __m128 kOne = _mm_set1_ps(1.0f);
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        // The three vectors are (r0 g0 b0 r1), (g1 b1 r2 g2), and (b2 r3 g3 b3).
+        const float* pRGB = pSource + i * 3;
+        __m128 rgb0       = _mm_loadu_ps(pRGB);
+        __m128 rgb1       = _mm_loadu_ps(pRGB + 4);
+        __m128 rgb2       = _mm_loadu_ps(pRGB + 8);
+
+        // Shuffle the values into four RGBA pixels.
+        __m128 rg1    = _mm_shuffle_ps(rgb0, rgb1, _MM_SHUFFLE(1, 0, 3, 3));
+        __m128 pixel0 = _mm_shuffle_ps(
+            rgb0, _mm_shuffle_ps(rgb0, kOne, _MM_SHUFFLE(0, 0, 3, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+        __m128 pixel1 = _mm_shuffle_ps(
+            rg1, _mm_shuffle_ps(rgb1, kOne, _MM_SHUFFLE(0, 0, 1, 1)), _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 pixel2 = _mm_shuffle_ps(
+            rgb1, _mm_shuffle_ps(rgb2, kOne, _MM_SHUFFLE(0, 0, 0, 0)), _MM_SHUFFLE(2, 0, 3, 2));
+        __m128 pixel3 = _mm_shuffle_ps(
+            rgb2, _mm_shuffle_ps(rgb2, kOne, _MM_SHUFFLE(0, 0, 3, 3)), _MM_SHUFFLE(2, 0, 2, 1));
+
+        // Convert the pixels to half floats, and store them.
+#if defined(PIXEL_CONVERSION_F16C)
+        __m128i low  = _mm_unpacklo_epi64(_mm_cvtps_ph(pixel0, _MM_FROUND_TO_NEAREST_INT),
+            _mm_cvtps_ph(pixel1, _MM_FROUND_TO_NEAREST_INT));
+        __m128i high = _mm_unpacklo_epi64(_mm_cvtps_ph(pixel2, _MM_FROUND_TO_NEAREST_INT),
+            _mm_cvtps_ph(pixel3, _MM_FROUND_TO_NEAREST_INT));
+#else
+        __m128i low  = _mm_packs_epi32(floatToHalfSSE2(pixel0), floatToHalfSSE2(pixel1));
+        __m128i high = _mm_packs_epi32(floatToHalfSSE2(pixel2), floatToHalfSSE2(pixel3));
+#endif
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + i * 4), low);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + i * 4 + 8), high);
+    }
+#elif defined(PIXEL_CONVERSION_NEON)
+    const uint16x4_t kOneHalf = vdup_n_u16(0x3C00);
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        // Load the pixels as separate RGB channels, and store them interleaved with the alpha.
+        float32x4x3_t rgb = vld3q_f32(pSource + i * 3);
+        uint16x4x4_t rgba;
+        rgba.val[0] = vreinterpret_u16_f16(vcvt_f16_f32(rgb.val[0]));
+        rgba.val[1] = vreinterpret_u16_f16(vcvt_f16_f32(rgb.val[1]));
+        rgba.val[2] = vreinterpret_u16_f16(vcvt_f16_f32(rgb.val[2]));
+        rgba.val[3] = kOneHalf;
+        vst4_u16(pDest + i * 4, rgba);
+    }
+#endif
+
+    // Convert any remaining pixels.
+    for (; i < pixelCount; i++)
+    {
+        pDest[i * 4]     = floatToHalf(pSource[i * 3]);
+        pDest[i * 4 + 1] = floatToHalf(pSource[i * 3 + 1]);
+        pDest[i * 4 + 2] = floatToHalf(pSource[i * 3 + 2]);
+        pDest[i * 4 + 3] = 0x3C00;
+    }
+}
+
+void convertFloatToUNorm8(const float* pSource, uint8_t* pDest, size_t count)
+{
+    // Use a constant rounding bias.
+    float biases[16];
+    std::fill(biases, biases + 16, 0.5f);
+    convertRowFloatToUNorm8(pSource, pDest, count, biases, 16);
+}
+
+void copyImageRows(const void* pSource, size_t sourceStride, void* pDest, size_t destStride,
+    size_t rowBytes, size_t height)
+{
+    // Copy the whole image at once if there is no padding, otherwise copy row by row.
+    if (isContiguous(sourceStride, destStride, rowBytes, rowBytes))
+    {
+        std::memcpy(pDest, pSource, rowBytes * height);
+        return;
+    }
+    for (size_t y = 0; y < height; y++)
+    {
+        std::memcpy(offsetBytes(pDest, y * destStride), offsetBytes(pSource, y * sourceStride),
+            rowBytes);
+    }
+}
+
+void convertImageFloatToHalf(const float* pSource, size_t sourceStride, uint16_t* pDest,
+    size_t destStride, size_t width, size_t height, size_t channelCount)
+{
+    size_t rowCount = width * channelCount;
+    if (isContiguous(sourceStride, destStride, rowCount * sizeof(float),
+            rowCount * sizeof(uint16_t)))
+    {
+        convertFloatToHalf(pSource, pDest, rowCount * height);
+        return;
+    }
+    for (size_t y = 0; y < height; y++)
+    {
+        convertFloatToHalf(offsetBytes(pSource, y * sourceStride),
+            offsetBytes(pDest, y * destStride), rowCount);
+    }
+}
+
+void convertImageHalfToFloat(const uint16_t* pSource, size_t sourceStride, float* pDest,
+    size_t destStride, size_t width, size_t height, size_t channelCount)
+{
+    size_t rowCount = width * channelCount;
+    if (isContiguous(sourceStride, destStride, rowCount * sizeof(uint16_t),
+            rowCount * sizeof(float)))
+    {
+        convertHalfToFloat(pSource, pDest, rowCount * height);
+        return;
+    }
+    for (size_t y = 0; y < height; y++)
+    {
+        convertHalfToFloat(offsetBytes(pSource, y * sourceStride),
+            offsetBytes(pDest, y * destStride), rowCount);
+    }
+}
+
+void convertImageFloatToUNorm8(const float* pSource, size_t sourceStride, uint8_t* pDest,
+    size_t destStride, size_t width, size_t height, size_t channelCount, bool dither)
+{
+    // Without dithering, the image can be converted with a constant rounding bias.
+    size_t rowCount = width * channelCount;
+    if (!dither)
+    {
+        if (isContiguous(sourceStride, destStride, rowCount * sizeof(float), rowCount))
+        {
+            convertFloatToUNorm8(pSource, pDest, rowCount * height);
+            return;
+        }
+        for (size_t y = 0; y < height; y++)
+        {
+            convertFloatToUNorm8(offsetBytes(pSource, y * sourceStride),
+                offsetBytes(pDest, y * destStride), rowCount);
+        }
+        return;
+    }
+
+    // Build a table of dither thresholds for each of the four rows of the Bayer matrix. The same
+    // threshold is used for all channels of a pixel, and the table for each row covers 16 pixels,
+    // so that it repeats at a multiple of both the pixel size and the SIMD width.
+    size_t biasCount = 16 * channelCount;
+    std::vector<float> biases(4 * biasCount);
+    for (size_t row = 0; row < 4; row++)
+    {
+        for (size_t i = 0; i < biasCount; i++)
+        {
+            int threshold = kBayerMatrix[row][(i / channelCount) % 4];
+            biases[row * biasCount + i] = (static_cast<float>(threshold) + 0.5f) / 16.0f;
+        }
+    }
+
+    // Convert each row with the dither thresholds for that row.
+    for (size_t y = 0; y < height; y++)
+    {
+        convertRowFloatToUNorm8(offsetBytes(pSource, y * sourceStride),
+            offsetBytes(pDest, y * destStride), rowCount, &biases[(y % 4) * biasCount], biasCount);
+    }
+}
+
+} // namespace Foundation
+} // namespace Aurora
@@ -0,0 +1,357 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Aurora/Foundation/Profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <unordered_map>
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+// Aggregated timing for a single zone name on a single thread, in nanoseconds.
+struct ZoneTotals
+{
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t self  = 0;
+    uint64_t min   = std::numeric_limits<uint64_t>::max();
+    uint64_t max   = 0;
+};
+
+// Per-thread storage for recorded zones. Only the owning thread records into a buffer, so the mutex
+// is uncontended except while the profiler is collecting or resetting.
+struct Profiler::ThreadBuffer
+{
+    std::mutex mutex;
+    uint32_t thread = 0;
+
+    // The stored events, for trace export.
+    std::vector<Event> events;
+    uint64_t droppedEvents = 0;
+
+    // The totals for each zone, keyed by the name pointer, which avoids hashing the name string.
+    std::unordered_map<const char*, ZoneTotals> totals;
+
+    // The accumulated time of nested zones, for each open zone. The size of this stack is the
+    // current nesting depth. This is only accessed by the owning thread, so it is not guarded by
+    // the mutex.
+    std::vector<uint64_t> childTimes;
+};
+
+// The thread buffers returned by threads that have exited, to be reused by new threads. This is
+// shared with the threads that use the profiler, so that a thread can safely return its buffer even
+// if the profiler has been destroyed.
+struct Profiler::FreeThreadBuffers
+{
+    std::mutex mutex;
+    std::vector<ThreadBuffer*> buffers;
+};
+
+// A source of unique profiler identifiers, so that a thread-local buffer lookup is never confused
+// by a new profiler that happens to be allocated at the address of a destroyed one.
+static std::atomic<uint64_t> gNextProfilerID = 1;
+
+// The singleton profiler instance.
+Profiler theProfiler;
+
+Profiler& Profiler::profiler()
+{
+    return theProfiler;
+}
+
+Profiler::Profiler(size_t maxEventsPerThread) :
+    _id(gNextProfilerID++),
+    _maxEventsPerThread(maxEventsPerThread),
+    _epoch(clock::now()),
+    _pFreeThreadBuffers(std::make_shared<FreeThreadBuffers>())
+{
+}
+
+Profiler::~Profiler() {}
+
+Profiler::ThreadBuffer* Profiler::threadBuffer()
+{
+    // Each thread keeps the buffer it uses for each profiler, along with the identifier of the
+    // profiler that owns it. This makes the common case (a single profiler) a lookup with no
+    // locking. The buffers are returned to their profilers when the thread exits.
+    struct Owner
+    {
+        uint64_t profilerID   = 0;
+        ThreadBuffer* pBuffer = nullptr;
+        std::weak_ptr<FreeThreadBuffers> pFreeBuffers;
+    };
+    struct Owners
+    {
+        ~Owners()
+        {
+            for (Owner& owner : owners)
+            {
+                std::shared_ptr<FreeThreadBuffers> pFreeBuffers = owner.pFreeBuffers.lock();
+                if (pFreeBuffers)
+                {
+                    std::lock_guard<std::mutex> lock(pFreeBuffers->mutex);
+                    pFreeBuffers->buffers.push_back(owner.pBuffer);
+                }
+            }
+        }
+
+        std::vector<Owner> owners;
+    };
+    thread_local Owners tOwners;
+    for (Owner& owner : tOwners.owners)
+    {
+        if (owner.profilerID == _id)
+        {
+            return owner.pBuffer;
+        }
+    }
+
+    // Forget the buffers of profilers that have been destroyed.
+    std::vector<Owner>& owners = tOwners.owners;
+    owners.erase(std::remove_if(owners.begin(), owners.end(),
+                     [](const Owner& owner) { return owner.pFreeBuffers.expired(); }),
+        owners.end());
+
+    // Otherwise reuse a buffer returned by a thread that has exited, or create a new buffer. The
+    // buffers are owned by the profiler, so that their events outlive the threads.
+    ThreadBuffer* pBuffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_pFreeThreadBuffers->mutex);
+        if (!_pFreeThreadBuffers->buffers.empty())
+        {
+            pBuffer = _pFreeThreadBuffers->buffers.back();
+            _pFreeThreadBuffers->buffers.pop_back();
+        }
+    }
+    if (!pBuffer)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _threadBuffers.push_back(std::make_unique<ThreadBuffer>());
+        pBuffer         = _threadBuffers.back().get();
+        pBuffer->thread = static_cast<uint32_t>(_threadBuffers.size() - 1);
+    }
+    owners.push_back({ _id, pBuffer, _pFreeThreadBuffers });
+
+    return pBuffer;
+}
+
+Profiler::ThreadBuffer* Profiler::beginZone()
+{
+    // Push an accumulator for the nested zones of the new zone.
+    ThreadBuffer* pBuffer = threadBuffer();
+    pBuffer->childTimes.push_back(0);
+
+    return pBuffer;
+}
+
+void Profiler::endZone(ThreadBuffer* pBuffer, const char* name, uint64_t start, uint64_t end)
+{
+    // Pop the accumulator for nested zones, which gives the self time of the zone.
+    uint64_t duration  = end - start;
+    uint64_t childTime = pBuffer->childTimes.back();
+    pBuffer->childTimes.pop_back();
+    uint32_t depth = static_cast<uint32_t>(pBuffer->childTimes.size());
+    if (depth > 0)
+    {
+        pBuffer->childTimes.back() += duration;
+    }
+
+    // Discard the zone if the profiler was reset while it was open. This is checked with the lock
+    // held, so that a zone is not recorded after its buffer is reset.
+    std::lock_guard<std::mutex> lock(pBuffer->mutex);
+    if (start < _resetTime.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // Accumulate the zone totals.
+    ZoneTotals& totals = pBuffer->totals[name];
+    totals.count++;
+    totals.total += duration;
+    totals.self += duration - std::min(childTime, duration);
+    totals.min = std::min(totals.min, duration);
+    totals.max = std::max(totals.max, duration);
+
+    // Store the event for trace export, unless the buffer is full.
+    if (pBuffer->events.size() < _maxEventsPerThread)
+    {
+        pBuffer->events.push_back({ name, start, duration, pBuffer->thread, depth });
+    }
+    else
+    {
+        pBuffer->droppedEvents++;
+    }
+}
+
+void Profiler::reset()
+{
+    // Clear each thread buffer. Zones which are open across the reset are discarded when they
+    // end, rather than attributed to the new session, as they started before the reset time.
+    std::lock_guard<std::mutex> lock(_mutex);
+    _resetTime.store(now(), std::memory_order_relaxed);
+    for (auto& pBuffer : _threadBuffers)
+    {
+        std::lock_guard<std::mutex> bufferLock(pBuffer->mutex);
+        pBuffer->events.clear();
+        pBuffer->events.shrink_to_fit();
+        pBuffer->totals.clear();
+        pBuffer->droppedEvents = 0;
+    }
+}
+
+Profiler::Statistics Profiler::statistics() const
+{
+    // Merge the totals of all threads by zone name. Distinct pointers may refer to equal names,
+    // e.g. the same string literal in different modules, so the merge uses the string value.
+    std::map<std::string, ZoneTotals> merged;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto& pBuffer : _threadBuffers)
+        {
+            std::lock_guard<std::mutex> bufferLock(pBuffer->mutex);
+            for (auto& entry : pBuffer->totals)
+            {
+                ZoneTotals& totals = merged[entry.first];
+                totals.count += entry.second.count;
+                totals.total += entry.second.total;
+                totals.self += entry.second.self;
+                totals.min = std::min(totals.min, entry.second.min);
+                totals.max = std::max(totals.max, entry.second.max);
+            }
+        }
+    }
+
+    // Convert the merged totals to statistics in milliseconds, sorted by decreasing total time.
+    const double kNanosecondsToMilliseconds = 1.0e-6;
+    Statistics stats;
+    stats.reserve(merged.size());
+    for (auto& entry : merged)
+    {
+        ZoneStatistics zone;
+        zone.name      = entry.first;
+        zone.count     = entry.second.count;
+        zone.totalTime = entry.second.total * kNanosecondsToMilliseconds;
+        zone.selfTime  = entry.second.self * kNanosecondsToMilliseconds;
+        zone.minTime   = entry.second.min * kNanosecondsToMilliseconds;
+        zone.maxTime   = entry.second.max * kNanosecondsToMilliseconds;
+        stats.push_back(zone);
+    }
+    std::stable_sort(stats.begin(), stats.end(),
+        [](const ZoneStatistics& a, const ZoneStatistics& b) { return a.totalTime > b.totalTime; });
+
+    return stats;
+}
+
+std::vector<Profiler::Event> Profiler::events() const
+{
+    // Gather the events of all threads. Each thread buffer is already in order of zone end times,
+    // so sort each thread's events by start time, which puts parents before their children.
+    std::vector<Event> allEvents;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& pBuffer : _threadBuffers)
+    {
+        std::lock_guard<std::mutex> bufferLock(pBuffer->mutex);
+        size_t first = allEvents.size();
+        allEvents.insert(allEvents.end(), pBuffer->events.begin(), pBuffer->events.end());
+        std::stable_sort(allEvents.begin() + first, allEvents.end(),
+            [](const Event& a, const Event& b) {
+                return a.start < b.start || (a.start == b.start && a.depth < b.depth);
+            });
+    }
+
+    return allEvents;
+}
+
+uint64_t Profiler::droppedEventCount() const
+{
+    uint64_t count = 0;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& pBuffer : _threadBuffers)
+    {
+        std::lock_guard<std::mutex> bufferLock(pBuffer->mutex);
+        count += pBuffer->droppedEvents;
+    }
+
+    return count;
+}
+
+// Writes a string to a stream as a JSON string value, with escaping.
+static void writeJSONString(std::ostream& stream, const char* str)
+{
+    stream << '"';
+    for (const char* pChar = str; *pChar; pChar++)
+    {
+        char c = *pChar;
+        if (c == '"' || c == '\\')
+        {
+            stream << '\\' << c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            stream << escaped;
+        }
+        else
+        {
+            stream << c;
+        }
+    }
+    stream << '"';
+}
+
+void Profiler::writeChromeTrace(std::ostream& stream) const
+{
+    // Write each event as a "complete" event (phase "X"), which has a start time and duration in
+    // microseconds. The viewer reconstructs the zone hierarchy from the nested time ranges on each
+    // thread. Fractional microseconds are written to retain nanosecond resolution.
+    // NOTE: See https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU for
+    // a description of the format.
+    std::vector<Event> allEvents = events();
+    char buffer[64];
+    stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (size_t i = 0; i < allEvents.size(); i++)
+    {
+        const Event& event = allEvents[i];
+        stream << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        writeJSONString(stream, event.name);
+        std::snprintf(buffer, sizeof(buffer), "%.3f", event.start * 1.0e-3);
+        stream << ",\"cat\":\"Aurora\",\"ph\":\"X\",\"ts\":" << buffer;
+        std::snprintf(buffer, sizeof(buffer), "%.3f", event.duration * 1.0e-3);
+        stream << ",\"dur\":" << buffer << ",\"pid\":0,\"tid\":" << event.thread << "}";
+    }
+    stream << "\n]}\n";
+}
+
+bool Profiler::writeChromeTrace(const std::string& filePath) const
+{
+    std::ofstream stream(filePath, std::ios::out | std::ios::trunc);
+    if (!stream)
+    {
+        return false;
+    }
+    writeChromeTrace(stream);
+
+    return stream.good();
+}
+
+} // namespace Foundation
+} // namespace Aurora
@@ -0,0 +1,857 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Aurora/Foundation/TextureCompression.h>
+#include <Aurora/Foundation/Utilities.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+namespace
+{
+
+// The number of pixels in a block.
+constexpr int kBlockPixelCount = 16;
+
+// The BC7 interpolation weights for four-bit indices, out of 64.
+constexpr int kBC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+// The number of refinement iterations for the high quality preset. Each iteration usually reduces
+// the error less than the previous one, and the refinement stops early if it doesn't.
+constexpr int kRefinementIterations = 2;
+
+// A block of 4x4 pixels, with RGBA values in the [0, 255] range.
+struct Block
+{
+    float pixels[kBlockPixelCount][4];
+};
+
+// Loads a block from an RGBA image, repeating the edge pixels for blocks that extend past the
+// right or bottom edge of the image.
+void loadBlock(const uint8_t* pPixels, uint32_t width, uint32_t height, uint32_t blockX,
+    uint32_t blockY, Block& block)
+{
+    for (uint32_t y = 0; y < 4; y++)
+    {
+        uint32_t pixelY = std::min(blockY * 4 + y, height - 1);
+        for (uint32_t x = 0; x < 4; x++)
+        {
+            uint32_t pixelX       = std::min(blockX * 4 + x, width - 1);
+            const uint8_t* pPixel = pPixels + (static_cast<size_t>(pixelY) * width + pixelX) * 4;
+            for (int c = 0; c < 4; c++)
+            {
+                block.pixels[y * 4 + x][c] = pPixel[c];
+            }
+        }
+    }
+}
+
+// Stores a decoded block to an RGBA image, skipping pixels that are outside the image.
+void storeBlock(const uint8_t decoded[kBlockPixelCount][4], uint32_t width, uint32_t height,
+    uint32_t blockX, uint32_t blockY, uint8_t* pPixels)
+{
+    for (uint32_t y = 0; y < 4 && blockY * 4 + y < height; y++)
+    {
+        for (uint32_t x = 0; x < 4 && blockX * 4 + x < width; x++)
+        {
+            size_t pixelIndex = static_cast<size_t>(blockY * 4 + y) * width + blockX * 4 + x;
+            memcpy(pPixels + pixelIndex * 4, decoded[y * 4 + x], 4);
+        }
+    }
+}
+
+// Writes bits to a block, starting from the least significant bit of the first byte.
+class BitWriter
+{
+public:
+    BitWriter(uint8_t* pOutput, size_t byteCount) : _pOutput(pOutput)
+    {
+        memset(pOutput, 0, byteCount);
+    }
+
+    void write(uint32_t value, uint32_t bitCount)
+    {
+        for (uint32_t i = 0; i < bitCount; i++, _position++)
+        {
+            _pOutput[_position >> 3] |=
+                static_cast<uint8_t>(((value >> i) & 1u) << (_position & 7));
+        }
+    }
+
+private:
+    uint8_t* _pOutput;
+    uint32_t _position = 0;
+};
+
+// Reads bits from a block, starting from the least significant bit of the first byte.
+class BitReader
+{
+public:
+    BitReader(const uint8_t* pInput) : _pInput(pInput) {}
+
+    uint32_t read(uint32_t bitCount)
+    {
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < bitCount; i++, _position++)
+        {
+            value |= ((_pInput[_position >> 3] >> (_position & 7)) & 1u) << i;
+        }
+
+        return value;
+    }
+
+private:
+    const uint8_t* _pInput;
+    uint32_t _position = 0;
+};
+
+// Fits a line to the pixels of a block, using the specified number of channels, and returns the
+// endpoints of the line as the extreme projections of the pixels onto its principal axis.
+void fitPrincipalAxis(const Block& block, int channelCount, float endpoint0[4], float endpoint1[4])
+{
+    // Compute the mean and the range of each channel.
+    float mean[4]     = {};
+    float minValue[4] = { 255.0f, 255.0f, 255.0f, 255.0f };
+    float maxValue[4] = {};
+    for (const float* pPixel : block.pixels)
+    {
+        for (int c = 0; c < channelCount; c++)
+        {
+            mean[c] += pPixel[c] / kBlockPixelCount;
+            minValue[c] = std::min(minValue[c], pPixel[c]);
+            maxValue[c] = std::max(maxValue[c], pPixel[c]);
+        }
+    }
+
+    // Compute the covariance matrix.
+    float covariance[4][4] = {};
+    for (const float* pPixel : block.pixels)
+    {
+        for (int i = 0; i < channelCount; i++)
+        {
+            for (int j = 0; j < channelCount; j++)
+            {
+                covariance[i][j] += (pPixel[i] - mean[i]) * (pPixel[j] - mean[j]);
+            }
+        }
+    }
+
+    // Find the principal axis with power iteration, starting from the diagonal of the bounding
+    // box, which converges in a few iterations for typical blocks.
+    float axis[4] = {};
+    for (int c = 0; c < channelCount; c++)
+    {
+        axis[c] = maxValue[c] - minValue[c];
+    }
+    for (int iteration = 0; iteration < 8; iteration++)
+    {
+        float product[4] = {};
+        float maxAbs     = 0.0f;
+        for (int i = 0; i < channelCount; i++)
+        {
+            for (int j = 0; j < channelCount; j++)
+            {
+                product[i] += covariance[i][j] * axis[j];
+            }
+            maxAbs = std::max(maxAbs, std::abs(product[i]));
+        }
+        if (maxAbs == 0.0f)
+        {
+            break;
+        }
+        for (int c = 0; c < channelCount; c++)
+        {
+            axis[c] = product[c] / maxAbs;
+        }
+    }
+    float lengthSquared = 0.0f;
+    for (int c = 0; c < channelCount; c++)
+    {
+        lengthSquared += axis[c] * axis[c];
+    }
+
+    // If the block has a single color, both endpoints are that color.
+    if (lengthSquared < 1.0e-8f)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            endpoint0[c] = endpoint1[c] = c < channelCount ? mean[c] : 255.0f;
+        }
+
+        return;
+    }
+    for (int c = 0; c < channelCount; c++)
+    {
+        axis[c] /= std::sqrt(lengthSquared);
+    }
+
+    // Project the pixels onto the axis, and use the extreme projections as the endpoints.
+    float minProjection = std::numeric_limits<float>::max();
+    float maxProjection = -std::numeric_limits<float>::max();
+    for (const float* pPixel : block.pixels)
+    {
+        float projection = 0.0f;
+        for (int c = 0; c < channelCount; c++)
+        {
+            projection += (pPixel[c] - mean[c]) * axis[c];
+        }
+        minProjection = std::min(minProjection, projection);
+        maxProjection = std::max(maxProjection, projection);
+    }
+    for (int c = 0; c < 4; c++)
+    {
+        endpoint0[c] = c < channelCount
+            ? std::clamp(mean[c] + axis[c] * minProjection, 0.0f, 255.0f)
+            : 255.0f;
+        endpoint1[c] = c < channelCount
+            ? std::clamp(mean[c] + axis[c] * maxProjection, 0.0f, 255.0f)
+            : 255.0f;
+    }
+}
+
+// Refines the endpoints of a block with a least-squares fit to the pixels, where each pixel has
+// the specified interpolation weight between the endpoints (zero for the first endpoint, and one
+// for the second). Returns false if the weights are degenerate, e.g. all the same.
+bool refineEndpoints(const Block& block, int channelCount, const float weights[kBlockPixelCount],
+    float endpoint0[4], float endpoint1[4])
+{
+    // Solve the 2x2 normal equations for each channel, which share the same matrix.
+    float a = 0.0f, b = 0.0f, c = 0.0f;
+    float x[4] = {}, y[4] = {};
+    for (int i = 0; i < kBlockPixelCount; i++)
+    {
+        float t = weights[i];
+        float s = 1.0f - t;
+        a += s * s;
+        b += s * t;
+        c += t * t;
+        for (int channel = 0; channel < channelCount; channel++)
+        {
+            x[channel] += s * block.pixels[i][channel];
+            y[channel] += t * block.pixels[i][channel];
+        }
+    }
+    float determinant = a * c - b * b;
+    if (std::abs(determinant) < 1.0e-6f)
+    {
+        return false;
+    }
+    for (int channel = 0; channel < channelCount; channel++)
+    {
+        endpoint0[channel] =
+            std::clamp((c * x[channel] - b * y[channel]) / determinant, 0.0f, 255.0f);
+        endpoint1[channel] =
+            std::clamp((a * y[channel] - b * x[channel]) / determinant, 0.0f, 255.0f);
+    }
+
+    return true;
+}
+
+// Computes the squared error between a pixel and a palette entry, for the specified channels.
+float squaredError(const float* pPixel, const int* pEntry, int channelCount)
+{
+    float error = 0.0f;
+    for (int c = 0; c < channelCount; c++)
+    {
+        float difference = pPixel[c] - static_cast<float>(pEntry[c]);
+        error += difference * difference;
+    }
+
+    return error;
+}
+
+// Chooses the palette entry with the lowest error for each pixel of a block, returning the total
+// error.
+float chooseIndices(const Block& block, const int palette[][4], int paletteSize, int channelCount,
+    uint8_t indices[kBlockPixelCount])
+{
+    float totalError = 0.0f;
+    for (int i = 0; i < kBlockPixelCount; i++)
+    {
+        float bestError = std::numeric_limits<float>::max();
+        for (int entry = 0; entry < paletteSize; entry++)
+        {
+            float error = squaredError(block.pixels[i], palette[entry], channelCount);
+            if (error < bestError)
+            {
+                bestError  = error;
+                indices[i] = static_cast<uint8_t>(entry);
+            }
+        }
+        totalError += bestError;
+    }
+
+    return totalError;
+}
+
+/*** BC1 ***/
+
+// Packs an RGB color to 5:6:5 bits.
+uint16_t packColor565(const float color[4])
+{
+    auto quantize = [](float value, int maxValue) {
+        return static_cast<uint16_t>(std::lround(value * maxValue / 255.0f));
+    };
+
+    return static_cast<uint16_t>(
+        (quantize(color[0], 31) << 11) | (quantize(color[1], 63) << 5) | quantize(color[2], 31));
+}
+
+// Unpacks a 5:6:5 color to 8-bit RGB, replicating the high bits into the low bits.
+void unpackColor565(uint16_t packed, int color[4])
+{
+    int r    = (packed >> 11) & 31;
+    int g    = (packed >> 5) & 63;
+    int b    = packed & 31;
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+    color[3] = 255;
+}
+
+// Builds the BC1 palette from the packed endpoint colors. This uses the four color mode when the
+// first color is greater than the second, and the three color mode (with transparent black)
+// otherwise; the encoder only uses the latter for single color blocks.
+void buildBC1Palette(uint16_t color0, uint16_t color1, int palette[4][4])
+{
+    unpackColor565(color0, palette[0]);
+    unpackColor565(color1, palette[1]);
+    for (int c = 0; c < 3; c++)
+    {
+        if (color0 > color1)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+        else
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+    palette[2][3] = 255;
+    palette[3][3] = color0 > color1 ? 255 : 0;
+}
+
+// The result of encoding a BC1 block with a pair of endpoints.
+struct BC1Encoding
+{
+    uint16_t color0 = 0;
+    uint16_t color1 = 0;
+    uint8_t indices[kBlockPixelCount];
+    float error = std::numeric_limits<float>::max();
+};
+
+// Encodes a BC1 block with the specified (unquantized) endpoints, in the four color mode.
+BC1Encoding encodeBC1Endpoints(
+    const Block& block, const float endpoint0[4], const float endpoint1[4])
+{
+    // The four color mode requires the first color to be greater than the second, so swap them if
+    // needed. If they are equal, the block is a single color, and every pixel uses the first.
+    BC1Encoding encoding;
+    encoding.color0 = packColor565(endpoint0);
+    encoding.color1 = packColor565(endpoint1);
+    if (encoding.color0 < encoding.color1)
+    {
+        std::swap(encoding.color0, encoding.color1);
+    }
+    int palette[4][4];
+    buildBC1Palette(encoding.color0, encoding.color1, palette);
+    encoding.error = chooseIndices(
+        block, palette, encoding.color0 == encoding.color1 ? 1 : 4, 3, encoding.indices);
+
+    return encoding;
+}
+
+void encodeBC1Block(const Block& block, CompressionQuality quality, uint8_t* pOutput)
+{
+    float endpoint0[4], endpoint1[4];
+    fitPrincipalAxis(block, 3, endpoint0, endpoint1);
+    BC1Encoding best = encodeBC1Endpoints(block, endpoint0, endpoint1);
+
+    // Refine the endpoints to fit the chosen indices, keeping the result if it has a lower error.
+    if (quality == CompressionQuality::High)
+    {
+        static constexpr float kIndexWeights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+        for (int iteration = 0; iteration < kRefinementIterations; iteration++)
+        {
+            float weights[kBlockPixelCount];
+            for (int i = 0; i < kBlockPixelCount; i++)
+            {
+                weights[i] = kIndexWeights[best.indices[i]];
+            }
+            if (!refineEndpoints(block, 3, weights, endpoint0, endpoint1))
+            {
+                break;
+            }
+            BC1Encoding refined = encodeBC1Endpoints(block, endpoint0, endpoint1);
+            if (refined.error >= best.error)
+            {
+                break;
+            }
+            best = refined;
+        }
+    }
+
+    // Write the endpoints followed by two bits for each index.
+    BitWriter writer(pOutput, 8);
+    writer.write(best.color0, 16);
+    writer.write(best.color1, 16);
+    for (uint8_t index : best.indices)
+    {
+        writer.write(index, 2);
+    }
+}
+
+void decodeBC1Block(const uint8_t* pInput, uint8_t decoded[kBlockPixelCount][4])
+{
+    BitReader reader(pInput);
+    uint16_t color0 = static_cast<uint16_t>(reader.read(16));
+    uint16_t color1 = static_cast<uint16_t>(reader.read(16));
+    int palette[4][4];
+    buildBC1Palette(color0, color1, palette);
+    for (int i = 0; i < kBlockPixelCount; i++)
+    {
+        const int* pEntry = palette[reader.read(2)];
+        for (int c = 0; c < 4; c++)
+        {
+            decoded[i][c] = static_cast<uint8_t>(pEntry[c]);
+        }
+    }
+}
+
+/*** BC4 ***/
+
+// Builds the BC4 palette from the endpoints. This uses eight interpolated values when the first
+// endpoint is greater than the second, and otherwise six interpolated values plus zero and 255.
+void buildBC4Palette(int value0, int value1, int palette[8][4])
+{
+    palette[0][0] = value0;
+    palette[1][0] = value1;
+    if (value0 > value1)
+    {
+        for (int i = 2; i < 8; i++)
+        {
+            palette[i][0] = ((8 - i) * value0 + (i - 1) * value1 + 3) / 7;
+        }
+    }
+    else
+    {
+        for (int i = 2; i < 6; i++)
+        {
+            palette[i][0] = ((6 - i) * value0 + (i - 1) * value1 + 2) / 5;
+        }
+        palette[6][0] = 0;
+        palette[7][0] = 255;
+    }
+}
+
+// The result of encoding a single BC4 channel with a pair of endpoints.
+struct BC4Encoding
+{
+    int value0 = 0;
+    int value1 = 0;
+    uint8_t indices[kBlockPixelCount];
+    float error = std::numeric_limits<float>::max();
+};
+
+// Encodes a single channel of a block as BC4 with the specified (unquantized) endpoints.
+BC4Encoding encodeBC4Endpoints(const Block& block, float value0, float value1)
+{
+    BC4Encoding encoding;
+    encoding.value0 = static_cast<int>(std::lround(value0));
+    encoding.value1 = static_cast<int>(std::lround(value1));
+    int palette[8][4];
+    buildBC4Palette(encoding.value0, encoding.value1, palette);
+    encoding.error = chooseIndices(block, palette, 8, 1, encoding.indices);
+
+    return encoding;
+}
+
+// Encodes a single channel of a block as BC4, where the block has the channel value in the first
+// (red) channel of each pixel.
+void encodeBC4Channel(const Block& block, CompressionQuality quality, uint8_t* pOutput)
+{
+    // Use the range of the values as the endpoints, in the eight value mode.
+    float minValue = 255.0f, maxValue = 0.0f;
+    for (const float* pPixel : block.pixels)
+    {
+        minValue = std::min(minValue, pPixel[0]);
+        maxValue = std::max(maxValue, pPixel[0]);
+    }
+    BC4Encoding best = encodeBC4Endpoints(block, maxValue, minValue);
+
+    if (quality == CompressionQuality::High && best.error > 0.0f)
+    {
+        // Refine the endpoints to fit the chosen indices.
+        float value0 = maxValue, value1 = minValue;
+        for (int iteration = 0; iteration < kRefinementIterations; iteration++)
+        {
+            float weights[kBlockPixelCount];
+            for (int i = 0; i < kBlockPixelCount; i++)
+            {
+                int index  = best.indices[i];
+                weights[i] = index <= 1 ? static_cast<float>(index) : (index - 1) / 7.0f;
+            }
+            float endpoint0[4] = { value0 }, endpoint1[4] = { value1 };
+            if (!refineEndpoints(block, 1, weights, endpoint0, endpoint1) ||
+                endpoint0[0] <= endpoint1[0])
+            {
+                break;
+            }
+            value0              = endpoint0[0];
+            value1              = endpoint1[0];
+            BC4Encoding refined = encodeBC4Endpoints(block, value0, value1);
+            if (refined.error >= best.error)
+            {
+                break;
+            }
+            best = refined;
+        }
+
+        // Try the six value mode, with the range of the values other than zero and 255, which
+        // are represented exactly in that mode. This is better for blocks with a few outliers.
+        float innerMin = 255.0f, innerMax = 0.0f;
+        for (const float* pPixel : block.pixels)
+        {
+            if (pPixel[0] > 0.0f && pPixel[0] < 255.0f)
+            {
+                innerMin = std::min(innerMin, pPixel[0]);
+                innerMax = std::max(innerMax, pPixel[0]);
+            }
+        }
+        if (innerMin <= innerMax)
+        {
+            BC4Encoding sixValues = encodeBC4Endpoints(block, innerMin, innerMax);
+            if (sixValues.error < best.error)
+            {
+                best = sixValues;
+            }
+        }
+    }
+
+    // Write the endpoints followed by three bits for each index.
+    BitWriter writer(pOutput, 8);
+    writer.write(best.value0, 8);
+    writer.write(best.value1, 8);
+    for (uint8_t index : best.indices)
+    {
+        writer.write(index, 3);
+    }
+}
+
+void encodeBC4Block(const Block& block, CompressionQuality quality, uint8_t* pOutput)
+{
+    encodeBC4Channel(block, quality, pOutput);
+}
+
+void encodeBC5Block(const Block& block, CompressionQuality quality, uint8_t* pOutput)
+{
+    // Encode the red channel, then move the green channel to the first channel and encode that.
+    encodeBC4Channel(block, quality, pOutput);
+    Block greenBlock;
+    for (int i = 0; i < kBlockPixelCount; i++)
+    {
+        greenBlock.pixels[i][0] = block.pixels[i][1];
+    }
+    encodeBC4Channel(greenBlock, quality, pOutput + 8);
+}
+
+// Decodes a single BC4 channel to the specified channel of the decoded block.
+void decodeBC4Channel(const uint8_t* pInput, int channel, uint8_t decoded[kBlockPixelCount][4])
+{
+    BitReader reader(pInput);
+    int value0 = static_cast<int>(reader.read(8));
+    int value1 = static_cast<int>(reader.read(8));
+    int palette[8][4];
+    buildBC4Palette(value0, value1, palette);
+    for (int i = 0; i < kBlockPixelCount; i++)
+    {
+        decoded[i][channel] = static_cast<uint8_t>(palette[reader.read(3)][0]);
+    }
+}
+
+void decodeBC4Block(const uint8_t* pInput, uint8_t decoded[kBlockPixelCount][4])
+{
+    memset(decoded, 0, kBlockPixelCount * 4);
+    decodeBC4Channel(pInput, 0, decoded);
+    for (int i = 0; i < kBlockPixelCount; i++)
+    {
+        decoded[i][3] = 255;
+    }
+}
+
+void decodeBC5Block(const uint8_t* pInput, uint8_t decoded[kBlockPixelCount][4])
+{
+    memset(decoded, 0, kBlockPixelCount * 4);
+    decodeBC4Channel(pInput, 0, decoded);
+    decodeBC4Channel(pInput + 8, 1, decoded);
+    for (int i = 0; i < kBlockPixelCount; i++)
+    {
+        decoded[i][3] = 255;
+    }
+}
+
+/*** BC7 ***/
+
+// Builds the BC7 mode 6 palette from the 8-bit endpoints.
+void buildBC7Palette(const int endpoint0[4], const int endpoint1[4], int palette[16][4])
+{
+    for (int i = 0; i < 16; i++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            palette[i][c] =
+                ((64 - kBC7Weights[i]) * endpoint0[c] + kBC7Weights[i] * endpoint1[c] + 32) >> 6;
+        }
+    }
+}
+
+// Quantizes an endpoint to seven bits per channel plus a shared p-bit, which is the least
+// significant bit of every channel, choosing the p-bit with the lowest error.
+void quantizeBC7Endpoint(const float endpoint[4], int quantized[4], int& pBit)
+{
+    float bestError = std::numeric_limits<float>::max();
+    for (int p = 0; p < 2; p++)
+    {
+        int candidate[4];
+        float error = 0.0f;
+        for (int c = 0; c < 4; c++)
+        {
+            candidate[c] =
+                std::clamp(static_cast<int>(std::lround((endpoint[c] - p) * 0.5f)), 0, 127);
+            float difference = static_cast<float>(candidate[c] * 2 + p) - endpoint[c];
+            error += difference * difference;
+        }
+        if (error < bestError)
+        {
+            bestError = error;
+            pBit      = p;
+            memcpy(quantized, candidate, sizeof(candidate));
+        }
+    }
+}
+
+// The result of encoding a BC7 mode 6 block with a pair of endpoints.
+struct BC7Encoding
+{
+    int endpoints[2][4] = {};
+    int pBits[2]        = {};
+    uint8_t indices[kBlockPixelCount];
+    float error = std::numeric_limits<float>::max();
+};
+
+// Encodes a BC7 mode 6 block with the specified (unquantized) endpoints.
+BC7Encoding encodeBC7Endpoints(
+    const Block& block, const float endpoint0[4], const float endpoint1[4])
+{
+    BC7Encoding encoding;
+    quantizeBC7Endpoint(endpoint0, encoding.endpoints[0], encoding.pBits[0]);
+    quantizeBC7Endpoint(endpoint1, encoding.endpoints[1], encoding.pBits[1]);
+    int expanded[2][4];
+    for (int e = 0; e < 2; e++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            expanded[e][c] = encoding.endpoints[e][c] * 2 + encoding.pBits[e];
+        }
+    }
+    int palette[16][4];
+    buildBC7Palette(expanded[0], expanded[1], palette);
+    encoding.error = chooseIndices(block, palette, 16, 4, encoding.indices);
+
+    // The most significant bit of the first index is implicitly zero (the "anchor" index), so if
+    // it would be one, swap the endpoints and invert the indices.
+    if (encoding.indices[0] >= 8)
+    {
+        std::swap(encoding.endpoints[0], encoding.endpoints[1]);
+        std::swap(encoding.pBits[0], encoding.pBits[1]);
+        for (uint8_t& index : encoding.indices)
+        {
+            index = static_cast<uint8_t>(15 - index);
+        }
+    }
+
+    return encoding;
+}
+
+void encodeBC7Block(const Block& block, CompressionQuality quality, uint8_t* pOutput)
+{
+    float endpoint0[4], endpoint1[4];
+    fitPrincipalAxis(block, 4, endpoint0, endpoint1);
+    BC7Encoding best = encodeBC7Endpoints(block, endpoint0, endpoint1);
+
+    // Refine the endpoints to fit the chosen indices, keeping the result if it has a lower error.
+    // The indices are relative to the (possibly swapped) endpoints of the encoding.
+    if (quality == CompressionQuality::High)
+    {
+        for (int iteration = 0; iteration < kRefinementIterations && best.error > 0.0f; iteration++)
+        {
+            float weights[kBlockPixelCount];
+            for (int i = 0; i < kBlockPixelCount; i++)
+            {
+                weights[i] = kBC7Weights[best.indices[i]] / 64.0f;
+            }
+            if (!refineEndpoints(block, 4, weights, endpoint0, endpoint1))
+            {
+                break;
+            }
+            BC7Encoding refined = encodeBC7Endpoints(block, endpoint0, endpoint1);
+            if (refined.error >= best.error)
+            {
+                break;
+            }
+            best = refined;
+        }
+    }
+
+    // Write the mode (a single one bit after six zero bits), the endpoints in channel order, the
+    // p-bits, and the indices, where the anchor index has one less bit.
+    BitWriter writer(pOutput, 16);
+    writer.write(1u << 6, 7);
+    for (int c = 0; c < 4; c++)
+    {
+        writer.write(best.endpoints[0][c], 7);
+        writer.write(best.endpoints[1][c], 7);
+    }
+    writer.write(best.pBits[0], 1);
+    writer.write(best.pBits[1], 1);
+    writer.write(best.indices[0], 3);
+    for (int i = 1; i < kBlockPixelCount; i++)
+    {
+        writer.write(best.indices[i], 4);
+    }
+}
+
+void decodeBC7Block(const uint8_t* pInput, uint8_t decoded[kBlockPixelCount][4])
+{
+    // Only mode 6 is supported, which is the only mode produced by the encoder.
+    BitReader reader(pInput);
+    if (reader.read(7) != 1u << 6)
+    {
+        assert(!"Unsupported BC7 mode.");
+        memset(decoded, 0, kBlockPixelCount * 4);
+
+        return;
+    }
+    int endpoints[2][4];
+    for (int c = 0; c < 4; c++)
+    {
+        endpoints[0][c] = static_cast<int>(reader.read(7));
+        endpoints[1][c] = static_cast<int>(reader.read(7));
+    }
+    for (int e = 0; e < 2; e++)
+    {
+        int pBit = static_cast<int>(reader.read(1));
+        for (int c = 0; c < 4; c++)
+        {
+            endpoints[e][c] = endpoints[e][c] * 2 + pBit;
+        }
+    }
+    int palette[16][4];
+    buildBC7Palette(endpoints[0], endpoints[1], palette);
+    for (int i = 0; i < kBlockPixelCount; i++)
+    {
+        const int* pEntry = palette[reader.read(i == 0 ? 3 : 4)];
+        for (int c = 0; c < 4; c++)
+        {
+            decoded[i][c] = static_cast<uint8_t>(pEntry[c]);
+        }
+    }
+}
+
+} // namespace
+
+size_t compressedBlockSize(BlockFormat format)
+{
+    return format == BlockFormat::BC1 || format == BlockFormat::BC4 ? 8 : 16;
+}
+
+size_t compressedRowPitch(BlockFormat format, uint32_t width)
+{
+    return static_cast<size_t>((width + 3) / 4) * compressedBlockSize(format);
+}
+
+size_t compressedImageSize(BlockFormat format, uint32_t width, uint32_t height)
+{
+    return compressedRowPitch(format, width) * ((height + 3) / 4);
+}
+
+void compressImage(const uint8_t* pPixels, uint32_t width, uint32_t height, BlockFormat format,
+    CompressionQuality quality, uint8_t* pOutput, uint32_t threadCount)
+{
+    assert(pPixels && pOutput && width > 0 && height > 0);
+
+    using EncodeFunction = void (*)(const Block&, CompressionQuality, uint8_t*);
+    EncodeFunction encode =
+        format == BlockFormat::BC1 ? encodeBC1Block
+        : format == BlockFormat::BC4 ? encodeBC4Block
+        : format == BlockFormat::BC5 ? encodeBC5Block
+                                     : encodeBC7Block;
+
+    // Encode each row of blocks independently, as each block is written to a fixed location.
+    uint32_t blockCountX = (width + 3) / 4;
+    uint32_t blockCountY = (height + 3) / 4;
+    size_t blockSize     = compressedBlockSize(format);
+    size_t rowPitch      = compressedRowPitch(format, width);
+    parallelForRanges(blockCountY, threadCount, [&](size_t begin, size_t end) {
+        Block block;
+        for (uint32_t blockY = static_cast<uint32_t>(begin); blockY < end; blockY++)
+        {
+            for (uint32_t blockX = 0; blockX < blockCountX; blockX++)
+            {
+                loadBlock(pPixels, width, height, blockX, blockY, block);
+                encode(block, quality, pOutput + blockY * rowPitch + blockX * blockSize);
+            }
+        }
+    });
+}
+
+void decompressImage(const uint8_t* pInput, uint32_t width, uint32_t height, BlockFormat format,
+    uint8_t* pPixels)
+{
+    assert(pInput && pPixels && width > 0 && height > 0);
+
+    using DecodeFunction = void (*)(const uint8_t*, uint8_t[kBlockPixelCount][4]);
+    DecodeFunction decode =
+        format == BlockFormat::BC1 ? decodeBC1Block
+        : format == BlockFormat::BC4 ? decodeBC4Block
+        : format == BlockFormat::BC5 ? decodeBC5Block
+                                     : decodeBC7Block;
+
+    uint32_t blockCountX = (width + 3) / 4;
+    uint32_t blockCountY = (height + 3) / 4;
+    size_t blockSize     = compressedBlockSize(format);
+    uint8_t decoded[kBlockPixelCount][4];
+    for (uint32_t blockY = 0; blockY < blockCountY; blockY++)
+    {
+        for (uint32_t blockX = 0; blockX < blockCountX; blockX++)
+        {
+            decode(pInput + (static_cast<size_t>(blockY) * blockCountX + blockX) * blockSize,
+                decoded);
+            storeBlock(decoded, width, height, blockX, blockY, pPixels);
+        }
+    }
+}
+
+} // namespace Foundation
+} // namespace Aurora
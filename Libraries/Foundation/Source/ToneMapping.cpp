@@ -0,0 +1,234 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Aurora/Foundation/ToneMapping.h>
+#include <Aurora/Foundation/Utilities.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+// Select the SIMD instruction set. SSE2 is always available on x64.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TONE_MAPPING_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Aurora
+{
+namespace Foundation
+{
+
+namespace
+{
+
+// The coefficients of a rational function (a cubic divided by a cubic) that inverts part of the
+// Canon spectrum tone mapping curve.
+struct RationalCurve
+{
+    float a;
+    float t1, t2, t3;
+    float d0, d1, d2, d3;
+};
+
+// The curves used below and above the break value, with the range of the result in log10 units,
+// and the middle gray value.
+constexpr RationalCurve kCanonLowCurve  = { 0.244925773f, -0.631960243f, -4.251792105f,
+    3.841721426f, -0.005002772f, -0.525010335f, -0.885018509f, 1.153153531f };
+constexpr RationalCurve kCanonHighCurve = { 0.514397858f, -0.553266341f, -2.677674970f,
+    2.903543727f, -0.005057344f, -0.804910686f, -1.427186761f, 2.068910419f };
+constexpr float kCanonLowHighBreak      = 0.9932f;
+constexpr float kCanonLogMin            = -2.152529302052785809f;
+constexpr float kCanonLogMax            = 1.163792197947214113f;
+constexpr float kCanonShift             = 0.18f;
+
+// Constants for the approximation of 10^x, from the Cephes library exp10f(): the value is split
+// into 2^n * 10^r, with |r| <= log10(2) / 2, and 10^r is approximated with a polynomial. log10(2)
+// is split into two parts, the first exactly representable with few bits, for an exact reduction.
+constexpr float kLog2Of10      = 3.32192809488736234787f;
+constexpr float kLog10Of2High  = 3.00781250000000000000e-1f;
+constexpr float kLog10Of2Low   = 2.48745663981195213739e-4f;
+constexpr float kExp10Coeffs[] = { 2.063216740311022e-1f, 5.420251702225484e-1f,
+    1.171292686296281e+0f, 2.034649854009453e+0f, 2.650948748208892e+0f, 2.302585167056758e+0f };
+
+inline float bitsFloat(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+// Evaluates a rational curve.
+inline float evaluateCurve(const RationalCurve& curve, float x)
+{
+    const float x2 = x * x;
+    const float x3 = x2 * x;
+
+    return curve.a * (curve.t1 * x + curve.t2 * x2 + curve.t3 * x3) /
+        (curve.d0 + curve.d1 * x + curve.d2 * x2 + curve.d3 * x3);
+}
+
+// Maps a value to the log10 range of the curve, before the power function is applied.
+inline float canonInverseLog(float value)
+{
+    value = value < kCanonLowHighBreak ? evaluateCurve(kCanonLowCurve, value)
+                                       : evaluateCurve(kCanonHighCurve, value);
+    value = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+
+    return value * (kCanonLogMax - kCanonLogMin) + kCanonLogMin;
+}
+
+// Applies the inverse curve to a value, approximating 10^x as described above. This is the same
+// algorithm as canonInverseSSE2(), for the values that do not fill a SIMD register.
+inline float canonInverseFast(float value, float exposureScale)
+{
+    float x = canonInverseLog(value);
+    float n = std::floor(x * kLog2Of10 + 0.5f);
+    x       = x - n * kLog10Of2High;
+    x       = x - n * kLog10Of2Low;
+    float p = kExp10Coeffs[0];
+    for (int i = 1; i < 6; i++)
+    {
+        p = p * x + kExp10Coeffs[i];
+    }
+    p = (1.0f + x * p) * bitsFloat(static_cast<uint32_t>(static_cast<int>(n) + 127) << 23);
+
+    return p / exposureScale * kCanonShift;
+}
+
+#if defined(TONE_MAPPING_SSE2)
+// Selects the bits of a where the mask is set, and the bits of b elsewhere.
+inline __m128 select(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Evaluates a rational curve for four values.
+inline __m128 evaluateCurveSSE2(const RationalCurve& curve, __m128 x)
+{
+    __m128 x2  = _mm_mul_ps(x, x);
+    __m128 x3  = _mm_mul_ps(x2, x);
+    __m128 num = _mm_mul_ps(_mm_set1_ps(curve.t1), x);
+    num        = _mm_add_ps(num, _mm_mul_ps(_mm_set1_ps(curve.t2), x2));
+    num        = _mm_add_ps(num, _mm_mul_ps(_mm_set1_ps(curve.t3), x3));
+    __m128 den = _mm_add_ps(_mm_set1_ps(curve.d0), _mm_mul_ps(_mm_set1_ps(curve.d1), x));
+    den        = _mm_add_ps(den, _mm_mul_ps(_mm_set1_ps(curve.d2), x2));
+    den        = _mm_add_ps(den, _mm_mul_ps(_mm_set1_ps(curve.d3), x3));
+
+    return _mm_div_ps(_mm_mul_ps(_mm_set1_ps(curve.a), num), den);
+}
+
+// Applies the inverse curve to four values. This is the same algorithm as canonInverseFast(),
+// with the branches replaced by selection masks.
+inline __m128 canonInverseSSE2(__m128 value, __m128 exposureScale)
+{
+    // Evaluate both curves, and select the result on each side of the break. The max() is first so
+    // that NaN becomes zero, as with the scalar comparisons.
+    __m128 isLow = _mm_cmplt_ps(value, _mm_set1_ps(kCanonLowHighBreak));
+    __m128 low   = evaluateCurveSSE2(kCanonLowCurve, value);
+    __m128 high  = evaluateCurveSSE2(kCanonHighCurve, value);
+    __m128 x     = _mm_max_ps(select(isLow, low, high), _mm_setzero_ps());
+    x            = _mm_min_ps(x, _mm_set1_ps(1.0f));
+    x            = _mm_mul_ps(x, _mm_set1_ps(kCanonLogMax - kCanonLogMin));
+    x            = _mm_add_ps(x, _mm_set1_ps(kCanonLogMin));
+
+    // Compute floor(x * log2(10) + 0.5), where the truncation is adjusted for negative values.
+    __m128 t  = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(kLog2Of10)), _mm_set1_ps(0.5f));
+    __m128i n = _mm_cvttps_epi32(t);
+    n         = _mm_add_epi32(n, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(n), t)));
+    __m128 nf = _mm_cvtepi32_ps(n);
+
+    // Reduce the value, and evaluate the polynomial.
+    x        = _mm_sub_ps(x, _mm_mul_ps(nf, _mm_set1_ps(kLog10Of2High)));
+    x        = _mm_sub_ps(x, _mm_mul_ps(nf, _mm_set1_ps(kLog10Of2Low)));
+    __m128 p = _mm_set1_ps(kExp10Coeffs[0]);
+    for (int i = 1; i < 6; i++)
+    {
+        p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(kExp10Coeffs[i]));
+    }
+    __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23));
+    p            = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x, p)), scale);
+
+    return _mm_mul_ps(_mm_div_ps(p, exposureScale), _mm_set1_ps(kCanonShift));
+}
+#endif
+
+} // namespace
+
+float canonInverse(float value, float exposure)
+{
+    value = value < kCanonLowHighBreak ? evaluateCurve(kCanonLowCurve, value)
+                                       : evaluateCurve(kCanonHighCurve, value);
+    value = std::min(std::max(value, 0.0f), 1.0f);
+    value = value * (kCanonLogMax - kCanonLogMin) + kCanonLogMin;
+    value = std::pow(10.0f, value);
+    value /= std::exp2(exposure);
+    value *= kCanonShift;
+
+    return value;
+}
+
+void canonInverseImage(const float* pSource, float* pDest, size_t width, size_t height,
+    size_t channelCount, float exposure, uint32_t threadCount)
+{
+    assert(pSource && pDest);
+
+    float exposureScale = std::exp2(exposure);
+    size_t rowSize      = width * channelCount;
+    parallelForRanges(height, threadCount, [&](size_t begin, size_t end) {
+        const float* pSourceRows = pSource + begin * rowSize;
+        float* pDestRows         = pDest + begin * rowSize;
+        size_t count             = (end - begin) * rowSize;
+        size_t i                 = 0;
+#if defined(TONE_MAPPING_SSE2)
+        __m128 exposureScale4 = _mm_set1_ps(exposureScale);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 value = _mm_loadu_ps(pSourceRows + i);
+            _mm_storeu_ps(pDestRows + i, canonInverseSSE2(value, exposureScale4));
+        }
+#endif
+
+        // Convert any remaining values.
+        for (; i < count; i++)
+        {
+            pDestRows[i] = canonInverseFast(pSourceRows[i], exposureScale);
+        }
+    });
+}
+
+void canonInverseImage(const uint8_t* pSource, float* pDest, size_t width, size_t height,
+    size_t channelCount, float exposure, uint32_t threadCount)
+{
+    assert(pSource && pDest);
+
+    float table[256];
+    for (int i = 0; i < 256; i++)
+    {
+        table[i] = canonInverse(static_cast<float>(i) / 255.0f, exposure);
+    }
+
+    size_t rowSize = width * channelCount;
+    parallelForRanges(height, threadCount, [&](size_t begin, size_t end) {
+        for (size_t i = begin * rowSize; i < end * rowSize; i++)
+        {
+            pDest[i] = table[pSource[i]];
+        }
+    });
+}
+
+} // namespace Foundation
+} // namespace Aurora
@@ -24,7 +24,9 @@
 #include <stdio.h>
 #endif
 
+#include <atomic>
 #include <fstream>
+#include <thread>
 
 namespace Aurora
 {
@@ -134,5 +136,61 @@ std::string getModulePath()
     return tempBuf;
 }
 
+void parallelForRanges(size_t count, uint32_t threadCount,
+    const std::function<void(size_t, size_t)>& func, size_t minRangeSize)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    size_t rangeCount = std::min<size_t>(threadCount, count / std::max<size_t>(minRangeSize, 1));
+    if (rangeCount <= 1)
+    {
+        func(0, count);
+
+        return;
+    }
+
+    size_t rangeSize = (count + rangeCount - 1) / rangeCount;
+    std::vector<std::thread> threads;
+    for (size_t begin = rangeSize; begin < count; begin += rangeSize)
+    {
+        threads.emplace_back(func, begin, std::min(begin + rangeSize, count));
+    }
+    func(0, rangeSize);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void parallelFor(size_t count, uint32_t threadCount, const std::function<void(size_t)>& func)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    threadCount = static_cast<uint32_t>(std::min<size_t>(threadCount, count));
+
+    // Each thread (including the calling thread) takes the next index until there are none left.
+    std::atomic<size_t> nextIndex(0);
+    auto work = [&]() {
+        for (size_t index = nextIndex++; index < count; index = nextIndex++)
+        {
+            func(index);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < threadCount; i++)
+    {
+        threads.emplace_back(work);
+    }
+    work();
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
 } // namespace Foundation
 } // namespace Aurora
@@ -15,6 +15,113 @@
 
 #include "HdAuroraImageCache.h"
 
+void HdAuroraImageLRUPolicy::addImage(const Aurora::Path& path)
+{
+    if (contains(path))
+        return;
+
+    _order.push_front(path);
+    _images[path].orderIter = _order.begin();
+}
+
+void HdAuroraImageLRUPolicy::addReference(const Aurora::Path& path)
+{
+    auto iter = _images.find(path);
+    if (iter == _images.end())
+        return;
+
+    iter->second.referenceCount++;
+    touch(iter->second);
+}
+
+void HdAuroraImageLRUPolicy::removeReference(const Aurora::Path& path)
+{
+    auto iter = _images.find(path);
+    if (iter == _images.end() || iter->second.referenceCount == 0)
+    {
+        AU_ERROR("Image %s released more times than it was acquired", path.c_str());
+        return;
+    }
+
+    iter->second.referenceCount--;
+    touch(iter->second);
+}
+
+bool HdAuroraImageLRUPolicy::isEvicted(const Aurora::Path& path) const
+{
+    auto iter = _images.find(path);
+    return iter != _images.end() && iter->second.isEvicted;
+}
+
+size_t HdAuroraImageLRUPolicy::referenceCount(const Aurora::Path& path) const
+{
+    auto iter = _images.find(path);
+    return iter == _images.end() ? 0 : iter->second.referenceCount;
+}
+
+void HdAuroraImageLRUPolicy::setImageSize(const Aurora::Path& path, size_t sizeBytes)
+{
+    auto iter = _images.find(path);
+    if (iter == _images.end())
+        return;
+
+    _totalSizeBytes = _totalSizeBytes - iter->second.sizeBytes + sizeBytes;
+    if (iter->second.isEvicted)
+        _evictedSizeBytes = _evictedSizeBytes - iter->second.sizeBytes + sizeBytes;
+    iter->second.sizeBytes = sizeBytes;
+}
+
+vector<Aurora::Path> HdAuroraImageLRUPolicy::evict()
+{
+    vector<Aurora::Path> evicted;
+    if (_budgetBytes == 0)
+        return evicted;
+
+    // Walk from the least recently used image, skipping images that are still referenced or
+    // already evicted.
+    auto orderIter = _order.end();
+    while (_totalSizeBytes - _evictedSizeBytes > _budgetBytes && orderIter != _order.begin())
+    {
+        orderIter--;
+        Entry& entry = _images[*orderIter];
+        if (entry.referenceCount > 0 || entry.isEvicted)
+            continue;
+
+        entry.isEvicted = true;
+        _evictedSizeBytes += entry.sizeBytes;
+        evicted.push_back(*orderIter);
+    }
+
+    return evicted;
+}
+
+void HdAuroraImageLRUPolicy::remove(const Aurora::Path& path)
+{
+    auto iter = _images.find(path);
+    if (iter == _images.end() || !iter->second.isEvicted)
+        return;
+
+    _totalSizeBytes -= iter->second.sizeBytes;
+    _evictedSizeBytes -= iter->second.sizeBytes;
+    _order.erase(iter->second.orderIter);
+    _images.erase(iter);
+}
+
+void HdAuroraImageLRUPolicy::restore(const Aurora::Path& path)
+{
+    auto iter = _images.find(path);
+    if (iter == _images.end() || !iter->second.isEvicted)
+        return;
+
+    iter->second.isEvicted = false;
+    _evictedSizeBytes -= iter->second.sizeBytes;
+}
+
+void HdAuroraImageLRUPolicy::touch(Entry& entry)
+{
+    _order.splice(_order.begin(), _order, entry.orderIter);
+}
+
 // Flag to set the flip-y flag on loaded images.
 void HdAuroraImageCache::setIsYFlipped(bool val)
 {
@@ -22,7 +129,7 @@ void HdAuroraImageCache::setIsYFlipped(bool val)
 }
 
 Aurora::Path HdAuroraImageCache::acquireImage(
-    const string& sFilePath, bool isEnvironmentImage, bool forceLinear)
+    const string& sFilePath, bool isEnvironmentImage, bool forceLinear, Aurora::ImageUsage usage)
 {
     // Calculate an Aurora image path from file path (should be different for environment images.)
     Aurora::Path auroraImagePath =
@@ -30,11 +137,18 @@ Aurora::Path HdAuroraImageCache::acquireImage(
     if (forceLinear)
         auroraImagePath += "-linear";
 
-    auto iter = _cache.find(auroraImagePath);
-    if (iter != _cache.end())
+    // If the image is already in the cache, just add a reference to it.
+    if (_policy.contains(auroraImagePath) && !_policy.isEvicted(auroraImagePath))
+    {
+        _policy.addReference(auroraImagePath);
         return auroraImagePath;
+    }
 
-    _cache.insert(auroraImagePath);
+    // Add the image, or restore it if it was evicted. The descriptor of an evicted image is set
+    // again below, as it may have been removed from the scene, and this cancels a pending removal.
+    _policy.addImage(auroraImagePath);
+    _policy.restore(auroraImagePath);
+    _policy.addReference(auroraImagePath);
 
     Aurora::ImageDescriptor descriptor;
     descriptor.getData = [this, auroraImagePath, sFilePath, forceLinear](
@@ -94,6 +208,9 @@ Aurora::Path HdAuroraImageCache::acquireImage(
         // Set output data point to the pixel buffer.
         dataOut.pPixelBuffer = pPixelData;
 
+        // Record the size of the image, which counts towards the cache budget.
+        _policy.setImageSize(auroraImagePath, dataOut.bufferSize);
+
         // Set output image dimensions.
         dataOut.dimensions = { image->GetWidth(), image->GetHeight() };
 
@@ -147,8 +264,41 @@ Aurora::Path HdAuroraImageCache::acquireImage(
     };
     descriptor.isEnvironment = isEnvironmentImage;
     descriptor.linearize     = forceLinear;
+    descriptor.usage         = usage;
 
     _pAuroraScene->setImageDescriptor(auroraImagePath, descriptor);
 
     return auroraImagePath;
 }
+
+void HdAuroraImageCache::releaseImage(const Aurora::Path& auroraImagePath)
+{
+    if (auroraImagePath.empty())
+        return;
+
+    _policy.removeReference(auroraImagePath);
+}
+
+void HdAuroraImageCache::evictUnusedImages()
+{
+    // Drop the images evicted by the previous call that the scene has removed since. The scene
+    // does not remove images that are still used by a resource, so those are restored.
+    for (const Aurora::Path& path : _evictedImages)
+    {
+        if (!_policy.isEvicted(path))
+            continue;
+
+        if (_pAuroraScene->getResourceType(path) == Aurora::ResourceType::Invalid)
+            _policy.remove(path);
+        else
+            _policy.restore(path);
+    }
+
+    // Remove the evicted images from the scene. The scene removes them on the next update, as long
+    // as no resource uses them by then.
+    _evictedImages = _policy.evict();
+    for (const Aurora::Path& path : _evictedImages)
+    {
+        _pAuroraScene->removeImage(path);
+    }
+}
@@ -14,7 +14,89 @@
 
 #pragma once
 
+#include <list>
+#include <map>
+
+// Least recently used (LRU) eviction policy for the image cache. This counts the references to
+// each image and records its size, and chooses the unreferenced images to release when the total
+// size of the images exceeds a budget. It does not use the Aurora scene, so it can be tested with
+// synthetic images.
+class HdAuroraImageLRUPolicy
+{
+public:
+    // Adds an image with no references and an unknown (zero) size, as the most recently used
+    // image. Does nothing if the image has already been added.
+    void addImage(const Aurora::Path& path);
+
+    // Gets whether the image has been added, and not removed since. This includes evicted images
+    // that have not been removed yet.
+    bool contains(const Aurora::Path& path) const { return _images.count(path) > 0; }
+
+    // Gets whether the image has been evicted, and not removed or restored since.
+    bool isEvicted(const Aurora::Path& path) const;
+
+    // Adds a reference to an image, which prevents it from being evicted, and marks it as the most
+    // recently used image.
+    void addReference(const Aurora::Path& path);
+
+    // Removes a reference to an image. The image is marked as the most recently used image, so
+    // images that were released recently are evicted last.
+    void removeReference(const Aurora::Path& path);
+
+    // Gets the number of references to an image, or zero if it has not been added.
+    size_t referenceCount(const Aurora::Path& path) const;
+
+    // Sets the size of an image in bytes, once it is known, i.e. when the image is loaded.
+    void setImageSize(const Aurora::Path& path, size_t sizeBytes);
+
+    // Sets the budget for the total size of the images in bytes, or zero for no limit.
+    void setBudget(size_t budgetBytes) { _budgetBytes = budgetBytes; }
+
+    // Gets the budget for the total size of the images in bytes.
+    size_t budget() const { return _budgetBytes; }
+
+    // Gets the total size of the images in bytes, including evicted images that have not been
+    // removed yet.
+    size_t totalSize() const { return _totalSizeBytes; }
+
+    // Evicts the least recently used images without references until the total size of the images
+    // that are not evicted is within the budget, or there are no more unreferenced images. Returns
+    // the paths of the evicted images, which must be released by the caller. The evicted images
+    // are kept until they are removed or restored.
+    vector<Aurora::Path> evict();
+
+    // Removes an evicted image, once it has been released. Does nothing if the image is not
+    // evicted.
+    void remove(const Aurora::Path& path);
+
+    // Restores an evicted image, e.g. if it could not be released as it was still in use. The
+    // image keeps its place in the order, so it is the first to be evicted again.
+    void restore(const Aurora::Path& path);
+
+private:
+    struct Entry
+    {
+        size_t referenceCount = 0;
+        size_t sizeBytes      = 0;
+        bool isEvicted        = false;
+        list<Aurora::Path>::iterator orderIter;
+    };
+
+    // Moves an image to the front of the order, as the most recently used image.
+    void touch(Entry& entry);
+
+    map<Aurora::Path, Entry> _images;
+    list<Aurora::Path> _order; // From most to least recently used.
+    size_t _totalSizeBytes   = 0;
+    size_t _evictedSizeBytes = 0;
+    size_t _budgetBytes      = 0;
+};
+
 // Image cache used by materials and environments to load Aurora images.
+//
+// The images are reference counted: each call to acquireImage() must be matched by a call to
+// releaseImage() when the image is no longer used. If a budget is set, the least recently used
+// images that are no longer used are removed from the Aurora scene by evictUnusedImages().
 class HdAuroraImageCache
 {
 public:
@@ -24,13 +106,28 @@ public:
     // Set the flag to indicate the Y axis should be flipped on loaded images.
     void setIsYFlipped(bool val);
 
-    // Acquire an image from the cache, loading if necessary.
+    // Acquire an image from the cache, loading if necessary. The usage determines the compressed
+    // format of the image, if texture compression is enabled, and is only used when the image is
+    // first acquired.
     // Returns the Aurora path for the image (will be different for environment images.)
-    Aurora::Path acquireImage(
-        const string& sFilePath, bool isEnvironmentImage = false, bool linearize = false);
+    Aurora::Path acquireImage(const string& sFilePath, bool isEnvironmentImage = false,
+        bool linearize = false, Aurora::ImageUsage usage = Aurora::ImageUsage::Unknown);
+
+    // Release an image acquired with acquireImage(), using the Aurora path it returned. Does
+    // nothing if the path is empty.
+    void releaseImage(const Aurora::Path& auroraImagePath);
+
+    // Set the budget for the total size of the images in bytes, or zero for no limit.
+    void setBudget(size_t budgetBytes) { _policy.setBudget(budgetBytes); }
+
+    // Remove the least recently used images that are no longer used from the Aurora scene, until
+    // the total size of the images is within the budget. The images removed by the previous call
+    // are only dropped from the cache if the scene has removed them since.
+    void evictUnusedImages();
 
 private:
-    set<Aurora::Path> _cache;
+    HdAuroraImageLRUPolicy _policy;
+    vector<Aurora::Path> _evictedImages;
     Aurora::IScenePtr _pAuroraScene;
     bool _isYFlipped = true;
 };
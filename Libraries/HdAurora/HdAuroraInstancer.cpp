@@ -32,6 +32,8 @@ HdAuroraInstancer::~HdAuroraInstancer()
 void HdAuroraInstancer::Sync(
     HdSceneDelegate* delegate, HdRenderParam* /*renderParam*/, HdDirtyBits* dirtyBits)
 {
+    AU_PROFILE_TO(Aurora::profiler(), "HdAuroraInstancer::Sync");
+
     _UpdateInstancer(delegate, dirtyBits);
 
     if (HdChangeTracker::IsAnyPrimvarDirty(*dirtyBits, GetId()))
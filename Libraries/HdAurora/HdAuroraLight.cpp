@@ -33,6 +33,7 @@ HdAuroraDomeLight::HdAuroraDomeLight(
 HdAuroraDomeLight::~HdAuroraDomeLight()
 {
     _owner->setAuroraEnvironmentLightImagePath("");
+    _owner->imageCache().releaseImage(_auroraImagePath);
 }
 
 HdDirtyBits HdAuroraDomeLight::GetInitialDirtyBitsMask() const
@@ -56,7 +57,8 @@ void HdAuroraDomeLight::Sync(
         // don't want the prior environment image visible through temporal accumulation.
         _environmentImageFilePath = envFilePath;
 
-        // Attempt to load the environment image, if any.
+        // Release the previous environment image, and attempt to load the new one, if any.
+        _owner->imageCache().releaseImage(_auroraImagePath);
         if (!_environmentImageFilePath.empty())
         {
             _auroraImagePath = _owner->imageCache().acquireImage(_environmentImageFilePath, true);
@@ -172,3 +174,170 @@ void HdAuroraDistantLight::Sync(
 
     *dirtyBits = Clean;
 }
+
+// Gets the intensity of a light from Hydra, with the exposure applied.
+static float getLightIntensity(HdSceneDelegate* delegate, const SdfPath& id)
+{
+    VtValue intensityVal = delegate->GetLightParamValue(id, HdLightTokens->intensity);
+    VtValue exposureVal  = delegate->GetLightParamValue(id, HdLightTokens->exposure);
+    float intensity      = intensityVal.GetWithDefault<float>(1.0f);
+    float exposure       = exposureVal.GetWithDefault<float>(0.0f);
+
+    return intensity * powf(2.0f, GfClamp(exposure, -50.0f, 50.0f));
+}
+
+HdAuroraSphereLight::HdAuroraSphereLight(
+    SdfPath const& rprimId, HdAuroraRenderDelegate* renderDelegate) :
+    HdLight(rprimId), _owner(renderDelegate)
+{
+    // Create a point light with zero intensity, which is replaced with a spot light in Sync() if
+    // the light is shaped with a cone.
+    _pLight = _owner->GetScene()->addLightPointer(Aurora::Names::LightTypes::kPointLight);
+    _pLight->values().setFloat(Aurora::Names::LightProperties::kIntensity, 0.0f);
+}
+
+HdAuroraSphereLight::~HdAuroraSphereLight()
+{
+    // Ensure sampler counter is reset.
+    _owner->SetSampleRestartNeeded(true);
+}
+
+HdDirtyBits HdAuroraSphereLight::GetInitialDirtyBitsMask() const
+{
+    return HdLight::DirtyParams | HdLight::DirtyTransform;
+}
+
+void HdAuroraSphereLight::Sync(
+    HdSceneDelegate* delegate, HdRenderParam* /* renderParam */, HdDirtyBits* dirtyBits)
+{
+    const auto& id = GetId();
+
+    // Ensure sampler counter is reset.
+    _owner->SetSampleRestartNeeded(true);
+
+    // A sphere light shaped with a cone is a spot light. Replace the Aurora light if the type has
+    // changed, as the type of an Aurora light is fixed when it is created.
+    VtValue coneAngleVal   = delegate->GetLightParamValue(id, HdLightTokens->shapingConeAngle);
+    float coneAngleDegrees = coneAngleVal.GetWithDefault<float>(180.0f);
+    bool isSpotLight       = coneAngleDegrees < 180.0f;
+    if (isSpotLight != _isSpotLight)
+    {
+        _pLight = _owner->GetScene()->addLightPointer(isSpotLight
+                ? Aurora::Names::LightTypes::kSpotLight
+                : Aurora::Names::LightTypes::kPointLight);
+        _isSpotLight = isSpotLight;
+    }
+
+    // Compute the light position and radius from the transform matrix, and the direction of a
+    // spot light from the -Z axis.
+    GfMatrix4f transformMatrix(delegate->GetTransform(id));
+    GfVec3f position        = transformMatrix.ExtractTranslation();
+    GfVec3f xAxis           = transformMatrix.GetRow3(0);
+    GfVec3f lightDirection  = -transformMatrix.GetRow3(2);
+    VtValue radiusVal       = delegate->GetLightParamValue(id, HdLightTokens->radius);
+    VtValue treatAsPointVal = delegate->GetLightParamValue(id, HdLightTokens->treatAsPoint);
+    float radius            = radiusVal.GetWithDefault<float>(0.5f) * xAxis.GetLength();
+    if (treatAsPointVal.GetWithDefault<bool>(false))
+    {
+        radius = 0.0f;
+    }
+
+    // Convert the radiance emitted by the surface of the sphere to the radiant intensity used by
+    // Aurora, unless the intensity is normalized to be independent of the size of the light.
+    float intensity      = getLightIntensity(delegate, id);
+    VtValue normalizeVal = delegate->GetLightParamValue(id, HdLightTokens->normalize);
+    if (!normalizeVal.GetWithDefault<bool>(false) && radius > 0.0f)
+    {
+        intensity *= static_cast<float>(M_PI) * radius * radius;
+    }
+
+    // Get the light color from Hydra.
+    GfVec3f lightColor =
+        delegate->GetLightParamValue(id, HdLightTokens->color).GetWithDefault<GfVec3f>(
+            GfVec3f(1.0f));
+
+    // Set the light properties in Aurora.
+    _pLight->values().setFloat(Aurora::Names::LightProperties::kIntensity, intensity);
+    _pLight->values().setFloat3(Aurora::Names::LightProperties::kColor, lightColor.data());
+    _pLight->values().setFloat3(Aurora::Names::LightProperties::kPosition, position.data());
+    _pLight->values().setFloat(Aurora::Names::LightProperties::kRadius, radius);
+    if (isSpotLight)
+    {
+        VtValue softnessVal = delegate->GetLightParamValue(id, HdLightTokens->shapingConeSoftness);
+        _pLight->values().setFloat3(
+            Aurora::Names::LightProperties::kDirection, lightDirection.data());
+        _pLight->values().setFloat(
+            Aurora::Names::LightProperties::kConeAngle, glm::radians(coneAngleDegrees));
+        _pLight->values().setFloat(Aurora::Names::LightProperties::kConeSoftness,
+            softnessVal.GetWithDefault<float>(0.0f));
+    }
+
+    *dirtyBits = Clean;
+}
+
+HdAuroraRectLight::HdAuroraRectLight(
+    SdfPath const& rprimId, HdAuroraRenderDelegate* renderDelegate) :
+    HdLight(rprimId), _owner(renderDelegate)
+{
+    // Create a light with zero intensity, the properties are set in Sync().
+    _pRectLight = _owner->GetScene()->addLightPointer(Aurora::Names::LightTypes::kRectLight);
+    _pRectLight->values().setFloat(Aurora::Names::LightProperties::kIntensity, 0.0f);
+}
+
+HdAuroraRectLight::~HdAuroraRectLight()
+{
+    // Ensure sampler counter is reset.
+    _owner->SetSampleRestartNeeded(true);
+}
+
+HdDirtyBits HdAuroraRectLight::GetInitialDirtyBitsMask() const
+{
+    return HdLight::DirtyParams | HdLight::DirtyTransform;
+}
+
+void HdAuroraRectLight::Sync(
+    HdSceneDelegate* delegate, HdRenderParam* /* renderParam */, HdDirtyBits* dirtyBits)
+{
+    const auto& id = GetId();
+
+    // Ensure sampler counter is reset.
+    _owner->SetSampleRestartNeeded(true);
+
+    // Compute the light position, orientation, and size from the transform matrix. The light is
+    // in the XY plane, and emits along the -Z axis.
+    GfMatrix4f transformMatrix(delegate->GetTransform(id));
+    GfVec3f position       = transformMatrix.ExtractTranslation();
+    GfVec3f xAxis          = transformMatrix.GetRow3(0);
+    GfVec3f yAxis          = transformMatrix.GetRow3(1);
+    GfVec3f lightDirection = -transformMatrix.GetRow3(2);
+    VtValue widthVal       = delegate->GetLightParamValue(id, HdLightTokens->width);
+    VtValue heightVal      = delegate->GetLightParamValue(id, HdLightTokens->height);
+    float width            = widthVal.GetWithDefault<float>(1.0f) * xAxis.GetLength();
+    float height           = heightVal.GetWithDefault<float>(1.0f) * yAxis.GetLength();
+
+    // Normalize the intensity by the area of the light, if required, so the power of the light is
+    // independent of its size.
+    float intensity      = getLightIntensity(delegate, id);
+    VtValue normalizeVal = delegate->GetLightParamValue(id, HdLightTokens->normalize);
+    if (normalizeVal.GetWithDefault<bool>(false) && width * height > 0.0f)
+    {
+        intensity /= width * height;
+    }
+
+    // Get the light color from Hydra.
+    GfVec3f lightColor =
+        delegate->GetLightParamValue(id, HdLightTokens->color).GetWithDefault<GfVec3f>(
+            GfVec3f(1.0f));
+
+    // Set the light properties in Aurora.
+    _pRectLight->values().setFloat(Aurora::Names::LightProperties::kIntensity, intensity);
+    _pRectLight->values().setFloat3(Aurora::Names::LightProperties::kColor, lightColor.data());
+    _pRectLight->values().setFloat3(Aurora::Names::LightProperties::kPosition, position.data());
+    _pRectLight->values().setFloat3(
+        Aurora::Names::LightProperties::kDirection, lightDirection.data());
+    _pRectLight->values().setFloat3(Aurora::Names::LightProperties::kTangent, xAxis.data());
+    _pRectLight->values().setFloat(Aurora::Names::LightProperties::kWidth, width);
+    _pRectLight->values().setFloat(Aurora::Names::LightProperties::kHeight, height);
+
+    *dirtyBits = Clean;
+}
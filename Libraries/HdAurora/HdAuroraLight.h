@@ -49,3 +49,36 @@ private:
     HdAuroraRenderDelegate* _owner;
     Aurora::ILightPtr _pDistantLight;
 };
+
+// A sphere light, which is rendered as a point light, or as a spot light if it is shaped with a
+// cone.
+class HdAuroraSphereLight : public HdLight
+{
+public:
+    HdAuroraSphereLight(SdfPath const& sprimId, HdAuroraRenderDelegate* renderDelegate);
+    ~HdAuroraSphereLight() override;
+
+    HdDirtyBits GetInitialDirtyBitsMask() const override;
+    void Sync(
+        HdSceneDelegate* delegate, HdRenderParam* renderParam, HdDirtyBits* dirtyBits) override;
+
+private:
+    HdAuroraRenderDelegate* _owner;
+    Aurora::ILightPtr _pLight;
+    bool _isSpotLight = false;
+};
+
+class HdAuroraRectLight : public HdLight
+{
+public:
+    HdAuroraRectLight(SdfPath const& sprimId, HdAuroraRenderDelegate* renderDelegate);
+    ~HdAuroraRectLight() override;
+
+    HdDirtyBits GetInitialDirtyBitsMask() const override;
+    void Sync(
+        HdSceneDelegate* delegate, HdRenderParam* renderParam, HdDirtyBits* dirtyBits) override;
+
+private:
+    HdAuroraRenderDelegate* _owner;
+    Aurora::ILightPtr _pRectLight;
+};
@@ -58,6 +58,22 @@ struct ProcessedMaterialNetwork
 };
 
 // Properties require a value to be added to a Uniform block.
+// Gets how an Aurora image property is used by the material, which determines the compressed
+// format of the image if texture compression is enabled. Opacity is read as a color.
+static Aurora::ImageUsage imageUsage(const string& imagePropertyName)
+{
+    if (imagePropertyName == "normal_image")
+    {
+        return Aurora::ImageUsage::Normal;
+    }
+    if (imagePropertyName == "specular_roughness_image")
+    {
+        return Aurora::ImageUsage::Scalar;
+    }
+
+    return Aurora::ImageUsage::Color;
+}
+
 static const string paramBindingTemplate = R"(
       <input name="%s" type="%s" value="%s" />)";
 
@@ -105,7 +121,10 @@ HdAuroraMaterial::HdAuroraMaterial(SdfPath const& rprimId, HdAuroraRenderDelegat
 {
 }
 
-HdAuroraMaterial::~HdAuroraMaterial() {}
+HdAuroraMaterial::~HdAuroraMaterial()
+{
+    ReleaseImages(_imagePaths);
+}
 
 HdDirtyBits HdAuroraMaterial::GetInitialDirtyBitsMask() const
 {
@@ -322,12 +341,36 @@ bool HdAuroraMaterial::SetupAuroraMaterial(
     return true;
 }
 
+Aurora::Path HdAuroraMaterial::AcquireImage(
+    const string& filePath, bool forceLinear, Aurora::ImageUsage usage)
+{
+    Aurora::Path auroraImagePath =
+        _owner->imageCache().acquireImage(filePath, false, forceLinear, usage);
+    _imagePaths.push_back(auroraImagePath);
+
+    return auroraImagePath;
+}
+
+void HdAuroraMaterial::ReleaseImages(vector<Aurora::Path>& imagePaths)
+{
+    for (const Aurora::Path& imagePath : imagePaths)
+    {
+        _owner->imageCache().releaseImage(imagePath);
+    }
+    imagePaths.clear();
+}
+
 void HdAuroraMaterial::ProcessHDMaterial(HdSceneDelegate* delegate)
 {
     const auto& id   = GetId();
     VtValue hdMatVal = delegate->GetMaterialResource(id);
     auto pRenderer   = _owner->GetRenderer();
 
+    // Keep the images used by the material until it has been processed again, so that images it
+    // still uses are not released in between.
+    vector<Aurora::Path> previousImagePaths;
+    previousImagePaths.swap(_imagePaths);
+
     string hdMaterialXType;
     string hdMaterialXDocument;
     if (GetHDMaterialXDocument(delegate, hdMaterialXType, hdMaterialXDocument))
@@ -380,7 +423,7 @@ void HdAuroraMaterial::ProcessHDMaterial(HdSceneDelegate* delegate)
             if (texFilename.size() > 0)
             {
                 Aurora::Path auroraImagePath =
-                    _owner->imageCache().acquireImage(texFilename, false, forceLinear);
+                    AcquireImage(texFilename, forceLinear, imageUsage(inputName.second));
 
                 materialProperties[inputName.second] = auroraImagePath;
             }
@@ -422,6 +465,8 @@ void HdAuroraMaterial::ProcessHDMaterial(HdSceneDelegate* delegate)
 
         _owner->GetScene()->setMaterialProperties(_auroraMaterialPath, materialProperties);
     }
+
+    ReleaseImages(previousImagePaths);
 }
 
 bool HdAuroraMaterial::GetHDMaterialXDocument(
@@ -470,6 +515,7 @@ bool HdAuroraMaterial::GetHDMaterialXDocument(
 void HdAuroraMaterial::Sync(
     HdSceneDelegate* delegate, HdRenderParam* /* renderParam */, HdDirtyBits* dirtyBits)
 {
+    AU_PROFILE_TO(Aurora::profiler(), "HdAuroraMaterial::Sync");
 
     if (_auroraMaterialPath.empty() || (*dirtyBits & HdMaterial::DirtyResource) ||
         (*dirtyBits & HdMaterial::DirtyParams))
@@ -805,7 +851,7 @@ bool HdAuroraMaterial::ApplyHDNetwork(const ProcessedMaterialNetwork& network)
                         {
                             bool forceLinear = parameterInfo.auroraName.compare("normal") == 0;
                             materialProperties[paramName] =
-                                _owner->imageCache().acquireImage(filename, false, forceLinear);
+                                AcquireImage(filename, forceLinear, imageUsage(paramName));
                         }
                     }
                 }
@@ -72,6 +72,11 @@ private:
     // Create a new aurora material with this material type and document, if required.
     // Does nothing if current material type and document match the ones provided.
     bool SetupAuroraMaterial(const string& materialType, const string& materialDocument);
+    // Acquire an image from the image cache for this material, recording it so that it is released
+    // when the material no longer uses it.
+    Aurora::Path AcquireImage(const string& filePath, bool forceLinear, Aurora::ImageUsage usage);
+    // Release the images acquired by this material, e.g. before the material is processed again.
+    void ReleaseImages(vector<Aurora::Path>& imagePaths);
 
     Aurora::Path _auroraMaterialPath;
     HdAuroraRenderDelegate* _owner;
@@ -82,6 +87,9 @@ private:
     // large documents).
     size_t _auroraMaterialDocumentHash = 0;
 
+    // The Aurora paths of the images acquired by the material from the image cache.
+    vector<Aurora::Path> _imagePaths;
+
     const set<string> _supportedimages = {
         "base_color_image",
         "opacity_image",
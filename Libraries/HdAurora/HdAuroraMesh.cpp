@@ -20,6 +20,7 @@
 #include "HdAuroraMesh.h"
 #include "HdAuroraRenderDelegate.h"
 #include "HdAuroraRenderPass.h"
+#include "HdAuroraSyncScheduler.h"
 #include "HdAuroraTokens.h"
 
 // If true extra validation done on the HDMesh geometry upon loading.
@@ -42,10 +43,31 @@ struct HdAuroraMeshVertexData
     VtVec3fArray flattenedNormals;
     VtVec3fArray flattenedTangents;
     VtVec2fArray flattenedUVs;
+    VtValue stValue;
     const VtArray<GfVec2f>* st;
     bool hasTexCoords;
 };
 
+// The Aurora scene updates for a mesh requested by Sync(), which are applied when the sync
+// scheduler runs them. A rebuild supersedes the other updates, as it uses the current instance
+// data and material of the mesh.
+struct HdAuroraMeshSceneUpdate
+{
+    bool clearInstances   = false;
+    bool updateTransforms = false;
+    bool updateMaterial   = false;
+    bool rebuild          = false;
+
+    // The geometry for a rebuild, including any geometry layers.
+    Aurora::GeometryDescriptor geometryDesc;
+    vector<pair<Aurora::Path, Aurora::GeometryDescriptor>> layerGeometry;
+    vector<Aurora::Path> materialLayerPaths;
+    vector<Aurora::Path> geometryLayerPaths;
+
+    // The points used to update the scene bounds with new transforms.
+    VtVec3fArray points;
+};
+
 bool HdAuroraMesh::validateIndices(const VtVec3iArray& indices, int maxAttrCount)
 {
     uint32_t maxVert = static_cast<uint32_t>(maxAttrCount);
@@ -71,6 +93,7 @@ HdAuroraMesh::HdAuroraMesh(SdfPath const& rprimId, HdAuroraRenderDelegate* rende
 
 HdAuroraMesh::~HdAuroraMesh()
 {
+    _owner->syncScheduler().cancel(GetId().GetString());
     _owner->SetSampleRestartNeeded(true);
     ClearAuroraInstances();
 }
@@ -96,10 +119,11 @@ void HdAuroraMesh::RebuildAuroraInstances(HdSceneDelegate* delegate)
     {
         if (_instanceData.size())
         {
-            // Lock the renderer mutex before accessing Aurora renderer.
-            std::lock_guard<std::mutex> rendererLock(_owner->rendererMutex());
-            // Remove any existing instances.
-            ClearAuroraInstances();
+            // Remove any existing instances, replacing any pending updates.
+            HdAuroraMeshSceneUpdate& update = GetSceneUpdate();
+            update                          = HdAuroraMeshSceneUpdate();
+            update.clearInstances           = true;
+            ScheduleSceneUpdate();
         }
 
         return;
@@ -138,7 +162,9 @@ void HdAuroraMesh::RebuildAuroraInstances(HdSceneDelegate* delegate)
     bool hasFaceVaryings       = false;
 
     // If we don't have per-vertex UVs look for STs in primvars
-    VtValue stVal;
+    // NOTE: The value is kept with the vertex data, as the STs are read when the geometry is added
+    // to the scene, which may be after this function returns.
+    VtValue& stVal = _pVertexData->stValue;
     if (_pVertexData->uvs.size() != _pVertexData->points.size())
     {
         if (readSTs(&stVal, delegate, meshUtil))
@@ -467,108 +493,148 @@ void HdAuroraMesh::RebuildAuroraInstances(HdSceneDelegate* delegate)
     geomDesc.attributeUpdateComplete = [this](const Aurora::AttributeDataMap&, size_t, size_t,
                                            size_t, size_t) { _pVertexData.reset(); };
 
-    // Actually create the instances in the renderer.
+    // Process material layers, and create a descriptor for the geometry of each layer.
+    auto materialLayersVal = delegate->Get(GetId(), HdAuroraTokens::kMeshMaterialLayers);
+    HdAuroraMeshSceneUpdate rebuild;
+    rebuild.rebuild = true;
+    if (!materialLayersVal.IsEmpty())
     {
-        // Lock the renderer mutex before accessing Aurora renderer.
-        std::lock_guard<std::mutex> rendererLock(_owner->rendererMutex());
-
-        // Process material layers.
-        // TODO: Some of this can be done outside mutex lock.
-        auto materialLayersVal = delegate->Get(GetId(), HdAuroraTokens::kMeshMaterialLayers);
-        vector<Aurora::Path> materialLayerPaths;
-        vector<Aurora::Path> geometryLayerPaths;
-        if (!materialLayersVal.IsEmpty())
+        auto geometryLayerUVsVal = delegate->Get(GetId(), HdAuroraTokens::kMeshGeometryLayerUVs);
+        // Get the Hydra ID for material layer.
+        auto layerArray = materialLayersVal.Get<pxr::SdfPathVector>();
+        _layerUVData    = vector<VtVec2fArray>(layerArray.size());
+        for (size_t layerIdx = 0; layerIdx < layerArray.size(); layerIdx++)
         {
-            auto geometryLayerUVsVal = delegate->Get(GetId(), HdAuroraTokens::kMeshGeometryLayerUVs);
-            // Get the Hydra ID for material layer.
-            auto layerArray = materialLayersVal.Get<pxr::SdfPathVector>();
-            _layerUVData    = vector<VtVec2fArray>(layerArray.size());
-            for (size_t layerIdx = 0; layerIdx < layerArray.size(); layerIdx++)
-            {
-                // Convert Hydra material ID to Aurora path,
-                auto& auroraMtlPath = HdAuroraMaterial::GetAuroraMaterialPath(layerArray[layerIdx]);
-                // Add path to vector.
-                materialLayerPaths.push_back(auroraMtlPath);
+            // Convert Hydra material ID to Aurora path,
+            auto& auroraMtlPath = HdAuroraMaterial::GetAuroraMaterialPath(layerArray[layerIdx]);
+            // Add path to vector.
+            rebuild.materialLayerPaths.push_back(auroraMtlPath);
 
-                // Get the geometry layer UVs.
-                Aurora::Path geomLayerPath = "";
+            // Get the geometry layer UVs.
+            Aurora::Path geomLayerPath = "";
 
-                // Value passed to Hydra is primvar name.
-                auto uvPrimVarArray = geometryLayerUVsVal.Get<pxr::VtTokenArray>();
-                if (uvPrimVarArray.size() > layerIdx)
-                {
-                    // UV primvar name.
-                    pxr::TfToken primvarName = uvPrimVarArray[layerIdx];
+            // Value passed to Hydra is primvar name.
+            auto uvPrimVarArray = geometryLayerUVsVal.Get<pxr::VtTokenArray>();
+            if (uvPrimVarArray.size() > layerIdx)
+            {
+                // UV primvar name.
+                pxr::TfToken primvarName = uvPrimVarArray[layerIdx];
 
-                    // Get the primvar given by name.
-                    auto layerUVsVal = delegate->Get(id, primvarName);
+                // Get the primvar given by name.
+                auto layerUVsVal = delegate->Get(id, primvarName);
 
-                    if (layerUVsVal.IsEmpty())
+                if (layerUVsVal.IsEmpty())
+                {
+                    AU_ERROR("Invalid layer UV%d primvar %s: Primvar not found.", layerIdx,
+                        primvarName.GetString().c_str());
+                }
+                else
+                {
+                    auto layerUVs = layerUVsVal.Get<VtVec2fArray>();
+                    // Create an Aurora geometry object for layer UVs, if any.
+                    if (layerUVs.size() != geomDesc.vertexDesc.count)
                     {
-                        AU_ERROR("Invalid layer UV%d primvar %s: Primvar not found.", layerIdx,
-                            primvarName.GetString().c_str());
+                        AU_ERROR("Invalid layer UV%d primvar %s: Array length %d does not match "
+                                 "base mesh vertex count of %d",
+                            layerIdx, primvarName.GetString().c_str(), layerUVs.size(),
+                            geomDesc.vertexDesc.count);
                     }
                     else
                     {
-                        auto layerUVs = layerUVsVal.Get<VtVec2fArray>();
-                        // Create an Aurora geometry object for layer UVs, if any.
-                        if (layerUVs.size() != geomDesc.vertexDesc.count)
-                        {
-                            AU_ERROR(
-                                "Invalid layer UV%d primvar %s: Array length %d does not match "
-                                "base mesh vertex count of %d",
-                                layerIdx, primvarName.GetString().c_str(), layerUVs.size(),
-                                geomDesc.vertexDesc.count);
-                        }
-                        else
-                        {
-                            // Create path for layer geometry.
-                            geomLayerPath =
-                                GetId().GetAsString() + "/GeometryLayer" + to_string(layerIdx);
-                            _layerUVData[layerIdx] = layerUVs;
-
-                            // Create descriptor for layer.
-                            Aurora::GeometryDescriptor layerGeomDesc;
-
-                            // Geometry is incomplete, only containing UVs.
-                            layerGeomDesc.vertexDesc.attributes = {
-                                { Aurora::Names::VertexAttributes::kTexCoord0,
-                                    Aurora::AttributeFormat::Float2 },
+                        // Create path for layer geometry.
+                        geomLayerPath =
+                            GetId().GetAsString() + "/GeometryLayer" + to_string(layerIdx);
+                        _layerUVData[layerIdx] = layerUVs;
+
+                        // Create descriptor for layer.
+                        Aurora::GeometryDescriptor layerGeomDesc;
+
+                        // Geometry is incomplete, only containing UVs.
+                        layerGeomDesc.vertexDesc.attributes = {
+                            { Aurora::Names::VertexAttributes::kTexCoord0,
+                                Aurora::AttributeFormat::Float2 },
+                        };
+                        layerGeomDesc.indexCount       = 0ul; // No indices.
+                        layerGeomDesc.vertexDesc.count = layerUVs.size();
+
+                        // Setup vertex attribute callback to read vertex data.
+                        // This will be called when the geometry is added to scene via
+                        // instance.
+                        layerGeomDesc.getAttributeData =
+                            [this, layerIdx](Aurora::AttributeDataMap& dataOut,
+                                size_t /* firstVertex*/, size_t /* vertexCount*/,
+                                size_t /* firstIndex*/, size_t /* indexCount*/) {
+                                // Set the UVs for layer only.
+                                dataOut[Aurora::Names::VertexAttributes::kTexCoord0].address =
+                                    &(_layerUVData[layerIdx][0]);
+                                dataOut[Aurora::Names::VertexAttributes::kTexCoord0].stride =
+                                    sizeof(GfVec2f);
+
+                                return true;
                             };
-                            layerGeomDesc.indexCount       = 0ul; // No indices.
-                            layerGeomDesc.vertexDesc.count = layerUVs.size();
-
-                            // Setup vertex attribute callback to read vertex data.
-                            // This will be called when the geometry is added to scene via
-                            // instance.
-                            layerGeomDesc.getAttributeData =
-                                [this, layerIdx](Aurora::AttributeDataMap& dataOut,
-                                    size_t /* firstVertex*/, size_t /* vertexCount*/,
-                                    size_t /* firstIndex*/, size_t /* indexCount*/) {
-                                    // Set the UVs for layer only.
-                                    dataOut[Aurora::Names::VertexAttributes::kTexCoord0].address =
-                                        &(_layerUVData[layerIdx][0]);
-                                    dataOut[Aurora::Names::VertexAttributes::kTexCoord0].stride =
-                                        sizeof(GfVec2f);
-
-                                    return true;
-                                };
-
-                            // Setup completion callback to release data when UV data has been
-                            // read. This will be called when the render is done accessing
-                            // vertex attributes.
-                            layerGeomDesc.attributeUpdateComplete =
-                                [this, layerIdx](const Aurora::AttributeDataMap&, size_t, size_t,
-                                    size_t, size_t) { _layerUVData[layerIdx] = {}; };
-
-                            _owner->GetScene()->setGeometryDescriptor(geomLayerPath, layerGeomDesc);
-                        }
+
+                        // Setup completion callback to release data when UV data has been
+                        // read. This will be called when the render is done accessing
+                        // vertex attributes.
+                        layerGeomDesc.attributeUpdateComplete =
+                            [this, layerIdx](const Aurora::AttributeDataMap&, size_t, size_t,
+                                size_t, size_t) { _layerUVData[layerIdx] = {}; };
+
+                        rebuild.layerGeometry.push_back({ geomLayerPath, layerGeomDesc });
                     }
                 }
-
-                geometryLayerPaths.push_back(geomLayerPath);
             }
+
+            rebuild.geometryLayerPaths.push_back(geomLayerPath);
+        }
+    }
+
+    // Schedule the creation of the geometry and instances in the renderer, replacing any pending
+    // updates.
+    rebuild.geometryDesc = geomDesc;
+    GetSceneUpdate()     = std::move(rebuild);
+    ScheduleSceneUpdate();
+}
+
+HdAuroraMeshSceneUpdate& HdAuroraMesh::GetSceneUpdate()
+{
+    if (!_pSceneUpdate)
+        _pSceneUpdate = make_unique<HdAuroraMeshSceneUpdate>();
+
+    return *_pSceneUpdate;
+}
+
+void HdAuroraMesh::ScheduleSceneUpdate()
+{
+    // The scheduled update applies whatever updates are pending when it runs, so it is the same
+    // for every sync.
+    _owner->ScheduleSceneUpdate(GetId().GetString(), [this]() { ApplySceneUpdate(); });
+}
+
+void HdAuroraMesh::ApplySceneUpdate()
+{
+    unique_ptr<HdAuroraMeshSceneUpdate> pUpdate = std::move(_pSceneUpdate);
+    if (!pUpdate)
+        return;
+
+    // Lock the renderer mutex before accessing Aurora renderer.
+    std::lock_guard<std::mutex> rendererLock(_owner->rendererMutex());
+    _owner->SetSampleRestartNeeded(true);
+
+    if (pUpdate->clearInstances)
+    {
+        // Remove any existing instances.
+        ClearAuroraInstances();
+    }
+
+    if (pUpdate->rebuild)
+    {
+        // Set the geometry descriptors for the layers.
+        for (auto& layerGeometry : pUpdate->layerGeometry)
+        {
+            _owner->GetScene()->setGeometryDescriptor(layerGeometry.first, layerGeometry.second);
         }
+
         // Update bounds with this mesh.
         UpdateAuroraSceneBounds(_pVertexData->points);
 
@@ -584,17 +650,53 @@ void HdAuroraMesh::RebuildAuroraInstances(HdSceneDelegate* delegate)
             instData.properties[Aurora::Names::InstanceProperties::kObjectID] = GetPrimId();
             instData.properties[Aurora::Names::InstanceProperties::kMaterial] = _auroraMaterialPath;
             instData.properties[Aurora::Names::InstanceProperties::kMaterialLayers] =
-                materialLayerPaths;
+                pUpdate->materialLayerPaths;
             instData.properties[Aurora::Names::InstanceProperties::kGeometryLayers] =
-                geometryLayerPaths;
+                pUpdate->geometryLayerPaths;
         }
 
         // Set the geometry descriptor for the instances. Will create it if it doesn't exist.
-        Aurora::Path geomPath = id.GetString() + "_Geometry";
-        _owner->GetScene()->setGeometryDescriptor(geomPath, geomDesc);
+        Aurora::Path geomPath = GetId().GetString() + "_Geometry";
+        _owner->GetScene()->setGeometryDescriptor(geomPath, pUpdate->geometryDesc);
 
         // Create the instances (this will invoke attribute callbacks).
         _auroraInstances = _owner->GetScene()->addInstances(geomPath, _instanceData);
+
+        return;
+    }
+
+    if (pUpdate->updateTransforms)
+    {
+        // size down (if necessary).
+        if (_instanceData.size() < _auroraInstances.size())
+        {
+            Aurora::Paths staleInstances(
+                _auroraInstances.begin() + _instanceData.size(), _auroraInstances.end());
+            _owner->GetScene()->removeInstances(staleInstances);
+        }
+        _auroraInstances.resize(_instanceData.size());
+
+        // update transforms only (as other properties have not changed)
+        for (size_t i = 0; i < _instanceData.size(); ++i)
+        {
+            _owner->GetScene()->setInstanceProperties(_auroraInstances[i],
+                { { Aurora::Names::InstanceProperties::kTransform,
+                    _instanceData[i].properties.at(
+                        Aurora::Names::InstanceProperties::kTransform) } });
+        }
+
+        // Update bounds with this mesh.
+        UpdateAuroraSceneBounds(pUpdate->points);
+    }
+
+    if (pUpdate->updateMaterial)
+    {
+        // Update the aurora material paths.
+        UpdateAuroraMaterialPath();
+
+        // Set the material for all the instances.
+        _owner->GetScene()->setInstanceProperties(_auroraInstances,
+            { { Aurora::Names::InstanceProperties::kMaterial, _auroraMaterialPath } });
     }
 }
 
@@ -687,6 +789,8 @@ bool HdAuroraMesh::readSTs(VtValue* stOut, HdSceneDelegate* delegate, HdMeshUtil
 void HdAuroraMesh::Sync(HdSceneDelegate* delegate, HdRenderParam* /* renderParam */,
     HdDirtyBits* dirtyBits, TfToken const& /* reprToken */)
 {
+    AU_PROFILE_TO(Aurora::profiler(), "HdAuroraMesh::Sync");
+
     const auto& id = GetId();
     _owner->SetSampleRestartNeeded(true);
 
@@ -761,41 +865,26 @@ void HdAuroraMesh::Sync(HdSceneDelegate* delegate, HdRenderParam* /* renderParam
         }
         else if (instancesDirty)
         {
-            // Lock the renderer mutex before accessing Aurora renderer.
-            std::lock_guard<std::mutex> rendererLock(_owner->rendererMutex());
-
-            // size down (if necessary).
-            if (_instanceData.size() < _auroraInstances.size())
+            // Update the transforms, unless there is a pending rebuild, which uses the current
+            // instance data, or the instances are being removed.
+            HdAuroraMeshSceneUpdate& update = GetSceneUpdate();
+            if (!update.rebuild && !update.clearInstances)
             {
-                Aurora::Paths staleInstances(
-                    _auroraInstances.begin() + _instanceData.size(), _auroraInstances.end());
-                _owner->GetScene()->removeInstances(staleInstances);
+                update.updateTransforms = true;
+                update.points           = delegate->Get(id, HdTokens->points).Get<VtVec3fArray>();
+                ScheduleSceneUpdate();
             }
-            _auroraInstances.resize(_instanceData.size());
-
-            // update transforms only (as other properties have not changed)
-            for (size_t i = 0; i < _instanceData.size(); ++i)
-            {
-                _owner->GetScene()->setInstanceProperties(_auroraInstances[i],
-                    { { Aurora::Names::InstanceProperties::kTransform,
-                        _instanceData[i].properties.at(
-                            Aurora::Names::InstanceProperties::kTransform) } });
-            }
-
-            // Update bounds with this mesh.
-            UpdateAuroraSceneBounds(delegate->Get(id, HdTokens->points).Get<VtVec3fArray>());
         }
         else if (materialDirty || materialIDChanged)
         {
-            // Lock the renderer mutex before accessing Aurora renderer.
-            std::lock_guard<std::mutex> rendererLock(_owner->rendererMutex());
-
-            // Update the aurora material paths.
-            UpdateAuroraMaterialPath();
-
-            // Set the material for all the instances.
-            _owner->GetScene()->setInstanceProperties(_auroraInstances,
-                { { Aurora::Names::InstanceProperties::kMaterial, _auroraMaterialPath } });
+            // Update the material, unless there is a pending rebuild, which uses the current
+            // material, or the instances are being removed.
+            HdAuroraMeshSceneUpdate& update = GetSceneUpdate();
+            if (!update.rebuild && !update.clearInstances)
+            {
+                update.updateMaterial = true;
+                ScheduleSceneUpdate();
+            }
         }
     }
     *dirtyBits &= ~HdChangeTracker::AllSceneDirtyBits;
@@ -17,6 +17,7 @@
 class HdAuroraMaterial;
 class HdAuroraRenderDelegate;
 struct HdAuroraMeshVertexData;
+struct HdAuroraMeshSceneUpdate;
 class HdAuroraMesh : public HdMesh
 {
 public:
@@ -46,7 +47,18 @@ private:
     void ClearAuroraInstances();
     void UpdateAuroraSceneBounds(const VtVec3fArray& points);
 
+    // Gets the pending scene update for the mesh, creating it if there is none.
+    HdAuroraMeshSceneUpdate& GetSceneUpdate();
+
+    // Schedules the pending scene update with the render delegate, which applies it when the sync
+    // scheduler runs it.
+    void ScheduleSceneUpdate();
+
+    // Applies the pending scene update to the Aurora scene, if there is one.
+    void ApplySceneUpdate();
+
     unique_ptr<HdAuroraMeshVertexData> _pVertexData;
+    unique_ptr<HdAuroraMeshSceneUpdate> _pSceneUpdate;
     vector<VtVec2fArray> _layerUVData;
 
     HdAuroraRenderDelegate* _owner;
@@ -16,6 +16,8 @@
 #include "HdAuroraRenderBuffer.h"
 #include "HdAuroraRenderDelegate.h"
 
+#include <Aurora/Foundation/PixelConversion.h>
+
 #include <GL/glew.h>
 #include <pxr/imaging/hdx/hgiConversions.h>
 #include <pxr/imaging/hgi/blitCmds.h>
@@ -233,6 +235,29 @@ private:
 // 1x1 pixel of invalid data
 static const uint8_t INVALID_DATA[] = { 0xFF, 0xFF, 0xFF, 0xFF };
 
+// Get the size in bytes of a pixel of an uncompressed Aurora image format.
+static size_t _getPixelSize(Aurora::ImageFormat format)
+{
+    switch (format)
+    {
+    case Aurora::ImageFormat::Byte_R:
+        return 1;
+    case Aurora::ImageFormat::Integer_RGBA:
+    case Aurora::ImageFormat::Float_R:
+        return 4;
+    case Aurora::ImageFormat::Integer_RG:
+    case Aurora::ImageFormat::Short_RGBA:
+    case Aurora::ImageFormat::Half_RGBA:
+        return 8;
+    case Aurora::ImageFormat::Float_RGB:
+        return 12;
+    case Aurora::ImageFormat::Float_RGBA:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
 // Obtain appropriate usage bits according to the format and purpose of the texture.
 static HgiTextureUsage _getTextureUsage(HdFormat format, TfToken const& name)
 {
@@ -253,6 +278,7 @@ HdAuroraRenderBuffer::HdAuroraRenderBuffer(
     HdRenderBuffer(id),
     _owner(renderDelegate),
     _pRenderBuffer(nullptr),
+    _imageFormat(Aurora::ImageFormat::Integer_RGBA),
     _dimensions(0, 0, 1),
     _stride(0),
     _format(HdFormatInvalid),
@@ -280,6 +306,7 @@ void HdAuroraRenderBuffer::Finalize(HdRenderParam* /* renderParam */)
 void HdAuroraRenderBuffer::_Deallocate()
 {
     _pRenderBuffer.reset();
+    _convertedPixelData.clear();
     _dimensions = GfVec3i(0, 0, 1);
     _stride     = 0;
     _format     = HdFormatUNorm8Vec4;
@@ -303,6 +330,37 @@ void* HdAuroraRenderBuffer::Map()
     return (void*)_pRenderBuffer->data(_stride, true);
 }
 
+bool HdAuroraRenderBuffer::ReadFloatPixels(std::vector<float>& pixels)
+{
+    if (!_valid || !_pRenderBuffer)
+        return false;
+
+    // Convert the pixels directly from the render buffer data, which also removes any row padding.
+    size_t width      = GetWidth();
+    size_t height     = GetHeight();
+    size_t destStride = width * 4 * sizeof(float);
+    size_t stride     = 0;
+    const void* pData = _pRenderBuffer->data(stride);
+    switch (_imageFormat)
+    {
+    case Aurora::ImageFormat::Half_RGBA:
+        pixels.resize(width * height * 4);
+        Aurora::Foundation::convertImageHalfToFloat(static_cast<const uint16_t*>(pData), stride,
+            pixels.data(), destStride, width, height, 4);
+        return true;
+    case Aurora::ImageFormat::Float_RGBA:
+        pixels.resize(width * height * 4);
+        for (size_t y = 0; y < height; y++)
+        {
+            std::memcpy(pixels.data() + y * width * 4,
+                static_cast<const uint8_t*>(pData) + y * stride, destStride);
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
 bool HdAuroraRenderBuffer::IsConverged() const
 {
     // Invalid render buffers are considered always converged
@@ -344,9 +402,11 @@ bool HdAuroraRenderBuffer::Allocate(
 
     _pRenderBuffer =
         _owner->GetRenderer()->createRenderBuffer(dimensions[0], dimensions[1], imageFormat);
+    _imageFormat = imageFormat;
 
-    // Get the stride TODO: not an ideal way to get the stride, but I don't think we need it anyway.
-    _pRenderBuffer->asReadable(_stride);
+    // Compute the stride of the mapped data, which has no row padding. This does not access the
+    // render buffer, so readback is only enabled when the data is first mapped or resolved.
+    _stride    = dimensions[0] * _getPixelSize(imageFormat);
     _format    = format;
     _converged = false;
     return true;
@@ -416,7 +476,9 @@ void HdAuroraRenderBuffer::Resolve()
         }
     }
 
-    // If we don't have a shareable buffer then fallback to using HGI blit
+    // If we don't have a shareable buffer then fallback to using HGI blit. The readable buffer is
+    // the most recent frame that has been read back, which may be the previous frame if the
+    // renderer is still reading back the current one, so this does not stall rendering.
     size_t stride;
     auto pixelBuffer = _pRenderBuffer->asReadable(stride);
     if (!pixelBuffer)
@@ -426,55 +488,14 @@ void HdAuroraRenderBuffer::Resolve()
     if (!pixelData)
         return;
 
-    size_t bytesPerPixel = 16;
-    switch (GetFormat())
-    {
-    case pxr::HdFormatFloat32:
-    case pxr::HdFormatUNorm8Vec4:
-        bytesPerPixel = 4;
-        break;
-    case pxr::HdFormatFloat16Vec4:
-        bytesPerPixel = 8;
-        break;
-    case pxr::HdFormatUNorm8:
-    case pxr::HdFormatUNorm8Vec2:
-    case pxr::HdFormatUNorm8Vec3:
-    case pxr::HdFormatSNorm8:
-    case pxr::HdFormatSNorm8Vec2:
-    case pxr::HdFormatSNorm8Vec3:
-    case pxr::HdFormatSNorm8Vec4:
-    case pxr::HdFormatFloat16:
-    case pxr::HdFormatFloat16Vec2:
-    case pxr::HdFormatFloat16Vec3:
-    case pxr::HdFormatFloat32Vec2:
-    case pxr::HdFormatFloat32Vec3:
-    case pxr::HdFormatFloat32Vec4:
-    case pxr::HdFormatUInt16:
-    case pxr::HdFormatUInt16Vec2:
-    case pxr::HdFormatUInt16Vec3:
-    case pxr::HdFormatUInt16Vec4:
-    case pxr::HdFormatInt16:
-    case pxr::HdFormatInt16Vec2:
-    case pxr::HdFormatInt16Vec3:
-    case pxr::HdFormatInt16Vec4:
-    case pxr::HdFormatInt32:
-    case pxr::HdFormatInt32Vec2:
-    case pxr::HdFormatInt32Vec3:
-    case pxr::HdFormatInt32Vec4:
-    case pxr::HdFormatFloat32UInt8:
-    case pxr::HdFormatInvalid:
-    case pxr::HdFormatCount:
-        break;
-    }
-
-    int actualWidth = static_cast<int>(stride / bytesPerPixel);
-
-    pxr::GfVec3i dim(actualWidth, static_cast<int>(GetHeight()), 1);
+    // Convert the pixel data to the texture format and remove any row padding, if needed.
+    pixelData = convertPixelData(pixelData, stride);
+    if (!pixelData)
+        return;
 
     // populate with data from render buffer
-    texDesc.dimensions     = dim;
     texDesc.initialData    = pixelData;
-    texDesc.pixelsByteSize = stride * GetHeight();
+    texDesc.pixelsByteSize = HdDataSizeOfFormat(GetFormat()) * GetWidth() * GetHeight();
 
     bool hasTexture = static_cast<bool>(_texture);
     if (hasTexture && texDesc != _texture->GetDescriptor())
@@ -495,11 +516,64 @@ void HdAuroraRenderBuffer::Resolve()
         blitOp.mipLevel               = 0;
         blitOp.destinationTexelOffset = GfVec3i(0, 0, 0);
         blitOp.cpuSourceBuffer        = pixelData;
+        blitOp.bufferByteSize         = texDesc.pixelsByteSize;
         blitCmds->CopyTextureCpuToGpu(blitOp);
         _owner->GetHgi()->SubmitCmds(blitCmds.get());
     }
 }
 
+const void* HdAuroraRenderBuffer::convertPixelData(const void* pixelData, size_t stride)
+{
+    // Get the number of bytes per pixel of the Aurora render buffer, and of the texture.
+    size_t bufferBytesPerPixel = 0;
+    switch (_imageFormat)
+    {
+    case Aurora::ImageFormat::Integer_RGBA:
+    case Aurora::ImageFormat::Float_R:
+        bufferBytesPerPixel = 4;
+        break;
+    case Aurora::ImageFormat::Integer_RG:
+    case Aurora::ImageFormat::Half_RGBA:
+        bufferBytesPerPixel = 8;
+        break;
+    default:
+        return nullptr;
+    }
+    size_t width                = GetWidth();
+    size_t height               = GetHeight();
+    size_t textureBytesPerPixel = HdDataSizeOfFormat(GetFormat());
+    size_t textureStride        = width * textureBytesPerPixel;
+
+    // Half float render buffers are used for four channel float formats, so convert to 32-bit
+    // floats if the texture requires them, removing any padding in the same pass.
+    if (_imageFormat == Aurora::ImageFormat::Half_RGBA && GetFormat() == HdFormatFloat32Vec4)
+    {
+        _convertedPixelData.resize(textureStride * height);
+        Aurora::Foundation::convertImageHalfToFloat(static_cast<const uint16_t*>(pixelData),
+            stride, reinterpret_cast<float*>(_convertedPixelData.data()), textureStride, width,
+            height, 4);
+
+        return _convertedPixelData.data();
+    }
+
+    // Other formats can't be converted, so the pixel sizes must match.
+    if (bufferBytesPerPixel != textureBytesPerPixel)
+    {
+        TF_WARN("HdAuroraRenderBuffer: unsupported conversion for render buffer format %d",
+            static_cast<int>(GetFormat()));
+        return nullptr;
+    }
+
+    // Remove the row padding, if there is any.
+    if (stride == textureStride)
+        return pixelData;
+    _convertedPixelData.resize(textureStride * height);
+    Aurora::Foundation::copyImageRows(
+        pixelData, stride, _convertedPixelData.data(), textureStride, textureStride, height);
+
+    return _convertedPixelData.data();
+}
+
 VtValue HdAuroraRenderBuffer::GetResource(bool /*multiSampled*/) const
 {
     if (!_valid)
@@ -64,15 +64,26 @@ public:
     // Get the stride of the render buffer
     size_t GetStride() { return _stride; }
 
+    // Read the pixels as four channel 32-bit floats, e.g. to estimate convergence. Returns false if
+    // the render buffer does not have a four channel half or float format, as 8-bit colors have
+    // been tone mapped and quantized.
+    bool ReadFloatPixels(std::vector<float>& pixels);
+
 private:
     virtual void _Deallocate() override;
 
     bool hasTextureResource(const pxr::HgiTextureDesc& texDesc);
 
+    // Convert pixel data read back from the Aurora render buffer to the format of the texture,
+    // removing any row padding. Returns the source data if no conversion is needed.
+    const void* convertPixelData(const void* pixelData, size_t stride);
+
     HdAuroraRenderDelegate* _owner;
 
     Aurora::IRenderBufferPtr _pRenderBuffer;
     pxr::HgiTextureHandle _texture;
+    Aurora::ImageFormat _imageFormat;
+    std::vector<uint8_t> _convertedPixelData;
     GfVec3i _dimensions;
     size_t _stride;
     bool _mapped;
@@ -26,6 +26,7 @@
 #include "HdAuroraRenderBuffer.h"
 #include "HdAuroraRenderDelegate.h"
 #include "HdAuroraRenderPass.h"
+#include "HdAuroraSyncScheduler.h"
 #include "HdAuroraTokens.h"
 
 const TfTokenVector SUPPORTED_RPRIM_TYPES = {
@@ -37,6 +38,8 @@ const TfTokenVector SUPPORTED_SPRIM_TYPES = {
     HdPrimTypeTokens->material,
     HdPrimTypeTokens->domeLight,
     HdPrimTypeTokens->distantLight,
+    HdPrimTypeTokens->sphereLight,
+    HdPrimTypeTokens->rectLight,
 };
 
 const TfTokenVector SUPPORTED_BPRIM_TYPES = {
@@ -81,6 +84,7 @@ HdAuroraRenderDelegate::HdAuroraRenderDelegate(HdRenderSettingsMap const& settin
     HdRenderDelegate(settings),
     _auroraRenderer(Aurora::createRenderer()),
     _sampleCounter(33, 250, 50),
+    _convergenceEstimator(0.0f),
     _hgi(nullptr)
 {
     if (!_auroraRenderer)
@@ -110,14 +114,19 @@ HdAuroraRenderDelegate::HdAuroraRenderDelegate(HdRenderSettingsMap const& settin
     _auroraRenderer->options().setFloat("maxLuminance", 1000.0f);
     _auroraRenderer->options().setBoolean("isDiffuseOnlyEnabled", false);
     _auroraRenderer->options().setInt("traceDepth", 5);
+    _auroraRenderer->options().setBoolean("isRussianRouletteEnabled", false);
+    _auroraRenderer->options().setInt("russianRouletteDepth", 3);
+    _auroraRenderer->options().setInt("samplerType", 0);
     _auroraRenderer->options().setBoolean("isDenoisingEnabled", false);
     _auroraRenderer->options().setBoolean("alphaEnabled", false);
+    _auroraRenderer->options().setBoolean("isHalfFloatImagesEnabled", false);
     _sampleCounter.setMaxSamples(1000);
     _sampleCounter.reset();
 
     // create a new scene for this renderer.
     _auroraScene = _auroraRenderer->createScene();
-    _pImageCache = std::make_unique<HdAuroraImageCache>(_auroraScene);
+    _pImageCache    = std::make_unique<HdAuroraImageCache>(_auroraScene);
+    _pSyncScheduler = std::make_unique<HdAuroraSyncScheduler>();
 
     // Create a ground plane object, which is assigned to the scene.
     _pGroundPlane = make_unique<GroundPlane>(_auroraRenderer.get(), _auroraScene.get());
@@ -139,6 +148,18 @@ HdAuroraRenderDelegate::HdAuroraRenderDelegate(HdRenderSettingsMap const& settin
         _auroraRenderer->options().setInt("traceDepth", value.Get<int>());
         return true;
     };
+    _settingFunctions[HdAuroraTokens::kIsRussianRouletteEnabled] = [this](VtValue const& value) {
+        _auroraRenderer->options().setBoolean("isRussianRouletteEnabled", value.Get<bool>());
+        return true;
+    };
+    _settingFunctions[HdAuroraTokens::kRussianRouletteDepth] = [this](VtValue const& value) {
+        _auroraRenderer->options().setInt("russianRouletteDepth", value.Get<int>());
+        return true;
+    };
+    _settingFunctions[HdAuroraTokens::kSamplerType] = [this](VtValue const& value) {
+        _auroraRenderer->options().setInt("samplerType", value.Get<int>());
+        return true;
+    };
     _settingFunctions[HdAuroraTokens::kMaxSamples] = [this](VtValue const& value) {
         int currentSamples = static_cast<int>(_sampleCounter.currentSamples());
         // Newly max sample value is smaller than current sample, stop render and keep the
@@ -146,8 +167,16 @@ HdAuroraRenderDelegate::HdAuroraRenderDelegate(HdRenderSettingsMap const& settin
         _sampleCounter.setMaxSamples(std::max(currentSamples, value.Get<int>()));
         return false;
     };
+    _settingFunctions[HdAuroraTokens::kConvergenceThreshold] = [this](VtValue const& value) {
+        // Re-evaluate convergence with the new threshold, so that rendering continues from the
+        // current accumulated result if the threshold is lowered.
+        _convergenceEstimator.setThreshold(std::max(value.Get<float>(), 0.0f));
+        _sampleCounter.setConverged(_convergenceEstimator.isConverged());
+        return false;
+    };
     _settingFunctions[HdAuroraTokens::kIsDenoisingEnabled] = [this](VtValue const& value) {
-        _auroraRenderer->options().setBoolean("isDenoisingEnabled", value.Get<bool>());
+        _isDenoisingEnabled = value.Get<bool>();
+        _auroraRenderer->options().setBoolean("isDenoisingEnabled", _isDenoisingEnabled);
         return true;
     };
     _settingFunctions[HdAuroraTokens::kIsAlphaEnabled] = [this](VtValue const& value) {
@@ -155,6 +184,18 @@ HdAuroraRenderDelegate::HdAuroraRenderDelegate(HdRenderSettingsMap const& settin
         _bEnvironmentIsDirty = true;
         return false;
     };
+    _settingFunctions[HdAuroraTokens::kIsHalfFloatImagesEnabled] = [this](VtValue const& value) {
+        _auroraRenderer->options().setBoolean("isHalfFloatImagesEnabled", value.Get<bool>());
+        return false;
+    };
+    _settingFunctions[HdAuroraTokens::kTextureCompression] = [this](VtValue const& value) {
+        _auroraRenderer->options().setInt("textureCompression", value.Get<int>());
+        return false;
+    };
+    _settingFunctions[HdAuroraTokens::kTextureCompressionCachePath] = [this](VtValue const& value) {
+        _auroraRenderer->options().setString("textureCompressionCachePath", value.Get<string>());
+        return false;
+    };
     _settingFunctions[HdAuroraTokens::kUseEnvironmentImageAsBackground] =
         [this](VtValue const& value) {
             _useEnvironmentLightAsBackground = value.Get<bool>();
@@ -166,6 +207,15 @@ HdAuroraRenderDelegate::HdAuroraRenderDelegate(HdRenderSettingsMap const& settin
         _bEnvironmentIsDirty     = true;
         return false;
     };
+    _settingFunctions[HdAuroraTokens::kImageCacheBudget] = [this](VtValue const& value) {
+        // The budget is set in megabytes.
+        _pImageCache->setBudget(static_cast<size_t>(std::max(value.Get<int>(), 0)) << 20);
+        return false;
+    };
+    _settingFunctions[HdAuroraTokens::kSyncBudget] = [this](VtValue const& value) {
+        _pSyncScheduler->setBudget(value.Get<float>());
+        return false;
+    };
     _settingFunctions[HdAuroraTokens::kFlipLoadedImageY] = [this](VtValue const& value) {
         bool flipY = value.Get<bool>();
         _pImageCache->setIsYFlipped(flipY);
@@ -315,6 +365,21 @@ VtValue HdAuroraRenderDelegate::GetRenderSetting(TfToken const& key) const
     {
         return VtValue(static_cast<int>(_sampleCounter.currentSamples()));
     }
+    else if (HdAuroraTokens::kConvergenceError == key)
+    {
+        return VtValue(_convergenceEstimator.statistics().maxError);
+    }
+    else if (HdAuroraTokens::kConvergedTileFraction == key)
+    {
+        const auto& stats = _convergenceEstimator.statistics();
+        return VtValue(stats.tileCount == 0
+                ? 0.0f
+                : static_cast<float>(stats.convergedTileCount) / stats.tileCount);
+    }
+    else if (HdAuroraTokens::kPendingSyncUpdates == key)
+    {
+        return VtValue(static_cast<int>(_pSyncScheduler->pendingCount()));
+    }
     else if (HdAuroraTokens::kIsAlphaEnabled == key)
     {
         return VtValue(_alphaEnabled);
@@ -355,6 +420,14 @@ HdSprim* HdAuroraRenderDelegate::CreateSprim(TfToken const& typeId, SdfPath cons
     {
         return new HdAuroraDistantLight(sprimId, this);
     }
+    else if (typeId == HdPrimTypeTokens->sphereLight)
+    {
+        return new HdAuroraSphereLight(sprimId, this);
+    }
+    else if (typeId == HdPrimTypeTokens->rectLight)
+    {
+        return new HdAuroraRectLight(sprimId, this);
+    }
     return nullptr;
 }
 
@@ -469,12 +542,27 @@ void HdAuroraRenderDelegate::UpdateBounds(const pxr::GfVec3f& min, const GfVec3f
     _boundsValid = true;
 }
 
+void HdAuroraRenderDelegate::ScheduleSceneUpdate(const string& key, function<void()> update)
+{
+    // Without a budget, run the update immediately, as the render pass would run all the updates
+    // before rendering anyway.
+    if (_pSyncScheduler->budget() == 0.0f)
+    {
+        update();
+        return;
+    }
+
+    _pSyncScheduler->schedule(key, std::move(update));
+}
+
 void HdAuroraRenderDelegate::UpdateAuroraEnvironment()
 {
     if (!_bEnvironmentIsDirty)
         return;
     SetSampleRestartNeeded(true);
 
+    // Release the previous background image, and acquire the new one, if any.
+    imageCache().releaseImage(_auroraEnvironmentBackgroundImagePath);
     if (!_backgroundImageFilePath.empty())
     {
         _auroraEnvironmentBackgroundImagePath =
@@ -19,6 +19,7 @@ class GroundPlane;
 class HdAuroraRenderPass;
 class HdAuroraRenderBuffer;
 class HdAuroraImageCache;
+class HdAuroraSyncScheduler;
 
 // Function used to update a Hydra render setting.
 using UpdateRenderSettingFunction = function<bool(VtValue const& value)>;
@@ -73,7 +74,12 @@ public:
     bool BoundsValid() { return _boundsValid; }
 
     Aurora::Foundation::SampleCounter& GetSampleCounter() { return _sampleCounter; }
+    Aurora::Foundation::ConvergenceEstimator& GetConvergenceEstimator()
+    {
+        return _convergenceEstimator;
+    }
     bool SampleRestartNeeded() const { return _sampleRestartNeeded; }
+    bool IsDenoisingEnabled() const { return _isDenoisingEnabled; }
     void SetSampleRestartNeeded(bool needed) { _sampleRestartNeeded = needed; }
 
     void ActivateRenderPass(
@@ -99,6 +105,12 @@ public:
     // thread safe.
     mutex& primIndexMutex() { return _primIndexMutex; }
     HdAuroraImageCache& imageCache() { return *_pImageCache; }
+    HdAuroraSyncScheduler& syncScheduler() { return *_pSyncScheduler; }
+
+    // Schedules a scene update for a prim, identified by a key such as the prim path, replacing any
+    // pending update for the same key. The update is run immediately if there is no sync budget,
+    // otherwise it is run by the render pass when it fits in the budget for a frame.
+    void ScheduleSceneUpdate(const string& key, function<void()> update);
 
     void setAuroraEnvironmentLightImagePath(const Aurora::Path& path)
     {
@@ -123,11 +135,14 @@ private:
     Aurora::IScenePtr _auroraScene;
     unique_ptr<GroundPlane> _pGroundPlane;
     unique_ptr<HdAuroraImageCache> _pImageCache;
+    unique_ptr<HdAuroraSyncScheduler> _pSyncScheduler;
 
     HdAuroraRenderPass* _activeRenderPass = nullptr;
 
     bool _sampleRestartNeeded = true;
     Aurora::Foundation::SampleCounter _sampleCounter;
+    Aurora::Foundation::ConvergenceEstimator _convergenceEstimator;
+    bool _isDenoisingEnabled = false;
 
     GfVec3f _boundsMin = GfVec3f(+FLT_MAX, +FLT_MAX, +FLT_MAX);
     GfVec3f _boundsMax = GfVec3f(-FLT_MAX, -FLT_MAX, -FLT_MAX);
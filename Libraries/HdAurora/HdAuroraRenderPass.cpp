@@ -1,8 +1,10 @@
 #include "pch.h"
 
+#include "HdAuroraImageCache.h"
 #include "HdAuroraRenderBuffer.h"
 #include "HdAuroraRenderDelegate.h"
 #include "HdAuroraRenderPass.h"
+#include "HdAuroraSyncScheduler.h"
 #include "HdAuroraTokens.h"
 #include <pxr/imaging/garch/glApi.h>
 
@@ -24,12 +26,44 @@ HdAuroraRenderPass::~HdAuroraRenderPass()
 
 bool HdAuroraRenderPass::IsConverged() const
 {
-    return _owner->GetSampleCounter().isComplete();
+    // Rendering is not converged while there are scene updates that have not been applied.
+    return _owner->GetSampleCounter().isComplete() && _owner->syncScheduler().pendingCount() == 0;
+}
+
+void HdAuroraRenderPass::UpdateConvergence()
+{
+    // Only read back the color buffer when the estimator needs it, which happens at a geometric
+    // progression of sample counts. The denoised color can't be used to estimate the remaining
+    // noise, so there is no estimate when denoising is enabled.
+    Aurora::Foundation::SampleCounter& sampleCounter    = _owner->GetSampleCounter();
+    Aurora::Foundation::ConvergenceEstimator& estimator = _owner->GetConvergenceEstimator();
+    uint32_t currentSamples                             = sampleCounter.currentSamples();
+    HdAuroraRenderBuffer* pColorBuffer                  = _renderBuffers[HdAovTokens->color];
+    if (!pColorBuffer || _owner->IsDenoisingEnabled() || !estimator.needsImage(currentSamples))
+    {
+        return;
+    }
+
+    if (!pColorBuffer->ReadFloatPixels(_convergencePixels))
+    {
+        return;
+    }
+    uint32_t width = pColorBuffer->GetWidth();
+    estimator.update(_convergencePixels.data(), width * 4 * sizeof(float), width,
+        pColorBuffer->GetHeight(), 4, currentSamples);
+
+    // Mark the sample counter as complete if the result has converged.
+    if (estimator.isConverged())
+    {
+        sampleCounter.setConverged(true);
+    }
 }
 
 void HdAuroraRenderPass::_Execute(
     HdRenderPassStateSharedPtr const& renderPassState, TfTokenVector const& /* renderTags */)
 {
+    AU_PROFILE_TO(Aurora::profiler(), "HdAuroraRenderPass::_Execute");
+
     // GetViewport has been deprecated. Only use when camera framing is not valid.
     const CameraUtilFraming& framing = renderPassState->GetFraming();
     int viewportWidth                = framing.IsValid() ? framing.dataWindow.GetWidth()
@@ -37,6 +71,10 @@ void HdAuroraRenderPass::_Execute(
     int viewportHeight               = framing.IsValid() ? framing.dataWindow.GetHeight()
                                                          : static_cast<int>(renderPassState->GetViewport()[3]);
 
+    // Apply the scene updates of synced prims that fit in the sync budget, leaving the rest for
+    // later frames, so that the scene is rendered progressively while a large stage is loaded.
+    _owner->syncScheduler().execute();
+
     // If the scene bounds are not valid set the bounds to a minimal bounding box, as it is not
     // permitted to render an Aurora scene with empty bounds.
     if (!_owner->BoundsValid())
@@ -186,15 +224,30 @@ void HdAuroraRenderPass::_Execute(
     // Update the background.
     _owner->UpdateAuroraEnvironment();
 
+    // Release the least recently used images that are no longer used, if over the budget. This is
+    // done after all the materials and lights have been synced, so that it does not release images
+    // that are used again this frame.
+    _owner->imageCache().evictUnusedImages();
+
     // Render the scene.
+    bool restart         = _owner->SampleRestartNeeded();
     uint32_t sampleStart = 0;
-    uint32_t sampleCount =
-        _owner->GetSampleCounter().update(sampleStart, _owner->SampleRestartNeeded());
+    uint32_t sampleCount = _owner->GetSampleCounter().update(sampleStart, restart);
     if (sampleCount > 0)
     {
         _owner->GetRenderer()->render(sampleStart, sampleCount);
     }
 
+    // Estimate the remaining noise in the accumulated result, stopping early if it has converged.
+    if (restart)
+    {
+        _owner->GetConvergenceEstimator().reset();
+    }
+    if (sampleCount > 0)
+    {
+        UpdateConvergence();
+    }
+
     // Clear the restart flag.
     _owner->SetSampleRestartNeeded(false);
 
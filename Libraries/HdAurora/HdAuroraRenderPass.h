@@ -33,6 +33,10 @@ protected:
     void _MarkCollectionDirty() override {}
 
 private:
+    // Estimate the remaining noise in the accumulated color buffer, when needed, and mark the
+    // sample counter as complete if it is below the convergence threshold.
+    void UpdateConvergence();
+
     HdAuroraRenderDelegate* _owner;
 
     HdRenderPassAovBindingVector _aovBindings;
@@ -44,4 +48,7 @@ private:
     std::map<TfToken, HdAuroraRenderBuffer*> _renderBuffers;
 
     GfMatrix4f _cameraView, _cameraProj;
+
+    // The color buffer pixels read back for convergence estimation, kept to avoid reallocation.
+    std::vector<float> _convergencePixels;
 };
\ No newline at end of file
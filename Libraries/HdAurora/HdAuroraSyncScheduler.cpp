@@ -0,0 +1,95 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pch.h"
+
+#include "HdAuroraSyncScheduler.h"
+
+HdAuroraSyncScheduler::HdAuroraSyncScheduler(ClockFunction clock) : _clock(clock)
+{
+    if (!_clock)
+    {
+        _clock = [this]() { return _timer.elapsed(); };
+    }
+}
+
+void HdAuroraSyncScheduler::schedule(const string& key, Update update)
+{
+    lock_guard<mutex> lock(_mutex);
+
+    // Replace the pending update for the key, if any, so that the prim keeps its place.
+    auto iter = _keys.find(key);
+    if (iter != _keys.end())
+    {
+        iter->second->second = std::move(update);
+        return;
+    }
+
+    _updates.emplace_back(key, std::move(update));
+    _keys[key] = std::prev(_updates.end());
+}
+
+void HdAuroraSyncScheduler::cancel(const string& key)
+{
+    lock_guard<mutex> lock(_mutex);
+
+    auto iter = _keys.find(key);
+    if (iter == _keys.end())
+        return;
+
+    _updates.erase(iter->second);
+    _keys.erase(iter);
+}
+
+size_t HdAuroraSyncScheduler::execute()
+{
+    float startTime = _clock();
+    size_t count    = 0;
+    while (true)
+    {
+        // Take the next update, and run it without the lock, so that an update can schedule
+        // another one.
+        Update update;
+        {
+            lock_guard<mutex> lock(_mutex);
+            if (_updates.empty())
+                break;
+
+            update = std::move(_updates.front().second);
+            _keys.erase(_updates.front().first);
+            _updates.pop_front();
+        }
+        update();
+        count++;
+
+        // Stop when the budget is used, if there is one.
+        if (_budgetMs > 0.0f && _clock() - startTime >= _budgetMs)
+            break;
+    }
+
+    return count;
+}
+
+size_t HdAuroraSyncScheduler::pendingCount() const
+{
+    lock_guard<mutex> lock(_mutex);
+
+    return _updates.size();
+}
+
+bool HdAuroraSyncScheduler::isPending(const string& key) const
+{
+    lock_guard<mutex> lock(_mutex);
+
+    return _keys.count(key) > 0;
+}
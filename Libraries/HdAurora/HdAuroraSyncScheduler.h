@@ -0,0 +1,78 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Aurora/Foundation/Timer.h>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+
+// Scheduler for the Aurora scene updates requested by prims when they are synced, e.g. creating
+// the geometry and instances of a mesh. The updates are run by the render pass, in the order they
+// were scheduled, until a time budget for the frame is used, and the rest are run in later frames.
+// This keeps frame times bounded while a large stage is loaded, and the scene is rendered
+// progressively with the updates that have been run so far.
+//
+// Each prim has at most one pending update, identified by a key such as the prim path: scheduling
+// an update for a key that already has one replaces it, keeping its place in the order. Updates
+// can be scheduled from multiple threads, as Hydra syncs prims in parallel. The scheduler does not
+// use the Aurora scene, so it can be tested with mock updates and a mock clock.
+class HdAuroraSyncScheduler
+{
+public:
+    // A scene update.
+    using Update = function<void()>;
+
+    // A function that returns the current time in milliseconds, used to measure the budget.
+    using ClockFunction = function<float()>;
+
+    // Constructor, with an optional clock function. The default clock measures CPU time.
+    HdAuroraSyncScheduler(ClockFunction clock = nullptr);
+
+    // Sets the budget for running updates in each frame in milliseconds, or zero for no limit.
+    void setBudget(float budgetMs) { _budgetMs = std::max(budgetMs, 0.0f); }
+
+    // Gets the budget for running updates in each frame in milliseconds.
+    float budget() const { return _budgetMs; }
+
+    // Schedules an update for a key, replacing any pending update for the same key.
+    void schedule(const string& key, Update update);
+
+    // Cancels the pending update for a key, if there is one, e.g. when the prim is destroyed.
+    void cancel(const string& key);
+
+    // Runs the pending updates in order until the budget is used. At least one update is run if
+    // there are any, so that progress is made even if a single update exceeds the budget. Returns
+    // the number of updates that were run.
+    size_t execute();
+
+    // Gets the number of pending updates.
+    size_t pendingCount() const;
+
+    // Gets whether there is a pending update for a key.
+    bool isPending(const string& key) const;
+
+private:
+    using Entry = pair<string, Update>;
+
+    ClockFunction _clock;
+    Aurora::Foundation::CPUTimer _timer;
+    float _budgetMs = 0.0f;
+
+    mutable mutex _mutex;
+    list<Entry> _updates;
+    map<string, list<Entry>::iterator> _keys;
+};
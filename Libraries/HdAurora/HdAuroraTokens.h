@@ -23,12 +23,31 @@ namespace HdAuroraTokens
 /// The maximum path tracing trace depth.
 static const TfToken kTraceDepth("aurora:trace_depth");
 
+/// Whether to randomly terminate paths with Russian roulette, based on path throughput.
+static const TfToken kIsRussianRouletteEnabled("aurora:is_russian_roulette_enabled");
+
+/// The path depth (number of bounces) after which Russian roulette is applied.
+static const TfToken kRussianRouletteDepth("aurora:russian_roulette_depth");
+
+/// The sampler used to generate random numbers: 0 (pseudorandom), 1 (Sobol), or 2 (blue noise).
+static const TfToken kSamplerType("aurora:sampler_type");
+
 /// The maximum number of path tracing samples per-pixel.
 static const TfToken kMaxSamples("aurora:max_samples");
 
 /// The current number of per-pixel samples rendered, as an output value.
 static const TfToken kCurrentSamples("aurora:current_samples");
 
+/// The noise threshold below which rendering stops before the maximum number of samples, as the
+/// relative error estimated for each tile of the image. Zero disables convergence detection.
+static const TfToken kConvergenceThreshold("aurora:convergence_threshold");
+
+/// The largest relative error estimated for any tile of the image, as an output value.
+static const TfToken kConvergenceError("aurora:convergence_error");
+
+/// The fraction of the tiles of the image with an error below the threshold, as an output value.
+static const TfToken kConvergedTileFraction("aurora:converged_tile_fraction");
+
 /// Whether to restart rendering, from the first sample.
 static const TfToken kIsRestartEnabled("aurora:is_restart_enabled");
 
@@ -53,6 +72,31 @@ static const TfToken kIsInverseToneMappingEnabled("aurora:is_inverse_tone_mappin
 /// The exposure to use for inverse tone mapping on the background image.
 static const TfToken kInverseToneMappingExposure("aurora:inverse_tone_mapping_exposure");
 
+/// Whether to store float (HDR) images, such as the environment image, as half floats. This only
+/// affects images loaded after the setting is changed.
+static const TfToken kIsHalfFloatImagesEnabled("aurora:is_half_float_images_enabled");
+
+/// The block compression of material textures: 0 for none, 1 for fast encoding, or 2 for high
+/// quality encoding. This only affects images loaded after the setting is changed.
+static const TfToken kTextureCompression("aurora:texture_compression");
+
+/// The directory for the persistent cache of compressed textures. The cache is not used if this is
+/// empty.
+static const TfToken kTextureCompressionCachePath("aurora:texture_compression_cache_path");
+
+/// The budget in megabytes for the images loaded by materials and lights, or zero for no limit.
+/// When the budget is exceeded, the least recently used images that are no longer used are
+/// released.
+static const TfToken kImageCacheBudget("aurora:image_cache_budget");
+
+/// The time budget in milliseconds for applying the scene updates of synced prims in each frame, or
+/// zero for no limit. With a budget, the geometry and instances of a large stage are created over
+/// several frames, and the scene is rendered progressively as they are created.
+static const TfToken kSyncBudget("aurora:sync_budget");
+
+/// The number of prims with scene updates that have not been applied yet, as an output value.
+static const TfToken kPendingSyncUpdates("aurora:pending_sync_updates");
+
 /// Whether to use a shared handle for renderer output.
 static const TfToken kIsSharedHandleEnabled("aurora:is_shared_handle_enabled");
 
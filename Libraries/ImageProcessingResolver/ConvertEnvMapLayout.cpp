@@ -15,6 +15,7 @@
 
 #include "ConvertEnvMapLayout.h"
 #include "Resolver.h"
+#include <Aurora/Foundation/CubeMap.h>
 #include <Aurora/Foundation/Log.h>
 #include <Aurora/Foundation/Utilities.h>
 
@@ -105,62 +106,45 @@ bool convertToLatLongLayout(
     int nChannels        = pxr::HioGetComponentCount(imageData.format);
     pxr::HioType hioType = pxr::HioGetHioType(imageData.format);
     OIIO::TypeDesc type  = convertToOIIODataType(hioType);
-    OIIO::ImageSpec spec(imageData.width, imageData.height, nChannels, type);
 
-    spec.full_x       = spec.x;
-    spec.full_y       = spec.y;
-    spec.full_z       = spec.z;
-    spec.full_width   = spec.width;
-    spec.full_height  = spec.height;
-    spec.full_depth   = spec.depth;
     int patch         = gcd(imageData.width, imageData.height);
     size_t outputSize = 4 * patch * 2 * patch * nChannels * sizeof(float);
     OIIO::ImageSpec latlongspec(4 * patch, 2 * patch, nChannels, type);
     std::vector<unsigned char> newPixels(outputSize);
     unsigned char* outputImageBuffer = newPixels.data();
     OIIO::ImageBuf latlong(latlongspec, outputImageBuffer);
-    float pixelGotten[4];
-    // Intergrate a latlong layout image from hcross/vcross
-    // 1.Construct the circumscribed sphere of the cube
-    // 2.Fill the sphere patch with cube surface( six images)
-    // 3.Expand the sphere along the 0 degree longitude
     std::vector<OIIO::ImageBuf> sixSidesList = {};
     sixSidesList                             = getSixFacesFromSourceImage(imageData);
-    for (int h = 0; h < 2 * patch; ++h)
+    if (sixSidesList.size() != 6)
     {
-        float const phi = static_cast<float>(M_PI * (h - patch) / (2 * patch)); //-pi/2~pi/2
-        for (int w = 0; w < 4 * patch; ++w)
-        {
-            int coord_x, coord_y;
-            // Translate from sphere coordinate to Cartesian coordinate.
-            float theta = static_cast<float>(M_PI * (w - 2 * patch) / (2 * patch)); // -pi~pi
-            float x     = cos(phi) * sin(theta);
-            float y     = sin(phi);
-            float z     = cos(phi) * cos(theta);
-            if (abs(x) >= abs(y) && abs(x) >= abs(z))
-            {
-                coord_x = static_cast<int>(patch * (1.0 - z / x) / 2.0);
-                coord_y = static_cast<int>(patch * (1.0 + y / x) / 2.0);
-                x < 0.0 ? sixSidesList.at(1).getpixel(coord_x, coord_y, pixelGotten)
-                        : sixSidesList.at(0).getpixel(coord_x, coord_y, pixelGotten);
-            }
-            else if (abs(y) > abs(z))
-            {
-                coord_x = static_cast<int>(patch * (1 + x / y) / 2.0);
-                coord_y = static_cast<int>(patch * (1 - z / y) / 2.0);
-                y < 0.0 ? sixSidesList.at(3).getpixel(coord_x, coord_y, pixelGotten)
-                        : sixSidesList.at(2).getpixel(coord_x, coord_y, pixelGotten);
-            }
-            else
-            {
-                coord_x = static_cast<int>(patch * (1 + x / z) / 2.0);
-                coord_y = static_cast<int>(patch * (1 + z / abs(z) * y / z) / 2.0);
-                z < 0.0 ? sixSidesList.at(5).getpixel(coord_x, coord_y, pixelGotten)
-                        : sixSidesList.at(4).getpixel(coord_x, coord_y, pixelGotten);
-            }
-            latlong.setpixel(w, h, pixelGotten);
-        }
+        AU_WARN("Unsupported cube map layout (%dx%d).", imageData.width, imageData.height);
+        return false;
     }
+
+    // Get the pixels of the six faces as floats, with the same conversion as OIIO getpixel().
+    std::vector<float> facePixels[6];
+    Aurora::Foundation::CubeMapFace faces[6];
+    for (int i = 0; i < 6; ++i)
+    {
+        const OIIO::ImageSpec& faceSpec = sixSidesList[i].spec();
+        facePixels[i].resize(static_cast<size_t>(faceSpec.width) * faceSpec.height * nChannels);
+        sixSidesList[i].get_pixels(
+            sixSidesList[i].roi(), OIIO::TypeDesc::FLOAT, facePixels[i].data());
+        faces[i] = { facePixels[i].data(), static_cast<uint32_t>(faceSpec.width),
+            static_cast<uint32_t>(faceSpec.height) };
+    }
+
+    // Intergrate a latlong layout image from hcross/vcross
+    // 1.Construct the circumscribed sphere of the cube
+    // 2.Fill the sphere patch with cube surface( six images)
+    // 3.Expand the sphere along the 0 degree longitude
+    // This is done with SIMD instructions and multiple threads, with the same result as sampling
+    // each pixel separately.
+    std::vector<float> latlongPixels(static_cast<size_t>(8) * patch * patch * nChannels);
+    Aurora::Foundation::convertCubeMapToLatLong(faces, static_cast<uint32_t>(patch),
+        static_cast<uint32_t>(nChannels), latlongPixels.data());
+    latlong.set_pixels(latlong.roi(), OIIO::TypeDesc::FLOAT, latlongPixels.data());
+
     imageBuf         = newPixels;
     imageData.width  = 4 * patch;
     imageData.height = 2 * patch;
@@ -197,6 +181,5 @@ bool convertEnvMapLayout(const AssetCacheEntry& record, pxr::HioImageSharedPtr c
         return false;
     }
 
-    convertToLatLongLayout(imageData, imageBuf);
-    return true;
+    return convertToLatLongLayout(imageData, imageBuf);
 }
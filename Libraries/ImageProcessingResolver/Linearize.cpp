@@ -14,38 +14,7 @@
 #include "pch.h"
 
 #include "Linearize.h"
-
-float reverseSpectrumToneMappingLow(float x)
-{
-    const float a  = 0.244925773f;
-    const float t1 = -0.631960243f;
-    const float t2 = -4.251792105f;
-    const float t3 = 3.841721426f;
-    const float d0 = -0.005002772f;
-    const float d1 = -0.525010335f;
-    const float d2 = -0.885018509f;
-    const float d3 = 1.153153531f;
-
-    const float x2 = x * x;
-    const float x3 = x2 * x;
-    return a * (t1 * x + t2 * x2 + t3 * x3) / (d0 + d1 * x + d2 * x2 + d3 * x3);
-}
-
-float reverseSpectrumToneMappingHigh(float x)
-{
-    const float a  = 0.514397858f;
-    const float t1 = -0.553266341f;
-    const float t2 = -2.677674970f;
-    const float t3 = 2.903543727f;
-    const float d0 = -0.005057344f;
-    const float d1 = -0.804910686f;
-    const float d2 = -1.427186761f;
-    const float d3 = 2.068910419f;
-
-    const float x2 = x * x;
-    const float x3 = x2 * x;
-    return a * (t1 * x + t2 * x2 + t3 * x3) / (d0 + d1 * x + d2 * x2 + d3 * x3);
-}
+#include <Aurora/Foundation/ToneMapping.h>
 
 void canonInverse(
     pxr::HioImage::StorageSpec& imageData, std::vector<unsigned char>& imageBuf, float exposure)
@@ -53,9 +22,6 @@ void canonInverse(
     // Work out channel count from HIO format.
     int numChannels = pxr::HioGetComponentCount(imageData.format);
 
-    // Compute 2^exposure.
-    float exposure2 = exp2(exposure);
-
     // Image dims and pixel count.
     int imageWidth  = imageData.width;
     int imageHeight = imageData.height;
@@ -77,35 +43,17 @@ void canonInverse(
         dst = reinterpret_cast<float*>(newPixels.data());
     }
 
-    const float spectrumTonemapMin = -2.152529302052785809f;
-    const float spectrumTonemapMax = 1.163792197947214113f;
-
-    const float lowHighBreak = 0.9932f;
-
-    const float shift = 0.18f;
-    for (size_t i = 0; i < pixels; ++i)
+    // Apply the inverse curve to the rows in parallel. LDR values use a lookup table, and float
+    // values use a SIMD approximation with a bounded error.
+    if (isConversionRequired)
     {
-        float val;
-        if (isConversionRequired)
-            val = float(srcBytes[i]) / 255.0f;
-        else
-            val = dst[i];
-
-        if (val < lowHighBreak)
-        {
-            val = reverseSpectrumToneMappingLow(val);
-        }
-        else
-        {
-            val = reverseSpectrumToneMappingHigh(val);
-        }
-        val = pxr::GfClamp(val, 0.0f, 1.0f);
-        val = val * (spectrumTonemapMax - spectrumTonemapMin) + spectrumTonemapMin;
-        val = pxr::GfPow(10.0f, val);
-        val /= exposure2;
-        val *= shift;
-
-        dst[i] = val;
+        Aurora::Foundation::canonInverseImage(
+            srcBytes, dst, imageWidth, imageHeight, numChannels, exposure);
+    }
+    else
+    {
+        Aurora::Foundation::canonInverseImage(
+            dst, dst, imageWidth, imageHeight, numChannels, exposure);
     }
 
     // Copy the temp buffer to the output buffer, if used.
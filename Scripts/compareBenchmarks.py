@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+# Copyright 2025 Autodesk, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compares two benchmark result files (in the Google Benchmark JSON format written by
+# AuroraBenchmarks) and reports regressions. Example:
+#
+#   AuroraBenchmarks --benchmark_repetitions=5 --benchmark_out=baseline.json
+#   ... make changes and rebuild ...
+#   AuroraBenchmarks --benchmark_repetitions=5 --benchmark_out=contender.json
+#   python compareBenchmarks.py baseline.json contender.json --threshold 10
+#
+# When repetitions are used, the median of the repetitions is compared, which is robust to noise.
+# The exit code is 1 if any benchmark is slower than the threshold, so this can be used in CI.
+
+import argparse
+import json
+import sys
+
+# Multipliers to convert time units to nanoseconds.
+TIME_UNITS = {"ns": 1.0, "us": 1.0e3, "ms": 1.0e6, "s": 1.0e9}
+
+def load_results(filename, metric):
+    """Loads a results file, returning a dictionary of benchmark name to time in nanoseconds."""
+    with open(filename, "r") as f:
+        data = json.load(f)
+
+    # Collect the benchmark times, preferring the median aggregate if there are repetitions.
+    results = {}
+    medians = {}
+    for benchmark in data.get("benchmarks", []):
+        if benchmark.get("error_occurred", False):
+            continue
+        time = benchmark[metric] * TIME_UNITS[benchmark.get("time_unit", "ns")]
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") == "median":
+                medians[benchmark["run_name"]] = time
+        elif benchmark["name"] not in results:
+            results[benchmark["name"]] = time
+    results.update(medians)
+
+    return results
+
+def format_time(nanoseconds):
+    """Formats a time in nanoseconds with a suitable unit."""
+    for unit, multiplier in (("s", 1.0e9), ("ms", 1.0e6), ("us", 1.0e3)):
+        if nanoseconds >= multiplier:
+            return "%.3f %s" % (nanoseconds / multiplier, unit)
+    return "%.1f ns" % nanoseconds
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two AuroraBenchmarks result files.")
+    parser.add_argument("baseline", help="The baseline results file (JSON).")
+    parser.add_argument("contender", help="The contender results file (JSON).")
+    parser.add_argument("--threshold", type=float, default=10.0,
+        help="The percentage slowdown reported as a regression (default 10).")
+    parser.add_argument("--metric", choices=["cpu_time", "real_time"], default="cpu_time",
+        help="The time to compare (default cpu_time).")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline, args.metric)
+    contender = load_results(args.contender, args.metric)
+
+    # Compare the benchmarks that are in both files, in the order of the baseline file.
+    regressions = []
+    print("%-50s %14s %14s %9s" % ("Benchmark", "Baseline", "Contender", "Change"))
+    print("-" * 90)
+    for name, baseline_time in baseline.items():
+        if name not in contender:
+            print("%-50s %14s %14s %9s" % (name, format_time(baseline_time), "missing", ""))
+            continue
+        contender_time = contender[name]
+        change = (contender_time - baseline_time) / baseline_time * 100.0 if baseline_time > 0 else 0.0
+        status = ""
+        if change > args.threshold:
+            status = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            status = "  improvement"
+        print("%-50s %14s %14s %+8.1f%%%s" % (name, format_time(baseline_time),
+            format_time(contender_time), change, status))
+    for name in contender:
+        if name not in baseline:
+            print("%-50s %14s %14s %9s" % (name, "new", format_time(contender[name]), ""))
+
+    # Report the regressions, and fail if there are any.
+    if regressions:
+        print("\n%d benchmark(s) regressed by more than %.1f%%: %s" % (len(regressions),
+            args.threshold, ", ".join(regressions)))
+        return 1
+    print("\nNo regressions above %.1f%%." % args.threshold)
+
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
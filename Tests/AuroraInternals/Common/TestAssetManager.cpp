@@ -66,6 +66,56 @@ TEST_F(AssetManagerTest, LinearImageTest)
     ASSERT_EQ(imgData1->data.linearize, false);
 }
 
+// Test that images loaded in the background match images loaded directly.
+TEST_F(AssetManagerTest, AsyncImageTest)
+{
+    Aurora::AssetManager testMgr;
+
+    // Start loading several images, including one that doesn't exist.
+    const vector<string> imageFiles = { "fishscale_basecolor.jpg", "fishscale_normal.png",
+        "Mandrill.png", "CoatOfArms.bmp", "missing.png" };
+    vector<Aurora::ImageAssetFuture> futures;
+    for (const string& imageFile : imageFiles)
+    {
+        futures.push_back(testMgr.acquireImageAsync(dataPath() + "/Textures/" + imageFile));
+    }
+
+    // Each image has the same properties and pixels as the image loaded directly, and the missing
+    // image has a null asset.
+    for (size_t i = 0; i < imageFiles.size(); i++)
+    {
+        auto imgData       = futures[i].get();
+        auto imgDataDirect = testMgr.acquireImage(dataPath() + "/Textures/" + imageFiles[i]);
+        if (!imgDataDirect)
+        {
+            ASSERT_EQ(imgData, nullptr);
+            continue;
+        }
+        ASSERT_NE(imgData, nullptr);
+        ASSERT_EQ(imgData->data.width, imgDataDirect->data.width);
+        ASSERT_EQ(imgData->data.height, imgDataDirect->data.height);
+        ASSERT_EQ(imgData->data.linearize, imgDataDirect->data.linearize);
+        ASSERT_EQ(imgData->sizeBytes, imgDataDirect->sizeBytes);
+        ASSERT_EQ(
+            memcmp(imgData->pixels.get(), imgDataDirect->pixels.get(), imgData->sizeBytes), 0);
+    }
+    ASSERT_EQ(futures.back().get(), nullptr);
+
+    // An image loaded with vertical flipping has its rows in the reverse order.
+    string imageFile = dataPath() + "/Textures/Mandrill.png";
+    testMgr.enableVerticalFlipOnImageLoad(false);
+    auto imgData = testMgr.acquireImageAsync(imageFile).get();
+    testMgr.enableVerticalFlipOnImageLoad(true);
+    auto imgDataFlipped = testMgr.acquireImageAsync(imageFile).get();
+    ASSERT_NE(imgData, nullptr);
+    ASSERT_NE(imgDataFlipped, nullptr);
+    size_t rowBytes = imgData->data.width * 4;
+    size_t lastRow  = imgData->data.height - 1;
+    ASSERT_EQ(memcmp(imgData->pixels.get(), imgDataFlipped->pixels.get() + lastRow * rowBytes,
+                  rowBytes),
+        0);
+}
+
 } // namespace
 
 #endif
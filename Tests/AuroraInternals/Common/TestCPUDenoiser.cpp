@@ -0,0 +1,170 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if !defined(DISABLE_UNIT_TESTS)
+
+#include "TestHelpers.h"
+#include <gtest/gtest.h>
+
+// Include the Aurora PCH (this is an internal test so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include <random>
+
+namespace
+{
+
+// Test fixture with helper functions for creating and measuring images.
+class CPUDenoiserTest : public ::testing::Test
+{
+public:
+    CPUDenoiserTest() {}
+    ~CPUDenoiserTest() {}
+
+    static constexpr uint32_t kWidth  = 128;
+    static constexpr uint32_t kHeight = 96;
+
+    // Creates an RGBA image where the left and right halves have the specified values, with
+    // optional noise relative to the value.
+    std::vector<float> createImage(float left, float right, float noise = 0.0f)
+    {
+        std::uniform_real_distribution<float> distribution(-noise, noise);
+        std::vector<float> image(kWidth * kHeight * 4, 1.0f);
+        for (uint32_t y = 0; y < kHeight; y++)
+        {
+            for (uint32_t x = 0; x < kWidth; x++)
+            {
+                float value  = x < kWidth / 2 ? left : right;
+                float* pixel = &image[(y * kWidth + x) * 4];
+                for (int i = 0; i < 3; i++)
+                {
+                    pixel[i] = value * (1.0f + distribution(_random));
+                }
+            }
+        }
+
+        return image;
+    }
+
+    // Computes the mean squared error of the red channel of the specified columns of an image,
+    // compared to the specified value.
+    static float meanSquaredError(
+        const std::vector<float>& image, uint32_t begin, uint32_t end, float value)
+    {
+        double sum = 0.0;
+        for (uint32_t y = 0; y < kHeight; y++)
+        {
+            for (uint32_t x = begin; x < end; x++)
+            {
+                double error = image[(y * kWidth + x) * 4] - value;
+                sum += error * error;
+            }
+        }
+
+        return static_cast<float>(sum / ((end - begin) * kHeight));
+    }
+
+private:
+    std::mt19937 _random;
+};
+
+// Test that noise is reduced in an image with no features.
+TEST_F(CPUDenoiserTest, TestNoiseReduction)
+{
+    std::vector<float> color = createImage(0.5f, 0.5f, 0.3f);
+    std::vector<float> output(color.size());
+    Aurora::DenoiserImages images;
+    images.width   = kWidth;
+    images.height  = kHeight;
+    images.pColor  = color.data();
+    images.pOutput = output.data();
+    Aurora::denoiseImage(images);
+
+    // The error is greatly reduced, and the mean is preserved.
+    float inputError  = meanSquaredError(color, 0, kWidth, 0.5f);
+    float outputError = meanSquaredError(output, 0, kWidth, 0.5f);
+    ASSERT_LT(outputError, inputError * 0.01f);
+    ASSERT_NEAR(output[(kHeight / 2 * kWidth + kWidth / 2) * 4], 0.5f, 0.01f);
+
+    // The result is the same with a single thread, and when the output is the color image.
+    Aurora::DenoiserOptions options;
+    options.threadCount = 1;
+    images.pOutput      = color.data();
+    Aurora::denoiseImage(images, options);
+    ASSERT_EQ(color, output);
+}
+
+// Test that edges are preserved when there are normal and depth guide images.
+TEST_F(CPUDenoiserTest, TestEdgePreservation)
+{
+    // Create noisy color with an edge in the middle, where the normal and depth also change.
+    std::vector<float> color  = createImage(0.2f, 0.8f, 0.3f);
+    std::vector<float> normal = createImage(0.0f, 1.0f);
+    std::vector<float> depth(kWidth * kHeight);
+    for (size_t i = 0; i < depth.size(); i++)
+    {
+        depth[i] = i % kWidth < kWidth / 2 ? 0.5f : 0.9f;
+    }
+
+    std::vector<float> output(color.size());
+    Aurora::DenoiserImages images;
+    images.width   = kWidth;
+    images.height  = kHeight;
+    images.pColor  = color.data();
+    images.pNormal = normal.data();
+    images.pDepth  = depth.data();
+    images.pOutput = output.data();
+    Aurora::denoiseImage(images);
+
+    // Each half is denoised, and the pixels on either side of the edge keep their values.
+    ASSERT_LT(meanSquaredError(output, 0, kWidth / 2, 0.2f),
+        meanSquaredError(color, 0, kWidth / 2, 0.2f) * 0.01f);
+    ASSERT_LT(meanSquaredError(output, kWidth / 2, kWidth, 0.8f),
+        meanSquaredError(color, kWidth / 2, kWidth, 0.8f) * 0.01f);
+    ASSERT_NEAR(output[(kHeight / 2 * kWidth + kWidth / 2 - 1) * 4], 0.2f, 0.01f);
+    ASSERT_NEAR(output[(kHeight / 2 * kWidth + kWidth / 2) * 4], 0.8f, 0.02f);
+}
+
+// Test that texture detail from the albedo is preserved.
+TEST_F(CPUDenoiserTest, TestAlbedoPreservation)
+{
+    // Create a checkerboard albedo with constant lighting, so the color is the albedo.
+    std::vector<float> albedo(kWidth * kHeight * 4, 1.0f);
+    for (uint32_t y = 0; y < kHeight; y++)
+    {
+        for (uint32_t x = 0; x < kWidth; x++)
+        {
+            float value = ((x / 2 + y / 2) % 2) ? 0.9f : 0.1f;
+            std::fill_n(&albedo[(y * kWidth + x) * 4], 3, value);
+        }
+    }
+
+    std::vector<float> output(albedo.size());
+    Aurora::DenoiserImages images;
+    images.width   = kWidth;
+    images.height  = kHeight;
+    images.pColor  = albedo.data();
+    images.pAlbedo = albedo.data();
+    images.pOutput = output.data();
+    Aurora::denoiseImage(images);
+
+    for (size_t i = 0; i < output.size(); i++)
+    {
+        ASSERT_NEAR(output[i], albedo[i], 1.0e-4f);
+    }
+}
+
+} // namespace
+
+#endif
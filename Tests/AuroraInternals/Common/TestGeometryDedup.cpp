@@ -0,0 +1,252 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if !defined(DISABLE_UNIT_TESTS)
+
+#include "TestHelpers.h"
+#include <gtest/gtest.h>
+
+// Include the Aurora PCH (this is an internal test so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "GeometryDedupIndex.h"
+
+namespace
+{
+
+// Test fixture for the geometry deduplication index.
+class GeometryDedupTest : public ::testing::Test
+{
+public:
+    GeometryDedupTest() {}
+    ~GeometryDedupTest() {}
+};
+
+// A geometry object that only records that it was created.
+class TestGeometry : public IGeometry
+{
+public:
+    ~TestGeometry() override {}
+};
+
+// Vertex data for a single triangle, with interleaved positions and normals, and indices. The
+// separate positions and normals are filled in when the data is requested with a separate layout.
+struct TriangleData
+{
+    vector<float> vertices   = { 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1 };
+    vector<uint32_t> indices = { 0, 1, 2 };
+    vector<float> positions;
+    vector<float> normals;
+    int getCount      = 0;
+    int completeCount = 0;
+};
+
+// Creates a descriptor for triangle data, with an interleaved or separate vertex layout.
+GeometryDescriptor createDescriptor(TriangleData& data, bool interleaved)
+{
+    GeometryDescriptor desc;
+    desc.vertexDesc.attributes[Names::VertexAttributes::kPosition] = AttributeFormat::Float3;
+    desc.vertexDesc.attributes[Names::VertexAttributes::kNormal]   = AttributeFormat::Float3;
+    desc.vertexDesc.count                                          = 3;
+    desc.indexCount                                                = 3;
+    desc.getAttributeData = [&data, interleaved](AttributeDataMap& buffers, size_t, size_t, size_t,
+                                size_t) {
+        data.getCount++;
+
+        // For the separate layout, copy the positions and normals to separate arrays.
+        size_t stride = interleaved ? 6 * sizeof(float) : 3 * sizeof(float);
+        if (!interleaved)
+        {
+            data.positions.clear();
+            data.normals.clear();
+            for (size_t i = 0; i < 3; i++)
+            {
+                data.positions.insert(data.positions.end(), data.vertices.begin() + i * 6,
+                    data.vertices.begin() + i * 6 + 3);
+                data.normals.insert(data.normals.end(), data.vertices.begin() + i * 6 + 3,
+                    data.vertices.begin() + i * 6 + 6);
+            }
+        }
+        buffers[Names::VertexAttributes::kPosition].address =
+            interleaved ? data.vertices.data() : data.positions.data();
+        buffers[Names::VertexAttributes::kPosition].stride = stride;
+        buffers[Names::VertexAttributes::kNormal].address =
+            interleaved ? data.vertices.data() : data.normals.data();
+        buffers[Names::VertexAttributes::kNormal].offset   = interleaved ? 3 * sizeof(float) : 0;
+        buffers[Names::VertexAttributes::kNormal].stride   = stride;
+        buffers[Names::VertexAttributes::kIndices].address = data.indices.data();
+        buffers[Names::VertexAttributes::kIndices].stride  = sizeof(uint32_t);
+
+        return true;
+    };
+    desc.attributeUpdateComplete = [&data](const AttributeDataMap&, size_t, size_t, size_t,
+                                       size_t) { data.completeCount++; };
+
+    return desc;
+}
+
+// Test that the hash depends on the content of the attribute streams, and not their layout.
+TEST_F(GeometryDedupTest, TestHash)
+{
+    TriangleData data1, data2;
+    size_t hash1, hash2;
+
+    // Identical content gives the same hash, whether the vertex data is interleaved or not. The
+    // attribute data is returned to the client after it is hashed.
+    ASSERT_TRUE(GeometryDedupIndex::hashDescriptor(createDescriptor(data1, true), hash1));
+    ASSERT_TRUE(GeometryDedupIndex::hashDescriptor(createDescriptor(data2, false), hash2));
+    ASSERT_EQ(hash1, hash2);
+    ASSERT_EQ(data1.getCount, 1);
+    ASSERT_EQ(data1.completeCount, 1);
+
+    // Changing a position or an index changes the hash.
+    data2.vertices[4] = 0.5f;
+    ASSERT_TRUE(GeometryDedupIndex::hashDescriptor(createDescriptor(data2, false), hash2));
+    ASSERT_NE(hash1, hash2);
+    data2.vertices[4] = 0.0f;
+    data2.indices[2]  = 1;
+    ASSERT_TRUE(GeometryDedupIndex::hashDescriptor(createDescriptor(data2, false), hash2));
+    ASSERT_NE(hash1, hash2);
+
+    // Descriptors with no attribute data can't be hashed.
+    GeometryDescriptor emptyDesc;
+    ASSERT_FALSE(GeometryDedupIndex::hashDescriptor(emptyDesc, hash1));
+}
+
+// Test that identical geometry is shared, with a reference count for each path.
+TEST_F(GeometryDedupTest, TestSharing)
+{
+    TriangleData data1, data2, data3;
+    data3.vertices[0] = 2.0f;
+
+    GeometryDedupIndex index;
+    int createCount = 0;
+    auto create     = [&createCount](const GeometryDescriptor&) {
+        createCount++;
+        return make_shared<TestGeometry>();
+    };
+
+    // Geometry with identical content is created once, and shared.
+    IGeometryPtr pGeom1 = index.acquire("Geom1", createDescriptor(data1, true), create);
+    IGeometryPtr pGeom2 = index.acquire("Geom2", createDescriptor(data2, false), create);
+    IGeometryPtr pGeom3 = index.acquire("Geom3", createDescriptor(data3, true), create);
+    ASSERT_EQ(createCount, 2);
+    ASSERT_EQ(pGeom1, pGeom2);
+    ASSERT_NE(pGeom1, pGeom3);
+    ASSERT_EQ(index.uniqueCount(), 2u);
+    ASSERT_EQ(index.referenceCount("Geom1"), 2u);
+    ASSERT_EQ(index.referenceCount("Geom3"), 1u);
+    ASSERT_TRUE(index.isPrimary("Geom1"));
+    ASSERT_FALSE(index.isPrimary("Geom2"));
+
+    // Releasing the first path keeps the geometry for the second path, which becomes primary, and
+    // is used for new geometry with the same content.
+    index.release("Geom1");
+    ASSERT_EQ(index.referenceCount("Geom1"), 0u);
+    ASSERT_EQ(index.referenceCount("Geom2"), 1u);
+    ASSERT_TRUE(index.isPrimary("Geom2"));
+    IGeometryPtr pGeom4 = index.acquire("Geom4", createDescriptor(data1, false), create);
+    ASSERT_EQ(pGeom4, pGeom2);
+    ASSERT_EQ(createCount, 2);
+
+    // Acquiring a path again with different content moves it to other geometry.
+    pGeom4 = index.acquire("Geom4", createDescriptor(data3, false), create);
+    ASSERT_EQ(pGeom4, pGeom3);
+    ASSERT_EQ(index.referenceCount("Geom2"), 1u);
+    ASSERT_EQ(index.referenceCount("Geom3"), 2u);
+
+    // Releasing all the paths removes the geometry from the index.
+    index.release("Geom2");
+    index.release("Geom3");
+    index.release("Geom4");
+    ASSERT_EQ(index.uniqueCount(), 0u);
+    index.acquire("Geom1", createDescriptor(data1, true), create);
+    ASSERT_EQ(createCount, 3);
+}
+
+// Test that the attribute data is obtained from the client once for each acquired path, and that
+// geometry is created from a copy of the data, as the client may free the data when it is returned.
+TEST_F(GeometryDedupTest, TestFreedData)
+{
+    // Create descriptors that free their data when it is returned, like a scene delegate that
+    // releases its vertex data once the geometry has been updated.
+    unique_ptr<TriangleData> pData1 = make_unique<TriangleData>();
+    unique_ptr<TriangleData> pData2 = make_unique<TriangleData>();
+    GeometryDescriptor desc1        = createDescriptor(*pData1, false);
+    GeometryDescriptor desc2        = createDescriptor(*pData2, true);
+    int getCount                    = 0;
+    int completeCount               = 0;
+    auto freeOnComplete = [&getCount, &completeCount](GeometryDescriptor& desc,
+                              unique_ptr<TriangleData>& pData) {
+        auto getData             = desc.getAttributeData;
+        desc.getAttributeData    = [getData, &getCount](AttributeDataMap& buffers, size_t first,
+                                    size_t count, size_t firstIndex, size_t indexCount) {
+            getCount++;
+            return getData(buffers, first, count, firstIndex, indexCount);
+        };
+        desc.attributeUpdateComplete = [&pData, &completeCount](
+                                           const AttributeDataMap&, size_t, size_t, size_t,
+                                           size_t) {
+            completeCount++;
+            pData.reset();
+        };
+    };
+    freeOnComplete(desc1, pData1);
+    freeOnComplete(desc2, pData2);
+
+    // The create function reads the attribute data from the descriptor it is given, as the
+    // renderer does, after the client data has been freed.
+    GeometryDedupIndex index;
+    int createCount = 0;
+    vector<float> createdPositions;
+    auto create = [&createCount, &createdPositions](const GeometryDescriptor& descriptor) {
+        createCount++;
+        AttributeDataMap buffers;
+        if (descriptor.getAttributeData(buffers, 0, 3, 0, 3))
+        {
+            const auto& position = buffers[Names::VertexAttributes::kPosition];
+            const uint8_t* pData = static_cast<const uint8_t*>(position.address);
+            for (size_t i = 0; i < 3; i++)
+            {
+                const float* pPosition =
+                    reinterpret_cast<const float*>(pData + position.offset + i * position.stride);
+                createdPositions.insert(createdPositions.end(), pPosition, pPosition + 3);
+            }
+        }
+        if (descriptor.attributeUpdateComplete)
+        {
+            descriptor.attributeUpdateComplete(buffers, 0, 3, 0, 3);
+        }
+        return make_shared<TestGeometry>();
+    };
+    IGeometryPtr pGeom1 = index.acquire("Geom1", desc1, create);
+    ASSERT_EQ(pData1, nullptr);
+    ASSERT_EQ(getCount, 1);
+    ASSERT_EQ(completeCount, 1);
+    ASSERT_EQ(createCount, 1);
+    ASSERT_EQ(createdPositions, vector<float>({ 0, 0, 0, 1, 0, 0, 0, 1, 0 }));
+
+    // Acquiring identical geometry for another path shares the geometry, without using the freed
+    // data of the first path.
+    IGeometryPtr pGeom2 = index.acquire("Geom2", desc2, create);
+    ASSERT_EQ(pData2, nullptr);
+    ASSERT_EQ(pGeom1, pGeom2);
+    ASSERT_EQ(getCount, 2);
+    ASSERT_EQ(completeCount, 2);
+    ASSERT_EQ(createCount, 1);
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,271 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if !defined(DISABLE_UNIT_TESTS)
+
+#include "TestHelpers.h"
+#include <gtest/gtest.h>
+
+// Include the Aurora PCH (this is an internal test so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "HostShaders.h"
+#include "SampleSequence.h"
+
+namespace
+{
+
+namespace SampleSequence = Aurora::SampleSequence;
+
+// Test fixture with the shared shader code compiled for the host CPU. The shaders are compiled once
+// for all the tests, as this takes several seconds.
+class HostShadersTest : public ::testing::Test
+{
+public:
+    HostShadersTest() {}
+    ~HostShadersTest() {}
+
+    static void SetUpTestSuite() { _pShaders = std::make_unique<TestHelpers::HostShaders>(); }
+    static void TearDownTestSuite() { _pShaders.reset(); }
+
+    void SetUp() override
+    {
+        // Skip the tests if the shaders can't be compiled, e.g. if there is no C++ compiler.
+        if (!_pShaders->isValid())
+        {
+            GTEST_SKIP() << "Host shaders could not be compiled: " << _pShaders->errors();
+        }
+    }
+
+    const TestHelpers::HostShaders& shaders() { return *_pShaders; }
+
+    // The number of stratified samples in each dimension, for Monte Carlo estimates.
+    static constexpr int kStrataCount = 64;
+
+    // Returns the stratified random numbers for the specified sample index.
+    static std::pair<float, float> stratifiedRandom(int index)
+    {
+        return { (index % kStrataCount + 0.5f) / kStrataCount,
+            (index / kStrataCount + 0.5f) / kStrataCount };
+    }
+
+    // Returns a view direction with the specified angle from the normal.
+    static vec3 viewDirection(float angle) { return vec3(sin(angle), 0.0f, cos(angle)); }
+
+    // Estimates the directional albedo of a material for the specified view direction, i.e. the
+    // fraction of light reflected from that direction, by sampling the material.
+    float estimateAlbedo(TestHelpers::HostMaterial material, vec3 V)
+    {
+        double sum = 0.0;
+        for (int i = 0; i < kStrataCount * kStrataCount; i++)
+        {
+            auto [random0, random1] = stratifiedRandom(i);
+            float result[8];
+            shaders().sampleMaterial(material.data(), &V.x, random0, random1, result);
+            float pdf = result[6];
+            if (pdf > 0.0f)
+            {
+                sum += (result[0] + result[1] + result[2]) / (3.0f * pdf);
+            }
+        }
+
+        return static_cast<float>(sum / (kStrataCount * kStrataCount));
+    }
+
+private:
+    static std::unique_ptr<TestHelpers::HostShaders> _pShaders;
+};
+
+std::unique_ptr<TestHelpers::HostShaders> HostShadersTest::_pShaders;
+
+// Test the direction sampling functions, checking the directions and PDFs are consistent.
+TEST_F(HostShadersTest, TestSampling)
+{
+    double hemisphereSum = 0.0;
+    double sphereSum     = 0.0;
+    for (int i = 0; i < kStrataCount * kStrataCount; i++)
+    {
+        auto [random0, random1] = stratifiedRandom(i);
+
+        // Cosine-weighted hemisphere samples are above the surface, with a PDF of cos(theta) / PI.
+        float result[4];
+        shaders().sampleHemisphere(random0, random1, result);
+        vec3 direction(result[0], result[1], result[2]);
+        ASSERT_NEAR(length(direction), 1.0f, 1.0e-4f);
+        ASSERT_GE(direction.z, 0.0f);
+        ASSERT_NEAR(result[3], direction.z / M_PI, 1.0e-4f);
+        hemisphereSum += result[3] > 0.0f ? 1.0 / result[3] : 0.0;
+
+        // Uniform direction samples have a constant PDF.
+        shaders().sampleUniformDirection(random0, random1, result);
+        direction = vec3(result[0], result[1], result[2]);
+        ASSERT_NEAR(length(direction), 1.0f, 1.0e-4f);
+        ASSERT_NEAR(result[3], 0.25f / M_PI, 1.0e-6f);
+        sphereSum += 1.0 / result[3];
+    }
+
+    // The average of one over the PDF is the solid angle of the sampled domain.
+    int sampleCount = kStrataCount * kStrataCount;
+    ASSERT_NEAR(hemisphereSum / sampleCount, 2.0 * M_PI, 0.02 * 2.0 * M_PI);
+    ASSERT_NEAR(sphereSum / sampleCount, 4.0 * M_PI, 1.0e-3);
+}
+
+// Test the random number generators produce well-distributed values in the unit range, which are
+// different for each pixel.
+TEST_F(HostShadersTest, TestRandom)
+{
+    const uint32_t count = 4096;
+    for (uint32_t samplerType : { SampleSequence::kRandom, SampleSequence::kSobol })
+    {
+        std::vector<float> values(count * 2);
+        shaders().random2D(samplerType, 0, 10, 20, count, values.data());
+        double sum = 0.0;
+        for (float value : values)
+        {
+            ASSERT_GE(value, 0.0f);
+            ASSERT_LE(value, 1.0f);
+            sum += value;
+        }
+        ASSERT_NEAR(sum / values.size(), 0.5, 0.02) << "Sampler type " << samplerType;
+
+        std::vector<float> otherValues(count * 2);
+        shaders().random2D(samplerType, 0, 11, 20, count, otherValues.data());
+        ASSERT_NE(values, otherValues) << "Sampler type " << samplerType;
+    }
+}
+
+// Test that the low-discrepancy samplers match the CPU implementation of the sequence, with a
+// different scrambling for each dimension (i.e. each call).
+TEST_F(HostShadersTest, TestLowDiscrepancySamplers)
+{
+    const uint32_t x = 10;
+    const uint32_t y = 20;
+    float values[4];
+    for (uint32_t sampleIndex = 0; sampleIndex < 256; sampleIndex++)
+    {
+        // The Sobol sampler is scrambled for each pixel.
+        uint32_t seed = SampleSequence::hash(y * 1024 + x);
+        shaders().random2D(SampleSequence::kSobol, sampleIndex, x, y, 2, values);
+        for (uint32_t dimension = 0; dimension < 2; dimension++)
+        {
+            vec2 expected =
+                SampleSequence::sobol2D(sampleIndex, SampleSequence::hashCombine(seed, dimension));
+            ASSERT_EQ(values[dimension * 2], expected.x) << "Sample " << sampleIndex;
+            ASSERT_EQ(values[dimension * 2 + 1], expected.y) << "Sample " << sampleIndex;
+        }
+
+        // The blue-noise sampler uses the same sequence for every pixel, with the first dimension
+        // unchanged when there is no offset from the blue-noise mask.
+        vec2 expected = SampleSequence::sobol2D(sampleIndex, SampleSequence::hashCombine(0, 0));
+        shaders().random2D(SampleSequence::kBlueNoise, sampleIndex, x, y, 1, values);
+        ASSERT_EQ(values[0], expected.x) << "Sample " << sampleIndex;
+        ASSERT_EQ(values[1], expected.y) << "Sample " << sampleIndex;
+    }
+}
+
+// Test that sampling the material returns the same BSDF and PDF as evaluating the material with the
+// sampled direction, for a range of materials and view directions. This is required for correct
+// multiple importance sampling.
+TEST_F(HostShadersTest, TestMaterialPDFConsistency)
+{
+    std::vector<TestHelpers::HostMaterial> materials(4);
+    materials[1].metalness         = 1.0f;
+    materials[1].specularRoughness = 0.5f;
+    materials[2].coat              = 1.0f;
+    materials[3].sheen             = 1.0f;
+    materials[3].specularRoughness = 0.8f;
+
+    for (TestHelpers::HostMaterial& material : materials)
+    {
+        for (float angle : { 0.1f, 0.8f, 1.4f })
+        {
+            vec3 V = viewDirection(angle);
+            for (int i = 0; i < kStrataCount * kStrataCount; i += 37)
+            {
+                auto [random0, random1] = stratifiedRandom(i);
+                float sampled[8];
+                shaders().sampleMaterial(material.data(), &V.x, random0, random1, sampled);
+                float pdf = sampled[6];
+                if (pdf <= 0.0f)
+                    continue;
+
+                float evaluated[5];
+                shaders().evaluateMaterial(
+                    material.data(), &V.x, &sampled[3], random0, random1, evaluated);
+                ASSERT_EQ(evaluated[4], sampled[7]) << "Lobe mismatch, sample " << i;
+                ASSERT_NEAR(evaluated[3], pdf, pdf * 1.0e-2f) << "PDF mismatch, sample " << i;
+                for (int c = 0; c < 3; c++)
+                {
+                    ASSERT_NEAR(evaluated[c], sampled[c], sampled[c] * 1.0e-2f + 1.0e-6f);
+                }
+            }
+        }
+    }
+}
+
+// Test that materials do not reflect more energy than they receive (a "white furnace" test), and
+// that a white diffuse material reflects nearly all of it.
+TEST_F(HostShadersTest, TestEnergyConservation)
+{
+    TestHelpers::HostMaterial diffuse;
+    diffuse.specular = 0.0f;
+    TestHelpers::HostMaterial dielectric;
+    TestHelpers::HostMaterial metal;
+    metal.metalness         = 1.0f;
+    metal.specularRoughness = 0.3f;
+
+    for (float angle : { 0.0f, 0.7f, 1.3f })
+    {
+        vec3 V = viewDirection(angle);
+        ASSERT_NEAR(estimateAlbedo(diffuse, V), 1.0f, 0.05f);
+        ASSERT_LE(estimateAlbedo(dielectric, V), 1.05f);
+        float metalAlbedo = estimateAlbedo(metal, V);
+        ASSERT_LE(metalAlbedo, 1.05f);
+        ASSERT_GT(metalAlbedo, 0.8f);
+    }
+}
+
+// Test that Russian roulette path termination is unbiased, i.e. it gives the same average radiance
+// as tracing every path to the maximum depth, while tracing fewer path segments.
+TEST_F(HostShadersTest, TestRussianRoulette)
+{
+    TestHelpers::HostMaterial materials[2];
+    materials[1].baseColor[0] = 0.2f;
+    materials[1].metalness    = 1.0f;
+
+    const int kMaxTraceDepth  = 10;
+    const uint32_t kPathCount = 200000;
+    for (TestHelpers::HostMaterial& material : materials)
+    {
+        float reference[4];
+        float roulette[4];
+        shaders().traceFurnacePaths(
+            material.data(), 1.0f, kMaxTraceDepth, kMaxTraceDepth + 1, 1, kPathCount, reference);
+        shaders().traceFurnacePaths(
+            material.data(), 1.0f, kMaxTraceDepth, 2, 2, kPathCount, roulette);
+
+        // The radiance matches within the expected noise, for each channel.
+        for (int c = 0; c < 3; c++)
+        {
+            ASSERT_NEAR(roulette[c], reference[c], reference[c] * 0.02f) << "Channel " << c;
+        }
+
+        // Fewer path segments are traced.
+        ASSERT_LT(roulette[3], reference[3]);
+    }
+}
+
+} // namespace
+
+#endif
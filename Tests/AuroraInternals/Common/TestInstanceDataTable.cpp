@@ -0,0 +1,161 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if !defined(DISABLE_UNIT_TESTS)
+
+#include "TestHelpers.h"
+#include <gtest/gtest.h>
+
+// Include the Aurora PCH (this is an internal test so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "InstanceDataTable.h"
+
+namespace
+{
+
+// Test fixture for the instance data table.
+class InstanceDataTableTest : public ::testing::Test
+{
+public:
+    InstanceDataTableTest() {}
+    ~InstanceDataTableTest() {}
+};
+
+// Creates the instance data for a geometry and material offset, with optional layers.
+InstanceDataTable::Key createKey(
+    const void* pGeometry, int materialOffset, vector<pair<int, int>> layers = {})
+{
+    InstanceDataTable::Key key;
+    key.pGeometry      = pGeometry;
+    key.materialOffset = materialOffset;
+    key.layers         = layers;
+
+    return key;
+}
+
+// Test that instances with the same data share an entry, and that changing the data of an instance
+// only changes the entry of that instance.
+TEST_F(InstanceDataTableTest, TestSharing)
+{
+    int geom1, geom2;
+    int inst[4];
+    InstanceDataTable table;
+
+    // Instances with identical data share an entry, and the layers are part of the data.
+    ASSERT_TRUE(table.set(&inst[0], createKey(&geom1, 0)));
+    ASSERT_TRUE(table.set(&inst[1], createKey(&geom1, 0)));
+    ASSERT_TRUE(table.set(&inst[2], createKey(&geom2, 0)));
+    ASSERT_TRUE(table.set(&inst[3], createKey(&geom1, 0, { { 64, 0 } })));
+    ASSERT_EQ(table.instanceCount(), 4u);
+    ASSERT_EQ(table.entryCount(), 3u);
+    ASSERT_EQ(table.index(&inst[0]), table.index(&inst[1]));
+    ASSERT_NE(table.index(&inst[0]), table.index(&inst[2]));
+    ASSERT_NE(table.index(&inst[0]), table.index(&inst[3]));
+    ASSERT_EQ(table.entry(table.index(&inst[3]))->layers.size(), 1u);
+    ASSERT_TRUE(table.isModified());
+    table.clearModified();
+
+    // Setting the same data again, e.g. when only the transform of an instance has changed, does
+    // not change the table.
+    ASSERT_FALSE(table.set(&inst[1], createKey(&geom1, 0)));
+    ASSERT_FALSE(table.isModified());
+
+    // Moving an instance to the data of an existing entry doesn't add an entry.
+    int index2 = table.index(&inst[2]);
+    ASSERT_TRUE(table.set(&inst[1], createKey(&geom2, 0)));
+    ASSERT_EQ(table.index(&inst[1]), index2);
+    ASSERT_EQ(table.entryCount(), 3u);
+    ASSERT_FALSE(table.isModified());
+
+    // Changing the material of an instance adds an entry, without changing the other entries.
+    int index0 = table.index(&inst[0]);
+    int index3 = table.index(&inst[3]);
+    ASSERT_TRUE(table.set(&inst[3], createKey(&geom1, 128)));
+    ASSERT_EQ(table.index(&inst[0]), index0);
+    ASSERT_EQ(table.index(&inst[2]), index2);
+    ASSERT_EQ(table.entry(table.index(&inst[3]))->materialOffset, 128);
+    ASSERT_TRUE(table.isModified());
+
+    // The entry released by the instance is no longer in the table.
+    ASSERT_NE(table.index(&inst[3]), index3);
+    ASSERT_EQ(table.entry(index3), nullptr);
+    ASSERT_EQ(table.entryCount(), 3u);
+}
+
+// Test that removed instances release their entries, and that the unused slots are reused and can
+// be compacted.
+TEST_F(InstanceDataTableTest, TestRemove)
+{
+    int geom;
+    int inst[4];
+    InstanceDataTable table;
+    for (int i = 0; i < 4; i++)
+    {
+        table.set(&inst[i], createKey(&geom, i * 64));
+    }
+    ASSERT_EQ(table.slotCount(), 4u);
+    table.clearModified();
+
+    // Removing an instance frees its slot, leaving the other indices unchanged.
+    int index1 = table.index(&inst[1]);
+    int index3 = table.index(&inst[3]);
+    ASSERT_TRUE(table.remove(&inst[1]));
+    ASSERT_FALSE(table.remove(&inst[1]));
+    ASSERT_FALSE(table.contains(&inst[1]));
+    ASSERT_EQ(table.index(&inst[1]), -1);
+    ASSERT_EQ(table.entry(index1), nullptr);
+    ASSERT_EQ(table.index(&inst[3]), index3);
+    ASSERT_EQ(table.entryCount(), 3u);
+    ASSERT_EQ(table.slotCount(), 4u);
+    ASSERT_TRUE(table.isModified());
+
+    // An entry is kept until the last instance that uses it is removed.
+    int shared;
+    table.set(&shared, createKey(&geom, 0));
+    ASSERT_EQ(table.index(&shared), table.index(&inst[0]));
+    table.remove(&inst[0]);
+    ASSERT_NE(table.entry(table.index(&shared)), nullptr);
+
+    // A new entry reuses the free slot.
+    table.set(&inst[1], createKey(&geom, 256));
+    ASSERT_EQ(table.index(&inst[1]), index1);
+    ASSERT_EQ(table.slotCount(), 4u);
+
+    // Compacting removes the unused slots, keeping the data of each instance.
+    table.remove(&inst[2]);
+    ASSERT_EQ(table.slotCount(), 4u);
+    ASSERT_TRUE(table.compact());
+    ASSERT_FALSE(table.compact());
+    ASSERT_EQ(table.slotCount(), 3u);
+    ASSERT_EQ(table.entryCount(), 3u);
+    ASSERT_EQ(table.instances().size(), 3u);
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_NE(table.entry(i), nullptr);
+    }
+    ASSERT_EQ(table.entry(table.index(&shared))->materialOffset, 0);
+    ASSERT_EQ(table.entry(table.index(&inst[1]))->materialOffset, 256);
+    ASSERT_EQ(table.entry(table.index(&inst[3]))->materialOffset, 192);
+    ASSERT_FALSE(table.set(&inst[3], createKey(&geom, 192)));
+
+    // Clearing the table removes everything.
+    table.clear();
+    ASSERT_EQ(table.instanceCount(), 0u);
+    ASSERT_EQ(table.slotCount(), 0u);
+}
+
+} // namespace
+
+#endif
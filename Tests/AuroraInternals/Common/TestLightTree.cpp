@@ -0,0 +1,239 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if !defined(DISABLE_UNIT_TESTS)
+
+#include "TestHelpers.h"
+#include <gtest/gtest.h>
+
+// Include the Aurora PCH (this is an internal test so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "LightTree.h"
+
+#include <random>
+
+namespace
+{
+
+using Aurora::LightTree;
+
+// Test fixture with helper functions for creating lights.
+class LightTreeTest : public ::testing::Test
+{
+public:
+    LightTreeTest() {}
+    ~LightTreeTest() {}
+
+    // Creates a point light with the specified position and intensity.
+    static LightTree::Light pointLight(const vec3& position, float intensity = 1.0f)
+    {
+        LightTree::Light light;
+        light.type              = LightTree::kPoint;
+        light.position          = position;
+        light.radius            = 0.1f;
+        light.colorAndIntensity = vec4(1.0f, 1.0f, 1.0f, intensity);
+
+        return light;
+    }
+
+    // Creates a random mix of point, spot, and rect lights in a 100 unit cube.
+    std::vector<LightTree::Light> createRandomLights(size_t count)
+    {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        std::vector<LightTree::Light> lights(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            vec3 position(distribution(_random), distribution(_random), distribution(_random));
+            lights[i] = pointLight(position * 50.0f, distribution(_random) + 1.5f);
+            vec3 direction(distribution(_random), distribution(_random), distribution(_random));
+            direction = normalize(direction + vec3(0.0f, 0.0f, 0.01f));
+            if (i % 3 == 1)
+            {
+                lights[i].type          = LightTree::kSpot;
+                lights[i].direction     = direction;
+                lights[i].cosOuterAngle = cos(0.5f);
+                lights[i].cosInnerAngle = cos(0.4f);
+            }
+            else if (i % 3 == 2)
+            {
+                lights[i].type      = LightTree::kRect;
+                lights[i].direction = direction;
+                lights[i].tangent   = normalize(cross(direction, vec3(0.0f, 1.0f, 0.0f)));
+                lights[i].width     = 2.0f;
+                lights[i].height    = 1.0f;
+            }
+        }
+
+        return lights;
+    }
+
+private:
+    std::mt19937 _random;
+};
+
+// Test that empty trees and trees with a single light can be sampled.
+TEST_F(LightTreeTest, TestSmallTrees)
+{
+    LightTree tree;
+    float pdf = 1.0f;
+    tree.build({});
+    ASSERT_TRUE(tree.nodes().empty());
+    ASSERT_EQ(tree.sample(vec3(0.0f), vec3(0.0f), 0.5f, pdf), -1);
+    ASSERT_EQ(pdf, 0.0f);
+
+    tree.build({ pointLight(vec3(1.0f, 2.0f, 3.0f)) });
+    ASSERT_EQ(tree.nodes().size(), 1);
+    ASSERT_EQ(tree.depth(), 1);
+    ASSERT_EQ(tree.sample(vec3(0.0f), vec3(0.0f), 0.5f, pdf), 0);
+    ASSERT_EQ(pdf, 1.0f);
+    ASSERT_EQ(tree.pdf(vec3(0.0f), vec3(0.0f), 0), 1.0f);
+}
+
+// Test that the light selection probabilities form a valid distribution, matching the
+// probabilities returned by sampling, for a range of shading points. Sampling may not choose a
+// light when none of the lights in a node can illuminate the shading point, so the probabilities
+// can add up to less than one.
+TEST_F(LightTreeTest, TestProbabilities)
+{
+    std::vector<LightTree::Light> lights = createRandomLights(300);
+    LightTree tree;
+    tree.build(lights);
+    ASSERT_EQ(tree.nodes().size(), lights.size() * 2 - 1);
+
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::mt19937 random;
+    for (int i = 0; i < 20; i++)
+    {
+        vec3 position(distribution(random), distribution(random), distribution(random));
+        position *= 60.0f;
+        vec3 normal = i % 2 ? vec3(0.0f) : normalize(vec3(0.3f, 1.0f, -0.2f));
+
+        // The probabilities of all the lights add up to at most one.
+        double sum = 0.0;
+        for (size_t light = 0; light < lights.size(); light++)
+        {
+            sum += tree.pdf(position, normal, static_cast<int>(light));
+        }
+        ASSERT_LE(sum, 1.0 + 1.0e-4);
+
+        // Sampled lights have the probability returned by pdf(), and the fraction of samples that
+        // choose a light matches the total probability.
+        const int kSampleCount = 10000;
+        int lightCount         = 0;
+        for (int sample = 0; sample < kSampleCount; sample++)
+        {
+            float pdf      = 0.0f;
+            float random   = (sample + 0.5f) / kSampleCount;
+            int lightIndex = tree.sample(position, normal, random, pdf);
+            if (lightIndex < 0)
+            {
+                ASSERT_EQ(pdf, 0.0f);
+                continue;
+            }
+
+            ASSERT_GT(pdf, 0.0f);
+            ASSERT_NEAR(pdf, tree.pdf(position, normal, lightIndex), pdf * 1.0e-4f);
+            lightCount++;
+        }
+        ASSERT_NEAR(static_cast<double>(lightCount) / kSampleCount, sum, 1.0e-3);
+    }
+}
+
+// Test that the frequency of sampling each light matches its probability.
+TEST_F(LightTreeTest, TestSamplingFrequency)
+{
+    std::vector<LightTree::Light> lights = createRandomLights(40);
+    LightTree tree;
+    tree.build(lights);
+
+    vec3 position(5.0f, -3.0f, 2.0f);
+    vec3 normal(0.0f, 0.0f, 1.0f);
+    const int kSampleCount = 100000;
+    std::vector<int> counts(lights.size(), 0);
+    for (int i = 0; i < kSampleCount; i++)
+    {
+        float pdf      = 0.0f;
+        int lightIndex = tree.sample(position, normal, (i + 0.5f) / kSampleCount, pdf);
+        if (lightIndex >= 0)
+        {
+            counts[lightIndex]++;
+        }
+    }
+
+    for (size_t i = 0; i < lights.size(); i++)
+    {
+        float expected = tree.pdf(position, normal, static_cast<int>(i));
+        ASSERT_NEAR(static_cast<float>(counts[i]) / kSampleCount, expected, 1.0e-3f);
+    }
+}
+
+// Test that brighter and closer lights are more important, and that lights which can't
+// illuminate the shading point are never chosen.
+TEST_F(LightTreeTest, TestImportance)
+{
+    std::vector<LightTree::Light> lights = { pointLight(vec3(0.0f, 0.0f, 10.0f)),
+        pointLight(vec3(10.0f, 0.0f, 10.0f), 4.0f), pointLight(vec3(0.0f, 0.0f, 100.0f), 4.0f),
+        pointLight(vec3(0.0f, 0.0f, -10.0f), 100.0f) };
+
+    // Add a spot light pointing away from the shading point, and a rect light facing away.
+    LightTree::Light spotLight = pointLight(vec3(0.0f, 10.0f, 10.0f), 100.0f);
+    spotLight.type             = LightTree::kSpot;
+    spotLight.direction        = vec3(0.0f, 1.0f, 0.0f);
+    spotLight.cosOuterAngle    = cos(0.5f);
+    spotLight.cosInnerAngle    = cos(0.5f);
+    LightTree::Light rectLight = pointLight(vec3(-10.0f, 0.0f, 10.0f), 100.0f);
+    rectLight.type             = LightTree::kRect;
+    rectLight.direction        = vec3(-1.0f, 0.0f, 0.0f);
+    rectLight.tangent          = vec3(0.0f, 1.0f, 0.0f);
+    lights.push_back(spotLight);
+    lights.push_back(rectLight);
+
+    LightTree tree;
+    tree.build(lights);
+    vec3 position(0.0f);
+    vec3 normal(0.0f, 0.0f, 1.0f);
+    ASSERT_GT(tree.pdf(position, normal, 1), tree.pdf(position, normal, 0));
+    ASSERT_GT(tree.pdf(position, normal, 0), tree.pdf(position, normal, 2));
+
+    // The light below the surface, and the lights facing away, are never chosen.
+    ASSERT_EQ(tree.pdf(position, normal, 3), 0.0f);
+    ASSERT_EQ(tree.pdf(position, normal, 4), 0.0f);
+    ASSERT_EQ(tree.pdf(position, normal, 5), 0.0f);
+
+    // Without a normal, the light below the surface is the most important.
+    ASSERT_GT(tree.pdf(position, vec3(0.0f), 3), 0.5f);
+}
+
+// Test that the depth of the tree grows logarithmically with the number of lights.
+TEST_F(LightTreeTest, TestDepth)
+{
+    for (size_t count : { 64, 1024, 16384 })
+    {
+        std::vector<LightTree::Light> lights = createRandomLights(count);
+        LightTree tree;
+        tree.build(lights);
+        ASSERT_LE(tree.depth(), 3 * static_cast<int>(log2(count))) << count << " lights";
+    }
+
+    // Lights at the same position are split evenly.
+    std::vector<LightTree::Light> lights(1000, pointLight(vec3(1.0f)));
+    LightTree tree;
+    tree.build(lights);
+    ASSERT_EQ(tree.depth(), 11);
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,140 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if !defined(DISABLE_UNIT_TESTS)
+
+#include "TestHelpers.h"
+#include <gtest/gtest.h>
+
+// Include the Aurora PCH (this is an internal test so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "RenderRegion.h"
+
+namespace
+{
+
+// Test fixture for render regions and tiles.
+class RenderRegionTest : public ::testing::Test
+{
+public:
+    RenderRegionTest() {}
+    ~RenderRegionTest() {}
+};
+
+// Gets whether two pixel regions are equal.
+bool isEqual(const PixelRegion& region1, const PixelRegion& region2)
+{
+    return region1.x == region2.x && region1.y == region2.y && region1.width == region2.width &&
+        region1.height == region2.height;
+}
+
+// Test that the rendered region is clipped to the targets, and maps dispatch indices to the
+// targets and the image.
+TEST_F(RenderRegionTest, TestRegion)
+{
+    RenderRegion renderRegion;
+    uvec2 targetDims(640, 480);
+
+    // With no region, the whole targets are rendered, and they are the whole image.
+    ASSERT_TRUE(isEqual(renderRegion.clip(targetDims), { 0, 0, 640, 480 }));
+    ASSERT_EQ(renderRegion.imageDimensions(targetDims), targetDims);
+    ASSERT_EQ(renderRegion.imageCoords(uvec2(10, 20), targetDims), uvec2(10, 20));
+
+    // A region inside the targets is rendered as it is, with the dispatch index offset by the
+    // region.
+    renderRegion.setRegion({ 100, 50, 200, 100 });
+    ASSERT_TRUE(isEqual(renderRegion.clip(targetDims), { 100, 50, 200, 100 }));
+    ASSERT_EQ(renderRegion.targetCoords(uvec2(0, 0), targetDims), uvec2(100, 50));
+    ASSERT_EQ(renderRegion.imageCoords(uvec2(199, 99), targetDims), uvec2(299, 149));
+
+    // A region that extends past the targets is clipped to them, and a region that doesn't
+    // overlap them is ignored.
+    renderRegion.setRegion({ 600, 400, 200, 200 });
+    ASSERT_TRUE(isEqual(renderRegion.clip(targetDims), { 600, 400, 40, 80 }));
+    renderRegion.setRegion({ 640, 0, 10, 10 });
+    ASSERT_TRUE(isEqual(renderRegion.clip(targetDims), { 0, 0, 640, 480 }));
+
+    // The thread groups cover the region, including partial groups at the edges.
+    ASSERT_EQ(RenderRegion::threadGroupCount({ 600, 400, 40, 80 }, uvec2(16, 8)), uvec2(3, 10));
+    ASSERT_EQ(RenderRegion::threadGroupCount({ 0, 0, 640, 480 }, uvec2(16, 8)), uvec2(40, 60));
+
+    // When the targets are a tile of a larger image, the image coordinates are offset by the
+    // position of the tile, and camera rays use the image dimensions.
+    renderRegion.setRegion({ 10, 10, 20, 20 });
+    renderRegion.setTile(uvec2(1920, 1080), uvec2(640, 480));
+    ASSERT_EQ(renderRegion.imageDimensions(targetDims), uvec2(1920, 1080));
+    ASSERT_EQ(renderRegion.targetCoords(uvec2(5, 5), targetDims), uvec2(15, 15));
+    ASSERT_EQ(renderRegion.imageCoords(uvec2(5, 5), targetDims), uvec2(655, 495));
+
+    // Clearing the tile makes the targets the whole image again.
+    renderRegion.setTile(uvec2(0, 0), uvec2(0, 0));
+    ASSERT_EQ(renderRegion.imageDimensions(targetDims), targetDims);
+}
+
+// Test that the tiles for an image cover it without overlapping, within the pixel limit.
+TEST_F(RenderRegionTest, TestTiles)
+{
+    // Checks that the tiles cover every pixel of an image once, with at most the specified number
+    // of pixels in each tile.
+    auto checkTiles = [](const vector<PixelRegion>& tiles, uint32_t width, uint32_t height,
+                          size_t maxTilePixels) {
+        vector<int> coverage(static_cast<size_t>(width) * height, 0);
+        for (const PixelRegion& tile : tiles)
+        {
+            ASSERT_FALSE(tile.isEmpty());
+            ASSERT_LE(static_cast<size_t>(tile.width) * tile.height, maxTilePixels);
+            ASSERT_LE(tile.x + tile.width, width);
+            ASSERT_LE(tile.y + tile.height, height);
+            for (uint32_t y = tile.y; y < tile.y + tile.height; y++)
+            {
+                for (uint32_t x = tile.x; x < tile.x + tile.width; x++)
+                {
+                    coverage[y * width + x]++;
+                }
+            }
+        }
+        for (int count : coverage)
+        {
+            ASSERT_EQ(count, 1);
+        }
+    };
+
+    // An image within the limit, or with no limit, is a single tile.
+    vector<PixelRegion> tiles = computeRenderTiles(640, 480, 640 * 480);
+    ASSERT_EQ(tiles.size(), 1u);
+    ASSERT_TRUE(isEqual(tiles[0], { 0, 0, 640, 480 }));
+    ASSERT_EQ(computeRenderTiles(640, 480, 0).size(), 1u);
+    ASSERT_TRUE(computeRenderTiles(0, 480, 1000).empty());
+
+    // A large image is split into balanced tiles, ordered by row.
+    tiles = computeRenderTiles(1000, 1000, 256 * 256);
+    ASSERT_EQ(tiles.size(), 16u);
+    ASSERT_TRUE(isEqual(tiles[0], { 0, 0, 250, 250 }));
+    ASSERT_TRUE(isEqual(tiles[1], { 250, 0, 250, 250 }));
+    ASSERT_TRUE(isEqual(tiles[4], { 0, 250, 250, 250 }));
+    checkTiles(tiles, 1000, 1000, 256 * 256);
+
+    // Tiles of a wide image use the full height, and images that don't divide evenly have
+    // smaller tiles at the edges.
+    tiles = computeRenderTiles(4000, 100, 100000);
+    ASSERT_EQ(tiles[0].height, 100u);
+    checkTiles(tiles, 4000, 100, 100000);
+    checkTiles(computeRenderTiles(1921, 1081, 512 * 512), 1921, 1081, 512 * 512);
+    checkTiles(computeRenderTiles(7, 3, 2), 7, 3, 2);
+}
+
+} // namespace
+
+#endif
@@ -442,6 +442,75 @@ TEST_F(ResourcesTest, TrackerUpdateTest)
     ASSERT_EQ(activeNotifier.count(), 2);
 }
 
+// A resource stub that reports a fixed amount of memory when active.
+class BlobResource : public Aurora::ResourceStub
+{
+public:
+    BlobResource(const Aurora::Path& path, const Aurora::ResourceMap& container) :
+        Aurora::ResourceStub(path, container)
+    {
+    }
+    virtual ~BlobResource() { shutdown(); }
+
+    void createResource() override { _resource = make_shared<vector<uint8_t>>(1000); }
+    void destroyResource() override { _resource.reset(); }
+    const ResourceType& type() override { return resourceType; }
+    void addMemoryUsage(Aurora::MemoryStatistics& statistics) override
+    {
+        statistics.resources[resourceType].cpuBytes += _resource->size();
+        statistics.resources[resourceType].deviceBytes += 2 * _resource->size();
+    }
+
+    static constexpr ResourceType resourceType = ResourceType::Geometry;
+
+private:
+    shared_ptr<vector<uint8_t>> _resource;
+};
+
+TEST_F(ResourcesTest, MemoryStatisticsTest)
+{
+    Aurora::ResourceMap resources;
+    resources["blob0"] = make_shared<BlobResource>("blob0", resources);
+    resources["blob1"] = make_shared<BlobResource>("blob1", resources);
+    resources["bar0"]  = make_shared<BarResource>("bar0", resources);
+
+    // Inactive resources are counted, but don't use any memory.
+    Aurora::MemoryStatistics statistics;
+    Aurora::addMemoryUsage(resources, statistics);
+    const Aurora::ResourceMemoryUsage& blobUsage = statistics.resources[ResourceType::Geometry];
+    ASSERT_EQ(blobUsage.count, 2);
+    ASSERT_EQ(blobUsage.activeCount, 0);
+    ASSERT_EQ(blobUsage.cpuBytes, 0);
+    ASSERT_EQ(statistics.resources[ResourceType::Environment].count, 1);
+    ASSERT_EQ(statistics.total().count, 3);
+
+    // Active resources add the memory used by their renderer resources.
+    resources["blob0"]->incrementPermanentRefCount();
+    resources["bar0"]->incrementPermanentRefCount();
+    statistics = Aurora::MemoryStatistics();
+    Aurora::addMemoryUsage(resources, statistics);
+    ASSERT_EQ(blobUsage.count, 2);
+    ASSERT_EQ(blobUsage.activeCount, 1);
+    ASSERT_EQ(blobUsage.cpuBytes, 1000);
+    ASSERT_EQ(blobUsage.deviceBytes, 2000);
+    ASSERT_EQ(statistics.resources[ResourceType::Environment].activeCount, 1);
+    ASSERT_EQ(statistics.resources[ResourceType::Environment].cpuBytes, 0);
+
+    // The totals include all the resource types.
+    Aurora::ResourceMemoryUsage total = statistics.total();
+    ASSERT_EQ(total.count, 3);
+    ASSERT_EQ(total.activeCount, 2);
+    ASSERT_EQ(total.cpuBytes, 1000);
+    ASSERT_EQ(total.deviceBytes, 2000);
+
+    // Deactivated resources no longer use memory.
+    resources["blob0"]->decrementPermanentRefCount();
+    statistics = Aurora::MemoryStatistics();
+    Aurora::addMemoryUsage(resources, statistics);
+    ASSERT_EQ(blobUsage.activeCount, 0);
+    ASSERT_EQ(statistics.total().cpuBytes, 0);
+}
+
 } // namespace
 
 #endif
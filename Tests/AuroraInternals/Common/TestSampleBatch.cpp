@@ -0,0 +1,149 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if !defined(DISABLE_UNIT_TESTS)
+
+#include "TestHelpers.h"
+#include <gtest/gtest.h>
+
+// Include the Aurora PCH (this is an internal test so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "SampleBatch.h"
+
+namespace
+{
+
+// A mock of the GPU commands for a batch of samples. This simulates a GPU queue: commands are
+// queued when they are recorded and only complete when there is a wait, and the sample data of
+// each slot is copied from a CPU staging buffer when the upload completes. This detects a slot
+// being overwritten before the GPU has read it.
+class MockSampleBatchCommands : public Aurora::ISampleBatchCommands
+{
+public:
+    MockSampleBatchCommands(uint32_t slotCount) :
+        _stagingSlots(slotCount, UINT32_MAX), _gpuSlots(slotCount, UINT32_MAX)
+    {
+    }
+
+    void uploadFrameData() override { log.push_back("frame"); }
+
+    void uploadSampleData(uint32_t firstSlot, uint32_t firstSampleIndex, uint32_t count) override
+    {
+        log.push_back("upload " + to_string(firstSlot) + " " + to_string(count));
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t slot       = firstSlot + i;
+            _stagingSlots[slot] = firstSampleIndex + i;
+            _queue.push_back([this, slot]() { _gpuSlots[slot] = _stagingSlots[slot]; });
+        }
+    }
+
+    void renderSample(uint32_t slot, bool wait) override
+    {
+        log.push_back("render " + to_string(slot) + (wait ? " wait" : ""));
+        _queue.push_back([this, slot]() { renderedSamples.push_back(_gpuSlots[slot]); });
+        if (wait)
+        {
+            flush();
+        }
+    }
+
+    void postProcess(bool wait) override
+    {
+        log.push_back(string("post") + (wait ? " wait" : ""));
+        if (wait)
+        {
+            flush();
+        }
+    }
+
+    // The recorded commands, and the sample indices read by the samples on the GPU.
+    vector<string> log;
+    vector<uint32_t> renderedSamples;
+
+private:
+    // Executes the queued commands, as the GPU does before a wait returns.
+    void flush()
+    {
+        for (auto& command : _queue)
+        {
+            command();
+        }
+        _queue.clear();
+    }
+
+    vector<uint32_t> _stagingSlots;
+    vector<uint32_t> _gpuSlots;
+    vector<function<void()>> _queue;
+};
+
+// Test that a batch that fits in the ring is uploaded once, with a single wait at the end.
+TEST(SampleBatchTest, TestSingleUpload)
+{
+    MockSampleBatchCommands commands(8);
+    Aurora::recordSampleBatch(commands, 8, 10, 3);
+
+    vector<string> expected = { "frame", "upload 0 3", "render 0", "render 1", "render 2",
+        "post wait" };
+    ASSERT_EQ(commands.log, expected);
+    vector<uint32_t> expectedSamples = { 10, 11, 12 };
+    ASSERT_EQ(commands.renderedSamples, expectedSamples);
+}
+
+// Test that a batch with more samples than slots waits before each slot is reused, and every
+// sample reads its own sample index.
+TEST(SampleBatchTest, TestRingWrap)
+{
+    MockSampleBatchCommands commands(4);
+    Aurora::recordSampleBatch(commands, 4, 0, 10);
+
+    size_t waitCount = count_if(commands.log.begin(), commands.log.end(),
+        [](const string& command) { return command.find("wait") != string::npos; });
+    ASSERT_EQ(waitCount, 3u);
+    ASSERT_EQ(commands.log[1], "upload 0 4");
+    ASSERT_EQ(commands.log[5], "render 3 wait");
+    ASSERT_EQ(commands.log.back(), "post wait");
+    ASSERT_EQ(commands.renderedSamples.size(), 10u);
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        ASSERT_EQ(commands.renderedSamples[i], i);
+    }
+}
+
+// Test that a batch exactly the size of the ring has no wait before post-processing.
+TEST(SampleBatchTest, TestFullRing)
+{
+    MockSampleBatchCommands commands(4);
+    Aurora::recordSampleBatch(commands, 4, 4, 4);
+
+    vector<string> expected = { "frame", "upload 0 4", "render 0", "render 1", "render 2",
+        "render 3", "post wait" };
+    ASSERT_EQ(commands.log, expected);
+    vector<uint32_t> expectedSamples = { 4, 5, 6, 7 };
+    ASSERT_EQ(commands.renderedSamples, expectedSamples);
+}
+
+// Test that an empty batch records no commands.
+TEST(SampleBatchTest, TestEmptyBatch)
+{
+    MockSampleBatchCommands commands(4);
+    Aurora::recordSampleBatch(commands, 4, 0, 0);
+
+    ASSERT_TRUE(commands.log.empty());
+}
+
+} // namespace
+
+#endif
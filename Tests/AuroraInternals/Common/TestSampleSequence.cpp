@@ -0,0 +1,221 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if !defined(DISABLE_UNIT_TESTS)
+
+#include "TestHelpers.h"
+#include <gtest/gtest.h>
+
+// Include the Aurora PCH (this is an internal test so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "SampleSequence.h"
+
+#include <random>
+
+namespace
+{
+
+namespace SampleSequence = Aurora::SampleSequence;
+
+// Test fixture with helper functions for estimating integrals.
+class SampleSequenceTest : public ::testing::Test
+{
+public:
+    SampleSequenceTest() {}
+    ~SampleSequenceTest() {}
+
+    // A smooth function over the unit square, and its integral.
+    static double function(double x, double y) { return sin(M_PI * x) * exp(y); }
+    static double integral() { return 2.0 / M_PI * (exp(1.0) - 1.0); }
+
+    // Computes the root mean square error of estimates of the integral of the function, with the
+    // specified number of samples for each estimate. The sample function is called with the index
+    // of the estimate and the index of the sample.
+    template <typename SampleFunction>
+    static double rmsError(uint32_t sampleCount, SampleFunction sample)
+    {
+        static constexpr uint32_t kEstimateCount = 64;
+
+        double sumSquaredError = 0.0;
+        for (uint32_t estimate = 0; estimate < kEstimateCount; estimate++)
+        {
+            double sum = 0.0;
+            for (uint32_t i = 0; i < sampleCount; i++)
+            {
+                vec2 point = sample(estimate, i);
+                sum += function(point.x, point.y);
+            }
+            double error = sum / sampleCount - integral();
+            sumSquaredError += error * error;
+        }
+
+        return sqrt(sumSquaredError / kEstimateCount);
+    }
+
+    // Computes the variance of the averages of each block of pixels with the specified size, for a
+    // single channel of a square image.
+    static double blockVariance(const std::vector<float>& values, uint32_t size, uint32_t blockSize)
+    {
+        double sum        = 0.0;
+        double sumSquared = 0.0;
+        uint32_t count    = 0;
+        for (uint32_t by = 0; by < size; by += blockSize)
+        {
+            for (uint32_t bx = 0; bx < size; bx += blockSize)
+            {
+                double average = 0.0;
+                for (uint32_t y = by; y < by + blockSize; y++)
+                {
+                    for (uint32_t x = bx; x < bx + blockSize; x++)
+                    {
+                        average += values[y * size + x];
+                    }
+                }
+                average /= blockSize * blockSize;
+                sum += average;
+                sumSquared += average * average;
+                count++;
+            }
+        }
+        double mean = sum / count;
+
+        return sumSquared / count - mean * mean;
+    }
+};
+
+// Test that the hash functions give different results for different inputs.
+TEST_F(SampleSequenceTest, TestHash)
+{
+    ASSERT_NE(SampleSequence::hash(0), SampleSequence::hash(1));
+    ASSERT_NE(SampleSequence::hashCombine(7, 0), SampleSequence::hashCombine(7, 1));
+    ASSERT_NE(SampleSequence::hashCombine(7, 0), SampleSequence::hashCombine(8, 0));
+}
+
+// Test that every power-of-two prefix of the Sobol sequence is stratified, for any seed, i.e. there
+// is exactly one point in each cell of every grid (elementary interval) with that number of cells.
+TEST_F(SampleSequenceTest, TestSobolStratification)
+{
+    static constexpr uint32_t kLog2Count = 8;
+    static constexpr uint32_t kCount     = 1 << kLog2Count;
+    for (uint32_t seed : { 0u, 1u, 12345u })
+    {
+        std::vector<vec2> points(kCount);
+        for (uint32_t i = 0; i < kCount; i++)
+        {
+            points[i] = SampleSequence::sobol2D(i, seed);
+            ASSERT_GE(points[i].x, 0.0f);
+            ASSERT_LT(points[i].x, 1.0f);
+            ASSERT_GE(points[i].y, 0.0f);
+            ASSERT_LT(points[i].y, 1.0f);
+        }
+
+        for (uint32_t log2X = 0; log2X <= kLog2Count; log2X++)
+        {
+            uint32_t cellsX = 1 << log2X;
+            uint32_t cellsY = kCount / cellsX;
+            std::vector<int> counts(kCount, 0);
+            for (const vec2& point : points)
+            {
+                uint32_t cellX = static_cast<uint32_t>(point.x * cellsX);
+                uint32_t cellY = static_cast<uint32_t>(point.y * cellsY);
+                counts[cellY * cellsX + cellX]++;
+            }
+            for (int count : counts)
+            {
+                ASSERT_EQ(count, 1) << "Seed " << seed << ", grid " << cellsX << "x" << cellsY;
+            }
+        }
+    }
+
+    // Different seeds give different points.
+    ASSERT_NE(SampleSequence::sobol2D(3, 0), SampleSequence::sobol2D(3, 1));
+}
+
+// Test that the Sobol sequence converges faster than pseudorandom numbers, i.e. it has a much lower
+// error at equal sample counts, and that the error decreases faster as the sample count increases.
+TEST_F(SampleSequenceTest, TestSobolConvergence)
+{
+    std::mt19937 random;
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    auto randomSample = [&](uint32_t, uint32_t) {
+        return vec2(distribution(random), distribution(random));
+    };
+    auto sobolSample = [](uint32_t estimate, uint32_t i) {
+        return SampleSequence::sobol2D(i, SampleSequence::hash(estimate));
+    };
+
+    double previousRandomError = 0.0;
+    double previousSobolError  = 0.0;
+    for (uint32_t sampleCount : { 64u, 1024u })
+    {
+        double randomError = rmsError(sampleCount, randomSample);
+        double sobolError  = rmsError(sampleCount, sobolSample);
+        ASSERT_LT(sobolError, randomError * 0.1) << sampleCount << " samples";
+
+        if (previousSobolError > 0.0)
+        {
+            ASSERT_LT(sobolError / previousSobolError, randomError / previousRandomError);
+        }
+        previousRandomError = randomError;
+        previousSobolError  = sobolError;
+    }
+}
+
+// Test that each channel of the blue-noise mask has every value once, and that the local averages
+// of the mask are much more uniform than for white noise, i.e. it has little low-frequency content.
+TEST_F(SampleSequenceTest, TestBlueNoise)
+{
+    const uint32_t size       = SampleSequence::kBlueNoiseSize;
+    const uint32_t pixelCount = size * size;
+    std::vector<vec2> mask    = SampleSequence::buildBlueNoise(size, 0);
+    ASSERT_EQ(mask.size(), pixelCount);
+
+    std::mt19937 random;
+    std::vector<float> whiteNoise(pixelCount);
+    for (uint32_t i = 0; i < pixelCount; i++)
+    {
+        whiteNoise[i] = (i + 0.5f) / pixelCount;
+    }
+    std::shuffle(whiteNoise.begin(), whiteNoise.end(), random);
+    double whiteVariance = blockVariance(whiteNoise, size, 8);
+
+    for (int channel = 0; channel < 2; channel++)
+    {
+        std::vector<float> values(pixelCount);
+        std::vector<int> counts(pixelCount, 0);
+        for (uint32_t i = 0; i < pixelCount; i++)
+        {
+            values[i] = mask[i][channel];
+            counts[static_cast<uint32_t>(values[i] * pixelCount)]++;
+        }
+        for (int count : counts)
+        {
+            ASSERT_EQ(count, 1);
+        }
+        ASSERT_LT(blockVariance(values, size, 8), whiteVariance * 0.2);
+    }
+
+    // The two channels are independent, so they rarely have the same value.
+    int sameCount = 0;
+    for (const vec2& value : mask)
+    {
+        sameCount += value.x == value.y ? 1 : 0;
+    }
+    ASSERT_LT(sameCount, 16);
+}
+
+} // namespace
+
+#endif
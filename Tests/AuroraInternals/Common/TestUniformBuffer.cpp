@@ -21,6 +21,7 @@
 #include "pch.h"
 
 #include "MaterialBase.h"
+#include "UniformArena.h"
 #include "UniformBuffer.h"
 
 namespace
@@ -80,6 +81,200 @@ TEST_F(UniformBufferTest, BasicTest)
     ASSERT_TRUE(errMsg.empty()) << errMsg;
 }
 
+// Test allocating, releasing, and reusing blocks in a uniform arena.
+TEST_F(UniformBufferTest, TestArenaAllocation)
+{
+    UniformArena arena;
+
+    // Blocks are aligned, and the arena grows to fit them.
+    size_t offset0 = arena.allocate(20);
+    size_t offset1 = arena.allocate(100);
+    size_t offset2 = arena.allocate(16);
+    ASSERT_EQ(offset0, 0u);
+    ASSERT_EQ(offset1, 32u);
+    ASSERT_EQ(offset2, 144u);
+    ASSERT_EQ(arena.size(), 160u);
+    ASSERT_EQ(arena.allocatedSize(), 160u);
+    ASSERT_EQ(arena.blockCount(), 3u);
+
+    // A released block is reused for a smaller block, which is cleared to zero.
+    arena.write(offset1, "abcd", 4);
+    arena.release(offset1);
+    ASSERT_EQ(arena.allocatedSize(), 48u);
+    size_t offset3 = arena.allocate(40);
+    ASSERT_EQ(offset3, offset1);
+    ASSERT_EQ(arena.data(offset3)[0], 0);
+    ASSERT_EQ(arena.size(), 160u);
+
+    // Releasing the blocks at the end shrinks the arena, merging the released blocks.
+    arena.release(offset2);
+    ASSERT_EQ(arena.size(), 80u);
+    arena.release(offset3);
+    ASSERT_EQ(arena.size(), 32u);
+    ASSERT_EQ(arena.blockCount(), 1u);
+
+    // The arena grows again after the remaining block.
+    ASSERT_EQ(arena.allocate(8), 32u);
+}
+
+// Test that dirty ranges are recorded only for changed bytes, and are coalesced.
+TEST_F(UniformBufferTest, TestArenaDirtyRanges)
+{
+    UniformArena arena;
+    UniformArena::ConsumerID consumer = arena.addConsumer();
+    size_t offset                     = arena.allocate(4096);
+
+    // The new block is dirty.
+    vector<UniformArena::Range> ranges = arena.takeDirtyRanges(consumer);
+    ASSERT_EQ(ranges.size(), 1u);
+    ASSERT_EQ(ranges[0].offset, offset);
+    ASSERT_EQ(ranges[0].size, 4096u);
+    ASSERT_FALSE(arena.isDirty(consumer));
+
+    // Writing the same bytes does not mark anything dirty.
+    uint32_t zero = 0;
+    arena.write(64, &zero, sizeof(zero));
+    ASSERT_FALSE(arena.isDirty(consumer));
+
+    // Writes separated by small gaps are combined, and writes far apart are not.
+    uint32_t value = 42;
+    arena.write(1000, &value, sizeof(value));
+    arena.write(100, &value, sizeof(value));
+    arena.write(200, &value, sizeof(value));
+    arena.write(104, &value, sizeof(value));
+    ranges = arena.takeDirtyRanges(consumer, UniformArena::kDefaultMaxGap);
+    ASSERT_EQ(ranges.size(), 2u);
+    ASSERT_EQ(ranges[0].offset, 100u);
+    ASSERT_EQ(ranges[0].size, 104u);
+    ASSERT_EQ(ranges[1].offset, 1000u);
+    ASSERT_EQ(ranges[1].size, 4u);
+
+    // Without a gap, only overlapping and adjacent ranges are combined.
+    vector<UniformArena::Range> separate = { { 40, 8 }, { 0, 16 }, { 16, 8 }, { 8, 4 } };
+    UniformArena::coalesceRanges(separate, 0);
+    ASSERT_EQ(separate.size(), 2u);
+    ASSERT_EQ(separate[0].offset, 0u);
+    ASSERT_EQ(separate[0].size, 24u);
+    ASSERT_EQ(separate[1].offset, 40u);
+    ASSERT_EQ(separate[1].size, 8u);
+
+    // Marking the whole arena dirty gives a single range.
+    arena.markAllDirty(consumer);
+    ranges = arena.takeDirtyRanges(consumer);
+    ASSERT_EQ(ranges.size(), 1u);
+    ASSERT_EQ(ranges[0].size, arena.size());
+}
+
+// Test that many scattered writes, e.g. one property changed on many materials, are coalesced so
+// that the number of dirty ranges stays bounded, while still covering every write.
+TEST_F(UniformBufferTest, TestArenaManyDirtyRanges)
+{
+    UniformArena arena;
+    UniformArena::ConsumerID consumer = arena.addConsumer();
+    const size_t kBlockCount          = 20000;
+    const size_t kBlockSize           = 512;
+    arena.allocate(kBlockCount * kBlockSize);
+    arena.takeDirtyRanges(consumer);
+
+    // Write in reverse order, so that no write extends the previous range.
+    uint32_t value = 42;
+    for (size_t i = kBlockCount; i-- > 0;)
+    {
+        arena.write(i * kBlockSize, &value, sizeof(value));
+    }
+    vector<UniformArena::Range> ranges = arena.takeDirtyRanges(consumer, 0);
+    ASSERT_LE(ranges.size(), UniformArena::kMaxDirtyRanges);
+    size_t rangeIndex = 0;
+    for (size_t i = 0; i < kBlockCount; i++)
+    {
+        size_t offset = i * kBlockSize;
+        while (rangeIndex < ranges.size() && ranges[rangeIndex].end() <= offset)
+        {
+            rangeIndex++;
+        }
+        ASSERT_LT(rangeIndex, ranges.size());
+        ASSERT_LE(ranges[rangeIndex].offset, offset);
+        ASSERT_GE(ranges[rangeIndex].end(), offset + sizeof(value));
+    }
+}
+
+// Test that each consumer of an arena, e.g. each scene, gets all the dirty ranges, regardless of
+// when the other consumers take theirs.
+TEST_F(UniformBufferTest, TestArenaConsumers)
+{
+    UniformArena arena;
+    size_t offset                      = arena.allocate(1024);
+    UniformArena::ConsumerID consumer1 = arena.addConsumer();
+
+    // A consumer added after data was allocated starts with the whole arena dirty.
+    UniformArena::ConsumerID consumer2 = arena.addConsumer();
+    vector<UniformArena::Range> ranges = arena.takeDirtyRanges(consumer2);
+    ASSERT_EQ(ranges.size(), 1u);
+    ASSERT_EQ(ranges[0].size, arena.size());
+    ASSERT_TRUE(arena.isDirty(consumer1));
+    arena.takeDirtyRanges(consumer1);
+
+    // A change is dirty for every consumer until each takes its ranges.
+    uint32_t value = 42;
+    arena.write(offset + 16, &value, sizeof(value));
+    ranges = arena.takeDirtyRanges(consumer1);
+    ASSERT_EQ(ranges.size(), 1u);
+    ASSERT_EQ(ranges[0].offset, offset + 16);
+    ASSERT_FALSE(arena.isDirty(consumer1));
+    ASSERT_TRUE(arena.isDirty(consumer2));
+    ranges = arena.takeDirtyRanges(consumer2);
+    ASSERT_EQ(ranges.size(), 1u);
+    ASSERT_EQ(ranges[0].offset, offset + 16);
+
+    // Marking the arena dirty for one consumer does not affect the other.
+    arena.markAllDirty(consumer1);
+    ASSERT_FALSE(arena.isDirty(consumer2));
+
+    // A removed consumer has no dirty ranges.
+    arena.removeConsumer(consumer1);
+    ASSERT_FALSE(arena.isDirty(consumer1));
+    ASSERT_TRUE(arena.takeDirtyRanges(consumer1).empty());
+}
+
+// Test that a uniform buffer moved to an arena writes its values to the arena, and marks only the
+// changed values dirty.
+TEST_F(UniformBufferTest, TestUniformBufferInArena)
+{
+    UniformArena arena;
+    UniformArena::ConsumerID consumer = arena.addConsumer();
+    UniformBuffer buffer(
+        MaterialBase::StandardSurfaceUniforms, MaterialBase::StandardSurfaceDefaults.properties);
+    float base = buffer.get<float>("base");
+    vector<uint8_t> contents(static_cast<const uint8_t*>(buffer.data()),
+        static_cast<const uint8_t*>(buffer.data()) + buffer.size());
+
+    // Allocate space for a header before the buffer, and move the buffer to the arena.
+    const size_t headerSize = 68;
+    size_t offset           = arena.allocate(headerSize + buffer.size());
+    buffer.moveToArena(&arena, offset + headerSize);
+    ASSERT_EQ(buffer.data(), arena.data(offset + headerSize));
+    ASSERT_EQ(::memcmp(buffer.data(), contents.data(), contents.size()), 0);
+    ASSERT_EQ(buffer.get<float>("base"), base);
+    arena.takeDirtyRanges(consumer);
+
+    // Setting the existing value does not mark anything dirty.
+    buffer.set("base", base);
+    ASSERT_FALSE(arena.isDirty(consumer));
+
+    // Setting a new value marks only that value dirty.
+    buffer.set("base", base + 0.5f);
+    ASSERT_EQ(buffer.get<float>("base"), base + 0.5f);
+    vector<UniformArena::Range> ranges = arena.takeDirtyRanges(consumer);
+    ASSERT_EQ(ranges.size(), 1u);
+    ASSERT_EQ(ranges[0].size, sizeof(float));
+    ASSERT_GE(ranges[0].offset, offset + headerSize);
+    ASSERT_LE(ranges[0].end(), offset + headerSize + buffer.size());
+
+    // The buffer remains valid when the arena grows.
+    arena.allocate(1 << 20);
+    ASSERT_EQ(buffer.get<float>("base"), base + 0.5f);
+}
+
 } // namespace
 
 #endif
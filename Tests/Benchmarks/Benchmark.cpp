@@ -0,0 +1,463 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace Benchmark
+{
+
+// A single measured run of a benchmark, with times per iteration in the benchmark's time unit.
+struct Run
+{
+    std::string name;
+    std::string runName;
+    std::string runType = "iteration";
+    std::string aggregateName;
+    int repetitions     = 1;
+    int repetitionIndex = 0;
+    uint64_t iterations = 0;
+    double realTime     = 0.0;
+    double cpuTime      = 0.0;
+    std::string timeUnit;
+    double itemsPerSecond = 0.0;
+    double bytesPerSecond = 0.0;
+    std::string label;
+    std::string errorMessage;
+};
+
+// The options for running benchmarks, from the command line.
+struct Options
+{
+    std::string filter = ".*";
+    double minTime     = 0.5;
+    int repetitions    = 1;
+    std::string outFile;
+    bool listOnly = false;
+};
+
+// Gets the list of registered benchmarks. This is a function-local static, so that registration
+// from static initializers in other files is safe.
+static std::vector<std::unique_ptr<Registration>>& registrations()
+{
+    static std::vector<std::unique_ptr<Registration>> sRegistrations;
+
+    return sRegistrations;
+}
+
+Registration* registerBenchmark(const std::string& name, Function function)
+{
+    registrations().push_back(std::make_unique<Registration>(name, function));
+
+    return registrations().back().get();
+}
+
+// Gets the CPU time used by all the threads of the process, in seconds. std::clock() is not used as
+// it measures wall time on Windows, and may wrap on other platforms.
+static double processCPUTime()
+{
+#if defined(_WIN32)
+    // The process times are in 100 nanosecond units.
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!::GetProcessTimes(::GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        return 0.0;
+    }
+    auto toTicks = [](const FILETIME& time) {
+        return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    };
+
+    return static_cast<double>(toTicks(kernelTime) + toTicks(userTime)) * 1.0e-7;
+#else
+    timespec time;
+    if (::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) != 0)
+    {
+        return 0.0;
+    }
+
+    return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) * 1.0e-9;
+#endif
+}
+
+void State::startTimer()
+{
+    if (!_isRunning)
+    {
+        _realStart = clock::now();
+        _cpuStart  = processCPUTime();
+        _isRunning = true;
+    }
+}
+
+void State::stopTimer()
+{
+    if (_isRunning)
+    {
+        _realTime += std::chrono::duration<double>(clock::now() - _realStart).count();
+        _cpuTime += processCPUTime() - _cpuStart;
+        _isRunning = false;
+    }
+}
+
+// Gets the multiplier to convert seconds to the specified time unit.
+static double timeUnitMultiplier(const std::string& timeUnit)
+{
+    if (timeUnit == "s")
+        return 1.0;
+    if (timeUnit == "ms")
+        return 1.0e3;
+    if (timeUnit == "us")
+        return 1.0e6;
+    return 1.0e9;
+}
+
+// Runs a benchmark with the specified arguments once, determining the number of iterations from the
+// minimum time (unless a fixed number of iterations is specified), in the same way as Google
+// Benchmark.
+static Run runOnce(const Registration& registration, const std::vector<int64_t>& args,
+    const std::string& name, const Options& options)
+{
+    const uint64_t kMaxIterations = 1000000000;
+    uint64_t iterations           = std::max<uint64_t>(registration.fixedIterations(), 1);
+    std::unique_ptr<State> pState;
+    while (true)
+    {
+        pState = std::make_unique<State>(iterations, args);
+        registration.function()(*pState);
+
+        // Stop if the benchmark was skipped, the iteration count is fixed, or the minimum time was
+        // reached.
+        double elapsed = pState->realTime();
+        if (!pState->errorMessage().empty() || registration.fixedIterations() > 0 ||
+            elapsed >= options.minTime || iterations >= kMaxIterations)
+        {
+            break;
+        }
+
+        // Predict the number of iterations needed to reach the minimum time, with some margin,
+        // growing by at most a factor of ten each attempt.
+        double multiplier = elapsed > 0.0 ? options.minTime * 1.4 / elapsed : 10.0;
+        multiplier        = std::min(std::max(multiplier, 2.0), 10.0);
+        iterations        = std::min(
+            static_cast<uint64_t>(std::ceil(iterations * multiplier)), kMaxIterations);
+    }
+
+    // Build the run result, with times per iteration.
+    Run run;
+    run.name         = name;
+    run.runName      = name;
+    run.timeUnit     = registration.timeUnit();
+    run.iterations   = pState->iterations();
+    run.label        = pState->label();
+    run.errorMessage = pState->errorMessage();
+    if (run.iterations > 0)
+    {
+        double unitScale = timeUnitMultiplier(run.timeUnit) / run.iterations;
+        run.realTime     = pState->realTime() * unitScale;
+        run.cpuTime      = pState->cpuTime() * unitScale;
+    }
+    if (pState->realTime() > 0.0)
+    {
+        run.itemsPerSecond = pState->itemsProcessed() / pState->realTime();
+        run.bytesPerSecond = pState->bytesProcessed() / pState->realTime();
+    }
+
+    return run;
+}
+
+// Computes the aggregate (mean, median, standard deviation) runs for a set of repetitions.
+static std::vector<Run> aggregate(const std::vector<Run>& runs)
+{
+    std::vector<Run> results;
+    if (runs.size() < 2)
+    {
+        return results;
+    }
+
+    // Gets a statistic of a member of the runs, using the specified function.
+    auto statistic = [&runs](const std::string& aggregateName,
+                         std::function<double(std::vector<double>&)> func) {
+        Run result           = runs[0];
+        result.name          = runs[0].runName + "_" + aggregateName;
+        result.runType       = "aggregate";
+        result.aggregateName = aggregateName;
+        std::vector<double> realTimes, cpuTimes, itemRates, byteRates;
+        for (const Run& run : runs)
+        {
+            realTimes.push_back(run.realTime);
+            cpuTimes.push_back(run.cpuTime);
+            itemRates.push_back(run.itemsPerSecond);
+            byteRates.push_back(run.bytesPerSecond);
+        }
+        result.realTime       = func(realTimes);
+        result.cpuTime        = func(cpuTimes);
+        result.itemsPerSecond = func(itemRates);
+        result.bytesPerSecond = func(byteRates);
+
+        return result;
+    };
+    auto mean = [](std::vector<double>& values) {
+        double sum = 0.0;
+        for (double value : values)
+            sum += value;
+        return sum / values.size();
+    };
+    auto median = [](std::vector<double>& values) {
+        std::sort(values.begin(), values.end());
+        size_t middle = values.size() / 2;
+        return values.size() % 2 ? values[middle] : 0.5 * (values[middle - 1] + values[middle]);
+    };
+    auto stddev = [&mean](std::vector<double>& values) {
+        double average = mean(values);
+        double sum     = 0.0;
+        for (double value : values)
+            sum += (value - average) * (value - average);
+        return std::sqrt(sum / (values.size() - 1));
+    };
+    results.push_back(statistic("mean", mean));
+    results.push_back(statistic("median", median));
+    results.push_back(statistic("stddev", stddev));
+
+    return results;
+}
+
+// Writes a string to a stream as a JSON string value, with escaping.
+static void writeJSONString(std::ostream& stream, const std::string& str)
+{
+    stream << '"';
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+            stream << '\\' << c;
+        else if (c == '\n')
+            stream << "\\n";
+        else
+            stream << c;
+    }
+    stream << '"';
+}
+
+// Writes the runs in the Google Benchmark JSON format.
+static void writeJSON(std::ostream& stream, const std::vector<Run>& runs, const char* executable)
+{
+    // Write the context, describing the machine and build.
+    char date[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+    stream << "{\n  \"context\": {\n    \"date\": ";
+    writeJSONString(stream, date);
+    stream << ",\n    \"executable\": ";
+    writeJSONString(stream, executable);
+    stream << ",\n    \"num_cpus\": " << std::thread::hardware_concurrency();
+#if defined(NDEBUG)
+    stream << ",\n    \"library_build_type\": \"release\"\n  },\n";
+#else
+    stream << ",\n    \"library_build_type\": \"debug\"\n  },\n";
+#endif
+
+    // Write the runs.
+    stream << "  \"benchmarks\": [";
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        const Run& run = runs[i];
+        stream << (i == 0 ? "\n" : ",\n") << "    {\n      \"name\": ";
+        writeJSONString(stream, run.name);
+        stream << ",\n      \"run_name\": ";
+        writeJSONString(stream, run.runName);
+        stream << ",\n      \"run_type\": \"" << run.runType << "\"";
+        if (!run.aggregateName.empty())
+        {
+            stream << ",\n      \"aggregate_name\": \"" << run.aggregateName << "\"";
+        }
+        stream << ",\n      \"repetitions\": " << run.repetitions;
+        stream << ",\n      \"repetition_index\": " << run.repetitionIndex;
+        stream << ",\n      \"threads\": 1";
+        stream << ",\n      \"iterations\": " << run.iterations;
+        stream << ",\n      \"real_time\": " << run.realTime;
+        stream << ",\n      \"cpu_time\": " << run.cpuTime;
+        stream << ",\n      \"time_unit\": \"" << run.timeUnit << "\"";
+        if (run.itemsPerSecond > 0.0)
+        {
+            stream << ",\n      \"items_per_second\": " << run.itemsPerSecond;
+        }
+        if (run.bytesPerSecond > 0.0)
+        {
+            stream << ",\n      \"bytes_per_second\": " << run.bytesPerSecond;
+        }
+        if (!run.label.empty())
+        {
+            stream << ",\n      \"label\": ";
+            writeJSONString(stream, run.label);
+        }
+        if (!run.errorMessage.empty())
+        {
+            stream << ",\n      \"error_occurred\": true,\n      \"error_message\": ";
+            writeJSONString(stream, run.errorMessage);
+        }
+        stream << "\n    }";
+    }
+    stream << "\n  ]\n}\n";
+}
+
+// Writes a run to the console, as a row of a table.
+static void writeConsole(const Run& run)
+{
+    char line[256];
+    if (!run.errorMessage.empty())
+    {
+        std::snprintf(line, sizeof(line), "%-50s SKIPPED: %s", run.name.c_str(),
+            run.errorMessage.c_str());
+    }
+    else
+    {
+        std::snprintf(line, sizeof(line), "%-50s %13.1f %-2s %13.1f %-2s %12llu", run.name.c_str(),
+            run.realTime, run.timeUnit.c_str(), run.cpuTime, run.timeUnit.c_str(),
+            static_cast<unsigned long long>(run.iterations));
+    }
+    std::cout << line;
+    if (run.itemsPerSecond > 0.0)
+    {
+        std::cout << " items/s=" << run.itemsPerSecond;
+    }
+    if (!run.label.empty())
+    {
+        std::cout << " " << run.label;
+    }
+    std::cout << std::endl;
+}
+
+// Parses the command line arguments into options, returning false if there are invalid arguments.
+static bool parseOptions(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg   = argv[i];
+        size_t equals     = arg.find('=');
+        std::string key   = arg.substr(0, equals);
+        std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+        if (key == "--benchmark_filter")
+            options.filter = value;
+        else if (key == "--benchmark_min_time")
+            options.minTime = std::stod(value);
+        else if (key == "--benchmark_repetitions")
+            options.repetitions = std::max(std::stoi(value), 1);
+        else if (key == "--benchmark_out")
+            options.outFile = value;
+        else if (key == "--benchmark_out_format")
+        {
+            if (value != "json")
+            {
+                std::cerr << "Only the JSON output format is supported." << std::endl;
+                return false;
+            }
+        }
+        else if (key == "--benchmark_list_tests")
+            options.listOnly = true;
+        else
+        {
+            std::cerr << "Unrecognized argument: " << arg << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int runBenchmarks(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 1;
+    }
+
+    // Run all the registered benchmarks with each of their arguments, in registration order.
+    std::regex filter(options.filter);
+    std::vector<Run> allRuns;
+    for (auto& pRegistration : registrations())
+    {
+        std::vector<std::vector<int64_t>> argSets = pRegistration->args();
+        if (argSets.empty())
+        {
+            argSets.push_back({});
+        }
+        for (auto& args : argSets)
+        {
+            // Build the name from the function name and the arguments, e.g. "BM_Foo/1000".
+            std::string name = pRegistration->name();
+            for (int64_t arg : args)
+            {
+                name += "/" + std::to_string(arg);
+            }
+            if (!std::regex_search(name, filter))
+            {
+                continue;
+            }
+            if (options.listOnly)
+            {
+                std::cout << name << std::endl;
+                continue;
+            }
+
+            // Run the repetitions, followed by the aggregates of the repetitions.
+            std::vector<Run> runs;
+            for (int repetition = 0; repetition < options.repetitions; repetition++)
+            {
+                Run run             = runOnce(*pRegistration, args, name, options);
+                run.repetitions     = options.repetitions;
+                run.repetitionIndex = repetition;
+                writeConsole(run);
+                runs.push_back(run);
+            }
+            std::vector<Run> aggregates = aggregate(runs);
+            for (const Run& run : aggregates)
+            {
+                writeConsole(run);
+            }
+            allRuns.insert(allRuns.end(), runs.begin(), runs.end());
+            allRuns.insert(allRuns.end(), aggregates.begin(), aggregates.end());
+        }
+    }
+
+    // Write the results file, if requested.
+    if (!options.outFile.empty())
+    {
+        std::ofstream stream(options.outFile);
+        if (!stream)
+        {
+            std::cerr << "Failed to open output file " << options.outFile << std::endl;
+            return 1;
+        }
+        writeJSON(stream, allRuns, argv[0]);
+    }
+
+    return 0;
+}
+
+} // namespace Benchmark
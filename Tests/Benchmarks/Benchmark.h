@@ -0,0 +1,231 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// A minimal micro-benchmark harness, modeled on Google Benchmark. The command line flags and the
+// JSON output use the same names and schema as Google Benchmark, so that results can be processed
+// with the same tools, e.g. Scripts/compareBenchmarks.py.
+//
+// A benchmark is a function that accepts a State object and runs the measured code in a loop:
+//
+//   static void BM_Example(Benchmark::State& state)
+//   {
+//       // Untimed setup ...
+//       while (state.keepRunning())
+//       {
+//           // Timed code ...
+//       }
+//   }
+//   AU_BENCHMARK(BM_Example)->range(1000, 1000000, 10);
+
+// Helpers to build a unique static variable name for a benchmark registration.
+#define AU_BENCHMARK_CONCAT_IMPL(_a, _b) _a##_b
+#define AU_BENCHMARK_CONCAT(_a, _b) AU_BENCHMARK_CONCAT_IMPL(_a, _b)
+
+/// Registers a benchmark function, returning a registration that can be used to add arguments.
+#define AU_BENCHMARK(_func)                                                                        \
+    static Benchmark::Registration* AU_BENCHMARK_CONCAT(_auBenchmark, __LINE__) =                  \
+        Benchmark::registerBenchmark(#_func, _func)
+
+namespace Benchmark
+{
+
+/// The state of a running benchmark, which controls the measured loop.
+class State
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    /// Constructor.
+    State(uint64_t iterations, const std::vector<int64_t>& args) :
+        _maxIterations(iterations), _args(args)
+    {
+    }
+
+    /// Returns whether another iteration of the measured loop should run. The timer is started
+    /// on the first call, and stopped when this returns false.
+    bool keepRunning()
+    {
+        if (!_isStarted)
+        {
+            _isStarted = true;
+            startTimer();
+        }
+        if (_iterations < _maxIterations)
+        {
+            _iterations++;
+            return true;
+        }
+        stopTimer();
+
+        return false;
+    }
+
+    /// Pauses the timer, e.g. to exclude per-iteration setup from the measurement.
+    void pauseTiming() { stopTimer(); }
+
+    /// Resumes the timer after it was paused.
+    void resumeTiming() { startTimer(); }
+
+    /// Gets the benchmark argument with the specified index.
+    int64_t range(size_t index = 0) const { return index < _args.size() ? _args[index] : 0; }
+
+    /// Sets the number of items processed by the benchmark, over all iterations.
+    void setItemsProcessed(int64_t items) { _itemsProcessed = items; }
+
+    /// Sets the number of bytes processed by the benchmark, over all iterations.
+    void setBytesProcessed(int64_t bytes) { _bytesProcessed = bytes; }
+
+    /// Sets a message for the benchmark, which is reported with the results.
+    void setLabel(const std::string& label) { _label = label; }
+
+    /// Marks the benchmark as skipped, with a message explaining why. The measured loop should
+    /// not be run after this.
+    void skipWithError(const std::string& message)
+    {
+        _errorMessage  = message;
+        _maxIterations = 0;
+    }
+
+    /// Gets the number of iterations of the measured loop.
+    uint64_t iterations() const { return _maxIterations; }
+
+    // Results, used by the harness.
+    double realTime() const { return _realTime; }
+    double cpuTime() const { return _cpuTime; }
+    int64_t itemsProcessed() const { return _itemsProcessed; }
+    int64_t bytesProcessed() const { return _bytesProcessed; }
+    const std::string& label() const { return _label; }
+    const std::string& errorMessage() const { return _errorMessage; }
+
+private:
+    void startTimer();
+    void stopTimer();
+
+    uint64_t _maxIterations = 0;
+    uint64_t _iterations    = 0;
+    std::vector<int64_t> _args;
+    bool _isStarted = false;
+    bool _isRunning = false;
+    clock::time_point _realStart;
+    double _cpuStart        = 0.0;
+    double _realTime        = 0.0;
+    double _cpuTime         = 0.0;
+    int64_t _itemsProcessed = 0;
+    int64_t _bytesProcessed = 0;
+    std::string _label;
+    std::string _errorMessage;
+};
+
+/// A benchmark function.
+using Function = std::function<void(State&)>;
+
+/// The registration of a benchmark function, with the arguments it is run with.
+class Registration
+{
+public:
+    Registration(const std::string& name, Function function) : _name(name), _function(function)
+    {
+    }
+
+    /// Adds a run of the benchmark with the specified argument.
+    Registration* arg(int64_t value)
+    {
+        _args.push_back({ value });
+        return this;
+    }
+
+    /// Adds a run of the benchmark with the specified set of arguments, accessed by index with
+    /// State::range().
+    Registration* argSet(const std::vector<int64_t>& values)
+    {
+        _args.push_back(values);
+        return this;
+    }
+
+    /// Adds runs of the benchmark with arguments from start to limit (inclusive), multiplying by
+    /// the specified factor.
+    Registration* range(int64_t start, int64_t limit, int64_t multiplier = 8)
+    {
+        for (int64_t value = start; value <= limit; value *= multiplier)
+        {
+            _args.push_back({ value });
+        }
+        return this;
+    }
+
+    /// Sets the unit for the reported times.
+    Registration* unit(const std::string& timeUnit)
+    {
+        _timeUnit = timeUnit;
+        return this;
+    }
+
+    /// Sets a fixed number of iterations, instead of determining it from the minimum time. Use this
+    /// for expensive benchmarks.
+    Registration* iterations(uint64_t count)
+    {
+        _fixedIterations = count;
+        return this;
+    }
+
+    const std::string& name() const { return _name; }
+    const Function& function() const { return _function; }
+    const std::vector<std::vector<int64_t>>& args() const { return _args; }
+    const std::string& timeUnit() const { return _timeUnit; }
+    uint64_t fixedIterations() const { return _fixedIterations; }
+
+private:
+    std::string _name;
+    Function _function;
+    std::vector<std::vector<int64_t>> _args;
+    std::string _timeUnit     = "ns";
+    uint64_t _fixedIterations = 0;
+};
+
+/// Registers a benchmark function, returning the registration.
+Registration* registerBenchmark(const std::string& name, Function function);
+
+/// Runs the registered benchmarks, as specified by the command line arguments.
+///
+/// The supported arguments are the following, with the same meaning as Google Benchmark:
+/// - --benchmark_filter=<regex>: Only run benchmarks with names that match the expression.
+/// - --benchmark_min_time=<seconds>: The minimum time to run each benchmark (default 0.5).
+/// - --benchmark_repetitions=<count>: The number of times to repeat each benchmark (default 1).
+/// - --benchmark_out=<file>: The file to write the results to.
+/// - --benchmark_out_format=json: The format of the results file; only JSON is supported.
+/// - --benchmark_list_tests: List the benchmarks instead of running them.
+///
+/// \return The process exit code.
+int runBenchmarks(int argc, char** argv);
+
+/// Prevents the compiler from optimizing away a value that is computed but not otherwise used.
+template <typename T>
+inline void doNotOptimize(T const& value)
+{
+#if defined(_MSC_VER)
+    static volatile const void* sSink;
+    sSink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+} // namespace Benchmark
@@ -0,0 +1,129 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Benchmark.h"
+#include "TestHelpers.h"
+
+// Include the Aurora PCH (this is an internal benchmark so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "AliasMap.h"
+#include "AssetManager.h"
+
+#include <Aurora/Foundation/PixelConversion.h>
+
+using namespace Aurora;
+
+namespace
+{
+
+// The test images to decode, selected by the benchmark argument.
+const vector<string> kImageFiles = { "Mandrill.png", "fishscale_basecolor.jpg", "CoatOfArms.bmp" };
+
+// Benchmarks decoding an image with the asset manager. The file is read into memory before the
+// benchmark starts, so only decoding and processing is measured, not file I/O.
+void BM_AssetManagerDecodeImage(Benchmark::State& state)
+{
+    // Read the file into memory.
+    const string& imageFile = kImageFiles[state.range(0)];
+    string filename         = TestHelpers::kSourceRoot + "/Tests/Assets/Textures/" + imageFile;
+    ifstream is(filename, ifstream::binary);
+    if (!is)
+    {
+        state.skipWithError("Failed to read " + filename);
+        return;
+    }
+    vector<unsigned char> fileBuffer((istreambuf_iterator<char>(is)), istreambuf_iterator<char>());
+
+    // Create an asset manager that loads the image from memory.
+    AssetManager assetManager([&fileBuffer](const string& uri, vector<unsigned char>* pBufferOut,
+                                  string* pFileNameOut) {
+        *pBufferOut   = fileBuffer;
+        *pFileNameOut = uri;
+        return true;
+    });
+
+    // Decode the image.
+    size_t pixelBytes = 0;
+    while (state.keepRunning())
+    {
+        shared_ptr<ImageAsset> pImage = assetManager.acquireImage(filename);
+        if (!pImage)
+        {
+            state.skipWithError("Failed to decode " + filename);
+            break;
+        }
+        pixelBytes = pImage->sizeBytes;
+        Benchmark::doNotOptimize(pImage->pixels.get());
+    }
+    state.setBytesProcessed(state.iterations() * fileBuffer.size());
+    state.setLabel(imageFile + " (" + to_string(pixelBytes) + " bytes decoded)");
+}
+AU_BENCHMARK(BM_AssetManagerDecodeImage)->arg(0)->arg(1)->arg(2)->unit("ms");
+
+// Benchmarks building an alias map for a lat-long environment image, with the width specified by
+// the first benchmark argument and half the height. The second argument selects the pixel format:
+// zero for RGB floats, and one for RGBA half floats.
+void BM_AliasMapBuild(Benchmark::State& state)
+{
+    // Create a synthetic RGB float image, with a bright "sun" and a sky gradient, which gives a
+    // skewed distribution like a typical environment.
+    unsigned int width = static_cast<unsigned int>(state.range(0));
+    uvec2 dimensions(width, width / 2);
+    size_t pixelCount = dimensions.x * dimensions.y;
+    vector<float> pixels(pixelCount * 3);
+    for (unsigned int y = 0; y < dimensions.y; y++)
+    {
+        for (unsigned int x = 0; x < dimensions.x; x++)
+        {
+            float sky      = 1.0f - static_cast<float>(y) / dimensions.y;
+            vec2 sunOffset = vec2(x, y) - vec2(dimensions.x * 0.3f, dimensions.y * 0.25f);
+            float sun      = dot(sunOffset, sunOffset) < 16.0f ? 1000.0f : 0.0f;
+            float* pPixel  = &pixels[(y * dimensions.x + x) * 3];
+            pPixel[0]      = sky * 0.4f + sun;
+            pPixel[1]      = sky * 0.6f + sun;
+            pPixel[2]      = sky * 1.0f + sun;
+        }
+    }
+
+    // Convert the image to half floats if requested.
+    bool isHalf        = state.range(1) != 0;
+    ImageFormat format = isHalf ? ImageFormat::Half_RGBA : ImageFormat::Float_RGB;
+    vector<uint16_t> halfPixels(isHalf ? pixelCount * 4 : 0);
+    if (isHalf)
+    {
+        Foundation::convertFloatToHalfRGBA(pixels.data(), 3, halfPixels.data(), pixelCount);
+    }
+    const void* pPixels = isHalf ? static_cast<const void*>(halfPixels.data()) : pixels.data();
+
+    // Build the alias map.
+    vector<AliasMap::Entry> aliasMap(pixelCount);
+    float luminanceIntegral = 0.0f;
+    while (state.keepRunning())
+    {
+        AliasMap::build(pPixels, format, dimensions, aliasMap.data(),
+            aliasMap.size() * sizeof(AliasMap::Entry), luminanceIntegral);
+        Benchmark::doNotOptimize(luminanceIntegral);
+    }
+    state.setItemsProcessed(state.iterations() * pixelCount);
+    state.setLabel(isHalf ? "Half_RGBA" : "Float_RGB");
+}
+AU_BENCHMARK(BM_AliasMapBuild)
+    ->argSet({ 1024, 0 })
+    ->argSet({ 1024, 1 })
+    ->argSet({ 4096, 0 })
+    ->argSet({ 4096, 1 })
+    ->unit("ms");
+
+} // namespace
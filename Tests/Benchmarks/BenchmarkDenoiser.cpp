@@ -0,0 +1,63 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <Aurora/Aurora.h>
+
+#include "Benchmark.h"
+
+using namespace std;
+
+namespace
+{
+
+// Benchmarks CPU denoising of a noisy RGBA float image with albedo, normal, and depth guides, for
+// the image width specified by the benchmark argument (with a 16:9 aspect ratio).
+void BM_DenoiseImage(Benchmark::State& state)
+{
+    uint32_t width    = static_cast<uint32_t>(state.range(0));
+    uint32_t height   = width * 9 / 16;
+    size_t pixelCount = static_cast<size_t>(width) * height;
+    mt19937 random;
+    uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    vector<float> color(pixelCount * 4);
+    vector<float> albedo(pixelCount * 4, 0.5f);
+    vector<float> normal(pixelCount * 4, 0.0f);
+    vector<float> depth(pixelCount, 0.5f);
+    vector<float> output(pixelCount * 4);
+    for (float& value : color)
+    {
+        value = distribution(random);
+    }
+
+    Aurora::DenoiserImages images;
+    images.width   = width;
+    images.height  = height;
+    images.pColor  = color.data();
+    images.pAlbedo = albedo.data();
+    images.pNormal = normal.data();
+    images.pDepth  = depth.data();
+    images.pOutput = output.data();
+    while (state.keepRunning())
+    {
+        Aurora::denoiseImage(images);
+        Benchmark::doNotOptimize(output.data());
+    }
+    state.setItemsProcessed(state.iterations() * pixelCount);
+}
+AU_BENCHMARK(BM_DenoiseImage)->arg(960)->arg(1920)->unit("ms");
+
+} // namespace
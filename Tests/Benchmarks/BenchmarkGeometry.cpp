@@ -0,0 +1,106 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <Aurora/Foundation/Geometry.h>
+
+#include "Benchmark.h"
+
+using namespace std;
+using namespace Aurora::Foundation;
+
+namespace
+{
+
+// An indexed triangle mesh, with positions, normals and texture coordinates.
+struct GridMesh
+{
+    vector<float> positions;
+    vector<float> normals;
+    vector<float> texCoords;
+    vector<unsigned int> indices;
+
+    size_t vertexCount() const { return positions.size() / 3; }
+    size_t triangleCount() const { return indices.size() / 3; }
+};
+
+// Creates a wavy grid mesh with the specified number of quads along each side.
+GridMesh createGridMesh(unsigned int size)
+{
+    GridMesh mesh;
+    unsigned int rowLength = size + 1;
+    for (unsigned int y = 0; y < rowLength; y++)
+    {
+        for (unsigned int x = 0; x < rowLength; x++)
+        {
+            float u = static_cast<float>(x) / size;
+            float v = static_cast<float>(y) / size;
+            mesh.positions.insert(mesh.positions.end(),
+                { u, v, 0.1f * std::sin(u * 20.0f) * std::cos(v * 20.0f) });
+            mesh.texCoords.insert(mesh.texCoords.end(), { u, v });
+        }
+    }
+    for (unsigned int y = 0; y < size; y++)
+    {
+        for (unsigned int x = 0; x < size; x++)
+        {
+            unsigned int i0 = y * rowLength + x;
+            unsigned int i1 = i0 + 1;
+            unsigned int i2 = i0 + rowLength;
+            unsigned int i3 = i2 + 1;
+            mesh.indices.insert(mesh.indices.end(), { i0, i1, i2, i2, i1, i3 });
+        }
+    }
+    mesh.normals.resize(mesh.positions.size());
+
+    return mesh;
+}
+
+// Benchmarks calculating vertex normals for a grid mesh, with the number of quads along each side
+// specified by the benchmark argument.
+void BM_CalculateNormals(Benchmark::State& state)
+{
+    GridMesh mesh = createGridMesh(static_cast<unsigned int>(state.range(0)));
+    while (state.keepRunning())
+    {
+        calculateNormals(mesh.vertexCount(), mesh.positions.data(), mesh.triangleCount(),
+            mesh.indices.data(), mesh.normals.data());
+        Benchmark::doNotOptimize(mesh.normals.data());
+    }
+    state.setItemsProcessed(state.iterations() * mesh.triangleCount());
+}
+AU_BENCHMARK(BM_CalculateNormals)->range(16, 1024, 4)->unit("us");
+
+// Benchmarks calculating vertex tangents for a grid mesh, with the number of quads along each side
+// specified by the benchmark argument.
+void BM_CalculateTangents(Benchmark::State& state)
+{
+    GridMesh mesh = createGridMesh(static_cast<unsigned int>(state.range(0)));
+    calculateNormals(mesh.vertexCount(), mesh.positions.data(), mesh.triangleCount(),
+        mesh.indices.data(), mesh.normals.data());
+    vector<float> tangents(mesh.positions.size());
+    while (state.keepRunning())
+    {
+        calculateTangents(mesh.vertexCount(), mesh.positions.data(), mesh.normals.data(),
+            mesh.texCoords.data(), mesh.triangleCount(), mesh.indices.data(), tangents.data());
+        Benchmark::doNotOptimize(tangents.data());
+    }
+    state.setItemsProcessed(state.iterations() * mesh.triangleCount());
+}
+AU_BENCHMARK(BM_CalculateTangents)->range(16, 1024, 4)->unit("us");
+
+} // namespace
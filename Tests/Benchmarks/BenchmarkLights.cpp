@@ -0,0 +1,83 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+#include <vector>
+
+#include "Benchmark.h"
+
+// Include the Aurora PCH (this is an internal benchmark so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "LightTree.h"
+
+namespace
+{
+
+using Aurora::LightTree;
+
+// Creates the specified number of point lights with random positions and intensities in a 100 unit
+// cube, as in a scene with many small lights.
+std::vector<LightTree::Light> createRandomLights(size_t count)
+{
+    std::mt19937 random;
+    std::uniform_real_distribution<float> distribution(-50.0f, 50.0f);
+    std::vector<LightTree::Light> lights(count);
+    for (LightTree::Light& light : lights)
+    {
+        vec3 position(distribution(random), distribution(random), distribution(random));
+        light.position          = position;
+        light.radius            = 0.1f;
+        light.colorAndIntensity = vec4(1.0f, 1.0f, 1.0f, distribution(random) + 51.0f);
+    }
+
+    return lights;
+}
+
+// Benchmarks building the light tree, for the number of lights specified by the benchmark
+// argument.
+void BM_BuildLightTree(Benchmark::State& state)
+{
+    std::vector<LightTree::Light> lights = createRandomLights(state.range(0));
+    LightTree tree;
+    while (state.keepRunning())
+    {
+        tree.build(lights);
+        Benchmark::doNotOptimize(tree.nodes().data());
+    }
+    state.setItemsProcessed(state.iterations() * lights.size());
+}
+AU_BENCHMARK(BM_BuildLightTree)->arg(1000)->arg(100000)->unit("ms");
+
+// Benchmarks choosing a light from the light tree for a shading point, for the number of lights
+// specified by the benchmark argument. This should grow logarithmically with the number of lights.
+void BM_SampleLightTree(Benchmark::State& state)
+{
+    LightTree tree;
+    tree.build(createRandomLights(state.range(0)));
+    vec3 position(1.0f, 2.0f, 3.0f);
+    vec3 normal(0.0f, 0.0f, 1.0f);
+    float random = 0.0f;
+    while (state.keepRunning())
+    {
+        float pdf;
+        int lightIndex = tree.sample(position, normal, random, pdf);
+        Benchmark::doNotOptimize(lightIndex);
+        random = fmod(random + 0.618034f, 1.0f);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+AU_BENCHMARK(BM_SampleLightTree)->arg(1000)->arg(100000)->unit("ns");
+
+} // namespace
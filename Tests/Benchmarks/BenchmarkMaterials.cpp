@@ -0,0 +1,118 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Benchmark.h"
+#include "TestHelpers.h"
+
+#include <filesystem>
+
+// Include the Aurora PCH (this is an internal benchmark so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "MaterialBase.h"
+#include "MaterialX/MaterialGenerator.h"
+#include "UniformBuffer.h"
+
+using namespace Aurora;
+
+namespace
+{
+
+// Benchmarks setting properties in the Standard Surface uniform buffer, by name.
+void BM_UniformBufferSet(Benchmark::State& state)
+{
+    UniformBuffer uniformBuffer(
+        MaterialBase::StandardSurfaceUniforms, MaterialBase::StandardSurfaceDefaults.properties);
+    float value = 0.0f;
+    while (state.keepRunning())
+    {
+        value += 0.001f;
+        uniformBuffer.set("base_color", vec3(value, 0.5f, 0.5f));
+        uniformBuffer.set("specular_roughness", value);
+        uniformBuffer.set("metalness", value);
+        uniformBuffer.set("coat_color", vec3(0.5f, value, 0.5f));
+    }
+    Benchmark::doNotOptimize(uniformBuffer.data());
+    state.setItemsProcessed(state.iterations() * 4);
+}
+AU_BENCHMARK(BM_UniformBufferSet);
+
+// Benchmarks getting properties from the Standard Surface uniform buffer, by name.
+void BM_UniformBufferGet(Benchmark::State& state)
+{
+    UniformBuffer uniformBuffer(
+        MaterialBase::StandardSurfaceUniforms, MaterialBase::StandardSurfaceDefaults.properties);
+    while (state.keepRunning())
+    {
+        Benchmark::doNotOptimize(uniformBuffer.get<vec3>("base_color"));
+        Benchmark::doNotOptimize(uniformBuffer.get<float>("specular_roughness"));
+        Benchmark::doNotOptimize(uniformBuffer.get<float>("metalness"));
+        Benchmark::doNotOptimize(uniformBuffer.get<vec3>("coat_color"));
+    }
+    state.setItemsProcessed(state.iterations() * 4);
+}
+AU_BENCHMARK(BM_UniformBufferGet);
+
+// Reads a text file into a string, returning false if the file could not be read.
+bool readTextFile(const string& filename, string& textOut)
+{
+    ifstream is(filename, ifstream::binary);
+    if (!is)
+        return false;
+    textOut.assign(istreambuf_iterator<char>(is), istreambuf_iterator<char>());
+
+    return true;
+}
+
+// Benchmarks generating material definitions (including the shader code) from all the MaterialX
+// documents in the test assets folder.
+void BM_MaterialGeneratorGenerate(Benchmark::State& state)
+{
+    // The MaterialX libraries are required, and are expected in the working folder.
+    string mtlxFolder = Foundation::getModulePath() + "MaterialX";
+    if (!filesystem::exists(mtlxFolder + "/libraries"))
+    {
+        state.skipWithError("MaterialX libraries not found in " + mtlxFolder);
+        return;
+    }
+
+    // Load the test documents.
+    vector<string> documents;
+    string materialsFolder = TestHelpers::kSourceRoot + "/Tests/Assets/Materials";
+    for (auto& entry : filesystem::directory_iterator(materialsFolder))
+    {
+        string document;
+        if (entry.path().extension() == ".mtlx" && readTextFile(entry.path().string(), document))
+        {
+            documents.push_back(document);
+        }
+    }
+
+    // Generate the definitions. The generator caches definitions only while they are in use, so
+    // each iteration generates every document from scratch.
+    MaterialXCodeGen::MaterialGenerator generator(mtlxFolder);
+    while (state.keepRunning())
+    {
+        for (const string& document : documents)
+        {
+            MaterialDefinitionPtr pDef = generator.generate(document);
+            Benchmark::doNotOptimize(pDef);
+        }
+    }
+    state.setItemsProcessed(state.iterations() * documents.size());
+    state.setLabel(to_string(documents.size()) + " documents");
+}
+AU_BENCHMARK(BM_MaterialGeneratorGenerate)->unit("ms");
+
+} // namespace
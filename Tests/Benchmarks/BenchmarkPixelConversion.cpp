@@ -0,0 +1,190 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <vector>
+
+#include <Aurora/Foundation/CubeMap.h>
+#include <Aurora/Foundation/PixelConversion.h>
+#include <Aurora/Foundation/TextureCompression.h>
+
+#include "Benchmark.h"
+
+using namespace std;
+using namespace Aurora::Foundation;
+
+namespace
+{
+
+// The dimensions of a render buffer with the specified width, with a 16:9 aspect ratio.
+struct ImageSize
+{
+    ImageSize(int64_t width) : width(static_cast<size_t>(width)), height(this->width * 9 / 16) {}
+
+    size_t width;
+    size_t height;
+    size_t valueCount() const { return width * height * 4; }
+};
+
+// Creates RGBA float pixels with a gradient across the image.
+vector<float> createFloatPixels(const ImageSize& size)
+{
+    vector<float> pixels(size.valueCount());
+    for (size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<float>(i % 4096) / 4096.0f;
+    }
+
+    return pixels;
+}
+
+// Benchmarks converting an RGBA half float render buffer to 32-bit floats, with padded rows as
+// returned by a readback buffer, for the image width specified by the benchmark argument.
+void BM_ConvertImageHalfToFloat(Benchmark::State& state)
+{
+    ImageSize size(state.range(0));
+    vector<float> floats = createFloatPixels(size);
+    size_t paddedWidth   = (size.width + 63) / 64 * 64;
+    vector<uint16_t> halves(paddedWidth * size.height * 4);
+    convertImageFloatToHalf(floats.data(), size.width * 4 * sizeof(float), halves.data(),
+        paddedWidth * 4 * sizeof(uint16_t), size.width, size.height, 4);
+    while (state.keepRunning())
+    {
+        convertImageHalfToFloat(halves.data(), paddedWidth * 4 * sizeof(uint16_t), floats.data(),
+            size.width * 4 * sizeof(float), size.width, size.height, 4);
+        Benchmark::doNotOptimize(floats.data());
+    }
+    state.setItemsProcessed(state.iterations() * size.width * size.height);
+}
+AU_BENCHMARK(BM_ConvertImageHalfToFloat)->arg(1920)->arg(3840)->unit("ms");
+
+// Benchmarks converting an RGBA float image to half floats, for the image width specified by the
+// benchmark argument.
+void BM_ConvertImageFloatToHalf(Benchmark::State& state)
+{
+    ImageSize size(state.range(0));
+    vector<float> floats = createFloatPixels(size);
+    vector<uint16_t> halves(size.valueCount());
+    while (state.keepRunning())
+    {
+        convertImageFloatToHalf(floats.data(), size.width * 4 * sizeof(float), halves.data(),
+            size.width * 4 * sizeof(uint16_t), size.width, size.height, 4);
+        Benchmark::doNotOptimize(halves.data());
+    }
+    state.setItemsProcessed(state.iterations() * size.width * size.height);
+}
+AU_BENCHMARK(BM_ConvertImageFloatToHalf)->arg(1920)->arg(3840)->unit("ms");
+
+// Benchmarks converting an RGB float image (e.g. a decoded HDR environment image) to RGBA half
+// floats, for the image width specified by the benchmark argument.
+void BM_ConvertFloatToHalfRGBA(Benchmark::State& state)
+{
+    ImageSize size(state.range(0));
+    size_t pixelCount    = size.width * size.height;
+    vector<float> floats = createFloatPixels(size);
+    vector<uint16_t> halves(pixelCount * 4);
+    while (state.keepRunning())
+    {
+        convertFloatToHalfRGBA(floats.data(), 3, halves.data(), pixelCount);
+        Benchmark::doNotOptimize(halves.data());
+    }
+    state.setItemsProcessed(state.iterations() * pixelCount);
+}
+AU_BENCHMARK(BM_ConvertFloatToHalfRGBA)->arg(1920)->arg(3840)->unit("ms");
+
+// Benchmarks converting an RGBA float image to 8-bit with dithering, for the image width
+// specified by the benchmark argument.
+void BM_ConvertImageFloatToUNorm8(Benchmark::State& state)
+{
+    ImageSize size(state.range(0));
+    vector<float> floats = createFloatPixels(size);
+    vector<uint8_t> bytes(size.valueCount());
+    while (state.keepRunning())
+    {
+        convertImageFloatToUNorm8(floats.data(), size.width * 4 * sizeof(float), bytes.data(),
+            size.width * 4, size.width, size.height, 4, true);
+        Benchmark::doNotOptimize(bytes.data());
+    }
+    state.setItemsProcessed(state.iterations() * size.width * size.height);
+}
+AU_BENCHMARK(BM_ConvertImageFloatToUNorm8)->arg(1920)->arg(3840)->unit("ms");
+
+// Benchmarks block compression of a square 8-bit RGBA texture, with all hardware threads. The
+// benchmark arguments are the texture size, the block format (BC1, BC4, BC5, BC7), and the quality
+// (fast or high).
+void BM_CompressImage(Benchmark::State& state)
+{
+    uint32_t size     = static_cast<uint32_t>(state.range(0));
+    auto format       = static_cast<BlockFormat>(state.range(1));
+    auto quality      = static_cast<CompressionQuality>(state.range(2));
+    size_t pixelCount = static_cast<size_t>(size) * size;
+    vector<uint8_t> pixels(pixelCount * 4);
+    for (size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<uint8_t>((i * 7 + i / (size * 4) * 3) % 256);
+    }
+    vector<uint8_t> compressed(compressedImageSize(format, size, size));
+    while (state.keepRunning())
+    {
+        compressImage(pixels.data(), size, size, format, quality, compressed.data());
+        Benchmark::doNotOptimize(compressed.data());
+    }
+    state.setItemsProcessed(state.iterations() * pixelCount);
+    static const char* kFormatNames[] = { "BC1", "BC4", "BC5", "BC7" };
+    state.setLabel(string(kFormatNames[state.range(1)]) +
+        (quality == CompressionQuality::High ? " high" : " fast"));
+}
+AU_BENCHMARK(BM_CompressImage)
+    ->argSet({ 2048, 0, 0 })
+    ->argSet({ 2048, 0, 1 })
+    ->argSet({ 2048, 1, 0 })
+    ->argSet({ 2048, 2, 0 })
+    ->argSet({ 2048, 3, 0 })
+    ->argSet({ 2048, 3, 1 })
+    ->unit("ms");
+
+// Benchmarks converting an RGB float cube map environment to a lat-long layout, as done by the
+// image processing resolver. The benchmark arguments are the face size, where 2048 produces an 8K
+// lat-long image, and the thread count, where zero uses all hardware threads.
+void BM_ConvertCubeMapToLatLong(Benchmark::State& state)
+{
+    uint32_t faceSize    = static_cast<uint32_t>(state.range(0));
+    uint32_t threadCount = static_cast<uint32_t>(state.range(1));
+    vector<float> pixels[6];
+    CubeMapFace faces[6];
+    for (uint32_t i = 0; i < 6; i++)
+    {
+        pixels[i].resize(static_cast<size_t>(faceSize) * faceSize * 3);
+        for (size_t j = 0; j < pixels[i].size(); j++)
+        {
+            pixels[i][j] = static_cast<float>((i * 977 + j) % 4096) / 4096.0f;
+        }
+        faces[i] = { pixels[i].data(), faceSize, faceSize };
+    }
+    size_t pixelCount = static_cast<size_t>(faceSize) * faceSize * 8;
+    vector<float> latLong(pixelCount * 3);
+    while (state.keepRunning())
+    {
+        convertCubeMapToLatLong(faces, faceSize, 3, latLong.data(), threadCount);
+        Benchmark::doNotOptimize(latLong.data());
+    }
+    state.setItemsProcessed(state.iterations() * pixelCount);
+}
+AU_BENCHMARK(BM_ConvertCubeMapToLatLong)
+    ->argSet({ 512, 1 })
+    ->argSet({ 512, 0 })
+    ->argSet({ 2048, 0 })
+    ->unit("ms");
+
+} // namespace
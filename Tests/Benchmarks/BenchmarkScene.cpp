@@ -0,0 +1,256 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Benchmark.h"
+#include "NullRenderer.h"
+
+#include "GeometryDedupIndex.h"
+
+using namespace Aurora;
+
+namespace
+{
+
+const Path kGeometryPath = "BenchmarkGeometry";
+const Path kMaterialPath = "BenchmarkMaterial";
+
+// A scene with a CPU-only renderer, with a single triangle geometry and a material.
+struct BenchmarkScene
+{
+    BenchmarkScene()
+    {
+        pRenderer = make_shared<TestHelpers::NullRenderer>();
+        pScene    = pRenderer->createScene();
+        pRenderer->setScene(pScene);
+
+        // Create the triangle geometry, using static vertex data.
+        static const float kPositions[] = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+        static const float kNormals[]   = { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f };
+        GeometryDescriptor geomDesc;
+        auto& attributes                               = geomDesc.vertexDesc.attributes;
+        attributes[Names::VertexAttributes::kPosition] = AttributeFormat::Float3;
+        attributes[Names::VertexAttributes::kNormal]   = AttributeFormat::Float3;
+
+        geomDesc.type             = PrimitiveType::Triangles;
+        geomDesc.vertexDesc.count = 3;
+        geomDesc.indexCount       = 0;
+        geomDesc.getAttributeData = [](AttributeDataMap& buffers, size_t, size_t vertexCount,
+                                        size_t, size_t) {
+            buffers[Names::VertexAttributes::kPosition].address = kPositions;
+            buffers[Names::VertexAttributes::kPosition].size    = vertexCount * sizeof(vec3);
+            buffers[Names::VertexAttributes::kPosition].stride  = sizeof(vec3);
+            buffers[Names::VertexAttributes::kNormal].address   = kNormals;
+            buffers[Names::VertexAttributes::kNormal].size      = vertexCount * sizeof(vec3);
+            buffers[Names::VertexAttributes::kNormal].stride    = sizeof(vec3);
+            return true;
+        };
+        pScene->setGeometryDescriptor(kGeometryPath, geomDesc);
+        pScene->setMaterialProperties(kMaterialPath, { { "base_color", vec3(1, 0, 0) } });
+    }
+
+    shared_ptr<TestHelpers::NullRenderer> pRenderer;
+    IScenePtr pScene;
+};
+
+// Creates the definitions for the specified number of instances, in a grid.
+InstanceDefinitions createInstanceDefinitions(size_t count, const string& prefix)
+{
+    InstanceDefinitions definitions(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        vec3 position  = vec3(static_cast<float>(i % 1000), static_cast<float>(i / 1000), 0.0f);
+        mat4 transform = translate(position);
+        definitions[i].path       = prefix + to_string(i);
+        definitions[i].properties = { { Names::InstanceProperties::kMaterial, kMaterialPath },
+            { Names::InstanceProperties::kTransform, transform } };
+    }
+
+    return definitions;
+}
+
+// Benchmarks adding instances to a scene, which creates and activates an instance resource for
+// each one.
+void BM_SceneAddInstances(Benchmark::State& state)
+{
+    size_t count                    = static_cast<size_t>(state.range(0));
+    InstanceDefinitions definitions = createInstanceDefinitions(count, "Instance");
+    unique_ptr<BenchmarkScene> pBenchmarkScene;
+    while (state.keepRunning())
+    {
+        // Create a new scene for each iteration, as instance paths must be unique. The scene from
+        // the previous iteration is destroyed here, so its destruction is not measured.
+        state.pauseTiming();
+        pBenchmarkScene = make_unique<BenchmarkScene>();
+        state.resumeTiming();
+
+        Paths paths = pBenchmarkScene->pScene->addInstances(kGeometryPath, definitions);
+        Benchmark::doNotOptimize(paths);
+    }
+    state.pauseTiming();
+    pBenchmarkScene.reset();
+    state.setItemsProcessed(state.iterations() * count);
+}
+AU_BENCHMARK(BM_SceneAddInstances)->range(1000, 1000000, 10)->unit("ms");
+
+// Benchmarks setting the properties of an active material, including the update of its uniform
+// buffer when the scene is updated.
+void BM_SceneSetMaterialProperties(Benchmark::State& state)
+{
+    BenchmarkScene benchmarkScene;
+    benchmarkScene.pScene->addInstance("Instance", kGeometryPath,
+        { { Names::InstanceProperties::kMaterial, kMaterialPath } });
+    benchmarkScene.pRenderer->render(0, 1);
+
+    size_t count = static_cast<size_t>(state.range(0));
+    float value  = 0.0f;
+    while (state.keepRunning())
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            value = value < 1.0f ? value + 0.001f : 0.0f;
+            benchmarkScene.pScene->setMaterialProperties(kMaterialPath,
+                { { "base_color", vec3(value, 0.5f, 0.5f) }, { "specular_roughness", value } });
+        }
+        benchmarkScene.pRenderer->render(0, 1);
+    }
+    state.setItemsProcessed(state.iterations() * count);
+}
+AU_BENCHMARK(BM_SceneSetMaterialProperties)->range(1, 1000, 10)->unit("us");
+
+// Benchmarks setting the properties of many active instances, followed by a scene update.
+void BM_SceneSetInstanceProperties(Benchmark::State& state)
+{
+    size_t count = static_cast<size_t>(state.range(0));
+    BenchmarkScene benchmarkScene;
+    Paths paths = benchmarkScene.pScene->addInstances(
+        kGeometryPath, createInstanceDefinitions(count, "Instance"));
+    benchmarkScene.pRenderer->render(0, 1);
+
+    float offset = 0.0f;
+    while (state.keepRunning())
+    {
+        offset += 1.0f;
+        mat4 transform = translate(vec3(offset, 0, 0));
+        for (const Path& path : paths)
+        {
+            benchmarkScene.pScene->setInstanceProperties(
+                path, { { Names::InstanceProperties::kTransform, transform } });
+        }
+        benchmarkScene.pRenderer->render(0, 1);
+    }
+    state.setItemsProcessed(state.iterations() * count);
+}
+AU_BENCHMARK(BM_SceneSetInstanceProperties)->range(1000, 100000, 10)->unit("ms");
+
+// Vertex and index data for a flat grid with the specified number of quads along each side.
+struct GridData
+{
+    GridData(uint32_t size)
+    {
+        uint32_t rowLength = size + 1;
+        for (uint32_t y = 0; y < rowLength; y++)
+        {
+            for (uint32_t x = 0; x < rowLength; x++)
+            {
+                positions.insert(positions.end(),
+                    { static_cast<float>(x) / size, static_cast<float>(y) / size, 0.0f });
+            }
+        }
+        for (uint32_t y = 0; y < size; y++)
+        {
+            for (uint32_t x = 0; x < size; x++)
+            {
+                uint32_t i = y * rowLength + x;
+                indices.insert(indices.end(),
+                    { i, i + 1, i + rowLength, i + 1, i + rowLength + 1, i + rowLength });
+            }
+        }
+    }
+
+    // Creates a descriptor for the grid data, which must outlive the descriptor.
+    GeometryDescriptor descriptor() const
+    {
+        GeometryDescriptor geomDesc;
+        geomDesc.vertexDesc.attributes[Names::VertexAttributes::kPosition] =
+            AttributeFormat::Float3;
+        geomDesc.vertexDesc.count = positions.size() / 3;
+        geomDesc.indexCount       = indices.size();
+        geomDesc.getAttributeData = [this](AttributeDataMap& buffers, size_t, size_t, size_t,
+                                        size_t) {
+            buffers[Names::VertexAttributes::kPosition].address = positions.data();
+            buffers[Names::VertexAttributes::kPosition].stride  = sizeof(vec3);
+            buffers[Names::VertexAttributes::kIndices].address  = indices.data();
+            buffers[Names::VertexAttributes::kIndices].stride   = sizeof(uint32_t);
+            return true;
+        };
+
+        return geomDesc;
+    }
+
+    vector<float> positions;
+    vector<uint32_t> indices;
+};
+
+// Benchmarks hashing the content of a geometry descriptor, as done for geometry deduplication, for
+// a grid with the specified number of quads along each side.
+void BM_GeometryDedupHash(Benchmark::State& state)
+{
+    GridData grid(static_cast<uint32_t>(state.range(0)));
+    GeometryDescriptor geomDesc = grid.descriptor();
+    while (state.keepRunning())
+    {
+        size_t hash = 0;
+        GeometryDedupIndex::hashDescriptor(geomDesc, hash);
+        Benchmark::doNotOptimize(hash);
+    }
+    state.setBytesProcessed(state.iterations() *
+        (grid.positions.size() * sizeof(float) + grid.indices.size() * sizeof(uint32_t)));
+}
+AU_BENCHMARK(BM_GeometryDedupHash)->range(16, 1024, 4)->unit("us");
+
+// Benchmarks setting many geometry descriptors with identical content, and activating them with an
+// instance each, with geometry deduplication disabled (0) or enabled (1).
+void BM_SceneDeduplicateGeometry(Benchmark::State& state)
+{
+    bool isDedupEnabled = state.range(0) != 0;
+    const size_t count  = 1000;
+    GridData grid(64);
+    GeometryDescriptor geomDesc = grid.descriptor();
+    unique_ptr<BenchmarkScene> pBenchmarkScene;
+    size_t createdCount = 0;
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        pBenchmarkScene = make_unique<BenchmarkScene>();
+        pBenchmarkScene->pScene->setGeometryDeduplicationEnabled(isDedupEnabled);
+        size_t initialCount = pBenchmarkScene->pRenderer->createdCounts().geometry;
+        state.resumeTiming();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            Path geometryPath = "Geometry" + to_string(i);
+            pBenchmarkScene->pScene->setGeometryDescriptor(geometryPath, geomDesc);
+            pBenchmarkScene->pScene->addInstance("Instance" + to_string(i), geometryPath);
+        }
+        pBenchmarkScene->pRenderer->render(0, 1);
+        createdCount = pBenchmarkScene->pRenderer->createdCounts().geometry - initialCount;
+    }
+    state.pauseTiming();
+    pBenchmarkScene.reset();
+    state.setItemsProcessed(state.iterations() * count);
+    state.setLabel(to_string(createdCount) + " geometry created");
+}
+AU_BENCHMARK(BM_SceneDeduplicateGeometry)->arg(0)->arg(1)->unit("ms");
+
+} // namespace
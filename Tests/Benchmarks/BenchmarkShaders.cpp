@@ -0,0 +1,94 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Benchmark.h"
+
+// Include the Aurora PCH (this is an internal benchmark so needs all the internal Aurora includes)
+#include "pch.h"
+
+#include "HostShaders.h"
+
+namespace
+{
+
+// Gets the shared shader code compiled for the host CPU, compiling it on first use.
+const TestHelpers::HostShaders& hostShaders()
+{
+    static TestHelpers::HostShaders shaders;
+
+    return shaders;
+}
+
+// Returns a material with all the Standard Surface lobes that are sampled by the path tracer.
+TestHelpers::HostMaterial layeredMaterial()
+{
+    TestHelpers::HostMaterial material;
+    material.metalness         = 0.5f;
+    material.specularRoughness = 0.4f;
+    material.coat              = 0.5f;
+    material.sheen             = 0.5f;
+
+    return material;
+}
+
+// Benchmarks evaluating the Standard Surface BSDF on the CPU, for a range of light directions.
+void BM_HostEvaluateMaterial(Benchmark::State& state)
+{
+    const TestHelpers::HostShaders& shaders = hostShaders();
+    if (!shaders.isValid())
+    {
+        state.skipWithError("Host shaders could not be compiled: " + shaders.errors());
+        return;
+    }
+
+    TestHelpers::HostMaterial material = layeredMaterial();
+    vec3 V                             = normalize(vec3(0.3f, 0.1f, 1.0f));
+    float result[5];
+    float angle = 0.0f;
+    while (state.keepRunning())
+    {
+        angle += 0.001f;
+        vec3 L = normalize(vec3(cos(angle), sin(angle), 1.0f));
+        shaders.evaluateMaterial(material.data(), &V.x, &L.x, 0.5f, fract(angle), result);
+        Benchmark::doNotOptimize(result);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+AU_BENCHMARK(BM_HostEvaluateMaterial);
+
+// Benchmarks sampling the Standard Surface BSDF on the CPU, for a range of random numbers.
+void BM_HostSampleMaterial(Benchmark::State& state)
+{
+    const TestHelpers::HostShaders& shaders = hostShaders();
+    if (!shaders.isValid())
+    {
+        state.skipWithError("Host shaders could not be compiled: " + shaders.errors());
+        return;
+    }
+
+    TestHelpers::HostMaterial material = layeredMaterial();
+    vec3 V                             = normalize(vec3(0.3f, 0.1f, 1.0f));
+    float result[8];
+    float random = 0.0f;
+    while (state.keepRunning())
+    {
+        random = fract(random + 0.618034f);
+        shaders.sampleMaterial(material.data(), &V.x, random, 1.0f - random, result);
+        Benchmark::doNotOptimize(result);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+AU_BENCHMARK(BM_HostSampleMaterial);
+
+} // namespace
@@ -0,0 +1,25 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Aurora/Foundation/Log.h>
+
+#include "Benchmark.h"
+
+int main(int argc, char** argv)
+{
+    // Disable message boxes, so that errors cannot block an unattended benchmark run.
+    Aurora::Foundation::Log::logger().enableFailureDialog(false);
+
+    return Benchmark::runBenchmarks(argc, argv);
+}
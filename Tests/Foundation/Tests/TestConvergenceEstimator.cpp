@@ -0,0 +1,254 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DISABLE_UNIT_TESTS
+
+#include <Aurora/Foundation/ConvergenceEstimator.h>
+#include <Aurora/Foundation/Timer.h>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include "TestHelpers.h"
+
+using namespace std;
+using namespace Aurora::Foundation;
+
+namespace
+{
+
+class ConvergenceEstimatorTest : public ::testing::Test
+{
+public:
+    ConvergenceEstimatorTest() {}
+    ~ConvergenceEstimatorTest() {}
+
+    // A progressively rendered RGBA image, where each sample of a pixel is its (gray) value plus
+    // Gaussian noise, and the noise can be different for the left and right halves of the image.
+    class NoisyImage
+    {
+    public:
+        NoisyImage(
+            uint32_t width, uint32_t height, float value, float leftNoise, float rightNoise) :
+            _width(width),
+            _height(height),
+            _value(value),
+            _leftNoise(leftNoise),
+            _rightNoise(rightNoise),
+            _sums(width * height, 0.0f),
+            _pixels(width * height * 4, 1.0f)
+        {
+        }
+
+        // Adds the specified number of samples to each pixel, updating the accumulated image.
+        void addSamples(uint32_t count)
+        {
+            normal_distribution<float> distribution(0.0f, 1.0f);
+            for (uint32_t i = 0; i < count; i++)
+            {
+                for (uint32_t y = 0; y < _height; y++)
+                {
+                    for (uint32_t x = 0; x < _width; x++)
+                    {
+                        float noise = x < _width / 2 ? _leftNoise : _rightNoise;
+                        _sums[y * _width + x] += _value + noise * distribution(_random);
+                    }
+                }
+            }
+            _sampleCount += count;
+            for (size_t i = 0; i < _sums.size(); i++)
+            {
+                float average      = _sums[i] / _sampleCount;
+                _pixels[i * 4]     = average;
+                _pixels[i * 4 + 1] = average;
+                _pixels[i * 4 + 2] = average;
+            }
+        }
+
+        // Updates the estimator with the accumulated image.
+        bool update(ConvergenceEstimator& estimator)
+        {
+            return estimator.update(
+                _pixels.data(), _width * 4 * sizeof(float), _width, _height, 4, _sampleCount);
+        }
+
+        uint32_t sampleCount() const { return _sampleCount; }
+
+    private:
+        uint32_t _width;
+        uint32_t _height;
+        float _value;
+        float _leftNoise;
+        float _rightNoise;
+        uint32_t _sampleCount = 0;
+        vector<float> _sums;
+        vector<float> _pixels;
+        mt19937 _random;
+    };
+
+    // Computes the expected error of a tile, for the specified noise and number of samples. This is
+    // the expected absolute error of the three channels, relative to the square root of the pixel
+    // brightness.
+    static float expectedError(float value, float noise, uint32_t sampleCount)
+    {
+        float absoluteError = noise / sqrt(static_cast<float>(sampleCount)) * sqrt(2.0f / M_PI);
+
+        return 3.0f * absoluteError / sqrt(3.0f * value);
+    }
+};
+
+// Test that the estimated error matches the actual error of the accumulated image.
+TEST_F(ConvergenceEstimatorTest, TestErrorEstimate)
+{
+    const float kValue = 0.5f;
+    NoisyImage image(64, 32, kValue, 0.4f, 0.1f);
+    ConvergenceEstimator estimator(0.001f, 16, 4);
+
+    // The first update only takes a snapshot.
+    image.addSamples(16);
+    ASSERT_TRUE(estimator.needsImage(image.sampleCount()));
+    ASSERT_FALSE(image.update(estimator));
+    ASSERT_TRUE(estimator.tileErrors().empty());
+
+    // The image isn't needed again until the sample count has grown enough.
+    image.addSamples(4);
+    ASSERT_FALSE(estimator.needsImage(image.sampleCount()));
+    image.addSamples(4);
+    ASSERT_TRUE(estimator.needsImage(image.sampleCount()));
+    ASSERT_TRUE(image.update(estimator));
+
+    // There are 4x2 tiles, where the left tiles have four times the noise of the right tiles.
+    const vector<float>& errors = estimator.tileErrors();
+    ASSERT_EQ(errors.size(), 8);
+    ASSERT_EQ(estimator.tileCountX(), 4);
+    float leftError  = expectedError(kValue, 0.4f, image.sampleCount());
+    float rightError = expectedError(kValue, 0.1f, image.sampleCount());
+    for (uint32_t i = 0; i < errors.size(); i++)
+    {
+        float expected = i % 4 < 2 ? leftError : rightError;
+        ASSERT_NEAR(errors[i], expected, expected * 0.2f) << "Tile " << i;
+    }
+
+    const ConvergenceEstimator::Statistics& stats = estimator.statistics();
+    ASSERT_EQ(stats.sampleCount, 24);
+    ASSERT_EQ(stats.tileCount, 8);
+    ASSERT_EQ(stats.convergedTileCount, 0);
+    ASSERT_NEAR(stats.maxError, leftError, leftError * 0.2f);
+    ASSERT_NEAR(stats.averageError, (leftError + rightError) * 0.5f, leftError * 0.1f);
+    ASSERT_FALSE(estimator.isConverged());
+
+    // Raising the threshold above the error of the right tiles converges those tiles only, and
+    // raising it above the error of every tile converges the image.
+    estimator.setThreshold(rightError * 1.5f);
+    ASSERT_EQ(estimator.statistics().convergedTileCount, 4);
+    ASSERT_FALSE(estimator.isConverged());
+    estimator.setThreshold(leftError * 1.5f);
+    ASSERT_TRUE(estimator.isConverged());
+
+    // Resetting the estimator discards the estimate and the snapshot.
+    estimator.reset();
+    ASSERT_FALSE(estimator.isConverged());
+    ASSERT_TRUE(estimator.tileErrors().empty());
+    ASSERT_FALSE(image.update(estimator));
+}
+
+// Test that progressive rendering stops at the sample count where the image reaches the threshold,
+// with few readbacks of the image.
+TEST_F(ConvergenceEstimatorTest, TestEarlyStopping)
+{
+    const float kValue     = 1.0f;
+    const float kThreshold = 0.02f;
+    NoisyImage image(48, 48, kValue, 0.2f, 0.05f);
+    ConvergenceEstimator estimator(kThreshold, 16, 16);
+
+    // Render a fixed number of samples per frame, estimating the error when needed.
+    uint32_t readbackCount = 0;
+    while (!estimator.isConverged() && image.sampleCount() < 10000)
+    {
+        image.addSamples(4);
+        if (estimator.needsImage(image.sampleCount()))
+        {
+            image.update(estimator);
+            readbackCount++;
+        }
+    }
+
+    // The image stops between the sample count needed for the noisiest tiles to reach the
+    // threshold, and that count multiplied by the growth factor between estimates.
+    float requiredSamples = powf(expectedError(kValue, 0.2f, 1) / kThreshold, 2.0f);
+    ASSERT_TRUE(estimator.isConverged());
+    ASSERT_GE(image.sampleCount(), requiredSamples * 0.8f);
+    ASSERT_LE(image.sampleCount(), requiredSamples * 1.5f * 1.2f);
+    ASSERT_LT(estimator.statistics().maxError, kThreshold);
+    ASSERT_LT(readbackCount, 16u);
+}
+
+// Test that the sample counter stops requesting samples once the result is converged, until it is
+// restarted.
+TEST_F(ConvergenceEstimatorTest, TestSampleCounterConverged)
+{
+    SampleCounter counter(33.3f, 200.0f, 1000);
+    uint32_t sampleStart = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        ASSERT_EQ(counter.update(sampleStart), 1u);
+    }
+    ASSERT_FALSE(counter.isComplete());
+
+    counter.setConverged(true);
+    ASSERT_TRUE(counter.isComplete());
+    ASSERT_EQ(counter.update(sampleStart), 0u);
+    ASSERT_EQ(sampleStart, 4u);
+    ASSERT_EQ(counter.currentSamples(), 4u);
+
+    ASSERT_GT(counter.update(sampleStart, true), 0u);
+    ASSERT_EQ(sampleStart, 0u);
+}
+
+// Test that a disabled estimator never needs an image, and that the image isn't converged before
+// the minimum number of samples, even if there is no noise.
+TEST_F(ConvergenceEstimatorTest, TestDisabledAndMinSamples)
+{
+    ConvergenceEstimator disabled(0.0f);
+    ASSERT_FALSE(disabled.isEnabled());
+    ASSERT_FALSE(disabled.needsImage(1000));
+
+    NoisyImage image(20, 10, 0.5f, 0.0f, 0.0f);
+    ConvergenceEstimator estimator(0.01f, 8, 64);
+    ASSERT_FALSE(estimator.needsImage(16));
+    image.addSamples(32);
+    ASSERT_TRUE(estimator.needsImage(image.sampleCount()));
+    image.update(estimator);
+    image.addSamples(16);
+    ASSERT_FALSE(estimator.needsImage(image.sampleCount()));
+    image.addSamples(16);
+    ASSERT_TRUE(image.update(estimator));
+
+    // The partial tiles at the edges are included.
+    ASSERT_EQ(estimator.tileErrors().size(), 6);
+    ASSERT_EQ(estimator.statistics().maxError, 0.0f);
+    ASSERT_TRUE(estimator.isConverged());
+
+    // An image with fewer samples, e.g. after a restart, only replaces the snapshot.
+    NoisyImage restarted(20, 10, 0.5f, 0.0f, 0.0f);
+    restarted.addSamples(8);
+    ASSERT_TRUE(estimator.needsImage(restarted.sampleCount()));
+    ASSERT_FALSE(restarted.update(estimator));
+    ASSERT_FALSE(estimator.isConverged());
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,176 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DISABLE_UNIT_TESTS
+
+#include <Aurora/Foundation/CubeMap.h>
+#include <cmath>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "TestHelpers.h"
+
+using namespace std;
+using namespace Aurora::Foundation;
+
+namespace
+{
+
+class CubeMapTest : public ::testing::Test
+{
+public:
+    CubeMapTest() {}
+    ~CubeMapTest() {}
+
+    // Creates the pixels of a cube map face, where each pixel is unique to the face and position.
+    static vector<float> createFace(
+        uint32_t faceIndex, uint32_t width, uint32_t height, uint32_t channelCount)
+    {
+        vector<float> pixels(width * height * channelCount);
+        for (size_t i = 0; i < pixels.size(); i++)
+        {
+            pixels[i] = static_cast<float>(faceIndex * 100000 + i) / 1000.0f;
+        }
+
+        return pixels;
+    }
+
+    // Converts a cube map to a lat-long image one pixel at a time, as the image processing resolver
+    // did originally. This is the golden reference, which the optimized conversion must match
+    // exactly.
+    static vector<float> convertReference(
+        const CubeMapFace faces[6], uint32_t faceSize, uint32_t channelCount)
+    {
+        int patch = static_cast<int>(faceSize);
+        vector<float> result(8 * faceSize * faceSize * channelCount);
+        for (int h = 0; h < 2 * patch; ++h)
+        {
+            float const phi = static_cast<float>(3.14159265358979323846 * (h - patch) / (2 * patch));
+            for (int w = 0; w < 4 * patch; ++w)
+            {
+                int coord_x, coord_y, face;
+                float theta =
+                    static_cast<float>(3.14159265358979323846 * (w - 2 * patch) / (2 * patch));
+                float x = cos(phi) * sin(theta);
+                float y = sin(phi);
+                float z = cos(phi) * cos(theta);
+                if (abs(x) >= abs(y) && abs(x) >= abs(z))
+                {
+                    coord_x = static_cast<int>(patch * (1.0 - z / x) / 2.0);
+                    coord_y = static_cast<int>(patch * (1.0 + y / x) / 2.0);
+                    face    = x < 0.0 ? 1 : 0;
+                }
+                else if (abs(y) > abs(z))
+                {
+                    coord_x = static_cast<int>(patch * (1 + x / y) / 2.0);
+                    coord_y = static_cast<int>(patch * (1 - z / y) / 2.0);
+                    face    = y < 0.0 ? 3 : 2;
+                }
+                else
+                {
+                    coord_x = static_cast<int>(patch * (1 + x / z) / 2.0);
+                    coord_y = static_cast<int>(patch * (1 + z / abs(z) * y / z) / 2.0);
+                    face    = z < 0.0 ? 5 : 4;
+                }
+
+                // Pixels outside the face are black, as with OpenImageIO.
+                const CubeMapFace& source = faces[face];
+                float* pDest = &result[(h * 4 * faceSize + w) * channelCount];
+                bool inside  = coord_x >= 0 && coord_y >= 0 &&
+                    coord_x < static_cast<int>(source.width) &&
+                    coord_y < static_cast<int>(source.height);
+                for (uint32_t c = 0; c < channelCount; c++)
+                {
+                    *pDest++ = inside
+                        ? source.pPixels[(coord_y * source.width + coord_x) * channelCount + c]
+                        : 0.0f;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    // Converts a cube map with the specified face size and extra face width, and checks that the
+    // result matches the reference conversion exactly, with one and several threads.
+    static void testConversion(uint32_t faceSize, uint32_t extraWidth, uint32_t channelCount)
+    {
+        vector<float> pixels[6];
+        CubeMapFace faces[6];
+        for (uint32_t i = 0; i < 6; i++)
+        {
+            uint32_t width = faceSize + (i < 2 ? extraWidth : 0);
+            pixels[i]      = createFace(i, width, faceSize, channelCount);
+            faces[i]       = { pixels[i].data(), width, faceSize };
+        }
+        vector<float> expected = convertReference(faces, faceSize, channelCount);
+
+        for (uint32_t threadCount : { 1u, 3u })
+        {
+            vector<float> result(expected.size(), -1.0f);
+            convertCubeMapToLatLong(faces, faceSize, channelCount, result.data(), threadCount);
+            ASSERT_EQ(memcmp(result.data(), expected.data(), expected.size() * sizeof(float)), 0)
+                << "Face size " << faceSize << ", channels " << channelCount << ", threads "
+                << threadCount;
+        }
+    }
+};
+
+// Test that the conversion matches the reference conversion exactly, for a range of face sizes.
+TEST_F(CubeMapTest, TestMatchesReference)
+{
+    for (uint32_t faceSize : { 1u, 2u, 3u, 16u, 17u, 64u, 255u })
+    {
+        testConversion(faceSize, 0, 4);
+        testConversion(faceSize, 0, 3);
+    }
+}
+
+// Test faces that are a pixel wider than the face size, as cut from some cross layouts.
+TEST_F(CubeMapTest, TestWideFaces)
+{
+    testConversion(32, 1, 3);
+    testConversion(100, 1, 4);
+}
+
+// Test that directions along each axis sample the center of the corresponding face.
+TEST_F(CubeMapTest, TestAxisDirections)
+{
+    // Create faces with a single channel, where each face is filled with its index.
+    const uint32_t faceSize = 8;
+    vector<float> pixels[6];
+    CubeMapFace faces[6];
+    for (uint32_t i = 0; i < 6; i++)
+    {
+        pixels[i].assign(faceSize * faceSize, static_cast<float>(i));
+        faces[i] = { pixels[i].data(), faceSize, faceSize };
+    }
+    vector<float> result(8 * faceSize * faceSize);
+    convertCubeMapToLatLong(faces, faceSize, 1, result.data());
+
+    // The center of the image faces +Z, and a quarter turn either side faces +X and -X, on the
+    // middle row. The first row faces -Y.
+    const uint32_t width = 4 * faceSize;
+    const uint32_t row   = faceSize * width;
+    ASSERT_EQ(result[row + 2 * faceSize], 4.0f);
+    ASSERT_EQ(result[row + 3 * faceSize], 0.0f);
+    ASSERT_EQ(result[row + faceSize], 1.0f);
+    ASSERT_EQ(result[row], 5.0f);
+    ASSERT_EQ(result[2 * faceSize], 3.0f);
+}
+
+} // namespace
+
+#endif
@@ -16,6 +16,8 @@
 
 #include <Aurora/Foundation/Log.h>
 #include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
 
 #include "TestHelpers.h"
 
@@ -179,4 +181,107 @@ TEST_F(LoggerTest, TestLogger)
     }
 }
 
+// Test that console output from a single call site is rate limited, and the discarded events
+// reported, while the callback still receives every event.
+TEST_F(LoggerTest, TestRateLimit)
+{
+    // Capture the standard error, which is used for warning events, and count the events passed
+    // to the callback.
+    std::stringstream capture;
+    std::streambuf* pPreviousBuffer = std::cerr.rdbuf(capture.rdbuf());
+    int count                       = 0;
+    Log::logger().setLogFunction(
+        [&count](const std::string&, int, Log::Level, const std::string&) {
+            count++;
+            return true;
+        });
+    Log::logger().setRateLimit(10);
+
+    // Only the first events from a call site are written, while other call sites are unaffected.
+    // NOTE: The limit is per second, so twice the limit is possible if the loop crosses a second.
+    for (int i = 0; i < 100; i++)
+    {
+        AU_WARN("Warning %d", i);
+    }
+    ASSERT_EQ(count, 100);
+    std::string output  = capture.str();
+    size_t writtenCount = 0;
+    size_t pos          = output.find("Warning ");
+    while (pos != std::string::npos)
+    {
+        writtenCount++;
+        pos = output.find("Warning ", pos + 1);
+    }
+    ASSERT_GE(writtenCount, 10u);
+    ASSERT_LE(writtenCount, 20u);
+    AU_WARN("Another warning");
+    ASSERT_EQ(count, 101);
+    ASSERT_NE(capture.str().find("Another warning"), std::string::npos);
+    std::cerr.rdbuf(pPreviousBuffer);
+
+    // Failures are never discarded. The callback returns false, so they don't abort.
+    count = 0;
+    Log::logger().setLogFunction(
+        [&count](const std::string&, int, Log::Level, const std::string&) {
+            count++;
+            return false;
+        });
+    for (int i = 0; i < 100; i++)
+    {
+        AU_FAIL("Failure %d", i);
+    }
+    ASSERT_EQ(count, 100);
+
+    Log::logger().setRateLimit(Log::kDefaultRateLimit);
+    Log::logger().setLogFunction(nullptr);
+}
+
+// Test asynchronous output, including deferred formatting and collapsing of repeated messages.
+TEST_F(LoggerTest, TestAsyncOutput)
+{
+    // Capture the standard output, which is used for information events.
+    std::stringstream capture;
+    std::streambuf* pPreviousBuffer = std::cout.rdbuf(capture.rdbuf());
+    Log::logger().setLogFunction(nullptr);
+    Log::logger().enableAsyncOutput(true);
+    ASSERT_TRUE(Log::logger().isAsyncOutputEnabled());
+
+    // Log a message with a string argument that is destroyed before the writer thread formats it,
+    // so it must be copied.
+    int startLine = __LINE__;
+    {
+        std::string name = "temporary";
+        AU_INFO("Value %d %s %0.2f", 42, name.c_str(), 1.5f);
+    }
+
+    // Log identical messages from multiple threads.
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([]() {
+            for (int j = 0; j < 5; j++)
+            {
+                AU_INFO("Repeated");
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    Log::logger().flush();
+    std::cout.rdbuf(pPreviousBuffer);
+    ASSERT_EQ(Log::logger().droppedEventCount(), 0u);
+    Log::logger().enableAsyncOutput(false);
+
+    // The first message must be formatted with the file and line prefix, and the repeated messages
+    // collapsed into a single message with a repeat count.
+    std::string output   = capture.str();
+    std::string expected = std::string(__FILE__) + " (" + std::to_string(startLine + 3) +
+        "):\tValue 42 temporary 1.50\n";
+    ASSERT_EQ(output.find(expected), 0u);
+    ASSERT_NE(output.find("Repeated\n"), std::string::npos);
+    ASSERT_NE(output.find("Last message repeated 19 times.\n"), std::string::npos);
+}
+
 #endif
@@ -0,0 +1,244 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DISABLE_UNIT_TESTS
+
+#include <Aurora/Foundation/PixelConversion.h>
+#include <cmath>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+#include "TestHelpers.h"
+
+using namespace std;
+using namespace Aurora::Foundation;
+
+namespace
+{
+
+class PixelConversionTest : public ::testing::Test
+{
+public:
+    PixelConversionTest() {}
+    ~PixelConversionTest() {}
+};
+
+// Test scalar conversion between float and half float, including special values.
+TEST_F(PixelConversionTest, TestHalfScalar)
+{
+    // Exactly representable values.
+    ASSERT_EQ(floatToHalf(0.0f), 0x0000);
+    ASSERT_EQ(floatToHalf(-0.0f), 0x8000);
+    ASSERT_EQ(floatToHalf(1.0f), 0x3C00);
+    ASSERT_EQ(floatToHalf(-2.0f), 0xC000);
+    ASSERT_EQ(floatToHalf(65504.0f), 0x7BFF);
+    ASSERT_EQ(floatToHalf(powf(2.0f, -24.0f)), 0x0001);
+
+    // Rounding to nearest even, overflow, and underflow.
+    ASSERT_EQ(floatToHalf(1.0f + powf(2.0f, -11.0f)), 0x3C00);
+    ASSERT_EQ(floatToHalf(1.0f + 3.0f * powf(2.0f, -11.0f)), 0x3C02);
+    ASSERT_EQ(floatToHalf(65520.0f), 0x7C00);
+    ASSERT_EQ(floatToHalf(powf(2.0f, -26.0f)), 0x0000);
+
+    // Infinity and NaN.
+    ASSERT_EQ(floatToHalf(numeric_limits<float>::infinity()), 0x7C00);
+    ASSERT_EQ(floatToHalf(-numeric_limits<float>::infinity()), 0xFC00);
+    uint16_t nan = floatToHalf(numeric_limits<float>::quiet_NaN());
+    ASSERT_EQ(nan & 0x7C00, 0x7C00);
+    ASSERT_NE(nan & 0x03FF, 0);
+
+    // Every half value (other than NaN) must survive a round trip through float.
+    for (uint32_t i = 0; i < 0x10000; i++)
+    {
+        uint16_t half = static_cast<uint16_t>(i);
+        float value   = halfToFloat(half);
+        if (isnan(value))
+        {
+            ASSERT_EQ(half & 0x7C00, 0x7C00);
+            continue;
+        }
+        ASSERT_EQ(floatToHalf(value), half);
+    }
+}
+
+// Test that the array conversions match the scalar conversions, for all lengths around the SIMD
+// width so that the remainder handling is exercised.
+TEST_F(PixelConversionTest, TestHalfArray)
+{
+    // Create values covering normals, subnormals, and special values.
+    vector<float> values;
+    for (int i = -40; i < 40; i++)
+    {
+        values.push_back(ldexpf(1.0f + i * 0.0137f, i));
+        values.push_back(-ldexpf(1.3f, i / 2));
+    }
+    values.push_back(numeric_limits<float>::infinity());
+    values.push_back(100000.0f);
+    values.push_back(-0.0f);
+
+    for (size_t count = 0; count <= values.size(); count += 7)
+    {
+        vector<uint16_t> halves(count, 0);
+        convertFloatToHalf(values.data(), halves.data(), count);
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(halves[i], floatToHalf(values[i])) << "Value " << values[i];
+        }
+
+        vector<float> floats(count, 0.0f);
+        convertHalfToFloat(halves.data(), floats.data(), count);
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(floats[i], halfToFloat(halves[i]));
+        }
+    }
+
+    // NaN remains NaN.
+    vector<float> nans(16, numeric_limits<float>::quiet_NaN());
+    vector<uint16_t> nanHalves(16);
+    convertFloatToHalf(nans.data(), nanHalves.data(), nans.size());
+    convertHalfToFloat(nanHalves.data(), nans.data(), nans.size());
+    for (float nan : nans)
+    {
+        ASSERT_TRUE(isnan(nan));
+    }
+}
+
+// Test that RGB and RGBA float pixels are converted to RGBA half pixels, with an alpha of one for
+// RGB pixels, for all pixel counts around the SIMD width.
+TEST_F(PixelConversionTest, TestHalfRGBA)
+{
+    vector<float> values;
+    for (int i = 0; i < 72; i++)
+    {
+        values.push_back(ldexpf(1.0f + i * 0.0137f, i % 20 - 10) * (i % 3 ? 1.0f : -1.0f));
+    }
+
+    for (size_t channelCount : { 3, 4 })
+    {
+        for (size_t pixelCount = 0; pixelCount <= values.size() / channelCount; pixelCount++)
+        {
+            vector<uint16_t> halves(pixelCount * 4, 0);
+            convertFloatToHalfRGBA(values.data(), channelCount, halves.data(), pixelCount);
+            for (size_t i = 0; i < pixelCount; i++)
+            {
+                for (size_t c = 0; c < 4; c++)
+                {
+                    uint16_t expected =
+                        c < channelCount ? floatToHalf(values[i * channelCount + c]) : 0x3C00;
+                    ASSERT_EQ(halves[i * 4 + c], expected) << "Pixel " << i << ", channel " << c;
+                }
+            }
+        }
+    }
+}
+
+// Test conversion to 8-bit unsigned normalized values, with and without dithering.
+TEST_F(PixelConversionTest, TestUNorm8)
+{
+    // Values are clamped and rounded to nearest, and NaN becomes zero.
+    vector<float> values = { -1.0f, 0.0f, 0.5f / 255.0f - 0.0001f, 0.5f / 255.0f + 0.0001f, 0.5f,
+        1.0f, 2.0f, numeric_limits<float>::quiet_NaN(), 128.0f / 255.0f, 254.6f / 255.0f };
+    vector<uint8_t> expected = { 0, 0, 0, 1, 128, 255, 255, 0, 128, 255 };
+    vector<float> repeated;
+    for (int i = 0; i < 5; i++)
+    {
+        repeated.insert(repeated.end(), values.begin(), values.end());
+    }
+    vector<uint8_t> result(repeated.size());
+    convertFloatToUNorm8(repeated.data(), result.data(), repeated.size());
+    for (size_t i = 0; i < result.size(); i++)
+    {
+        ASSERT_EQ(result[i], expected[i % expected.size()]) << "Index " << i;
+    }
+
+    // A constant value halfway between two levels is dithered to an even mix of both levels, and
+    // the same level is used for each channel of a pixel.
+    const size_t width = 32, height = 8, channelCount = 3;
+    vector<float> image(width * height * channelCount, 100.5f / 255.0f);
+    vector<uint8_t> dithered(image.size());
+    convertImageFloatToUNorm8(image.data(), width * channelCount * sizeof(float), dithered.data(),
+        width * channelCount, width, height, channelCount, true);
+    size_t upperCount = 0;
+    for (size_t i = 0; i < dithered.size(); i += channelCount)
+    {
+        ASSERT_TRUE(dithered[i] == 100 || dithered[i] == 101);
+        ASSERT_EQ(dithered[i + 1], dithered[i]);
+        ASSERT_EQ(dithered[i + 2], dithered[i]);
+        upperCount += dithered[i] == 101 ? 1 : 0;
+    }
+    ASSERT_EQ(upperCount, width * height / 2);
+
+    // Dithering never changes values that are exactly representable.
+    fill(image.begin(), image.end(), 1.0f);
+    convertImageFloatToUNorm8(image.data(), width * channelCount * sizeof(float), dithered.data(),
+        width * channelCount, width, height, channelCount, true);
+    for (uint8_t value : dithered)
+    {
+        ASSERT_EQ(value, 255);
+    }
+}
+
+// Test that image conversions remove row padding.
+TEST_F(PixelConversionTest, TestRemovePadding)
+{
+    // Create a float RGBA image with padded rows, where the padding is filled with a marker value.
+    const size_t width = 13, height = 5, channelCount = 4, paddedWidth = 16;
+    const float kPadding = -123.0f;
+    vector<float> source(paddedWidth * height * channelCount, kPadding);
+    for (size_t y = 0; y < height; y++)
+    {
+        for (size_t i = 0; i < width * channelCount; i++)
+        {
+            source[y * paddedWidth * channelCount + i] = static_cast<float>(y * 100 + i) / 1000.0f;
+        }
+    }
+    size_t sourceStride = paddedWidth * channelCount * sizeof(float);
+
+    // Copy the rows.
+    vector<float> copied(width * height * channelCount);
+    copyImageRows(source.data(), sourceStride, copied.data(), width * channelCount * sizeof(float),
+        width * channelCount * sizeof(float), height);
+
+    // Convert to half, and back to float.
+    vector<uint16_t> halves(width * height * channelCount);
+    convertImageFloatToHalf(source.data(), sourceStride, halves.data(),
+        width * channelCount * sizeof(uint16_t), width, height, channelCount);
+    vector<float> floats(width * height * channelCount);
+    convertImageHalfToFloat(halves.data(), width * channelCount * sizeof(uint16_t), floats.data(),
+        width * channelCount * sizeof(float), width, height, channelCount);
+
+    // Convert to 8-bit.
+    vector<uint8_t> bytes(width * height * channelCount);
+    convertImageFloatToUNorm8(source.data(), sourceStride, bytes.data(), width * channelCount,
+        width, height, channelCount);
+
+    for (size_t y = 0; y < height; y++)
+    {
+        for (size_t i = 0; i < width * channelCount; i++)
+        {
+            float expected = source[y * paddedWidth * channelCount + i];
+            size_t index   = y * width * channelCount + i;
+            ASSERT_EQ(copied[index], expected);
+            ASSERT_NEAR(floats[index], expected, expected * 0.001f);
+            ASSERT_EQ(bytes[index], static_cast<uint8_t>(min(expected, 1.0f) * 255.0f + 0.5f));
+        }
+    }
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,269 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DISABLE_UNIT_TESTS
+
+#include <Aurora/Foundation/Profiler.h>
+#include <Aurora/Foundation/Timer.h>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include "TestHelpers.h"
+
+using namespace std;
+using namespace Aurora::Foundation;
+
+namespace
+{
+
+class ProfilerTest : public ::testing::Test
+{
+public:
+    ProfilerTest() {}
+    ~ProfilerTest() {}
+
+    // Finds the statistics for the named zone, or nullptr if there are none.
+    const Profiler::ZoneStatistics* findZone(
+        const Profiler::Statistics& stats, const string& name)
+    {
+        for (auto& zone : stats)
+        {
+            if (zone.name == name)
+            {
+                return &zone;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+// Spins for at least the specified number of nanoseconds.
+void spin(uint64_t nanoseconds)
+{
+    CPUTimer timer;
+    while (timer.elapsedNanoseconds() < nanoseconds)
+    {
+    }
+}
+
+// Test that the CPU timer reports fractional milliseconds.
+TEST_F(ProfilerTest, TestTimerResolution)
+{
+    CPUTimer timer;
+    spin(250000);
+    float elapsed = timer.elapsed();
+
+    // A quarter of a millisecond must not be truncated to zero.
+    ASSERT_GT(elapsed, 0.0f);
+    ASSERT_GE(timer.elapsedNanoseconds(), 250000u);
+
+    // Time spent suspended is not included.
+    timer.suspend();
+    float suspended = timer.elapsed();
+    spin(100000);
+    ASSERT_EQ(timer.elapsed(), suspended);
+}
+
+// Test that nothing is recorded while profiling is disabled.
+TEST_F(ProfilerTest, TestDisabled)
+{
+    Profiler profiler;
+    ASSERT_FALSE(profiler.isEnabled());
+    {
+        AU_PROFILE_TO(profiler, "Disabled");
+    }
+    ASSERT_TRUE(profiler.statistics().empty());
+    ASSERT_TRUE(profiler.events().empty());
+}
+
+// Test the statistics and hierarchy of nested zones.
+TEST_F(ProfilerTest, TestNestedZones)
+{
+    Profiler profiler;
+    profiler.setEnabled(true);
+    for (int i = 0; i < 3; i++)
+    {
+        AU_PROFILE_TO(profiler, "Outer");
+        spin(50000);
+        {
+            AU_PROFILE_TO(profiler, "Inner");
+            spin(100000);
+        }
+    }
+
+    // Each zone must be recorded three times, with the inner time excluded from the outer self
+    // time.
+    Profiler::Statistics stats = profiler.statistics();
+    ASSERT_EQ(stats.size(), 2u);
+    const Profiler::ZoneStatistics* pOuter = findZone(stats, "Outer");
+    const Profiler::ZoneStatistics* pInner = findZone(stats, "Inner");
+    ASSERT_NE(pOuter, nullptr);
+    ASSERT_NE(pInner, nullptr);
+    ASSERT_EQ(pOuter->count, 3u);
+    ASSERT_EQ(pInner->count, 3u);
+    ASSERT_GE(pInner->minTime, 0.1);
+    ASSERT_LE(pInner->minTime, pInner->maxTime);
+    ASSERT_GE(pOuter->totalTime, pInner->totalTime);
+    ASSERT_NEAR(pOuter->selfTime, pOuter->totalTime - pInner->totalTime, 1.0e-6);
+    ASSERT_DOUBLE_EQ(pInner->selfTime, pInner->totalTime);
+
+    // The statistics are sorted by decreasing total time.
+    ASSERT_EQ(stats[0].name, "Outer");
+
+    // The events are sorted by start time, with each inner zone contained in its outer zone.
+    vector<Profiler::Event> events = profiler.events();
+    ASSERT_EQ(events.size(), 6u);
+    for (size_t i = 0; i < events.size(); i += 2)
+    {
+        const Profiler::Event& outer = events[i];
+        const Profiler::Event& inner = events[i + 1];
+        ASSERT_STREQ(outer.name, "Outer");
+        ASSERT_STREQ(inner.name, "Inner");
+        ASSERT_EQ(outer.depth, 0u);
+        ASSERT_EQ(inner.depth, 1u);
+        ASSERT_GE(inner.start, outer.start);
+        ASSERT_LE(inner.start + inner.duration, outer.start + outer.duration);
+    }
+
+    // Resetting discards everything.
+    profiler.reset();
+    ASSERT_TRUE(profiler.statistics().empty());
+    ASSERT_TRUE(profiler.events().empty());
+}
+
+// Test that zones from multiple threads are recorded separately and merged in the statistics.
+TEST_F(ProfilerTest, TestThreads)
+{
+    Profiler profiler;
+    profiler.setEnabled(true);
+    const int kThreadCount = 4;
+    const int kZoneCount   = 100;
+    atomic<int> startedCount(0);
+    vector<thread> threads;
+    for (int i = 0; i < kThreadCount; i++)
+    {
+        threads.emplace_back([&profiler, &startedCount]() {
+            // Wait until all the threads have recorded a zone, so that they all run at once.
+            {
+                AU_PROFILE_TO(profiler, "Worker");
+            }
+            startedCount++;
+            while (startedCount < kThreadCount)
+            {
+                this_thread::yield();
+            }
+            for (int j = 1; j < kZoneCount; j++)
+            {
+                AU_PROFILE_TO(profiler, "Worker");
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    Profiler::Statistics stats = profiler.statistics();
+    ASSERT_EQ(stats.size(), 1u);
+    ASSERT_EQ(stats[0].count, static_cast<uint64_t>(kThreadCount * kZoneCount));
+
+    // Each thread's events have a distinct thread index.
+    vector<Profiler::Event> events = profiler.events();
+    ASSERT_EQ(events.size(), static_cast<size_t>(kThreadCount * kZoneCount));
+    ASSERT_NE(events.front().thread, events.back().thread);
+}
+
+// Test that the storage of a thread that has exited is reused by a new thread, keeping its events.
+TEST_F(ProfilerTest, TestThreadReuse)
+{
+    Profiler profiler;
+    profiler.setEnabled(true);
+    for (int i = 0; i < 8; i++)
+    {
+        thread worker([&profiler]() { AU_PROFILE_TO(profiler, "Worker"); });
+        worker.join();
+    }
+
+    // Each thread ran after the previous one exited, so they all have the same thread index.
+    vector<Profiler::Event> events = profiler.events();
+    ASSERT_EQ(events.size(), 8u);
+    set<uint32_t> threadIndices;
+    for (auto& event : events)
+    {
+        threadIndices.insert(event.thread);
+    }
+    ASSERT_EQ(threadIndices.size(), 1u);
+}
+
+// Test that zones which are open when the profiler is reset are discarded.
+TEST_F(ProfilerTest, TestResetOpenZone)
+{
+    Profiler profiler;
+    profiler.setEnabled(true);
+    {
+        AU_PROFILE_TO(profiler, "Outer");
+        spin(1000);
+        profiler.reset();
+        spin(1000);
+        {
+            AU_PROFILE_TO(profiler, "Inner");
+        }
+    }
+
+    // Only the zone started after the reset is recorded, with its actual depth.
+    vector<Profiler::Event> events = profiler.events();
+    ASSERT_EQ(events.size(), 1u);
+    ASSERT_STREQ(events[0].name, "Inner");
+    ASSERT_EQ(events[0].depth, 1u);
+}
+
+// Test that the stored events are bounded, while the statistics remain complete.
+TEST_F(ProfilerTest, TestEventLimit)
+{
+    Profiler profiler(10);
+    profiler.setEnabled(true);
+    for (int i = 0; i < 25; i++)
+    {
+        AU_PROFILE_TO(profiler, "Limited");
+    }
+    ASSERT_EQ(profiler.events().size(), 10u);
+    ASSERT_EQ(profiler.droppedEventCount(), 15u);
+    ASSERT_EQ(profiler.statistics()[0].count, 25u);
+}
+
+// Test the Chrome trace output.
+TEST_F(ProfilerTest, TestChromeTrace)
+{
+    Profiler profiler;
+    profiler.setEnabled(true);
+    {
+        AU_PROFILE_TO(profiler, "Quote\"Zone");
+    }
+
+    stringstream stream;
+    profiler.writeChromeTrace(stream);
+    string trace = stream.str();
+    ASSERT_NE(trace.find("\"traceEvents\":["), string::npos);
+    ASSERT_NE(trace.find("\"name\":\"Quote\\\"Zone\""), string::npos);
+    ASSERT_NE(trace.find("\"ph\":\"X\""), string::npos);
+    ASSERT_NE(trace.find("\"dur\":"), string::npos);
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,194 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DISABLE_UNIT_TESTS
+
+#include <Aurora/Foundation/TextureCompression.h>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include "TestHelpers.h"
+
+using namespace std;
+using namespace Aurora::Foundation;
+
+namespace
+{
+
+class TextureCompressionTest : public ::testing::Test
+{
+public:
+    TextureCompressionTest() {}
+    ~TextureCompressionTest() {}
+
+    // Creates an RGBA test image with smooth gradients in each channel, plus a small amount of
+    // noise, similar to a typical photographic texture.
+    static vector<uint8_t> createImage(uint32_t width, uint32_t height, bool hasAlpha)
+    {
+        mt19937 random;
+        uniform_int_distribution<int> noise(-6, 6);
+        vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+        for (uint32_t y = 0; y < height; y++)
+        {
+            for (uint32_t x = 0; x < width; x++)
+            {
+                uint8_t* pPixel = &pixels[(static_cast<size_t>(y) * width + x) * 4];
+                float u         = static_cast<float>(x) / width;
+                float v         = static_cast<float>(y) / height;
+                float values[4] = { 200.0f * u + 30.0f, 120.0f + 100.0f * sin(6.0f * v),
+                    255.0f * u * v, hasAlpha ? 255.0f * (1.0f - v) : 255.0f };
+                for (int c = 0; c < 4; c++)
+                {
+                    int value = static_cast<int>(values[c]) + (c < 3 ? noise(random) : 0);
+                    pPixel[c] = static_cast<uint8_t>(std::clamp(value, 0, 255));
+                }
+            }
+        }
+
+        return pixels;
+    }
+
+    // Computes the peak signal-to-noise ratio (in dB) between two images, for the specified range
+    // of channels.
+    static double psnr(const vector<uint8_t>& image, const vector<uint8_t>& reference,
+        int firstChannel, int channelCount)
+    {
+        double sumSquaredError = 0.0;
+        size_t count           = 0;
+        for (size_t i = 0; i < image.size(); i += 4)
+        {
+            for (int c = firstChannel; c < firstChannel + channelCount; c++)
+            {
+                double error = static_cast<double>(image[i + c]) - reference[i + c];
+                sumSquaredError += error * error;
+                count++;
+            }
+        }
+        if (sumSquaredError == 0.0)
+        {
+            return 100.0;
+        }
+
+        return 10.0 * log10(255.0 * 255.0 / (sumSquaredError / count));
+    }
+
+    // Compresses and decompresses an image, returning the decompressed image.
+    static vector<uint8_t> roundTrip(const vector<uint8_t>& pixels, uint32_t width,
+        uint32_t height, BlockFormat format, CompressionQuality quality, uint32_t threadCount = 0)
+    {
+        vector<uint8_t> compressed(compressedImageSize(format, width, height));
+        compressImage(
+            pixels.data(), width, height, format, quality, compressed.data(), threadCount);
+        vector<uint8_t> decompressed(pixels.size());
+        decompressImage(compressed.data(), width, height, format, decompressed.data());
+
+        return decompressed;
+    }
+};
+
+// Test the compressed sizes, which are 4 bits per pixel for BC1 and BC4, and 8 bits per pixel for
+// BC5 and BC7, with partial blocks rounded up.
+TEST_F(TextureCompressionTest, TestSizes)
+{
+    ASSERT_EQ(compressedBlockSize(BlockFormat::BC1), 8u);
+    ASSERT_EQ(compressedBlockSize(BlockFormat::BC4), 8u);
+    ASSERT_EQ(compressedBlockSize(BlockFormat::BC5), 16u);
+    ASSERT_EQ(compressedBlockSize(BlockFormat::BC7), 16u);
+    ASSERT_EQ(compressedImageSize(BlockFormat::BC1, 256, 128), 256u * 128u / 2u);
+    ASSERT_EQ(compressedImageSize(BlockFormat::BC7, 256, 128), 256u * 128u);
+    ASSERT_EQ(compressedRowPitch(BlockFormat::BC1, 10), 24u);
+    ASSERT_EQ(compressedImageSize(BlockFormat::BC5, 10, 5), 3u * 2u * 16u);
+}
+
+// Test that each format reproduces the image with a low error, that the high quality preset has a
+// lower error than the fast preset, and that single color blocks have little or no error.
+TEST_F(TextureCompressionTest, TestQuality)
+{
+    const uint32_t width   = 64;
+    const uint32_t height  = 48;
+    vector<uint8_t> pixels = createImage(width, height, true);
+
+    struct FormatInfo
+    {
+        BlockFormat format;
+        int firstChannel;
+        int channelCount;
+        double minPSNR;
+    };
+    const FormatInfo formats[] = { { BlockFormat::BC1, 0, 3, 32.0 },
+        { BlockFormat::BC4, 0, 1, 38.0 }, { BlockFormat::BC5, 0, 2, 38.0 },
+        { BlockFormat::BC7, 0, 4, 35.0 } };
+    for (const FormatInfo& info : formats)
+    {
+        double fastPSNR = psnr(roundTrip(pixels, width, height, info.format,
+                                   CompressionQuality::Fast),
+            pixels, info.firstChannel, info.channelCount);
+        double highPSNR = psnr(roundTrip(pixels, width, height, info.format,
+                                   CompressionQuality::High),
+            pixels, info.firstChannel, info.channelCount);
+        int formatIndex = static_cast<int>(info.format);
+        ASSERT_GT(fastPSNR, info.minPSNR) << "Format " << formatIndex;
+        ASSERT_GE(highPSNR, fastPSNR) << "Format " << formatIndex;
+    }
+
+    // A single color is encoded almost exactly by BC5 and BC7 (which has 7-bit endpoints and a
+    // shared p-bit), and to the nearest 5:6:5 color by BC1.
+    vector<uint8_t> solid(static_cast<size_t>(width) * height * 4);
+    for (size_t i = 0; i < solid.size(); i += 4)
+    {
+        solid[i]     = 200;
+        solid[i + 1] = 100;
+        solid[i + 2] = 50;
+        solid[i + 3] = 128;
+    }
+    vector<uint8_t> solidBC7 =
+        roundTrip(solid, width, height, BlockFormat::BC7, CompressionQuality::Fast);
+    ASSERT_GE(psnr(solidBC7, solid, 0, 4), 48.0);
+    vector<uint8_t> solidBC5 =
+        roundTrip(solid, width, height, BlockFormat::BC5, CompressionQuality::Fast);
+    ASSERT_EQ(psnr(solidBC5, solid, 0, 2), 100.0);
+    vector<uint8_t> solidBC1 =
+        roundTrip(solid, width, height, BlockFormat::BC1, CompressionQuality::Fast);
+    ASSERT_GE(psnr(solidBC1, solid, 0, 3), 40.0);
+}
+
+// Test that BC7 preserves alpha, that the result is the same for any number of threads, and that
+// images with partial blocks at the edges are supported.
+TEST_F(TextureCompressionTest, TestAlphaThreadsAndEdges)
+{
+    const uint32_t width   = 37;
+    const uint32_t height  = 21;
+    vector<uint8_t> pixels = createImage(width, height, true);
+
+    vector<uint8_t> singleThread =
+        roundTrip(pixels, width, height, BlockFormat::BC7, CompressionQuality::High, 1);
+    vector<uint8_t> multipleThreads =
+        roundTrip(pixels, width, height, BlockFormat::BC7, CompressionQuality::High, 4);
+    ASSERT_EQ(singleThread, multipleThreads);
+    ASSERT_GT(psnr(singleThread, pixels, 3, 1), 38.0);
+
+    // BC1 is always opaque.
+    vector<uint8_t> bc1 =
+        roundTrip(pixels, width, height, BlockFormat::BC1, CompressionQuality::Fast);
+    for (size_t i = 3; i < bc1.size(); i += 4)
+    {
+        ASSERT_EQ(bc1[i], 255);
+    }
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,109 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DISABLE_UNIT_TESTS
+
+#include <Aurora/Foundation/ToneMapping.h>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "TestHelpers.h"
+
+using namespace std;
+using namespace Aurora::Foundation;
+
+namespace
+{
+
+class ToneMappingTest : public ::testing::Test
+{
+public:
+    ToneMappingTest() {}
+    ~ToneMappingTest() {}
+};
+
+// Test known values of the scalar inverse curve.
+TEST_F(ToneMappingTest, TestCanonInverseScalar)
+{
+    // Zero maps to the bottom of the log range, and one to the top, scaled to middle gray.
+    ASSERT_NEAR(canonInverse(0.0f, 0.0f), 0.18f * pow(10.0f, -2.152529302f), 1e-7f);
+    ASSERT_NEAR(canonInverse(1.0f, 0.0f), 0.18f * pow(10.0f, 1.163792198f), 1e-4f);
+
+    // Each stop of exposure halves the result.
+    ASSERT_NEAR(canonInverse(0.5f, 1.0f), canonInverse(0.5f, 0.0f) * 0.5f, 1e-6f);
+
+    // The result increases with the input.
+    float previous = canonInverse(0.0f, 0.0f);
+    for (int i = 1; i <= 100; i++)
+    {
+        float value = canonInverse(static_cast<float>(i) / 100.0f, 0.0f);
+        ASSERT_GE(value, previous);
+        previous = value;
+    }
+}
+
+// Test that the float image conversion is within the error bound of the scalar reference, for
+// every input in a dense sweep across and beyond the curve, with several exposures.
+TEST_F(ToneMappingTest, TestCanonInverseFloatErrorBound)
+{
+    // Use an odd row length, so that the values that do not fill a SIMD register are also tested.
+    const size_t width = 1023, height = 1025;
+    vector<float> source(width * height);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        source[i] = -0.25f + 1.5f * static_cast<float>(i) / static_cast<float>(source.size());
+    }
+
+    for (float exposure : { 0.0f, 1.5f, -2.0f })
+    {
+        vector<float> result(source.size());
+        canonInverseImage(source.data(), result.data(), width, height, 1, exposure);
+        float maxError = 0.0f;
+        for (size_t i = 0; i < source.size(); i++)
+        {
+            float expected = canonInverse(source[i], exposure);
+            maxError       = max(maxError, abs(result[i] - expected) / expected);
+        }
+        ASSERT_LT(maxError, 1e-6f) << "Exposure " << exposure;
+    }
+
+    // Converting in place, with a single thread, gives the same result.
+    vector<float> result(source.size());
+    canonInverseImage(source.data(), result.data(), width, height, 1, 0.0f);
+    canonInverseImage(source.data(), source.data(), width, height, 1, 0.0f, 1);
+    ASSERT_EQ(source, result);
+}
+
+// Test that the 8-bit image conversion matches the scalar reference exactly.
+TEST_F(ToneMappingTest, TestCanonInverseUNorm8)
+{
+    const size_t width = 256, height = 7, channelCount = 3;
+    vector<uint8_t> source(width * height * channelCount);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        source[i] = static_cast<uint8_t>(i * 7 % 256);
+    }
+
+    vector<float> result(source.size());
+    canonInverseImage(source.data(), result.data(), width, height, channelCount, 0.5f);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        ASSERT_EQ(result[i], canonInverse(static_cast<float>(source[i]) / 255.0f, 0.5f));
+    }
+}
+
+} // namespace
+
+#endif
@@ -17,6 +17,8 @@
 #include <Aurora/Foundation/Utilities.h>
 #include <gtest/gtest.h>
 
+#include <mutex>
+
 #include "TestHelpers.h"
 
 using namespace std;
@@ -62,6 +64,47 @@ TEST_F(UtilitiesTest, TestUtilities)
     ASSERT_NE(modulePath.size(), 0);
 }
 
+// Test that running a function on ranges in parallel covers every index exactly once.
+TEST_F(UtilitiesTest, TestParallelForRanges)
+{
+    for (size_t count : { 0, 1, 7, 100, 1000 })
+    {
+        vector<int> visits(count, 0);
+        size_t rangeCount = 0;
+        std::mutex mutex;
+        parallelForRanges(
+            count, 4,
+            [&](size_t begin, size_t end) {
+                std::lock_guard<std::mutex> lock(mutex);
+                rangeCount++;
+                for (size_t i = begin; i < end; i++)
+                {
+                    visits[i]++;
+                }
+            },
+            16);
+        ASSERT_EQ(std::count(visits.begin(), visits.end(), 1), static_cast<ptrdiff_t>(count));
+
+        // Small inputs are not split into ranges smaller than the minimum size.
+        ASSERT_LE(rangeCount, std::max<size_t>(count / 16, 1));
+    }
+}
+
+// Test that calling a function for each index in parallel calls it exactly once for each index.
+TEST_F(UtilitiesTest, TestParallelFor)
+{
+    for (size_t count : { 0, 1, 3, 1000 })
+    {
+        vector<int> visits(count, 0);
+        std::mutex mutex;
+        parallelFor(count, 0, [&](size_t index) {
+            std::lock_guard<std::mutex> lock(mutex);
+            visits[index]++;
+        });
+        ASSERT_EQ(std::count(visits.begin(), visits.end(), 1), static_cast<ptrdiff_t>(count));
+    }
+}
+
 } // namespace
 
 #endif
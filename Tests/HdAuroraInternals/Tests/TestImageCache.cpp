@@ -0,0 +1,147 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DISABLE_UNIT_TESTS
+#include <gtest/gtest.h>
+
+// Aurora headers.
+#include <Aurora/Aurora.h>
+
+// Internal HdAurora headers.
+using namespace std;
+#include "HdAuroraImageCache.h"
+
+namespace
+{
+
+// Adds a synthetic image with the specified size and one reference to a policy.
+void addImage(HdAuroraImageLRUPolicy& policy, const Aurora::Path& path, size_t sizeBytes)
+{
+    policy.addImage(path);
+    policy.addReference(path);
+    policy.setImageSize(path, sizeBytes);
+}
+
+// Test that the total size follows the images that are added and evicted.
+TEST(ImageCacheTest, TestSizes)
+{
+    HdAuroraImageLRUPolicy policy;
+    addImage(policy, "a", 100);
+    addImage(policy, "b", 200);
+    ASSERT_EQ(policy.totalSize(), 300);
+
+    // Adding an image again does not change it, and resizing an image replaces its size.
+    policy.addImage("a");
+    ASSERT_EQ(policy.referenceCount("a"), 1);
+    policy.setImageSize("b", 50);
+    ASSERT_EQ(policy.totalSize(), 150);
+
+    // Nothing is evicted without a budget, even if the images are not referenced.
+    policy.removeReference("a");
+    policy.removeReference("b");
+    ASSERT_TRUE(policy.evict().empty());
+    ASSERT_EQ(policy.totalSize(), 150);
+}
+
+// Test that only unreferenced images are evicted, in least recently used order, and that evicted
+// images are kept until they are removed or restored.
+TEST(ImageCacheTest, TestEviction)
+{
+    HdAuroraImageLRUPolicy policy;
+    policy.setBudget(250);
+    addImage(policy, "a", 100);
+    addImage(policy, "b", 100);
+    addImage(policy, "c", 100);
+    addImage(policy, "d", 100);
+
+    // All the images are referenced, so none can be evicted even though the budget is exceeded.
+    ASSERT_TRUE(policy.evict().empty());
+    ASSERT_EQ(policy.totalSize(), 400);
+
+    // Release the images in the order b, a, c. Then use a again, making it the most recently used.
+    policy.removeReference("b");
+    policy.removeReference("a");
+    policy.removeReference("c");
+    policy.addReference("a");
+    policy.removeReference("a");
+
+    // The least recently used unreferenced images are evicted until the budget is met: b then c.
+    // They are still counted until they are removed.
+    vector<Aurora::Path> evicted = policy.evict();
+    ASSERT_EQ(evicted.size(), 2);
+    ASSERT_EQ(evicted[0], "b");
+    ASSERT_EQ(evicted[1], "c");
+    ASSERT_TRUE(policy.isEvicted("b"));
+    ASSERT_TRUE(policy.isEvicted("c"));
+    ASSERT_EQ(policy.totalSize(), 400);
+    policy.remove("b");
+    policy.remove("c");
+    ASSERT_EQ(policy.totalSize(), 200);
+    ASSERT_FALSE(policy.contains("b"));
+    ASSERT_FALSE(policy.contains("c"));
+    ASSERT_TRUE(policy.contains("a"));
+    ASSERT_TRUE(policy.contains("d"));
+
+    // Within budget, so nothing more is evicted.
+    ASSERT_TRUE(policy.evict().empty());
+
+    // Lowering the budget evicts the remaining unreferenced image, but not the referenced one.
+    policy.setBudget(50);
+    evicted = policy.evict();
+    ASSERT_EQ(evicted.size(), 1);
+    ASSERT_EQ(evicted[0], "a");
+
+    // An image that is evicted is not evicted again, until it is restored, e.g. if it could not be
+    // released.
+    ASSERT_TRUE(policy.evict().empty());
+    policy.restore("a");
+    ASSERT_FALSE(policy.isEvicted("a"));
+    ASSERT_EQ(policy.totalSize(), 200);
+    evicted = policy.evict();
+    ASSERT_EQ(evicted.size(), 1);
+    ASSERT_EQ(evicted[0], "a");
+
+    // Only evicted images can be removed.
+    policy.remove("d");
+    policy.remove("a");
+    ASSERT_EQ(policy.totalSize(), 100);
+    ASSERT_EQ(policy.referenceCount("d"), 1);
+}
+
+// Test that images with multiple references are only evicted when all are released.
+TEST(ImageCacheTest, TestReferenceCounts)
+{
+    HdAuroraImageLRUPolicy policy;
+    policy.setBudget(1);
+    addImage(policy, "a", 100);
+    policy.addReference("a");
+    ASSERT_EQ(policy.referenceCount("a"), 2);
+
+    policy.removeReference("a");
+    ASSERT_TRUE(policy.evict().empty());
+
+    policy.removeReference("a");
+    ASSERT_EQ(policy.referenceCount("a"), 0);
+    ASSERT_EQ(policy.evict().size(), 1);
+    policy.remove("a");
+    ASSERT_EQ(policy.totalSize(), 0);
+
+    // References to evicted or unknown images are ignored.
+    policy.addReference("a");
+    ASSERT_EQ(policy.referenceCount("a"), 0);
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,124 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DISABLE_UNIT_TESTS
+#include <gtest/gtest.h>
+
+// Aurora headers.
+#include <Aurora/Aurora.h>
+
+// Internal HdAurora headers.
+using namespace std;
+#include "HdAuroraSyncScheduler.h"
+
+namespace
+{
+
+// A mock scene, which records the updates applied to it, and a mock clock, which advances by the
+// cost of each update.
+struct MockScene
+{
+    vector<string> applied;
+    float time = 0.0f;
+
+    // Creates an update that adds an instance with the specified cost in milliseconds.
+    HdAuroraSyncScheduler::Update addInstance(const string& path, float costMs = 1.0f)
+    {
+        return [this, path, costMs]() {
+            applied.push_back(path);
+            time += costMs;
+        };
+    }
+
+    HdAuroraSyncScheduler::ClockFunction clock()
+    {
+        return [this]() { return time; };
+    }
+};
+
+// Test that updates are run in the order they were scheduled, within the budget for each frame.
+TEST(SyncSchedulerTest, TestBudget)
+{
+    MockScene scene;
+    HdAuroraSyncScheduler scheduler(scene.clock());
+    scheduler.setBudget(2.5f);
+    for (int i = 0; i < 7; i++)
+    {
+        scheduler.schedule("mesh" + to_string(i), scene.addInstance("mesh" + to_string(i)));
+    }
+    ASSERT_EQ(scheduler.pendingCount(), 7);
+    ASSERT_TRUE(scene.applied.empty());
+
+    // Each frame runs updates until the budget is used, i.e. three updates of one millisecond.
+    ASSERT_EQ(scheduler.execute(), 3);
+    ASSERT_EQ(scene.applied, vector<string>({ "mesh0", "mesh1", "mesh2" }));
+    ASSERT_EQ(scheduler.pendingCount(), 4);
+    ASSERT_EQ(scheduler.execute(), 3);
+    ASSERT_EQ(scheduler.execute(), 1);
+    ASSERT_EQ(scene.applied.back(), "mesh6");
+    ASSERT_EQ(scheduler.pendingCount(), 0);
+
+    // Nothing is run when there are no pending updates.
+    ASSERT_EQ(scheduler.execute(), 0);
+
+    // An update that exceeds the budget is still run, so that progress is always made.
+    scheduler.schedule("large", scene.addInstance("large", 10.0f));
+    scheduler.schedule("small", scene.addInstance("small"));
+    ASSERT_EQ(scheduler.execute(), 1);
+    ASSERT_EQ(scene.applied.back(), "large");
+    ASSERT_EQ(scheduler.execute(), 1);
+
+    // Without a budget, all the pending updates are run.
+    scheduler.setBudget(0.0f);
+    for (int i = 0; i < 5; i++)
+    {
+        scheduler.schedule("mesh" + to_string(i), scene.addInstance("mesh" + to_string(i), 5.0f));
+    }
+    ASSERT_EQ(scheduler.execute(), 5);
+    ASSERT_EQ(scheduler.pendingCount(), 0);
+}
+
+// Test that each key has at most one pending update, and that updates can be cancelled.
+TEST(SyncSchedulerTest, TestReplaceAndCancel)
+{
+    MockScene scene;
+    HdAuroraSyncScheduler scheduler(scene.clock());
+    scheduler.schedule("a", scene.addInstance("a1"));
+    scheduler.schedule("b", scene.addInstance("b1"));
+    scheduler.schedule("c", scene.addInstance("c1"));
+
+    // Scheduling a key again replaces its update, which keeps its place in the order.
+    scheduler.schedule("a", scene.addInstance("a2"));
+    ASSERT_EQ(scheduler.pendingCount(), 3);
+    ASSERT_TRUE(scheduler.isPending("a"));
+
+    // A cancelled update is never run, e.g. when a prim is destroyed before it is added.
+    scheduler.cancel("b");
+    scheduler.cancel("unknown");
+    ASSERT_FALSE(scheduler.isPending("b"));
+    ASSERT_EQ(scheduler.execute(), 2);
+    ASSERT_EQ(scene.applied, vector<string>({ "a2", "c1" }));
+
+    // A key can be scheduled again once its update has run, and an update can schedule another.
+    scheduler.schedule("a", [&]() {
+        scene.applied.push_back("a3");
+        scheduler.schedule("d", scene.addInstance("d1"));
+    });
+    ASSERT_EQ(scheduler.execute(), 2);
+    ASSERT_EQ(scene.applied, vector<string>({ "a2", "c1", "a3", "d1" }));
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,77 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "HostShaders.h"
+
+#include "TestHelpers.h"
+
+#include <filesystem>
+
+namespace TestHelpers
+{
+
+// Reads the contents of a text file, returning an empty string if it can't be read.
+static std::string readTextFile(const std::filesystem::path& path)
+{
+    std::ifstream stream(path);
+    std::stringstream contents;
+    contents << stream.rdbuf();
+
+    return contents.str();
+}
+
+HostShaders::HostShaders()
+{
+    // Read the shared shader files, in the same form as the minified shader directory used by the
+    // renderers, i.e. a map of file name to contents.
+    std::filesystem::path shaderFolder = kSourceRoot + "/Libraries/Aurora/Source/Shaders";
+    std::map<std::string, std::string> fileContents;
+    for (const auto& entry : std::filesystem::directory_iterator(shaderFolder))
+    {
+        if (entry.path().extension() == ".slang")
+        {
+            fileContents[entry.path().filename().string()] = readTextFile(entry.path());
+        }
+    }
+    std::map<std::string, const std::string&> fileText;
+    for (const auto& [name, contents] : fileContents)
+    {
+        fileText.insert({ name, contents });
+    }
+
+    // Compile the host shader code, which includes the shared shader files.
+    std::string code = readTextFile(kSourceRoot + "/Tests/Helpers/HostShaders.slang");
+    Aurora::Transpiler transpiler(fileText);
+    _pLibrary = transpiler.compileHostCallable(code, _errors);
+    if (!_pLibrary)
+        return;
+
+    // Look up the functions.
+    sampleHemisphere = _pLibrary->findFunction<SampleFunction>("hostSampleHemisphere");
+    sampleUniformDirection =
+        _pLibrary->findFunction<SampleFunction>("hostSampleUniformDirection");
+    random2D         = _pLibrary->findFunction<Random2DFunction>("hostRandom2D");
+    evaluateMaterial = _pLibrary->findFunction<EvaluateMaterialFunction>("hostEvaluateMaterial");
+    sampleMaterial   = _pLibrary->findFunction<SampleMaterialFunction>("hostSampleMaterial");
+    traceFurnacePaths =
+        _pLibrary->findFunction<TraceFurnacePathsFunction>("hostTraceFurnacePaths");
+    if (!sampleHemisphere || !sampleUniformDirection || !random2D || !evaluateMaterial ||
+        !sampleMaterial || !traceFurnacePaths)
+    {
+        _errors = "Host shader functions not found.";
+        _pLibrary.reset();
+    }
+}
+
+} // namespace TestHelpers
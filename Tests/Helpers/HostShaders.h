@@ -0,0 +1,79 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+// NOTE: This is only used by tests and benchmarks that are built with the internal Aurora sources,
+// so it uses the internal Aurora headers.
+#include "pch.h"
+
+#include "Transpiler.h"
+
+/// Convenience helper functions for internal use in unit tests
+namespace TestHelpers
+{
+
+// The material values passed to the host shader functions, which are applied to the default
+// material. The layout must match hostMaterial() in HostShaders.slang.
+struct HostMaterial
+{
+    float base              = 1.0f;
+    float baseColor[3]      = { 1.0f, 1.0f, 1.0f };
+    float metalness         = 0.0f;
+    float specular          = 1.0f;
+    float specularRoughness = 0.2f;
+    float specularIOR       = 1.5f;
+    float coat              = 0.0f;
+    float sheen             = 0.0f;
+    float transmission      = 0.0f;
+
+    float* data() { return &base; }
+};
+
+// The shared path tracing shader code (sampling, random numbers, and the Standard Surface BSDF),
+// compiled to native code for the host CPU. See HostShaders.slang for descriptions of the
+// functions, which write their results to the pResult array.
+class HostShaders
+{
+public:
+    // The types of the host shader functions.
+    using SampleFunction   = void(float random0, float random1, float* pResult);
+    using Random2DFunction = void(uint32_t samplerType, uint32_t sampleIndex, uint32_t x,
+        uint32_t y, uint32_t count, float* pResult);
+    using EvaluateMaterialFunction = void(
+        float* pMaterial, float* pV, float* pL, float random0, float random1, float* pResult);
+    using SampleMaterialFunction =
+        void(float* pMaterial, float* pV, float random0, float random1, float* pResult);
+    using TraceFurnacePathsFunction = void(float* pMaterial, float emission, int maxTraceDepth,
+        int russianRouletteDepth, uint32_t seed, uint32_t pathCount, float* pResult);
+
+    // Compiles the shaders, from the shader source folder. If compilation fails (e.g. if there is
+    // no C++ compiler available), isValid() returns false and errors() describes the failure.
+    HostShaders();
+
+    bool isValid() const { return _pLibrary != nullptr; }
+    const std::string& errors() const { return _errors; }
+
+    SampleFunction* sampleHemisphere             = nullptr;
+    SampleFunction* sampleUniformDirection       = nullptr;
+    Random2DFunction* random2D                   = nullptr;
+    EvaluateMaterialFunction* evaluateMaterial   = nullptr;
+    SampleMaterialFunction* sampleMaterial       = nullptr;
+    TraceFurnacePathsFunction* traceFurnacePaths = nullptr;
+
+private:
+    std::shared_ptr<Aurora::HostShaderLibrary> _pLibrary;
+    std::string _errors;
+};
+
+} // namespace TestHelpers
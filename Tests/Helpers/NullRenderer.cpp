@@ -0,0 +1,113 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "NullRenderer.h"
+
+using namespace Aurora;
+
+namespace TestHelpers
+{
+
+IInstancePtr NullScene::addInstancePointer(const Path& /* path*/, const IGeometryPtr& pGeometry,
+    const IMaterialPtr& pMaterial, const mat4& transform, const LayerDefinitions& /* layers*/)
+{
+    return make_shared<NullInstance>(pGeometry, pMaterial, transform);
+}
+
+NullRenderer::NullRenderer() : RendererBase(1)
+{
+    _isValid = true;
+
+    // Create the definition for built-in materials, with the Standard Surface properties but no
+    // shader code, as no shaders are compiled.
+    _pDefaultMaterialDefinition = make_shared<MaterialDefinition>(MaterialShaderSource("Default"),
+        MaterialBase::StandardSurfaceDefaults, MaterialBase::updateBuiltInMaterial, false);
+}
+
+IImagePtr NullRenderer::createImagePointer(const IImage::InitData& initData)
+{
+    _createdCounts.images++;
+
+    return make_shared<NullImage>(initData);
+}
+
+ISamplerPtr NullRenderer::createSamplerPointer(const Properties& /* props*/)
+{
+    _createdCounts.samplers++;
+
+    return make_shared<NullSampler>();
+}
+
+IMaterialPtr NullRenderer::createMaterialPointer(
+    const string& materialType, const string& /* document*/, const string& name)
+{
+    // Only built-in materials are supported, as MaterialX documents would require code generation.
+    if (materialType.compare(Names::MaterialTypes::kBuiltIn) != 0)
+    {
+        AU_ERROR(
+            "Unrecognized material type %s for material %s", materialType.c_str(), name.c_str());
+        return nullptr;
+    }
+    _createdCounts.materials++;
+
+    return make_shared<MaterialBase>(name, nullptr, _pDefaultMaterialDefinition);
+}
+
+IEnvironmentPtr NullRenderer::createEnvironmentPointer()
+{
+    _createdCounts.environments++;
+
+    return make_shared<NullEnvironment>();
+}
+
+IGeometryPtr NullRenderer::createGeometryPointer(const GeometryDescriptor& desc, const string& name)
+{
+    _createdCounts.geometry++;
+
+    return make_shared<GeometryBase>(name, desc);
+}
+
+IScenePtr NullRenderer::createScene()
+{
+    return make_shared<NullScene>(this);
+}
+
+void NullRenderer::setScene(const IScenePtr& pScene)
+{
+    // Assign the new scene, and create its default resources as the other renderers do.
+    _pScene = dynamic_pointer_cast<SceneBase>(pScene);
+    if (_pScene)
+    {
+        _pScene->createDefaultResources();
+    }
+}
+
+void NullRenderer::render(uint32_t /* sampleStart*/, uint32_t /* sampleCount*/)
+{
+    // Update the scene, which is all the CPU work performed by rendering.
+    if (_pScene)
+    {
+        _pScene->preUpdate();
+        _pScene->update();
+    }
+}
+
+const vector<string>& NullRenderer::builtInMaterials()
+{
+    static const vector<string> sBuiltins = { "Default" };
+
+    return sBuiltins;
+}
+
+} // namespace TestHelpers
@@ -0,0 +1,171 @@
+// Copyright 2025 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+// NOTE: This is only used by tests and benchmarks that are built with the internal Aurora sources,
+// so it uses the internal Aurora headers.
+#include "pch.h"
+
+#include "EnvironmentBase.h"
+#include "GeometryBase.h"
+#include "ImageBase.h"
+#include "MaterialBase.h"
+#include "RendererBase.h"
+#include "Resources.h"
+#include "SceneBase.h"
+
+/// Convenience helper functions for internal use in unit tests
+namespace TestHelpers
+{
+
+// A CPU-only image, which only records its description.
+class NullImage : public Aurora::ImageBase
+{
+public:
+    NullImage(const Aurora::IImage::InitData& initData) :
+        format(initData.format), width(initData.width), height(initData.height)
+    {
+    }
+
+    Aurora::ImageFormat format;
+    uint32_t width;
+    uint32_t height;
+};
+
+// A CPU-only sampler.
+class NullSampler : public Aurora::ISampler
+{
+};
+
+// A CPU-only environment, with the same properties as the GPU implementations.
+class NullEnvironment : public Aurora::EnvironmentBase
+{
+};
+
+// A CPU-only instance, which records the values set on it.
+class NullInstance : public Aurora::IInstance
+{
+public:
+    NullInstance(const Aurora::IGeometryPtr& pGeometry, const Aurora::IMaterialPtr& pMaterial,
+        const glm::mat4& transform) :
+        pGeometry(pGeometry), pMaterial(pMaterial), transform(transform)
+    {
+    }
+
+    void setMaterial(const Aurora::IMaterialPtr& pNewMaterial) override
+    {
+        pMaterial = pNewMaterial;
+    }
+    void setTransform(const glm::mat4& newTransform) override { transform = newTransform; }
+    void setObjectIdentifier(int objectId) override { objectIdentifier = objectId; }
+    void setVisible(bool visible) override { isVisible = visible; }
+    Aurora::IGeometryPtr geometry() const override { return pGeometry; }
+
+    Aurora::IGeometryPtr pGeometry;
+    Aurora::IMaterialPtr pMaterial;
+    glm::mat4 transform;
+    int objectIdentifier = 0;
+    bool isVisible       = true;
+};
+
+// A CPU-only scene, which exercises the resource system of SceneBase without any GPU resources.
+class NullScene : public Aurora::SceneBase
+{
+public:
+    NullScene(Aurora::IRenderer* pRenderer) : SceneBase(pRenderer) {}
+
+    void setGroundPlanePointer(const Aurora::IGroundPlanePtr&) override {}
+    Aurora::IInstancePtr addInstancePointer(const Aurora::Path& path,
+        const Aurora::IGeometryPtr& pGeometry, const Aurora::IMaterialPtr& pMaterial,
+        const glm::mat4& transform, const Aurora::LayerDefinitions& materialLayers) override;
+    Aurora::ILightPtr addLightPointer(const std::string&) override { return nullptr; }
+
+    // Gets the trackers of the scene, so tests can inspect the active resources.
+    Aurora::TypedResourceTracker<Aurora::InstanceResource, Aurora::IInstance>& instances()
+    {
+        return _instances;
+    }
+    Aurora::TypedResourceTracker<Aurora::GeometryResource, Aurora::IGeometry>& geometry()
+    {
+        return _geometry;
+    }
+    Aurora::TypedResourceTracker<Aurora::MaterialResource, Aurora::IMaterial>& materials()
+    {
+        return _materials;
+    }
+    Aurora::TypedResourceTracker<Aurora::ImageResource, Aurora::IImage>& images()
+    {
+        return _images;
+    }
+};
+
+// A CPU-only renderer, which creates CPU-only implementations of all the renderer objects. This
+// allows the scene and resource machinery to be tested and benchmarked without a GPU.
+class NullRenderer : public Aurora::RendererBase
+{
+public:
+    NullRenderer();
+
+    /*** IRenderer Functions ***/
+
+    Aurora::IWindowPtr createWindow(Aurora::WindowHandle, uint32_t, uint32_t) override
+    {
+        return nullptr;
+    }
+    Aurora::IRenderBufferPtr createRenderBuffer(int, int, Aurora::ImageFormat) override
+    {
+        return nullptr;
+    }
+    Aurora::IImagePtr createImagePointer(const Aurora::IImage::InitData& initData) override;
+    Aurora::ISamplerPtr createSamplerPointer(const Aurora::Properties& props) override;
+    Aurora::IMaterialPtr createMaterialPointer(const std::string& materialType,
+        const std::string& document, const std::string& name) override;
+    Aurora::IEnvironmentPtr createEnvironmentPointer() override;
+    Aurora::IGeometryPtr createGeometryPointer(
+        const Aurora::GeometryDescriptor& desc, const std::string& name) override;
+    Aurora::IGroundPlanePtr createGroundPlanePointer() override { return nullptr; }
+    Aurora::IScenePtr createScene() override;
+    void setScene(const Aurora::IScenePtr& pScene) override;
+    Backend backend() const override { return Backend::Default; }
+    void setTargets(const Aurora::TargetAssignments&) override {}
+    void render(uint32_t sampleStart, uint32_t sampleCount) override;
+    void waitForTask() override {}
+    const std::vector<std::string>& builtInMaterials() override;
+    void setLoadResourceFunction(Aurora::LoadResourceFunction func) override
+    {
+        _pAssetMgr->setLoadResourceFunction(func);
+    }
+
+    // Gets the current scene, if any.
+    std::shared_ptr<NullScene> scene() { return std::dynamic_pointer_cast<NullScene>(_pScene); }
+
+    // The number of objects created by the renderer, by type.
+    struct CreatedCounts
+    {
+        size_t images       = 0;
+        size_t samplers     = 0;
+        size_t materials    = 0;
+        size_t environments = 0;
+        size_t geometry     = 0;
+    };
+
+    // Gets the number of objects created by the renderer, by type.
+    const CreatedCounts& createdCounts() const { return _createdCounts; }
+
+private:
+    Aurora::MaterialDefinitionPtr _pDefaultMaterialDefinition;
+    CreatedCounts _createdCounts;
+};
+
+} // namespace TestHelpers